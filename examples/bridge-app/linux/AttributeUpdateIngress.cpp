@@ -0,0 +1,126 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "AttributeUpdateIngress.h"
+
+#include <app/reporting/reporting.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/PlatformManager.h>
+
+using namespace chip;
+using namespace chip::app;
+
+bool AttributeUpdateIngress::IsIdle()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return !mBatchScheduled && mPending.empty();
+}
+
+AttributeUpdateIngress::Stats AttributeUpdateIngress::GetStats()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mStats;
+}
+
+CHIP_ERROR AttributeUpdateIngress::Enqueue(const ConcreteAttributePath & path, std::optional<Value> value)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    mStats.mPostedCount++;
+
+    auto pending = mPending.try_emplace(path, std::move(value));
+    if (!pending.second)
+    {
+        mStats.mCoalescedCount++;
+
+        // A change without a value only asks for the attribute to be reported, which the pending update already does
+        if (value.has_value())
+        {
+            pending.first->second = std::move(value);
+        }
+    }
+
+    return mBatchScheduled ? CHIP_NO_ERROR : ScheduleBatch();
+}
+
+CHIP_ERROR AttributeUpdateIngress::ScheduleBatch()
+{
+    // The update stays pending on failure, and the next update posted tries again
+    CHIP_ERROR err  = DeviceLayer::PlatformMgr().ScheduleWork(ApplyBatch, reinterpret_cast<intptr_t>(this));
+    mBatchScheduled = (err == CHIP_NO_ERROR);
+    return err;
+}
+
+void AttributeUpdateIngress::ApplyBatch(intptr_t context)
+{
+    reinterpret_cast<AttributeUpdateIngress *>(context)->ApplyBatch();
+}
+
+void AttributeUpdateIngress::ApplyBatch()
+{
+    UpdateSet batch;
+    uint64_t appliedCount = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        batch.swap(mPending);
+    }
+
+    for (const auto & update : batch)
+    {
+        if (update.second.has_value() && mApplyFunction)
+        {
+            mApplyFunction(update.first, update.second.value());
+            appliedCount++;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+
+        // Changes of the attributes of the batch posted while it was applied, including those posted by the apply function
+        // when storing values in the device model, are covered by the reports below.
+        for (const auto & update : batch)
+        {
+            auto pending = mPending.find(update.first);
+            if (pending != mPending.end() && !pending->second.has_value())
+            {
+                mPending.erase(pending);
+            }
+        }
+
+        mStats.mAppliedCount += appliedCount;
+        mStats.mReportedCount += batch.size();
+        mStats.mBatchCount++;
+
+        mBatchScheduled = false;
+        if (!mPending.empty())
+        {
+            CHIP_ERROR err = ScheduleBatch();
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(AppServer, "Failed to schedule attribute updates: %" CHIP_ERROR_FORMAT, err.Format());
+            }
+        }
+    }
+
+    for (const auto & update : batch)
+    {
+        MatterReportingAttributeChangeCallback(update.first);
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPError.h>
+
+#include <stdint.h>
+
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+
+/**
+ * Ingress for attribute updates made by bridged device threads.
+ *
+ * Device threads post updates from any thread without taking the CHIP stack lock. Updates are kept in a
+ * pending set keyed by attribute path, where a later update of a path replaces the value of an earlier one
+ * still pending, and are applied in a batch on the CHIP thread: the apply function stores the value of each
+ * update in the bridge's device model, then every updated attribute is marked dirty for reporting.
+ *
+ * Only the first update posted after a batch was taken schedules work on the CHIP thread, so that a burst of
+ * updates costs a single event, whatever the number of threads posting them.
+ */
+class AttributeUpdateIngress
+{
+public:
+    using Value         = std::variant<bool, int64_t, std::string>;
+    using ApplyFunction = std::function<void(const chip::app::ConcreteAttributePath &, const Value &)>;
+
+    struct Stats
+    {
+        uint64_t mPostedCount    = 0; ///< Updates posted
+        uint64_t mCoalescedCount = 0; ///< Updates merged into an update of the same path still pending
+        uint64_t mAppliedCount   = 0; ///< Values given to the apply function
+        uint64_t mReportedCount  = 0; ///< Attributes marked dirty
+        uint64_t mBatchCount     = 0; ///< Batches applied on the CHIP thread
+    };
+
+    void SetApplyFunction(ApplyFunction applyFunction) { mApplyFunction = applyFunction; }
+
+    /**
+     * Post an update of the given attribute, to be applied with the given value on the CHIP thread.
+     *
+     * May be called from any thread.
+     */
+    CHIP_ERROR Post(const chip::app::ConcreteAttributePath & path, Value value) { return Enqueue(path, std::move(value)); }
+
+    /**
+     * Post a change of the given attribute, whose value was already stored in the device model, to be marked
+     * dirty on the CHIP thread.
+     *
+     * May be called from any thread.
+     */
+    CHIP_ERROR Post(const chip::app::ConcreteAttributePath & path) { return Enqueue(path, std::nullopt); }
+
+    /// Whether every update posted so far has been applied
+    bool IsIdle();
+
+    Stats GetStats();
+
+private:
+    struct PathHash
+    {
+        size_t operator()(const chip::app::ConcreteAttributePath & path) const
+        {
+            return std::hash<uint64_t>()((static_cast<uint64_t>(path.mEndpointId) << 48) ^
+                                         (static_cast<uint64_t>(path.mClusterId) << 16) ^ path.mAttributeId);
+        }
+    };
+
+    using UpdateSet = std::unordered_map<chip::app::ConcreteAttributePath, std::optional<Value>, PathHash>;
+
+    CHIP_ERROR Enqueue(const chip::app::ConcreteAttributePath & path, std::optional<Value> value);
+    CHIP_ERROR ScheduleBatch();
+    static void ApplyBatch(intptr_t context);
+    void ApplyBatch();
+
+    ApplyFunction mApplyFunction;
+
+    std::mutex mLock;
+    UpdateSet mPending;
+    // Whether a batch is scheduled or being applied, in which case posting an update does not schedule another
+    bool mBatchScheduled = false;
+    Stats mStats;
+};
@@ -38,18 +38,22 @@
 #include <platform/CommissionableDataProvider.h>
 #include <setup_payload/QRCodeSetupPayloadGenerator.h>
 #include <setup_payload/SetupPayload.h>
+#include <system/SystemClock.h>
 
 #include <pthread.h>
 #include <sys/ioctl.h>
 
+#include "AttributeUpdateIngress.h"
 #include "CommissionableInit.h"
 #include "Device.h"
 #include "main.h"
 #include <app/server/Server.h>
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace chip;
@@ -74,6 +78,9 @@ Device * gDevices[CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT + 1];
 std::vector<Room *> gRooms;
 std::vector<Action *> gActions;
 
+// Attribute updates made by device threads, applied and reported in batches on the CHIP thread
+AttributeUpdateIngress gAttributeUpdates;
+
 const int16_t minMeasuredValue     = -27315;
 const int16_t maxMeasuredValue     = 32766;
 const int16_t initialMeasuredValue = 100;
@@ -372,17 +379,47 @@ std::vector<Action *> GetActionListInfo(chip::EndpointId parentId)
 }
 
 namespace {
-void CallReportingCallback(intptr_t closure)
+void ScheduleReportingCallback(Device * dev, ClusterId cluster, AttributeId attribute)
 {
-    auto path = reinterpret_cast<app::ConcreteAttributePath *>(closure);
-    MatterReportingAttributeChangeCallback(*path);
-    Platform::Delete(path);
+    // Changes are coalesced and reported in batches, rather than scheduling work for each of them
+    gAttributeUpdates.Post(app::ConcreteAttributePath(dev->GetEndpointId(), cluster, attribute));
 }
 
-void ScheduleReportingCallback(Device * dev, ClusterId cluster, AttributeId attribute)
+void ApplyAttributeUpdate(const app::ConcreteAttributePath & path, const AttributeUpdateIngress::Value & value)
 {
-    auto * path = Platform::New<app::ConcreteAttributePath>(dev->GetEndpointId(), cluster, attribute);
-    PlatformMgr().ScheduleWork(CallReportingCallback, reinterpret_cast<intptr_t>(path));
+    uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(path.mEndpointId);
+    VerifyOrReturn((endpointIndex < CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT) && (gDevices[endpointIndex] != nullptr));
+
+    Device * dev                    = gDevices[endpointIndex];
+    const bool * boolValue          = std::get_if<bool>(&value);
+    const int64_t * intValue        = std::get_if<int64_t>(&value);
+    const std::string * stringValue = std::get_if<std::string>(&value);
+
+    if (path.mClusterId == BridgedDeviceBasicInformation::Id &&
+        path.mAttributeId == BridgedDeviceBasicInformation::Attributes::Reachable::Id && boolValue != nullptr)
+    {
+        dev->SetReachable(*boolValue);
+    }
+    else if (path.mClusterId == BridgedDeviceBasicInformation::Id &&
+             path.mAttributeId == BridgedDeviceBasicInformation::Attributes::NodeLabel::Id && stringValue != nullptr)
+    {
+        dev->SetName(stringValue->c_str());
+    }
+    else if (path.mClusterId == OnOff::Id && path.mAttributeId == OnOff::Attributes::OnOff::Id && boolValue != nullptr)
+    {
+        static_cast<DeviceOnOff *>(dev)->SetOnOff(*boolValue);
+    }
+    else if (path.mClusterId == TemperatureMeasurement::Id &&
+             path.mAttributeId == TemperatureMeasurement::Attributes::MeasuredValue::Id && intValue != nullptr)
+    {
+        auto * sensor = static_cast<DeviceTempSensor *>(dev);
+        sensor->SetMeasuredValue(static_cast<int16_t>(std::clamp<int64_t>(*intValue, sensor->mMin, sensor->mMax)));
+    }
+    else
+    {
+        ChipLogError(DeviceLayer, "Unsupported update of attribute " ChipLogFormatMEI " of cluster " ChipLogFormatMEI,
+                     ChipLogValueMEI(path.mAttributeId), ChipLogValueMEI(path.mClusterId));
+    }
 }
 } // anonymous namespace
 
@@ -774,6 +811,106 @@ const EmberAfDeviceType gBridgedTempSensorDeviceTypes[] = { { DEVICE_TYPE_TEMP_S
 #define POLL_INTERVAL_MS (100)
 uint8_t poll_prescale = 0;
 
+constexpr unsigned kBenchmarkThreadCount      = 4;
+constexpr unsigned kBenchmarkUpdatesPerThread = 2500;
+
+DeviceTempSensor * const gBenchmarkSensors[] = { &TempSensor1, &TempSensor2, &ComposedTempSensor1, &ComposedTempSensor2 };
+
+// Runs the given update from several device threads, and returns the time taken until all the updates are reported
+template <typename UpdateFunc>
+System::Clock::Milliseconds64 RunAttributeUpdateThreads(UpdateFunc update)
+{
+    std::vector<std::thread> threads;
+
+    const System::Clock::Milliseconds64 start = System::SystemClock().GetMonotonicMilliseconds64();
+
+    for (unsigned thread = 0; thread < kBenchmarkThreadCount; thread++)
+    {
+        threads.emplace_back([thread, &update]() {
+            for (unsigned i = 0; i < kBenchmarkUpdatesPerThread; i++)
+            {
+                DeviceTempSensor * sensor = gBenchmarkSensors[(thread + i) % ArraySize(gBenchmarkSensors)];
+                update(sensor, static_cast<int16_t>(initialMeasuredValue + (i % 1000) * 10));
+            }
+        });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    while (!gAttributeUpdates.IsIdle())
+    {
+        usleep(1000);
+    }
+
+    return System::SystemClock().GetMonotonicMilliseconds64() - start;
+}
+
+// Compares updating temperature measurements under the stack lock, one by one, with posting them to the ingress
+void RunAttributeUpdateBenchmark()
+{
+    // The measurements are restored after the run: TC-BR-4 checks them
+    int16_t measuredValues[ArraySize(gBenchmarkSensors)];
+
+    // The baseline reports each change directly, under the stack lock, instead of posting it to the ingress
+    PlatformMgr().LockChipStack();
+    for (size_t i = 0; i < ArraySize(gBenchmarkSensors); i++)
+    {
+        measuredValues[i] = gBenchmarkSensors[i]->GetMeasuredValue();
+    }
+    for (DeviceTempSensor * sensor : gBenchmarkSensors)
+    {
+        sensor->SetChangeCallback([](DeviceTempSensor * dev, DeviceTempSensor::Changed_t itemChangedMask) {
+            if (itemChangedMask & DeviceTempSensor::kChanged_MeasurementValue)
+            {
+                MatterReportingAttributeChangeCallback(dev->GetEndpointId(), TemperatureMeasurement::Id,
+                                                       TemperatureMeasurement::Attributes::MeasuredValue::Id);
+            }
+        });
+    }
+    PlatformMgr().UnlockChipStack();
+
+    const System::Clock::Milliseconds64 lockedTime = RunAttributeUpdateThreads([](DeviceTempSensor * sensor, int16_t value) {
+        PlatformMgr().LockChipStack();
+        sensor->SetMeasuredValue(value);
+        PlatformMgr().UnlockChipStack();
+    });
+
+    PlatformMgr().LockChipStack();
+    for (DeviceTempSensor * sensor : gBenchmarkSensors)
+    {
+        sensor->SetChangeCallback(&HandleDeviceTempSensorStatusChanged);
+    }
+    PlatformMgr().UnlockChipStack();
+
+    const AttributeUpdateIngress::Stats before = gAttributeUpdates.GetStats();
+
+    const System::Clock::Milliseconds64 ingressTime = RunAttributeUpdateThreads([](DeviceTempSensor * sensor, int16_t value) {
+        gAttributeUpdates.Post(app::ConcreteAttributePath(sensor->GetEndpointId(), TemperatureMeasurement::Id,
+                                                          TemperatureMeasurement::Attributes::MeasuredValue::Id),
+                               static_cast<int64_t>(value));
+    });
+
+    const AttributeUpdateIngress::Stats after = gAttributeUpdates.GetStats();
+
+    PlatformMgr().LockChipStack();
+    for (size_t i = 0; i < ArraySize(gBenchmarkSensors); i++)
+    {
+        gBenchmarkSensors[i]->SetMeasuredValue(measuredValues[i]);
+    }
+    PlatformMgr().UnlockChipStack();
+
+    ChipLogProgress(DeviceLayer, "%u updates from %u threads: %u ms under the stack lock, %u ms through the ingress",
+                    kBenchmarkThreadCount * kBenchmarkUpdatesPerThread, kBenchmarkThreadCount,
+                    static_cast<unsigned>(lockedTime.count()), static_cast<unsigned>(ingressTime.count()));
+    ChipLogProgress(DeviceLayer, "Ingress: %u updates coalesced, %u applied in %u batches",
+                    static_cast<unsigned>(after.mCoalescedCount - before.mCoalescedCount),
+                    static_cast<unsigned>(after.mAppliedCount - before.mAppliedCount),
+                    static_cast<unsigned>(after.mBatchCount - before.mBatchCount));
+}
+
 bool kbhit()
 {
     int byteswaiting;
@@ -887,6 +1024,12 @@ void * bridge_polling_thread(void * context)
                 action3.setIsVisible(true);
             }
 
+            if (ch == 'p')
+            {
+                // Measure the throughput of attribute updates made by device threads
+                RunAttributeUpdateBenchmark();
+            }
+
             // Commands used for the Bridged Device Basic Information test plan
             if (ch == 'u')
             {
@@ -943,6 +1086,8 @@ void ApplicationInit()
     ComposedTempSensor2.SetChangeCallback(&HandleDeviceTempSensorStatusChanged);
     ComposedPowerSource.SetChangeCallback(&HandleDevicePowerSourceStatusChanged);
 
+    gAttributeUpdates.SetApplyFunction(&ApplyAttributeUpdate);
+
     // Set starting endpoint id where dynamic endpoints will be assigned, which
     // will be the next consecutive endpoint id after the last fixed endpoint.
     gFirstDynamicEndpointId = static_cast<chip::EndpointId>(
@@ -953,6 +1098,13 @@ void ApplicationInit()
     // supported clusters so that ZAP will generated the requisite code.
     emberAfEndpointEnableDisable(emberAfEndpointFromIndex(static_cast<uint16_t>(emberAfFixedEndpointCount() - 1)), false);
 
+    // Group the registration of the bridged devices, so that the PartsList of the aggregator and of the root endpoint are
+    // reported once rather than after each device.
+    {
+        DeviceLayer::StackLock lock;
+        emberAfBeginDynamicEndpointUpdate();
+    }
+
     // Add light 1 -> will be mapped to ZCL endpoints 3
     AddDeviceEndpoint(&Light1, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes),
                       Span<DataVersion>(gLight1DataVersions), 1);
@@ -983,6 +1135,11 @@ void ApplicationInit()
     AddDeviceEndpoint(&ActionLight4, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes),
                       Span<DataVersion>(gActionLight4DataVersions), 1);
 
+    {
+        DeviceLayer::StackLock lock;
+        emberAfEndDynamicEndpointUpdate();
+    }
+
     // Because the power source is on the same endpoint as the composed device, it needs to be explicitly added
     gDevices[CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT] = &ComposedPowerSource;
     // This provides power for the composed endpoint
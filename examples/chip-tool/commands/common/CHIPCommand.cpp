@@ -155,7 +155,8 @@ CHIP_ERROR CHIPCommand::MaybeSetUpStack()
         // Make sure different commissioners run on different ports.
         port = static_cast<uint16_t>(port + CurrentCommissionerId());
     }
-    factoryInitParams.listenPort = port;
+    factoryInitParams.listenPort        = port;
+    factoryInitParams.maxSecureSessions = mMaxSecureSessions.ValueOr(0);
     ReturnLogErrorOnFailure(DeviceControllerFactory::GetInstance().Init(factoryInitParams));
 
     auto systemState = chip::Controller::DeviceControllerFactory::GetInstance().GetSystemState();
@@ -102,6 +102,9 @@ public:
         AddArgument(
             "commissioner-vendor-id", 0, UINT16_MAX, &mCommissionerVendorId,
             "The vendor id to use for chip-tool. If not provided, chip::VendorId::TestVendor1 (65521, 0xFFF1) will be used.");
+        AddArgument("max-sessions", 1, UINT16_MAX, &mMaxSecureSessions,
+                    "Maximum number of concurrent secure sessions before older ones get evicted. Raise this to stay connected to "
+                    "large numbers of nodes. This only takes effect for the command that starts the stack.");
     }
 
     /////////// Command Interface /////////
@@ -227,6 +230,7 @@ private:
     chip::Optional<bool> mUseMaxSizedCerts;
     chip::Optional<bool> mOnlyAllowTrustedCdKeys;
     chip::Optional<char *> mDacRevocationSetPath;
+    chip::Optional<uint16_t> mMaxSecureSessions;
 
     // Cached trust store so commands other than the original startup command
     // can spin up commissioners as needed.
@@ -23,6 +23,8 @@
 #include <app-common/zap-generated/ids/Attributes.h>
 #include <app-common/zap-generated/ids/Clusters.h>
 #include <app/ConcreteAttributePath.h>
+#include <app/TimerDelegates.h>
+#include <app/WriteBehindAttributePersistenceProvider.h>
 #include <app/server/Server.h>
 #include <lib/support/logging/CHIPLogging.h>
 
@@ -45,6 +47,12 @@ namespace {
 constexpr char kChipEventFifoPathPrefix[] = "/tmp/chip_lighting_fifo_";
 NamedPipeCommands sChipNamedPipeCommands;
 LightingAppCommandDelegate sLightingAppCommandDelegate;
+
+// Level and color transitions update their attributes every few hundred milliseconds: keep the values of
+// NVM-backed attributes in RAM and write them behind in batches, to reduce the flash wear.
+DefaultTimerDelegate sAttributePersisterTimerDelegate;
+WriteBehindAttributePersistenceProvider sWriteBehindAttributePersister(Server::GetInstance().GetDefaultAttributePersister(),
+                                                                       sAttributePersisterTimerDelegate);
 } // namespace
 
 void MatterPostAttributeChangeCallback(const chip::app::ConcreteAttributePath & attributePath, uint8_t type, uint16_t size,
@@ -78,6 +86,8 @@ void emberAfOnOffClusterInitCallback(EndpointId endpoint)
 
 void ApplicationInit()
 {
+    SetAttributePersistenceProvider(&sWriteBehindAttributePersister);
+
     std::string path = kChipEventFifoPathPrefix + std::to_string(getpid());
 
     if (sChipNamedPipeCommands.Start(path, &sLightingAppCommandDelegate) != CHIP_NO_ERROR)
@@ -93,6 +103,15 @@ void ApplicationShutdown()
     {
         ChipLogError(NotSpecified, "Failed to stop CHIP NamedPipeCommands");
     }
+
+    // Persist the values still in RAM and stop the flush timer while the system layer is up, then write through while the
+    // server shuts down
+    CHIP_ERROR err = sWriteBehindAttributePersister.Shutdown();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(NotSpecified, "Failed to flush attribute values: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    SetAttributePersistenceProvider(&Server::GetInstance().GetDefaultAttributePersister());
 }
 
 extern "C" int main(int argc, char * argv[])
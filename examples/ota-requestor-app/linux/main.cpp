@@ -21,12 +21,19 @@
 #include <app/clusters/ota-requestor/DefaultOTARequestor.h>
 #include <app/clusters/ota-requestor/DefaultOTARequestorStorage.h>
 #include <app/clusters/ota-requestor/DefaultOTARequestorUserConsent.h>
+#include <app/clusters/ota-requestor/DeltaOTAImageProcessor.h>
 #include <app/clusters/ota-requestor/ExtendedOTARequestorDriver.h>
 #include <platform/Linux/OTAImageProcessorImpl.h>
 
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 using chip::BDXDownloader;
 using chip::ByteSpan;
 using chip::CharSpan;
+using chip::DeltaOTAImageProcessor;
 using chip::EndpointId;
 using chip::FabricIndex;
 using chip::GetRequestorInstance;
@@ -34,6 +41,7 @@ using chip::NodeId;
 using chip::OnDeviceConnected;
 using chip::OnDeviceConnectionFailure;
 using chip::OTADownloader;
+using chip::OTABaseImage;
 using chip::OTAImageProcessorImpl;
 using chip::PeerId;
 using chip::Server;
@@ -59,11 +67,25 @@ public:
     void SendNotifyUpdateApplied();
 };
 
+// The running executable, which delta images apply to
+class RunningImage : public OTABaseImage
+{
+public:
+    uint32_t GetSoftwareVersion() override;
+    uint64_t GetSize() override;
+    CHIP_ERROR Read(uint64_t offset, MutableByteSpan buffer) override;
+
+private:
+    int mFd = -1;
+};
+
 DefaultOTARequestor gRequestorCore;
 DefaultOTARequestorStorage gRequestorStorage;
 CustomOTARequestorDriver gRequestorUser;
 BDXDownloader gDownloader;
 OTAImageProcessorImpl gImageProcessor;
+DeltaOTAImageProcessor gDeltaImageProcessor;
+RunningImage gRunningImage;
 chip::ota::DefaultOTARequestorUserConsent gUserConsentProvider;
 static chip::ota::UserConsentState gUserConsentState = chip::ota::UserConsentState::kUnknown;
 
@@ -195,6 +217,38 @@ void CustomOTARequestorDriver::SendNotifyUpdateApplied()
     gRequestorCore.Reset();
 }
 
+uint32_t RunningImage::GetSoftwareVersion()
+{
+    uint32_t version = 0;
+    ConfigurationMgr().GetSoftwareVersion(version);
+    return version;
+}
+
+uint64_t RunningImage::GetSize()
+{
+    struct stat info;
+    return (stat("/proc/self/exe", &info) == 0) ? static_cast<uint64_t>(info.st_size) : 0;
+}
+
+CHIP_ERROR RunningImage::Read(uint64_t offset, MutableByteSpan buffer)
+{
+    if (mFd < 0)
+    {
+        mFd = open("/proc/self/exe", O_RDONLY | O_CLOEXEC);
+        VerifyOrReturnError(mFd >= 0, CHIP_ERROR_POSIX(errno));
+    }
+
+    size_t done = 0;
+    while (done < buffer.size())
+    {
+        ssize_t result = pread(mFd, buffer.data() + done, buffer.size() - done, static_cast<off_t>(offset + done));
+        VerifyOrReturnError(result > 0, (result < 0) ? CHIP_ERROR_POSIX(errno) : CHIP_ERROR_END_OF_INPUT);
+        done += static_cast<size_t>(result);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 static void InitOTARequestor(void)
 {
     // Set the global instance of the OTA requestor core component
@@ -209,13 +263,17 @@ static void InitOTARequestor(void)
 
     gRequestorStorage.Init(chip::Server::GetInstance().GetPersistentStorage());
     gRequestorCore.Init(chip::Server::GetInstance(), gRequestorStorage, gRequestorUser, gDownloader);
-    gRequestorUser.Init(&gRequestorCore, &gImageProcessor);
+    gRequestorUser.Init(&gRequestorCore, &gDeltaImageProcessor);
 
     gImageProcessor.SetOTAImageFile(gOtaDownloadPath);
-    gImageProcessor.SetOTADownloader(&gDownloader);
+    gImageProcessor.SetOTADownloader(gDeltaImageProcessor.GetImageProcessorDownloader());
+
+    // Rebuild the downloaded image from the running one if it is a delta image
+    gDeltaImageProcessor.Init(&gImageProcessor, &gRunningImage);
+    gDeltaImageProcessor.SetOTADownloader(&gDownloader);
 
     // Set the image processor instance used for handling image being downloaded
-    gDownloader.SetImageProcessorDelegate(&gImageProcessor);
+    gDownloader.SetImageProcessorDelegate(&gDeltaImageProcessor);
 
     if (gUserConsentState != chip::ota::UserConsentState::kUnknown)
     {
@@ -24,6 +24,7 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app/BufferedReadCallback.h>
 #include <app/InteractionModelEngine.h>
+#include <lib/core/TLVUtilities.h>
 #include <lib/support/ScopedBuffer.h>
 
 namespace chip {
@@ -65,7 +66,17 @@ CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aR
     //
     // To avoid that, a single contiguous buffer is the best likely approach for now.
     //
-    size_t totalBufSize = 0;
+    // A list received whole, in a single chunk, is already in such a buffer.
+    //
+    if (mBufferedList.empty() && mBufferedArray.Get() != nullptr)
+    {
+        const size_t arraySize = mBufferedArray.AllocatedSize();
+        aReader.Init(std::move(mBufferedArray), arraySize);
+        mBufferedArray.Free();
+        return CHIP_NO_ERROR;
+    }
+
+    size_t totalBufSize = mBufferedArray.AllocatedSize();
     for (const auto & packetBuffer : mBufferedList)
     {
         totalBufSize += packetBuffer->TotalLength();
@@ -82,6 +93,23 @@ CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aR
     TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
     ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType));
 
+    if (mBufferedArray.Get() != nullptr)
+    {
+        TLV::TLVReader reader;
+        TLV::TLVType arrayType;
+        CHIP_ERROR err;
+
+        reader.Init(mBufferedArray.Get(), mBufferedArray.AllocatedSize());
+        ReturnErrorOnFailure(reader.Next());
+        ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    }
+
     for (auto & bufHandle : mBufferedList)
     {
         System::PacketBufferTLVReader reader;
@@ -105,19 +133,15 @@ CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
 {
     System::PacketBufferTLVWriter writer;
     System::PacketBufferHandle handle;
+    size_t itemSize = 0;
 
     //
-    // We conservatively allocate a packet buffer as big as an IPv6 MTU (since we're buffering
-    // data received over the wire, which should always fit within that).
-    //
-    // We could have snapshotted the reader at its current position, advanced it past the current element
-    // and computed the delta in its read point to figure out the size of the element before allocating
-    // our target buffer. However, the reader's current position is already set past the control octet
-    // and the tag. Consequently, the computed size is always going to omit the sizes of these two parts of the
-    // TLV element. Since the tag can vary in size, for now, let's just do the safe thing. In the future, if this is a problem,
-    // we can improve this.
+    // Size the buffer to the item: items received over a session that allows large payloads
+    // may not fit an MTU-sized buffer, and most items are much smaller than one.
     //
-    handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    ReturnErrorOnFailure(TLV::Utilities::EncodedLength(reader, TLV::AnonymousTag(), itemSize));
+
+    handle = System::PacketBufferHandle::New(itemSize, 0);
     VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
 
     writer.Init(std::move(handle), false);
@@ -125,42 +149,39 @@ CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
     ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
     ReturnErrorOnFailure(writer.Finalize(&handle));
 
-    // Compact the buffer down to a more reasonably sized packet buffer
-    // if we can.
-    //
-    handle.RightSize();
-
     mBufferedList.push_back(std::move(handle));
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR BufferedReadCallback::BufferList(TLV::TLVReader & reader)
+{
+    TLV::TLVWriter writer;
+    size_t listSize = 0;
+
+    ReturnErrorOnFailure(TLV::Utilities::EncodedLength(reader, TLV::AnonymousTag(), listSize));
+
+    mBufferedArray.Calloc(listSize);
+    VerifyOrReturnError(mBufferedArray.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    writer.Init(mBufferedArray.Get(), listSize);
+    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+    return writer.Finalize();
+}
+
 CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData)
 {
 
     if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::ReplaceAll)
     {
-        TLV::TLVType outerContainer;
-
         VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
         mBufferedList.clear();
 
-        ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
-
-        CHIP_ERROR err;
-
-        while ((err = apData->Next()) == CHIP_NO_ERROR)
-        {
-            ReturnErrorOnFailure(BufferListItem(*apData));
-        }
-
-        if (err == CHIP_END_OF_TLV)
-        {
-            err = CHIP_NO_ERROR;
-        }
-
-        ReturnErrorOnFailure(err);
-        ReturnErrorOnFailure(apData->ExitContainer(outerContainer));
+        //
+        // Keep the list as a whole rather than item by item: with large chunks, lists usually arrive
+        // in a single one and can then be dispatched without being re-encoded.
+        //
+        ReturnErrorOnFailure(BufferList(*apData));
     }
     else if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem)
     {
@@ -223,6 +244,7 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     // Clear out our buffered contents to free up allocated buffers, and reset the buffered path.
     //
     mBufferedList.clear();
+    mBufferedArray.Free();
     mBufferedPath = ConcreteDataAttributePath();
     return CHIP_NO_ERROR;
 }
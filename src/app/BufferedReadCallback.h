@@ -24,6 +24,7 @@
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
 #include <app/ReadClient.h>
+#include <lib/support/ScopedBuffer.h>
 #include <vector>
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
@@ -74,6 +75,7 @@ private:
     void OnError(CHIP_ERROR aError) override
     {
         mBufferedList.clear();
+        mBufferedArray.Free();
         return mCallback.OnError(aError);
     }
 
@@ -128,7 +130,15 @@ private:
      *
      */
     CHIP_ERROR BufferListItem(TLV::TLVReader & reader);
+
+    /*
+     * Given a reader positioned at a list, copy the whole list into mBufferedArray. Items appended
+     * in later chunks are buffered separately, using BufferListItem.
+     *
+     */
+    CHIP_ERROR BufferList(TLV::TLVReader & reader);
     ConcreteDataAttributePath mBufferedPath;
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mBufferedArray;
     std::vector<System::PacketBufferHandle> mBufferedList;
     Callback & mCallback;
 };
@@ -0,0 +1,345 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/CASEConnectionScheduler.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+
+namespace {
+
+constexpr uint32_t kMilliTokensPerToken = 1000;
+
+} // namespace
+
+void CASEConnectionScheduler::Init(Delegate * delegate, const Config & config)
+{
+    mDelegate = delegate;
+    SetConfig(config);
+}
+
+void CASEConnectionScheduler::SetConfig(const Config & config)
+{
+    mConfig         = config;
+    mBucketsStarted = false;
+}
+
+CHIP_ERROR CASEConnectionScheduler::Enqueue(const ScopedNodeId & peerId, ConnectionPriority priority,
+                                            TransportPayloadCapability transportPayloadCapability,
+                                            Callback::Callback<OnDeviceConnected> * onConnection,
+                                            Callback::Callback<OnDeviceConnectionFailure> * onFailure,
+                                            Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                            ,
+                                            uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+)
+{
+    VerifyOrReturnError(IsEnabled(), CHIP_ERROR_INCORRECT_STATE);
+
+    Request * request = FindQueued(peerId, transportPayloadCapability);
+    if (request == nullptr)
+    {
+        request = mRequestPool.CreateObject(peerId, priority, transportPayloadCapability);
+        VerifyOrReturnError(request != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        mQueues[to_underlying(priority)].PushBack(request);
+        mQueuedCount++;
+    }
+    else if (to_underlying(priority) < to_underlying(request->priority))
+    {
+        // Promoted requests join the back of their new class
+        mQueues[to_underlying(request->priority)].Remove(request);
+        mQueues[to_underlying(priority)].PushBack(request);
+        request->priority = priority;
+    }
+
+    request->callbacks.Enqueue(onConnection, onFailure, onSetupFailure);
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    request->attemptCount = std::max(request->attemptCount, attemptCount);
+    request->retryCallbacks.Enqueue(onRetry);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+
+    ChipLogDetail(CASESessionManager, "Queued session setup for " ChipLogFormatScopedNodeId " (%u queued, %u in progress)",
+                  ChipLogValueScopedNodeId(peerId), static_cast<unsigned>(mQueuedCount), static_cast<unsigned>(mInProgressCount));
+    return CHIP_NO_ERROR;
+}
+
+Optional<System::Clock::Timeout> CASEConnectionScheduler::Process(System::Clock::Timestamp now)
+{
+    Optional<System::Clock::Timeout> retryAfter;
+    VerifyOrReturnValue(IsEnabled(), retryAfter);
+
+    if (!mBucketsStarted)
+    {
+        ResetBuckets();
+        for (auto & bucket : mBuckets)
+        {
+            bucket.lastRefill = now;
+        }
+        mBucketsStarted = true;
+    }
+
+    while (mInProgressCount < mConfig.window && mQueuedCount > 0)
+    {
+        Request * request = SelectNext(now, retryAfter);
+        VerifyOrReturnValue(request != nullptr, retryAfter);
+
+        mQueues[to_underlying(request->priority)].Remove(request);
+        mQueuedCount--;
+
+        // Everyone interested in this peer went away while the request was queued
+        if (request->callbacks.IsEmpty())
+        {
+            Release(request);
+            continue;
+        }
+
+        const size_t transport = to_underlying(TransportClassFor(request->transportPayloadCapability));
+        if (mConfig.buckets[transport].ratePerSecond > 0)
+        {
+            mBuckets[transport].milliTokens -= kMilliTokensPerToken;
+        }
+        mLastServedFabric[to_underlying(request->priority)] = request->peerId.GetFabricIndex();
+
+        mInProgress.PushBack(request);
+        mInProgressCount++;
+
+        // May call OnSessionSetupComplete (or Enqueue) re-entrantly
+        mDelegate->StartSessionSetup(*request);
+    }
+
+    retryAfter.ClearValue();
+    return retryAfter;
+}
+
+bool CASEConnectionScheduler::OnSessionSetupComplete(const ScopedNodeId & peerId)
+{
+    bool released = false;
+    for (auto it = mInProgress.begin(); it != mInProgress.end();)
+    {
+        Request & request = *it;
+        ++it;
+        if (request.peerId == peerId)
+        {
+            mInProgress.Remove(&request);
+            mInProgressCount--;
+            Release(&request);
+            released = true;
+        }
+    }
+    return released;
+}
+
+void CASEConnectionScheduler::CancelFabric(FabricIndex fabricIndex)
+{
+    IntrusiveList<Request> cancelled;
+    auto cancelMatching = [&](IntrusiveList<Request> & list, size_t & count) {
+        for (auto it = list.begin(); it != list.end();)
+        {
+            Request & request = *it;
+            ++it;
+            if (request.peerId.GetFabricIndex() == fabricIndex)
+            {
+                list.Remove(&request);
+                count--;
+                cancelled.PushBack(&request);
+            }
+        }
+    };
+
+    for (auto & queue : mQueues)
+    {
+        cancelMatching(queue, mQueuedCount);
+    }
+    cancelMatching(mInProgress, mInProgressCount);
+
+    ReleaseCancelled(cancelled);
+}
+
+void CASEConnectionScheduler::CancelAll()
+{
+    IntrusiveList<Request> cancelled;
+    auto cancelAll = [&](IntrusiveList<Request> & list) {
+        while (!list.Empty())
+        {
+            Request & request = *list.begin();
+            list.Remove(&request);
+            cancelled.PushBack(&request);
+        }
+    };
+
+    for (auto & queue : mQueues)
+    {
+        cancelAll(queue);
+    }
+    cancelAll(mInProgress);
+    mQueuedCount     = 0;
+    mInProgressCount = 0;
+
+    ReleaseCancelled(cancelled);
+}
+
+CASEConnectionScheduler::Request * CASEConnectionScheduler::FindQueued(const ScopedNodeId & peerId,
+                                                                       TransportPayloadCapability transportPayloadCapability)
+{
+    for (auto & queue : mQueues)
+    {
+        for (auto & request : queue)
+        {
+            if (request.peerId == peerId && request.transportPayloadCapability == transportPayloadCapability)
+            {
+                return &request;
+            }
+        }
+    }
+    return nullptr;
+}
+
+CASEConnectionScheduler::Request * CASEConnectionScheduler::SelectNext(System::Clock::Timestamp now,
+                                                                       Optional<System::Clock::Timeout> & retryAfter)
+{
+    bool available[kTransportClassCount];
+    bool blocked[kTransportClassCount] = {};
+    for (size_t i = 0; i < kTransportClassCount; i++)
+    {
+        Refill(mBuckets[i], mConfig.buckets[i], now);
+        available[i] = (mConfig.buckets[i].ratePerSecond == 0) || (mBuckets[i].milliTokens >= kMilliTokensPerToken);
+    }
+
+    for (size_t priority = 0; priority < kPriorityCount; priority++)
+    {
+        // Round-robin over fabrics: serve the lowest fabric index after the one served last,
+        // wrapping around, and the oldest request of that fabric.
+        const FabricIndex lastServed = mLastServedFabric[priority];
+        Request * nextFabric         = nullptr;
+        Request * firstFabric        = nullptr;
+
+        for (auto & request : mQueues[priority])
+        {
+            const size_t transport = to_underlying(TransportClassFor(request.transportPayloadCapability));
+            if (!available[transport])
+            {
+                blocked[transport] = true;
+                continue;
+            }
+
+            const FabricIndex fabric = request.peerId.GetFabricIndex();
+            if (fabric > lastServed && (nextFabric == nullptr || fabric < nextFabric->peerId.GetFabricIndex()))
+            {
+                nextFabric = &request;
+            }
+            if (firstFabric == nullptr || fabric < firstFabric->peerId.GetFabricIndex())
+            {
+                firstFabric = &request;
+            }
+        }
+
+        if (nextFabric != nullptr || firstFabric != nullptr)
+        {
+            return (nextFabric != nullptr) ? nextFabric : firstFabric;
+        }
+    }
+
+    // Nothing admissible: report when the first blocked transport gets a token back
+    retryAfter.ClearValue();
+    for (size_t i = 0; i < kTransportClassCount; i++)
+    {
+        if (!blocked[i])
+        {
+            continue;
+        }
+
+        const uint32_t missing = kMilliTokensPerToken - mBuckets[i].milliTokens;
+        const uint32_t rate    = mConfig.buckets[i].ratePerSecond;
+        const System::Clock::Timeout wait((missing + rate - 1) / rate);
+        if (!retryAfter.HasValue() || wait < retryAfter.Value())
+        {
+            retryAfter.SetValue(wait);
+        }
+    }
+    return nullptr;
+}
+
+void CASEConnectionScheduler::Refill(TokenBucket & bucket, const TokenBucketConfig & config, System::Clock::Timestamp now)
+{
+    VerifyOrReturn(config.ratePerSecond > 0 && now > bucket.lastRefill);
+
+    // ratePerSecond tokens per second is ratePerSecond milli-tokens per millisecond
+    const uint64_t capacity  = static_cast<uint64_t>(std::max<uint16_t>(config.burst, 1)) * kMilliTokensPerToken;
+    const uint64_t elapsedMs = std::chrono::duration_cast<System::Clock::Milliseconds64>(now - bucket.lastRefill).count();
+    const uint64_t refilled  = bucket.milliTokens + elapsedMs * config.ratePerSecond;
+
+    bucket.milliTokens = static_cast<uint32_t>(std::min(refilled, capacity));
+    bucket.lastRefill  = now;
+}
+
+void CASEConnectionScheduler::ResetBuckets()
+{
+    for (size_t i = 0; i < kTransportClassCount; i++)
+    {
+        mBuckets[i].milliTokens = static_cast<uint32_t>(std::max<uint16_t>(mConfig.buckets[i].burst, 1)) * kMilliTokensPerToken;
+    }
+}
+
+void CASEConnectionScheduler::Release(Request * request)
+{
+    mRequestPool.ReleaseObject(request);
+}
+
+void CASEConnectionScheduler::ReleaseCancelled(IntrusiveList<Request> & cancelled)
+{
+    // All cancelled requests are out of the queues before any callback runs, as callbacks
+    // may queue new requests.
+    while (!cancelled.Empty())
+    {
+        Request & request = *cancelled.begin();
+        cancelled.Remove(&request);
+
+        // In progress requests have no callbacks left: they were handed to the session setup
+        const ScopedNodeId peerId = request.peerId;
+        SuccessFailureCallbackList callbacks;
+        callbacks.EnqueueTakeAll(request.callbacks);
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+        request.retryCallbacks.Clear();
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+        Release(&request);
+
+        Callback::Callback<OnDeviceConnected> * onConnection;
+        Callback::Callback<OnDeviceConnectionFailure> * onFailure;
+        Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure;
+        while (callbacks.Take(onConnection, onFailure, onSetupFailure))
+        {
+            if (onFailure != nullptr)
+            {
+                onFailure->mCall(onFailure->mContext, peerId, CHIP_ERROR_CANCELLED);
+            }
+            if (onSetupFailure != nullptr)
+            {
+                OperationalSessionSetup::ConnectionFailureInfo failureInfo(peerId, CHIP_ERROR_CANCELLED,
+                                                                           SessionEstablishmentStage::kNotInKeyExchange);
+                onSetupFailure->mCall(onSetupFailure->mContext, failureInfo);
+            }
+        }
+    }
+}
+
+} // namespace chip
@@ -0,0 +1,216 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/OperationalSessionSetup.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/GroupedCallbackList.h>
+#include <lib/core/Optional.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/Pool.h>
+#include <system/SystemClock.h>
+#include <transport/raw/PeerAddress.h>
+
+namespace chip {
+
+/**
+ * Priority class of a session setup request. Queued requests of a higher
+ * class are always admitted before those of a lower class.
+ */
+enum class ConnectionPriority : uint8_t
+{
+    kHigh       = 0, // e.g. user initiated interactions
+    kNormal     = 1,
+    kBackground = 2, // e.g. bulk reconnection after a restart
+};
+
+/**
+ * Admission control for operational session setups.
+ *
+ * Starting address resolution and a CASE handshake for many peers at once
+ * (e.g. a controller reconnecting to all of its nodes after a restart)
+ * floods the network, which on constrained links such as Thread leads to
+ * MRP retransmission storms and failed handshakes. The scheduler queues
+ * session setup requests and admits them subject to:
+ *
+ *   - a concurrency window: the number of setups in progress at any time,
+ *   - a token bucket per transport, pacing the rate at which setups start,
+ *   - priority classes, served strictly in order,
+ *   - fair queuing: within a priority class, fabrics are served round-robin.
+ *
+ * Requests for a peer that is already queued with the same transport payload
+ * capability are merged with the queued request. The scheduler does not own a timer: Process() admits what it can
+ * and tells the caller when it should be called again.
+ */
+class CASEConnectionScheduler
+{
+public:
+    enum class TransportClass : uint8_t
+    {
+        kUdp = 0,
+        kTcp = 1,
+    };
+    static constexpr size_t kTransportClassCount = 2;
+    static constexpr size_t kPriorityCount       = 3;
+
+    struct TokenBucketConfig
+    {
+        uint16_t ratePerSecond = 0; // 0 disables rate limiting
+        uint16_t burst         = 1;
+    };
+
+    struct Config
+    {
+        uint16_t window                                 = CHIP_CONFIG_CASE_SESSION_SETUP_WINDOW; // 0 disables admission control
+        TokenBucketConfig buckets[kTransportClassCount] = {
+            { CHIP_CONFIG_CASE_SESSION_SETUP_UDP_RATE, CHIP_CONFIG_CASE_SESSION_SETUP_UDP_BURST },
+            { CHIP_CONFIG_CASE_SESSION_SETUP_TCP_RATE, CHIP_CONFIG_CASE_SESSION_SETUP_TCP_BURST },
+        };
+    };
+
+    using SuccessFailureCallbackList =
+        Callback::GroupedCallbackList<OnDeviceConnected, OnDeviceConnectionFailure, OperationalSessionSetup::OnSetupFailure>;
+
+    /// A queued (or admitted) session setup request for one peer.
+    struct Request : public IntrusiveListNodeBase<>
+    {
+        Request(const ScopedNodeId & aPeerId, ConnectionPriority aPriority, TransportPayloadCapability aCapability) :
+            peerId(aPeerId), priority(aPriority), transportPayloadCapability(aCapability)
+        {}
+
+        ScopedNodeId peerId;
+        ConnectionPriority priority;
+        TransportPayloadCapability transportPayloadCapability;
+        SuccessFailureCallbackList callbacks;
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+        uint8_t attemptCount = 1;
+        Callback::GroupedCallbackList<OnDeviceConnectionRetry> retryCallbacks;
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    };
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * Start the session setup for an admitted request. The delegate must take all
+         * callbacks out of the request, and must not use the request afterwards: it is
+         * released by OnSessionSetupComplete, which may be called from within this call.
+         */
+        virtual void StartSessionSetup(Request & request) = 0;
+    };
+
+    CASEConnectionScheduler() = default;
+    ~CASEConnectionScheduler() { CancelAll(); }
+
+    CASEConnectionScheduler(const CASEConnectionScheduler &)             = delete;
+    CASEConnectionScheduler & operator=(const CASEConnectionScheduler &) = delete;
+
+    void Init(Delegate * delegate, const Config & config);
+
+    /**
+     * Change the scheduling configuration. Queued and in progress requests are kept;
+     * the new limits apply from the next call to Process().
+     */
+    void SetConfig(const Config & config);
+    const Config & GetConfig() const { return mConfig; }
+
+    bool IsEnabled() const { return mDelegate != nullptr && mConfig.window > 0; }
+
+    /**
+     * Queue a session setup request for the given peer. If a request for the peer with the
+     * same transport payload capability is already queued the callbacks are added to it
+     * (and its priority raised if needed).
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the request could not be queued.
+     */
+    CHIP_ERROR Enqueue(const ScopedNodeId & peerId, ConnectionPriority priority,
+                       TransportPayloadCapability transportPayloadCapability, Callback::Callback<OnDeviceConnected> * onConnection,
+                       Callback::Callback<OnDeviceConnectionFailure> * onFailure,
+                       Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                       ,
+                       uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    );
+
+    /**
+     * Admit as many queued requests as the window and token buckets allow, starting
+     * them through the delegate.
+     *
+     * @return the time after which Process() should be called again if requests are
+     *         held back by a token bucket. No value is returned when nothing can be
+     *         admitted until a request is queued or a setup completes.
+     */
+    Optional<System::Clock::Timeout> Process(System::Clock::Timestamp now);
+
+    /**
+     * Release the window slots held by the in progress setups for the given peer. Requests
+     * for the peer admitted with different capabilities share a single session setup.
+     *
+     * @return true if a slot was released, in which case Process() should be called.
+     */
+    bool OnSessionSetupComplete(const ScopedNodeId & peerId);
+
+    /// Drop queued and in progress requests for a fabric. The failure callbacks of queued
+    /// requests are called with CHIP_ERROR_CANCELLED, as for a released session setup.
+    void CancelFabric(FabricIndex fabricIndex);
+
+    /// Drop all queued and in progress requests. The failure callbacks of queued requests
+    /// are called with CHIP_ERROR_CANCELLED, as for a released session setup.
+    void CancelAll();
+
+    size_t QueuedCount() const { return mQueuedCount; }
+    size_t InProgressCount() const { return mInProgressCount; }
+
+    static TransportClass TransportClassFor(TransportPayloadCapability capability)
+    {
+        return (capability == TransportPayloadCapability::kLargePayload) ? TransportClass::kTcp : TransportClass::kUdp;
+    }
+
+private:
+    struct TokenBucket
+    {
+        uint32_t milliTokens = 0;
+        System::Clock::Timestamp lastRefill;
+    };
+
+    Request * FindQueued(const ScopedNodeId & peerId, TransportPayloadCapability transportPayloadCapability);
+    Request * SelectNext(System::Clock::Timestamp now, Optional<System::Clock::Timeout> & retryAfter);
+    void Refill(TokenBucket & bucket, const TokenBucketConfig & config, System::Clock::Timestamp now);
+    void ResetBuckets();
+    void Release(Request * request);
+    void ReleaseCancelled(IntrusiveList<Request> & cancelled);
+
+    Delegate * mDelegate = nullptr;
+    Config mConfig;
+    TokenBucket mBuckets[kTransportClassCount];
+    bool mBucketsStarted = false;
+
+    IntrusiveList<Request> mQueues[kPriorityCount];
+    IntrusiveList<Request> mInProgress;
+    FabricIndex mLastServedFabric[kPriorityCount] = {};
+    size_t mQueuedCount                           = 0;
+    size_t mInProgressCount                       = 0;
+
+    ObjectPool<Request, CHIP_CONFIG_CASE_SESSION_SETUP_MAX_QUEUED> mRequestPool;
+};
+
+} // namespace chip
@@ -24,28 +24,42 @@ namespace chip {
 CHIP_ERROR CASESessionManager::Init(chip::System::Layer * systemLayer, const CASESessionManagerConfig & params)
 {
     ReturnErrorOnFailure(params.sessionInitParams.Validate());
-    mConfig = params;
+    mConfig      = params;
+    mSystemLayer = systemLayer;
+    mConnectionScheduler.Init(this, params.connectionScheduling);
     params.sessionInitParams.exchangeMgr->GetReliableMessageMgr()->RegisterSessionUpdateDelegate(this);
     return AddressResolve::Resolver::Instance().Init(systemLayer);
 }
 
 void CASESessionManager::Shutdown()
 {
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleConnectionSchedulerTimer, this);
+    }
+    mConnectionScheduler.CancelAll();
     AddressResolve::Resolver::Instance().Shutdown();
 }
 
+void CASESessionManager::SetConnectionSchedulingConfig(const CASEConnectionScheduler::Config & config)
+{
+    mConfig.connectionScheduling = config;
+    mConnectionScheduler.SetConfig(config);
+    ScheduleConnectionProcessing(System::Clock::kZero);
+}
+
 void CASESessionManager::FindOrEstablishSession(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
                                                 Callback::Callback<OnDeviceConnectionFailure> * onFailure,
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                                 uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
-                                                TransportPayloadCapability transportPayloadCapability)
+                                                TransportPayloadCapability transportPayloadCapability, ConnectionPriority priority)
 {
     FindOrEstablishSessionHelper(peerId, onConnection, onFailure, nullptr,
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                  attemptCount, onRetry,
 #endif
-                                 transportPayloadCapability);
+                                 transportPayloadCapability, priority);
 }
 
 void CASESessionManager::FindOrEstablishSession(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
@@ -53,13 +67,13 @@ void CASESessionManager::FindOrEstablishSession(const ScopedNodeId & peerId, Cal
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                                 uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
 #endif
-                                                TransportPayloadCapability transportPayloadCapability)
+                                                TransportPayloadCapability transportPayloadCapability, ConnectionPriority priority)
 {
     FindOrEstablishSessionHelper(peerId, onConnection, nullptr, onSetupFailure,
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                  attemptCount, onRetry,
 #endif
-                                 transportPayloadCapability);
+                                 transportPayloadCapability, priority);
 }
 
 void CASESessionManager::FindOrEstablishSession(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
@@ -67,13 +81,13 @@ void CASESessionManager::FindOrEstablishSession(const ScopedNodeId & peerId, Cal
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                                 uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
 #endif
-                                                TransportPayloadCapability transportPayloadCapability)
+                                                TransportPayloadCapability transportPayloadCapability, ConnectionPriority priority)
 {
     FindOrEstablishSessionHelper(peerId, onConnection, nullptr, nullptr,
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                  attemptCount, onRetry,
 #endif
-                                 transportPayloadCapability);
+                                 transportPayloadCapability, priority);
 }
 
 void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerId,
@@ -83,11 +97,50 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                                       uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
 #endif
-                                                      TransportPayloadCapability transportPayloadCapability)
+                                                      TransportPayloadCapability transportPayloadCapability,
+                                                      ConnectionPriority priority)
 {
     ChipLogDetail(CASESessionManager, "FindOrEstablishSession: PeerId = [%d:" ChipLogFormatX64 "]", peerId.GetFabricIndex(),
                   ChipLogValueX64(peerId.GetNodeId()));
 
+    // Requests that need a new session setup go through admission control. Requests served by an
+    // existing session, or joining a setup already in progress, add no load and start directly.
+    // Without a failure callback no connection is attempted, so there is nothing to schedule.
+    if (mConnectionScheduler.IsEnabled() && (onFailure != nullptr || onSetupFailure != nullptr) &&
+        FindExistingSessionSetup(peerId) == nullptr && !FindExistingSession(peerId, transportPayloadCapability).HasValue())
+    {
+        CHIP_ERROR err = mConnectionScheduler.Enqueue(peerId, priority, transportPayloadCapability, onConnection, onFailure,
+                                                      onSetupFailure
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                                      ,
+                                                      attemptCount, onRetry
+#endif
+        );
+        if (err != CHIP_NO_ERROR)
+        {
+            NotifySetupFailure(peerId, onFailure, onSetupFailure, err);
+            return;
+        }
+
+        ScheduleConnectionProcessing(System::Clock::kZero);
+        return;
+    }
+
+    ConnectSessionSetup(peerId, onConnection, onFailure, onSetupFailure,
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                        attemptCount, onRetry,
+#endif
+                        transportPayloadCapability);
+}
+
+void CASESessionManager::ConnectSessionSetup(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
+                                             Callback::Callback<OnDeviceConnectionFailure> * onFailure,
+                                             Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure,
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                             uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
+#endif
+                                             TransportPayloadCapability transportPayloadCapability)
+{
     bool forAddressUpdate             = false;
     OperationalSessionSetup * session = FindExistingSessionSetup(peerId, forAddressUpdate);
     if (session == nullptr)
@@ -97,17 +150,7 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
 
         if (session == nullptr)
         {
-            if (onFailure != nullptr)
-            {
-                onFailure->mCall(onFailure->mContext, peerId, CHIP_ERROR_NO_MEMORY);
-            }
-
-            if (onSetupFailure != nullptr)
-            {
-                OperationalSessionSetup::ConnectionFailureInfo failureInfo(peerId, CHIP_ERROR_NO_MEMORY,
-                                                                           SessionEstablishmentStage::kUnknown);
-                onSetupFailure->mCall(onSetupFailure->mContext, failureInfo);
-            }
+            NotifySetupFailure(peerId, onFailure, onSetupFailure, CHIP_ERROR_NO_MEMORY);
             return;
         }
     }
@@ -131,13 +174,101 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
     }
 }
 
+void CASESessionManager::NotifySetupFailure(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnectionFailure> * onFailure,
+                                            Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure,
+                                            CHIP_ERROR error)
+{
+    if (onFailure != nullptr)
+    {
+        onFailure->mCall(onFailure->mContext, peerId, error);
+    }
+
+    if (onSetupFailure != nullptr)
+    {
+        OperationalSessionSetup::ConnectionFailureInfo failureInfo(peerId, error, SessionEstablishmentStage::kUnknown);
+        onSetupFailure->mCall(onSetupFailure->mContext, failureInfo);
+    }
+}
+
+void CASESessionManager::StartSessionSetup(CASEConnectionScheduler::Request & request)
+{
+    // Take everything out of the request first: it is released as soon as the setup
+    // completes, which can happen synchronously below.
+    const ScopedNodeId peerId                                   = request.peerId;
+    const TransportPayloadCapability transportPayloadCapability = request.transportPayloadCapability;
+    CASEConnectionScheduler::SuccessFailureCallbackList callbacks;
+    callbacks.EnqueueTakeAll(request.callbacks);
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    const uint8_t attemptCount = request.attemptCount;
+    Callback::GroupedCallbackList<OnDeviceConnectionRetry> retryCallbacks;
+    retryCallbacks.EnqueueTakeAll(request.retryCallbacks);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+
+    ChipLogDetail(CASESessionManager, "Starting queued session setup for " ChipLogFormatScopedNodeId,
+                  ChipLogValueScopedNodeId(peerId));
+
+    // The first group of callbacks starts the setup, the others join it
+    Callback::Callback<OnDeviceConnected> * onConnection;
+    Callback::Callback<OnDeviceConnectionFailure> * onFailure;
+    Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure;
+    while (callbacks.Take(onConnection, onFailure, onSetupFailure))
+    {
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+        Callback::Callback<OnDeviceConnectionRetry> * onRetry = nullptr;
+        retryCallbacks.Take(onRetry);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+
+        // Only the success callback is left (the caller cancelled the others): nothing would be connected
+        if (onFailure == nullptr && onSetupFailure == nullptr)
+        {
+            continue;
+        }
+
+        ConnectSessionSetup(peerId, onConnection, onFailure, onSetupFailure,
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                            attemptCount, onRetry,
+#endif
+                            transportPayloadCapability);
+    }
+
+    // Nothing reports completion if no setup was left running (e.g. it failed synchronously)
+    if (FindExistingSessionSetup(peerId) == nullptr && mConnectionScheduler.OnSessionSetupComplete(peerId))
+    {
+        ScheduleConnectionProcessing(System::Clock::kZero);
+    }
+}
+
+void CASESessionManager::ScheduleConnectionProcessing(System::Clock::Timeout delay)
+{
+    VerifyOrReturn(mSystemLayer != nullptr && mConnectionScheduler.IsEnabled());
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(delay, HandleConnectionSchedulerTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(CASESessionManager, "Failed to schedule queued session setups: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void CASESessionManager::HandleConnectionSchedulerTimer(System::Layer * layer, void * context)
+{
+    auto * self     = static_cast<CASESessionManager *>(context);
+    auto retryAfter = self->mConnectionScheduler.Process(System::SystemClock().GetMonotonicTimestamp());
+    if (retryAfter.HasValue())
+    {
+        self->ScheduleConnectionProcessing(retryAfter.Value());
+    }
+}
+
 void CASESessionManager::ReleaseSessionsForFabric(FabricIndex fabricIndex)
 {
+    mConnectionScheduler.CancelFabric(fabricIndex);
     mConfig.sessionSetupPool->ReleaseAllSessionSetupsForFabric(fabricIndex);
+    ScheduleConnectionProcessing(System::Clock::kZero);
 }
 
 void CASESessionManager::ReleaseAllSessions()
 {
+    mConnectionScheduler.CancelAll();
     mConfig.sessionSetupPool->ReleaseAllSessionSetup();
 }
 
@@ -192,6 +323,11 @@ void CASESessionManager::ReleaseSession(OperationalSessionSetup * session)
 {
     if (session != nullptr)
     {
+        // Address updates are not admission controlled and hold no window slot
+        if (!session->IsForAddressUpdate() && mConnectionScheduler.OnSessionSetupComplete(session->GetPeerId()))
+        {
+            ScheduleConnectionProcessing(System::Clock::kZero);
+        }
         mConfig.sessionSetupPool->Release(session);
     }
 }
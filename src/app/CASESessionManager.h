@@ -19,6 +19,7 @@
 #pragma once
 
 #include <app/CASEClientPool.h>
+#include <app/CASEConnectionScheduler.h>
 #include <app/OperationalSessionSetup.h>
 #include <app/OperationalSessionSetupPool.h>
 #include <lib/core/CHIPConfig.h>
@@ -36,6 +37,7 @@ struct CASESessionManagerConfig
     CASEClientInitParams sessionInitParams;
     CASEClientPoolDelegate * clientPool                    = nullptr;
     OperationalSessionSetupPoolDelegate * sessionSetupPool = nullptr;
+    CASEConnectionScheduler::Config connectionScheduling;
 };
 
 /**
@@ -45,8 +47,12 @@ struct CASESessionManagerConfig
  * 3. API to lookup an existing proxy object, or allocate a new one by triggering session establishment with the peer node.
  * 4. During session establishment, trigger node ID resolution (if needed), and update the DNS-SD cache (if resolution is
  * successful)
+ * 5. Admission control: when enabled (see CASEConnectionScheduler), new session setups are queued and started within a
+ * concurrency window, paced per transport and ordered by priority.
  */
-class CASESessionManager : public OperationalSessionReleaseDelegate, public SessionUpdateDelegate
+class CASESessionManager : public OperationalSessionReleaseDelegate,
+                           public SessionUpdateDelegate,
+                           public CASEConnectionScheduler::Delegate
 {
 public:
     CASESessionManager() = default;
@@ -77,13 +83,17 @@ public:
      *
      * attemptCount can be used to automatically retry multiple times if session
      * setup is not successful.
+     *
+     * priority orders the request against other queued session setups when
+     * admission control is enabled.
      */
     void FindOrEstablishSession(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
                                 Callback::Callback<OnDeviceConnectionFailure> * onFailure,
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                 uint8_t attemptCount = 1, Callback::Callback<OnDeviceConnectionRetry> * onRetry = nullptr,
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
-                                TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload);
+                                TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload,
+                                ConnectionPriority priority                           = ConnectionPriority::kNormal);
 
     /**
      * Find an existing session for the given node ID or trigger a new session request.
@@ -107,13 +117,15 @@ public:
      * @param attemptCount The number of retry attempts if session setup fails (default is 1).
      * @param onRetry A callback to be called on a retry attempt (enabled by a config flag).
      * @param transportPayloadCapability An indicator of what payload types the session needs to be able to transport.
+     * @param priority The priority class of the request when session setups are queued (see CASEConnectionScheduler).
      */
     void FindOrEstablishSession(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
                                 Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure,
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                 uint8_t attemptCount = 1, Callback::Callback<OnDeviceConnectionRetry> * onRetry = nullptr,
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
-                                TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload);
+                                TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload,
+                                ConnectionPriority priority                           = ConnectionPriority::kNormal);
 
     /**
      * Find an existing session for the given node ID or trigger a new session request.
@@ -135,12 +147,14 @@ public:
      * @param attemptCount The number of retry attempts if session setup fails (default is 1).
      * @param onRetry A callback to be called on a retry attempt (enabled by a config flag).
      * @param transportPayloadCapability An indicator of what payload types the session needs to be able to transport.
+     * @param priority The priority class of the request when session setups are queued (see CASEConnectionScheduler).
      */
     void FindOrEstablishSession(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection, std::nullptr_t,
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                 uint8_t attemptCount = 1, Callback::Callback<OnDeviceConnectionRetry> * onRetry = nullptr,
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
-                                TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload);
+                                TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload,
+                                ConnectionPriority priority                           = ConnectionPriority::kNormal);
 
     void ReleaseSessionsForFabric(FabricIndex fabricIndex);
 
@@ -163,6 +177,15 @@ public:
     //////////// SessionUpdateDelegate Implementation ///////////////
     void UpdatePeerAddress(ScopedNodeId peerId) override;
 
+    //////////// CASEConnectionScheduler::Delegate Implementation ///////////////
+    void StartSessionSetup(CASEConnectionScheduler::Request & request) override;
+
+    /**
+     * Change the admission control configuration used for new session setups.
+     */
+    void SetConnectionSchedulingConfig(const CASEConnectionScheduler::Config & config);
+    const CASEConnectionScheduler & GetConnectionScheduler() const { return mConnectionScheduler; }
+
 private:
     OperationalSessionSetup * FindExistingSessionSetup(const ScopedNodeId & peerId, bool forAddressUpdate = false) const;
 
@@ -176,9 +199,25 @@ private:
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                       uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
 #endif
-                                      TransportPayloadCapability transportPayloadCapability);
+                                      TransportPayloadCapability transportPayloadCapability, ConnectionPriority priority);
+
+    void ConnectSessionSetup(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
+                             Callback::Callback<OnDeviceConnectionFailure> * onFailure,
+                             Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure,
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                             uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
+#endif
+                             TransportPayloadCapability transportPayloadCapability);
+
+    static void NotifySetupFailure(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnectionFailure> * onFailure,
+                                   Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure, CHIP_ERROR error);
+
+    void ScheduleConnectionProcessing(System::Clock::Timeout delay);
+    static void HandleConnectionSchedulerTimer(System::Layer * layer, void * context);
 
     CASESessionManagerConfig mConfig;
+    System::Layer * mSystemLayer = nullptr;
+    CASEConnectionScheduler mConnectionScheduler;
 };
 
 } // namespace chip
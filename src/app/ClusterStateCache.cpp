@@ -19,6 +19,8 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+#include <lib/core/TLVUtilities.h>
+#include <lib/support/SafeInt.h>
 #include <tuple>
 
 namespace chip {
@@ -52,16 +54,12 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
 template <bool CanEnableDataCaching>
 CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
 {
-    Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-    TLV::TLVReader reader;
-    reader.Init(*apData);
-    size_t totalBufSize = reader.GetTotalLength();
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
-    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    aSize = writer.GetLengthWritten();
-    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+    // Measure the element rather than copying it: the reader spans the whole report, which can be
+    // large when it was received over a session that allows large payloads.
+    size_t size = 0;
+    ReturnErrorOnFailure(TLV::Utilities::EncodedLength(*apData, TLV::AnonymousTag(), size));
+    VerifyOrReturnError(CanCastTo<uint32_t>(size), CHIP_ERROR_BUFFER_TOO_SMALL);
+    aSize = static_cast<uint32_t>(size);
     return CHIP_NO_ERROR;
 }
 
@@ -193,7 +191,11 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
         }
         if (mCacheData)
         {
-            System::PacketBufferHandle handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+            // Events received in large reports may not fit an MTU-sized buffer, so size it to the event.
+            size_t eventSize = 0;
+            ReturnErrorOnFailure(TLV::Utilities::EncodedLength(*apData, TLV::AnonymousTag(), eventSize));
+
+            System::PacketBufferHandle handle = System::PacketBufferHandle::New(eventSize, 0);
             VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
 
             System::PacketBufferTLVWriter writer;
@@ -202,12 +204,6 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
             ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
             ReturnErrorOnFailure(writer.Finalize(&handle));
 
-            //
-            // Compact the buffer down to a more reasonably sized packet buffer
-            // if we can.
-            //
-            handle.RightSize();
-
             EventData eventData;
             eventData.first  = aEventHeader;
             eventData.second = std::move(handle);
@@ -247,6 +243,12 @@ void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
     auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
     if (lastClusterInfo.mPendingDataVersion.HasValue())
     {
+        if (lastClusterInfo.mCommittedDataVersion.HasValue() &&
+            lastClusterInfo.mCommittedDataVersion != lastClusterInfo.mPendingDataVersion &&
+            lastClusterInfo.mDataVersionChangeCount < UINT16_MAX)
+        {
+            lastClusterInfo.mDataVersionChangeCount++;
+        }
         lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
         lastClusterInfo.mPendingDataVersion.ClearValue();
     }
@@ -555,7 +557,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
 
             DataVersionFilter filter(endpointId, clusterId, dataVersion);
 
-            aVector.push_back(std::make_pair(filter, clusterSize));
+            // Rank by expected saving, counting clusters that changed often as likely to have changed again.
+            aVector.push_back(std::make_pair(filter, clusterSize / (1u + clusterIter.second.mDataVersionChangeCount)));
         }
     }
 
@@ -606,11 +609,11 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterLi
     std::vector<std::pair<DataVersionFilter, size_t>> filterVector;
     GetSortedFilters(filterVector);
 
-    aEncodedDataVersionList = false;
+    size_t skippedFilterCount = 0;
+    aEncodedDataVersionList   = false;
     for (auto & filter : filterVector)
     {
         bool intersected = false;
-        aDataVersionFilterIBsBuilder.Checkpoint(backup);
 
         // if the particular cached cluster does not intersect with user provided attribute paths, skip the cached one
         for (const auto & attributePath : aAttributePaths)
@@ -626,18 +629,32 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterLi
             continue;
         }
 
-        SuccessOrExit(err = aDataVersionFilterIBsBuilder.EncodeDataVersionFilterIB(filter.first));
+        if (aDataVersionFilterIBsBuilder.GetWriter()->GetRemainingFreeLength() < kMinDataVersionFilterIBSize)
+        {
+            skippedFilterCount++;
+            continue;
+        }
+
+        aDataVersionFilterIBsBuilder.Checkpoint(backup);
+        err = aDataVersionFilterIBsBuilder.EncodeDataVersionFilterIB(filter.first);
+        if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            // The encoding of filters varies with the size of their values, so a filter further down the list may
+            // still fit in the remaining space.
+            aDataVersionFilterIBsBuilder.Rollback(backup);
+            skippedFilterCount++;
+            continue;
+        }
+        ReturnErrorOnFailure(err);
         aEncodedDataVersionList = true;
     }
 
-exit:
-    if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    if (skippedFilterCount > 0)
     {
-        ChipLogProgress(DataManagement, "OnUpdateDataVersionFilterList out of space; rolling back");
-        aDataVersionFilterIBsBuilder.Rollback(backup);
-        err = CHIP_NO_ERROR;
+        ChipLogProgress(DataManagement, "OnUpdateDataVersionFilterList out of space; skipped %u of %u filters",
+                        static_cast<unsigned>(skippedFilterCount), static_cast<unsigned>(filterVector.size()));
     }
-    return err;
+    return CHIP_NO_ERROR;
 }
 
 template <bool CanEnableDataCaching>
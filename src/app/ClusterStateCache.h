@@ -567,11 +567,15 @@ private:
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
     // value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
     // and we must not be in the middle of receiving reports for that cluster.
+    //
+    // mDataVersionChangeCount counts how many times the committed data version has changed, saturating at its maximum value.
+    // Clusters that change often are less likely to be unchanged when resubscribing.
     struct ClusterState
     {
         std::map<AttributeId, AttributeState> mAttributes;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
+        uint16_t mDataVersionChangeCount = 0;
     };
     using EndpointState = std::map<ClusterId, ClusterState>;
     using NodeState     = std::map<EndpointId, EndpointState>;
@@ -680,9 +684,14 @@ private:
     // Commit the pending cluster data version, if there is one.
     void CommitPendingDataVersion();
 
-    // Get our list of data version filters, sorted from larges to smallest by the total size of the TLV
-    // payload for the filter's cluster.  Applying filters in this order should maximize space savings
-    // on the wire if not all filters can be applied.
+    // Size of the shortest DataVersionFilterIB encoding, with single-byte endpoint, cluster and data version values.
+    static constexpr uint32_t kMinDataVersionFilterIBSize = 14;
+
+    // Get our list of data version filters, sorted from largest to smallest by the expected saving: the total
+    // size of the TLV payload for the filter's cluster, divided by one more than the number of times the
+    // cluster's data version has changed.  Applying filters in this order should maximize space savings
+    // on the wire if not all filters can be applied, since a filter for a cluster that has changed by the
+    // time we resubscribe saves nothing.
     void GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const;
 
     CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize);
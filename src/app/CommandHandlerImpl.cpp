@@ -672,14 +672,16 @@ CHIP_ERROR CommandHandlerImpl::PrepareInvokeResponseCommand(const CommandPathReg
     // If you're encountering CHIP_ERROR_INCORRECT_STATE, refactoring to use AddResponse is recommended.
     ReturnErrorOnFailure(AllocateBuffer());
 
-    if (!mInternalCallToAddResponseData && mState == State::AddedCommand)
+    if (!mInternalCallToAddResponseData && mState == State::AddedCommand &&
+        mCommandMessageWriter.GetRemainingFreeLength() < CHIP_CONFIG_COMMAND_RESPONSE_MIN_FREE_SPACE)
     {
         // An attempt is being made to add CommandData InvokeResponse using primitive
         // CommandHandlerImpl APIs. While not recommended, as this potentially leaves the
         // CommandHandlerImpl in an incorrect state upon failure, this approach is permitted
         // for legacy reasons. To maximize the likelihood of success, particularly when
         // handling large amounts of data, we try to obtain a new, completely empty
-        // InvokeResponseMessage, as the existing one already has space occupied.
+        // InvokeResponseMessage when the existing one is running out of space. We do not
+        // do so unconditionally, as a batched invoke would then cost one message per command.
         ReturnErrorOnFailure(FinalizeInvokeResponseMessageAndPrepareNext());
     }
 
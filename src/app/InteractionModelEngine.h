@@ -265,6 +265,14 @@ public:
      * Return the number of active read clients being tracked by the engine.
      */
     size_t GetNumActiveReadClients();
+
+    /**
+     * Install a coordinator for the re-subscriptions of all tracked read clients, or remove it by
+     * passing nullptr. While no coordinator is installed, every read client backs off independently.
+     * The coordinator must be removed before it is destroyed.
+     */
+    void SetResubscriptionCoordinator(ResubscriptionCoordinator * apCoordinator) { mpResubscriptionCoordinator = apCoordinator; }
+    ResubscriptionCoordinator * GetResubscriptionCoordinator() const { return mpResubscriptionCoordinator; }
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
     /**
@@ -662,7 +670,8 @@ private:
     ObjectPool<ReadHandler, CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mReadHandlers;
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
-    ReadClient * mpActiveReadClientList = nullptr;
+    ReadClient * mpActiveReadClientList                     = nullptr;
+    ResubscriptionCoordinator * mpResubscriptionCoordinator = nullptr;
 #endif
 
     ReadHandler::ApplicationCallback * mpReadHandlerApplicationCallback = nullptr;
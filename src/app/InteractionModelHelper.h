@@ -25,15 +25,16 @@
 namespace chip {
 namespace app {
 
-static CHIP_ERROR InitWriterWithSpaceReserved(System::PacketBufferTLVWriter & aWriter, uint32_t aReserveSpace)
+static CHIP_ERROR InitWriterWithSpaceReserved(System::PacketBufferTLVWriter & aWriter, uint32_t aReserveSpace,
+                                              size_t aMaxSduLength = kMaxSecureSduLengthBytes)
 {
-    System::PacketBufferHandle msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    System::PacketBufferHandle msgBuf = System::PacketBufferHandle::New(aMaxSduLength);
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
     uint16_t reservedSize = 0;
 
-    if (msgBuf->AvailableDataLength() > kMaxSecureSduLengthBytes)
+    if (msgBuf->AvailableDataLength() > aMaxSduLength)
     {
-        reservedSize = static_cast<uint16_t>(msgBuf->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        reservedSize = static_cast<uint16_t>(msgBuf->AvailableDataLength() - aMaxSduLength);
     }
 
     reservedSize = static_cast<uint16_t>(reservedSize + Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES + aReserveSpace);
@@ -80,6 +80,7 @@ void ReadClient::StopResubscription()
 {
     CancelLivenessCheckTimer();
     CancelResubscribeTimer();
+    ReleaseResubscriptionSlot();
 
     // Only deallocate the paths if they are not already deallocated.
     if (mReadPrepareParams.mpAttributePathParamsList != nullptr || mReadPrepareParams.mpEventPathParamsList != nullptr ||
@@ -121,7 +122,13 @@ uint32_t ReadClient::ComputeTimeTillNextSubscription()
     uint32_t waitTimeInMsec    = 0;
     uint32_t minWaitTimeInMsec = 0;
 
-    if (mNumRetries <= CHIP_RESUBSCRIBE_MAX_FIBONACCI_STEP_INDEX)
+    ResubscriptionCoordinator * coordinator = GetResubscriptionCoordinator();
+    if (coordinator != nullptr)
+    {
+        waitTimeInMsec              = coordinator->ComputeResubscriptionDelay(mPreviousResubscribeDelayMs);
+        mPreviousResubscribeDelayMs = waitTimeInMsec;
+    }
+    else if (mNumRetries <= CHIP_RESUBSCRIBE_MAX_FIBONACCI_STEP_INDEX)
     {
         maxWaitTimeInMsec = GetFibonacciForIndex(mNumRetries) * CHIP_RESUBSCRIBE_WAIT_TIME_MULTIPLIER_MS;
     }
@@ -130,7 +137,7 @@ uint32_t ReadClient::ComputeTimeTillNextSubscription()
         maxWaitTimeInMsec = CHIP_RESUBSCRIBE_MAX_RETRY_WAIT_INTERVAL_MS;
     }
 
-    if (maxWaitTimeInMsec != 0)
+    if (coordinator == nullptr && maxWaitTimeInMsec != 0)
     {
         minWaitTimeInMsec = (CHIP_RESUBSCRIBE_MIN_WAIT_TIME_INTERVAL_PERCENT_PER_STEP * maxWaitTimeInMsec) / 100;
         waitTimeInMsec    = minWaitTimeInMsec + (Crypto::GetRandU32() % (maxWaitTimeInMsec - minWaitTimeInMsec));
@@ -193,6 +200,7 @@ void ReadClient::Close(CHIP_ERROR aError, bool allowResubscription)
         }
 
         ClearActiveSubscriptionState();
+        ReleaseResubscriptionSlot();
         if (aError != CHIP_NO_ERROR)
         {
             //
@@ -294,7 +302,7 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
     ReadRequestMessage::Builder request;
     System::PacketBufferTLVWriter writer;
 
-    InitWriterWithSpaceReserved(writer, kReservedSizeForTLVEncodingOverhead);
+    InitWriterWithSpaceReserved(writer, kReservedSizeForTLVEncodingOverhead, GetMaxRequestSduLength(aReadPrepareParams));
     ReturnErrorOnFailure(request.Init(&writer));
 
     if (!attributePaths.empty())
@@ -398,6 +406,17 @@ CHIP_ERROR ReadClient::GenerateAttributePaths(AttributePathIBs::Builder & aAttri
     return aAttributePathIBsBuilder.EndOfAttributePathIBs();
 }
 
+size_t ReadClient::GetMaxRequestSduLength(const ReadPrepareParams & aReadPrepareParams)
+{
+    // Sessions that allow large payloads fit many more data version filters, which saves resending clusters on resubscribe.
+    if (aReadPrepareParams.mSessionHolder && aReadPrepareParams.mSessionHolder->AllowsLargePayload())
+    {
+        return kMaxLargeSecureSduLengthBytes;
+    }
+
+    return kMaxSecureSduLengthBytes;
+}
+
 CHIP_ERROR ReadClient::BuildDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
                                                   const Span<AttributePathParams> & aAttributePaths,
                                                   const Span<DataVersionFilter> & aDataVersionFilters,
@@ -1092,7 +1111,9 @@ CHIP_ERROR ReadClient::ProcessSubscribeResponse(System::PacketBufferHandle && aP
 
     mpCallback.OnSubscriptionEstablished(subscriptionId);
 
-    mNumRetries = 0;
+    mNumRetries                 = 0;
+    mPreviousResubscribeDelayMs = 0;
+    ReleaseResubscriptionSlot(/* established = */ true);
 
     ReturnErrorOnFailure(RefreshLivenessCheckTimer());
 
@@ -1165,7 +1186,7 @@ CHIP_ERROR ReadClient::SendSubscribeRequestImpl(const ReadPrepareParams & aReadP
     System::PacketBufferHandle msgBuf;
     System::PacketBufferTLVWriter writer;
     SubscribeRequestMessage::Builder request;
-    InitWriterWithSpaceReserved(writer, kReservedSizeForTLVEncodingOverhead);
+    InitWriterWithSpaceReserved(writer, kReservedSizeForTLVEncodingOverhead, GetMaxRequestSduLength(aReadPrepareParams));
 
     ReturnErrorOnFailure(request.Init(&writer));
 
@@ -1325,6 +1346,14 @@ void ReadClient::OnResubscribeTimerCallback(System::Layer * /* If this starts be
 
     _this->mIsResubscriptionScheduled = false;
 
+    ResubscriptionCoordinator * coordinator = _this->GetResubscriptionCoordinator();
+    if (coordinator != nullptr && !coordinator->RequestResubscription(*_this))
+    {
+        // Queued behind other re-subscriptions; OnResubscriptionAdmitted will get us back here.
+        _this->mIsResubscriptionScheduled = true;
+        return;
+    }
+
     CHIP_ERROR err;
 
     ChipLogProgress(DataManagement, "OnResubscribeTimerCallback: ForceCASE = %d", _this->mForceCaseOnNextResub);
@@ -1399,6 +1428,21 @@ CHIP_ERROR ReadClient::GetMinEventNumber(const ReadPrepareParams & aReadPrepareP
     return CHIP_NO_ERROR;
 }
 
+bool ReadClient::HasActiveResubscriptionSession() const
+{
+    return mReadPrepareParams.mSessionHolder && mReadPrepareParams.mSessionHolder->AsSecureSession()->IsActiveSession();
+}
+
+void ReadClient::OnResubscriptionAdmitted()
+{
+    OnResubscribeTimerCallback(nullptr, this);
+}
+
+ResubscriptionCoordinator * ReadClient::GetResubscriptionCoordinator() const
+{
+    return (mpImEngine != nullptr) ? mpImEngine->GetResubscriptionCoordinator() : nullptr;
+}
+
 void ReadClient::TriggerResubscribeIfScheduled(const char * reason)
 {
     if (!mIsResubscriptionScheduled)
@@ -36,6 +36,7 @@
 #include <app/MessageDef/SubscribeResponseMessage.h>
 #include <app/OperationalSessionSetup.h>
 #include <app/ReadPrepareParams.h>
+#include <app/ResubscriptionCoordinator.h>
 #include <app/data-model/Decode.h>
 #include <lib/core/CHIPCallback.h>
 #include <lib/core/CHIPCore.h>
@@ -67,7 +68,7 @@ class InteractionModelEngine;
  *         Callback::OnResubscriptionNeeded and providing an alternative implementation.
  *
  */
-class ReadClient : public Messaging::ExchangeDelegate
+class ReadClient : public Messaging::ExchangeDelegate, private ResubscriptionCoordinator::Participant
 {
 public:
     class Callback
@@ -442,6 +443,9 @@ public:
      *
      * CHIP_RESUBSCRIBE_MAX_FIBONACCI_STEP_INDEX is the maximum value the retry count can tick up to.
      *
+     * If a ResubscriptionCoordinator is installed on the InteractionModelEngine, the time is instead
+     * computed by the coordinator, using decorrelated jitter.
+     *
      */
     uint32_t ComputeTimeTillNextSubscription();
 
@@ -618,6 +622,7 @@ private:
     static void HandleDeviceConnectionFailure(void * context, const OperationalSessionSetup::ConnectionFailureInfo & failureInfo);
 
     CHIP_ERROR GetMinEventNumber(const ReadPrepareParams & aReadPrepareParams, Optional<EventNumber> & aEventMin);
+    static size_t GetMaxRequestSduLength(const ReadPrepareParams & aReadPrepareParams);
 
     /**
      * Start setting up a CASE session to our peer, if we can locate a
@@ -626,6 +631,13 @@ private:
      */
     CHIP_ERROR EstablishSessionToPeer();
 
+    // ResubscriptionCoordinator::Participant
+    ScopedNodeId GetResubscriptionPeer() const override { return mPeer; }
+    bool HasActiveResubscriptionSession() const override;
+    void OnResubscriptionAdmitted() override;
+
+    ResubscriptionCoordinator * GetResubscriptionCoordinator() const;
+
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
     Messaging::ExchangeHolder mExchange;
     Callback & mpCallback;
@@ -662,6 +674,8 @@ private:
     //
     ReadPrepareParams mReadPrepareParams;
     uint32_t mNumRetries = 0;
+    // Delay before the previous re-subscription attempt, when computed by a ResubscriptionCoordinator.
+    uint32_t mPreviousResubscribeDelayMs = 0;
 
     System::Clock::Timeout mLivenessTimeoutOverride = System::Clock::kZero;
 
@@ -901,7 +901,15 @@ Transport::SecureSession * ReadHandler::GetSession() const
 
 void ReadHandler::ForceDirtyState()
 {
+    bool oldReportable = ShouldStartReporting();
+    bool oldForceDirty = IsForceDirty();
     SetStateFlag(ReadHandlerFlags::ForceDirty);
+
+    // The scheduler may have deferred the report of a handler that was already dirty, let it know the report is now forced
+    if (oldReportable && !oldForceDirty)
+    {
+        mObserver->OnBecameReportable(this);
+    }
 }
 
 void ReadHandler::SetStateFlag(ReadHandlerFlags aFlag, bool aValue)
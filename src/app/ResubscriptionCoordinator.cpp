@@ -0,0 +1,267 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ResubscriptionCoordinator.h>
+
+#include <crypto/RandUtils.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <tracing/metric_event.h>
+
+#include <algorithm>
+
+using namespace chip::Tracing;
+
+namespace chip {
+namespace app {
+
+ResubscriptionCoordinator::Participant::~Participant()
+{
+    ReleaseResubscriptionSlot();
+}
+
+void ResubscriptionCoordinator::Init(System::Layer * systemLayer, const Config & config)
+{
+    mSystemLayer = systemLayer;
+    mConfig      = config;
+}
+
+void ResubscriptionCoordinator::Shutdown()
+{
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(AdmitQueued, this);
+    }
+
+    for (auto * list : { &mQueue, &mInProgress })
+    {
+        while (!list->Empty())
+        {
+            Participant & participant = *list->begin();
+            list->Remove(&participant);
+            participant.mState       = Participant::State::kIdle;
+            participant.mCoordinator = nullptr;
+        }
+    }
+    mQueuedCount     = 0;
+    mInProgressCount = 0;
+}
+
+void ResubscriptionCoordinator::SetConfig(const Config & config)
+{
+    mConfig = config;
+    if (!mQueue.Empty() && HasFreeSlot())
+    {
+        ScheduleAdmission();
+    }
+}
+
+uint32_t ResubscriptionCoordinator::ComputeResubscriptionDelay(uint32_t previousDelayMs)
+{
+    const uint32_t baseDelayMs = std::max<uint32_t>(mConfig.baseDelayMs, 1);
+    uint32_t delayMs;
+
+    if (previousDelayMs == 0)
+    {
+        // Full jitter for the first attempt, so that subscriptions dropped at the same
+        // time do not all retry at the same time.
+        delayMs = 1 + Crypto::GetRandU32() % baseDelayMs;
+    }
+    else
+    {
+        // Decorrelated jitter: uniform in [base, 3 * previous], growing on average
+        // with every attempt while staying spread out.
+        const uint64_t upperMs = std::max<uint64_t>(static_cast<uint64_t>(previousDelayMs) * 3, baseDelayMs + 1u);
+        delayMs                = static_cast<uint32_t>(baseDelayMs + Crypto::GetRandU32() % (upperMs - baseDelayMs));
+    }
+
+    delayMs = std::min(delayMs, mConfig.maxDelayMs);
+    MATTER_LOG_METRIC(kMetricResubscriptionDelay, delayMs);
+    return delayMs;
+}
+
+bool ResubscriptionCoordinator::RequestResubscription(Participant & participant)
+{
+    if (participant.mCoordinator != nullptr && participant.mCoordinator != this)
+    {
+        participant.mCoordinator->Release(participant);
+    }
+
+    if (participant.mState == Participant::State::kInProgress)
+    {
+        return true;
+    }
+    VerifyOrReturnValue(participant.mState != Participant::State::kQueued, false);
+
+    if (mQueue.Empty() && HasFreeSlot())
+    {
+        Admit(participant);
+        return true;
+    }
+
+    participant.mState       = Participant::State::kQueued;
+    participant.mCoordinator = this;
+    mQueue.PushBack(&participant);
+    mQueuedCount++;
+    MATTER_LOG_METRIC(kMetricResubscriptionQueued, static_cast<uint32_t>(mQueuedCount));
+
+    ChipLogDetail(DataManagement, "Queued resubscription to " ChipLogFormatScopedNodeId " (%u queued, %u in progress)",
+                  ChipLogValueScopedNodeId(participant.GetResubscriptionPeer()), static_cast<unsigned>(mQueuedCount),
+                  static_cast<unsigned>(mInProgressCount));
+    return false;
+}
+
+void ResubscriptionCoordinator::Release(Participant & participant, bool established)
+{
+    VerifyOrReturn(participant.mCoordinator == this);
+
+    if (established)
+    {
+        mRecentPeers[mNextRecentPeer] = participant.GetResubscriptionPeer();
+        mNextRecentPeer               = (mNextRecentPeer + 1) % kRecentPeerCount;
+    }
+
+    if (participant.mState == Participant::State::kQueued)
+    {
+        mQueue.Remove(&participant);
+        mQueuedCount--;
+    }
+    else
+    {
+        mInProgress.Remove(&participant);
+        mInProgressCount--;
+        MATTER_LOG_METRIC(kMetricResubscriptionInProgress, static_cast<uint32_t>(mInProgressCount));
+    }
+    participant.mState       = Participant::State::kIdle;
+    participant.mCoordinator = nullptr;
+
+    if (!mQueue.Empty() && HasFreeSlot())
+    {
+        ScheduleAdmission();
+    }
+}
+
+bool ResubscriptionCoordinator::HasFreeSlot() const
+{
+    return mConfig.maxConcurrentAttempts == 0 || mInProgressCount < mConfig.maxConcurrentAttempts;
+}
+
+bool ResubscriptionCoordinator::IsRecentlyEstablished(const ScopedNodeId & peer) const
+{
+    return std::find(std::begin(mRecentPeers), std::end(mRecentPeers), peer) != std::end(mRecentPeers);
+}
+
+bool ResubscriptionCoordinator::IsInProgress(const ScopedNodeId & peer)
+{
+    for (auto & participant : mInProgress)
+    {
+        if (participant.GetResubscriptionPeer() == peer)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+ResubscriptionCoordinator::Participant * ResubscriptionCoordinator::SelectNext()
+{
+    // In order of preference: an attempt that has a session, one for a peer a session was just
+    // established with, the oldest one for a peer nobody is connecting to, and the oldest one.
+    // Attempts for a peer another attempt is connecting to would share its CASE handshake, but
+    // would hold a slot while just waiting for it: they are better admitted once it completes.
+    Participant * recentPeer = nullptr;
+    Participant * idlePeer   = nullptr;
+    for (auto & participant : mQueue)
+    {
+        if (participant.HasActiveResubscriptionSession())
+        {
+            return &participant;
+        }
+
+        const ScopedNodeId peer = participant.GetResubscriptionPeer();
+        if (recentPeer == nullptr && IsRecentlyEstablished(peer))
+        {
+            recentPeer = &participant;
+        }
+        else if (idlePeer == nullptr && !IsInProgress(peer))
+        {
+            idlePeer = &participant;
+        }
+    }
+
+    if (recentPeer != nullptr)
+    {
+        return recentPeer;
+    }
+    return (idlePeer != nullptr) ? idlePeer : &*mQueue.begin();
+}
+
+void ResubscriptionCoordinator::Admit(Participant & participant)
+{
+    [[maybe_unused]] const bool reusesSession = participant.HasActiveResubscriptionSession() ||
+        IsRecentlyEstablished(participant.GetResubscriptionPeer()) || IsInProgress(participant.GetResubscriptionPeer());
+    MATTER_LOG_METRIC(kMetricResubscriptionSessionReuse, static_cast<uint32_t>(reusesSession ? 1 : 0));
+
+    participant.mState       = Participant::State::kInProgress;
+    participant.mCoordinator = this;
+    mInProgress.PushBack(&participant);
+    mInProgressCount++;
+    MATTER_LOG_METRIC(kMetricResubscriptionInProgress, static_cast<uint32_t>(mInProgressCount));
+}
+
+void ResubscriptionCoordinator::ScheduleAdmission()
+{
+    if (mSystemLayer == nullptr)
+    {
+        AdmitQueued();
+        return;
+    }
+
+    // Admit from a fresh call stack: Release() is typically called while a ReadClient is
+    // being closed, which is no place to start another ReadClient's re-subscription.
+    if (mSystemLayer->StartTimer(System::Clock::kZero, AdmitQueued, this) != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to schedule resubscription admission");
+    }
+}
+
+void ResubscriptionCoordinator::AdmitQueued(System::Layer * systemLayer, void * context)
+{
+    static_cast<ResubscriptionCoordinator *>(context)->AdmitQueued();
+}
+
+void ResubscriptionCoordinator::AdmitQueued()
+{
+    VerifyOrReturn(!mAdmitting);
+    mAdmitting = true;
+
+    while (!mQueue.Empty() && HasFreeSlot())
+    {
+        Participant * participant = SelectNext();
+        mQueue.Remove(participant);
+        mQueuedCount--;
+        Admit(*participant);
+
+        // May call Release() or RequestResubscription() re-entrantly
+        participant->OnResubscriptionAdmitted();
+    }
+
+    mAdmitting = false;
+}
+
+} // namespace app
+} // namespace chip
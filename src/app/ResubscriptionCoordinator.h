@@ -0,0 +1,172 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/IntrusiveList.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Fleet-level coordination of re-subscriptions.
+ *
+ * With the default policy every ReadClient backs off independently, and the
+ * first retry after a subscription drops happens immediately. After a network
+ * blip all subscriptions of a controller therefore retry in lockstep, and the
+ * resulting burst of CASE handshakes and subscribe requests overloads the
+ * network and the peers, so most attempts fail and are retried again.
+ *
+ * When installed on the InteractionModelEngine, the coordinator:
+ *
+ *   - computes re-subscription delays using decorrelated jitter, so that
+ *     retries of different subscriptions spread out instead of clustering,
+ *   - caps the number of re-subscription attempts in progress at any time,
+ *     queueing further attempts until one completes,
+ *   - admits queued attempts that can reuse a CASE session first: those with
+ *     an active session, then those for a peer a session was recently
+ *     established with. Attempts for a peer that another attempt is
+ *     connecting to are admitted last, as they would only wait for it.
+ */
+class ResubscriptionCoordinator
+{
+public:
+    struct Config
+    {
+        uint32_t baseDelayMs           = CHIP_CONFIG_RESUBSCRIPTION_JITTER_BASE_MS;
+        uint32_t maxDelayMs            = CHIP_RESUBSCRIBE_MAX_RETRY_WAIT_INTERVAL_MS;
+        uint16_t maxConcurrentAttempts = CHIP_CONFIG_RESUBSCRIPTION_MAX_CONCURRENT; // 0 means no limit
+    };
+
+    /**
+     * A subscription taking part in coordinated re-subscription.
+     */
+    class Participant : public IntrusiveListNodeBase<>
+    {
+    public:
+        virtual ~Participant();
+
+        /// The peer the subscription is to.
+        virtual ScopedNodeId GetResubscriptionPeer() const = 0;
+
+        /// Whether a re-subscription attempt could use an existing CASE session.
+        virtual bool HasActiveResubscriptionSession() const = 0;
+
+        /// Called when a queued re-subscription attempt is admitted and should start.
+        virtual void OnResubscriptionAdmitted() = 0;
+
+    protected:
+        /// Release the slot (or queue entry) held with whichever coordinator admitted or queued us.
+        void ReleaseResubscriptionSlot(bool established = false)
+        {
+            if (mCoordinator != nullptr)
+            {
+                mCoordinator->Release(*this, established);
+            }
+        }
+
+    private:
+        friend class ResubscriptionCoordinator;
+
+        enum class State : uint8_t
+        {
+            kIdle,
+            kQueued,
+            kInProgress,
+        };
+
+        ResubscriptionCoordinator * mCoordinator = nullptr;
+        State mState                             = State::kIdle;
+    };
+
+    ResubscriptionCoordinator() = default;
+    ~ResubscriptionCoordinator() { Shutdown(); }
+
+    ResubscriptionCoordinator(const ResubscriptionCoordinator &)             = delete;
+    ResubscriptionCoordinator & operator=(const ResubscriptionCoordinator &) = delete;
+
+    /**
+     * Initialize the coordinator. Admission of queued attempts is deferred to the
+     * given system layer; if it is null, queued attempts are admitted synchronously
+     * from Release().
+     */
+    void Init(System::Layer * systemLayer, const Config & config);
+
+    /// Forget all participants (without notifying them) and cancel pending work.
+    void Shutdown();
+
+    void SetConfig(const Config & config);
+    const Config & GetConfig() const { return mConfig; }
+
+    /**
+     * Compute the delay before the next re-subscription attempt.
+     *
+     * @param previousDelayMs the delay computed for the previous attempt of the same
+     *                        subscription, or 0 for the first attempt since it dropped.
+     */
+    uint32_t ComputeResubscriptionDelay(uint32_t previousDelayMs);
+
+    /**
+     * Request to start a re-subscription attempt.
+     *
+     * @return true if the attempt may start now. Otherwise the participant is queued
+     *         (or stays queued) and OnResubscriptionAdmitted is called once it may start.
+     */
+    bool RequestResubscription(Participant & participant);
+
+    /**
+     * Release the slot held by a participant's attempt, or remove it from the queue.
+     *
+     * @param established whether the attempt succeeded, which makes queued attempts
+     *                    for the same peer preferred for admission.
+     */
+    void Release(Participant & participant, bool established = false);
+
+    size_t QueuedCount() const { return mQueuedCount; }
+    size_t InProgressCount() const { return mInProgressCount; }
+
+private:
+    static constexpr size_t kRecentPeerCount = 16;
+
+    bool HasFreeSlot() const;
+    bool IsRecentlyEstablished(const ScopedNodeId & peer) const;
+    bool IsInProgress(const ScopedNodeId & peer);
+    Participant * SelectNext();
+    void Admit(Participant & participant);
+    void ScheduleAdmission();
+    void AdmitQueued();
+    static void AdmitQueued(System::Layer * systemLayer, void * context);
+
+    System::Layer * mSystemLayer = nullptr;
+    Config mConfig;
+
+    IntrusiveList<Participant> mQueue;
+    IntrusiveList<Participant> mInProgress;
+    size_t mQueuedCount     = 0;
+    size_t mInProgressCount = 0;
+
+    ScopedNodeId mRecentPeers[kRecentPeerCount];
+    size_t mNextRecentPeer = 0;
+
+    bool mAdmitting = false;
+};
+
+} // namespace app
+} // namespace chip
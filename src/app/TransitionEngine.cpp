@@ -0,0 +1,164 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/TransitionEngine.h>
+
+#include <app/TimerDelegates.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+DefaultTimerDelegate gTimerDelegate;
+TransitionEngine gTransitionEngine(gTimerDelegate);
+
+} // namespace
+
+TransitionEngine & TransitionEngine::Instance()
+{
+    return gTransitionEngine;
+}
+
+TransitionEngine::~TransitionEngine()
+{
+    // The timer is cancelled by Shutdown(): the system layer of the shared engine is gone by the time it is destroyed
+    UnlinkAll();
+}
+
+void TransitionEngine::Shutdown()
+{
+    // The timer is only active while steps are scheduled
+    if (!mScheduled.Empty())
+    {
+        mTimerDelegate.CancelTimer(this);
+    }
+    UnlinkAll();
+}
+
+void TransitionEngine::UnlinkAll()
+{
+    while (!mScheduled.Empty())
+    {
+        mScheduled.begin()->Unlink();
+    }
+}
+
+void TransitionEngine::ScheduleStep(Transition & transition, StepCallback callback, EndpointId endpoint,
+                                    System::Clock::Milliseconds32 delay)
+{
+    const System::Clock::Timestamp now = mTimerDelegate.GetCurrentMonotonicTimestamp();
+
+    transition.Unlink();
+    transition.mCallback = callback;
+    transition.mEndpoint = endpoint;
+    transition.mStepTime = GetStepTime(now, delay);
+    mScheduled.PushBack(&transition);
+
+    // The timer is restarted once every step of the current event has run
+    VerifyOrReturn(!mRunningSteps);
+
+    if (!mTimerDelegate.IsTimerActive(this) || transition.mStepTime < mTimerTime)
+    {
+        StartTimer();
+    }
+}
+
+void TransitionEngine::CancelStep(Transition & transition)
+{
+    transition.Unlink();
+
+    // The timer is left running when other steps are scheduled, a timer event without due steps only restarts it
+    if (mScheduled.Empty())
+    {
+        mTimerDelegate.CancelTimer(this);
+    }
+}
+
+System::Clock::Timestamp TransitionEngine::GetStepTime(System::Clock::Timestamp now, System::Clock::Milliseconds32 delay) const
+{
+    const System::Clock::Timestamp stepTime = now + delay;
+    VerifyOrReturnValue(delay.count() > 0 && mTick.count() > 0, stepTime);
+
+    // Rounding to the nearest tick rather than up keeps a transition rescheduling each step from the time its previous step ran,
+    // a little after the tick because of the timer latency, from drifting by a tick per step
+    const uint64_t tick = mTick.count();
+    return System::Clock::Timestamp((stepTime.count() + tick / 2) / tick * tick);
+}
+
+void TransitionEngine::StartTimer()
+{
+    VerifyOrReturn(!mScheduled.Empty());
+
+    System::Clock::Timestamp nextStepTime = mScheduled.begin()->mStepTime;
+    for (const Transition & transition : mScheduled)
+    {
+        nextStepTime = std::min(nextStepTime, transition.mStepTime);
+    }
+
+    const System::Clock::Timestamp now = mTimerDelegate.GetCurrentMonotonicTimestamp();
+    const System::Clock::Timeout delay =
+        (nextStepTime > now) ? std::chrono::duration_cast<System::Clock::Timeout>(nextStepTime - now) : System::Clock::kZero;
+
+    mTimerDelegate.CancelTimer(this);
+    CHIP_ERROR err = mTimerDelegate.StartTimer(this, delay);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Transition engine failed to schedule event: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mTimerTime = nextStepTime;
+}
+
+void TransitionEngine::TimerFired()
+{
+    const System::Clock::Timestamp now = mTimerDelegate.GetCurrentMonotonicTimestamp();
+    TransitionList due;
+
+    mStats.mTickCount++;
+
+    // Steps scheduled by the callbacks of this event are run by the next one, even when they are already due
+    for (auto it = mScheduled.begin(); it != mScheduled.end();)
+    {
+        Transition & transition = *it;
+        ++it;
+        if (transition.mStepTime <= now)
+        {
+            transition.Unlink();
+            due.PushBack(&transition);
+        }
+    }
+
+    mRunningSteps = true;
+    while (!due.Empty())
+    {
+        Transition & transition = *due.begin();
+        transition.Unlink();
+
+        mStats.mStepCount++;
+        transition.mCallback(transition.mEndpoint);
+    }
+    mRunningSteps = false;
+
+    StartTimer();
+}
+
+} // namespace app
+} // namespace chip
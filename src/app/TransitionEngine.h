@@ -0,0 +1,117 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/reporting/ReportScheduler.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/IntrusiveList.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Steps the transitions of the LevelControl and ColorControl clusters of every
+ * endpoint from a single timer.
+ *
+ * Each cluster keeps a Transition per endpoint, and schedules the next step of
+ * the endpoint's transition with ScheduleStep() instead of starting a system
+ * timer of its own. Step times are rounded to the nearest point of a grid of
+ * Tick, so that steps of transitions running in parallel, such as the fades of
+ * every light of a bridge, are run together from one timer event, and the
+ * system timer list holds a single timer whatever the number of active
+ * transitions.
+ *
+ * The cluster computes the values of the step, and marks the attributes
+ * dirty, in the step callback as it did from its own timer.
+ */
+class TransitionEngine : private reporting::TimerContext
+{
+public:
+    using TimerDelegate = reporting::ReportScheduler::TimerDelegate;
+    using StepCallback  = void (*)(EndpointId endpoint);
+
+    class Transition : public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
+    {
+    public:
+        bool IsScheduled() const { return IsInList(); }
+
+    private:
+        friend class TransitionEngine;
+
+        StepCallback mCallback = nullptr;
+        EndpointId mEndpoint   = kInvalidEndpointId;
+        System::Clock::Timestamp mStepTime;
+    };
+
+    struct Stats
+    {
+        uint32_t mTickCount = 0; ///< Timer events
+        uint32_t mStepCount = 0; ///< Steps run from these events
+    };
+
+    // Passed-in timer delegate must outlive this object.
+    TransitionEngine(TimerDelegate & timerDelegate, System::Clock::Milliseconds32 tick) :
+        mTimerDelegate(timerDelegate), mTick(tick)
+    {}
+    explicit TransitionEngine(TimerDelegate & timerDelegate) :
+        TransitionEngine(timerDelegate, System::Clock::Milliseconds32(CHIP_CONFIG_TRANSITION_ENGINE_TICK_MS))
+    {}
+    ~TransitionEngine();
+
+    /// @brief Engine shared by the clusters, driven by the system layer of the interaction model engine
+    static TransitionEngine & Instance();
+
+    /**
+     * Cancel the timer and every scheduled step. Must be called while the system layer driving the
+     * timer is still running: the destructor leaves the timer alone.
+     */
+    void Shutdown();
+
+    /**
+     * Schedule the next step of a transition, replacing its scheduled step if
+     * any. The callback is called with the endpoint once the delay, rounded to
+     * the nearest point of the tick grid, elapses. A step without delay is run
+     * from the next timer event, without rounding.
+     */
+    void ScheduleStep(Transition & transition, StepCallback callback, EndpointId endpoint, System::Clock::Milliseconds32 delay);
+
+    /// @brief Cancel the scheduled step of a transition, if any
+    void CancelStep(Transition & transition);
+
+    const Stats & GetStats() const { return mStats; }
+
+private:
+    using TransitionList = IntrusiveList<Transition, IntrusiveMode::AutoUnlink>;
+
+    void UnlinkAll();
+    System::Clock::Timestamp GetStepTime(System::Clock::Timestamp now, System::Clock::Milliseconds32 delay) const;
+    void StartTimer();
+    void TimerFired() override;
+
+    TimerDelegate & mTimerDelegate;
+    const System::Clock::Milliseconds32 mTick;
+
+    TransitionList mScheduled;
+    // When the timer fires, valid while it is active
+    System::Clock::Timestamp mTimerTime;
+    bool mRunningSteps = false;
+    Stats mStats;
+};
+
+} // namespace app
+} // namespace chip
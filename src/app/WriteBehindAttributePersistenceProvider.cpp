@@ -0,0 +1,180 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/WriteBehindAttributePersistenceProvider.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace chip {
+namespace app {
+
+WriteBehindAttributePersistenceProvider::~WriteBehindAttributePersistenceProvider()
+{
+    // Dirty values not flushed by the owner are lost. The timer is left alone: static instances are destroyed after the
+    // system layer the timer delegate relies on, and Shutdown() already cancelled it.
+    mDirtyAttributes.ReleaseAll();
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue)
+{
+    mStats.mWriteCount++;
+
+    DirtyAttribute * attribute = FindDirtyAttribute(aPath);
+    if (attribute != nullptr)
+    {
+        mStats.mCoalescedCount++;
+    }
+    else
+    {
+        // Pools may be allocated from the heap, in which case the capacity is not enforced by the pool itself
+        attribute = (mDirtyAttributes.Allocated() < kCapacity) ? mDirtyAttributes.CreateObject(aPath) : nullptr;
+        if (attribute == nullptr)
+        {
+            mStats.mWriteThroughCount++;
+            return mPersister.WriteValue(aPath, aValue);
+        }
+    }
+
+    if (attribute->mValue.AllocatedSize() != aValue.size())
+    {
+        // The pending value is only replaced once the buffer of the new one is allocated
+        Platform::ScopedMemoryBufferWithSize<uint8_t> value;
+        value.Alloc(aValue.size());
+        if (!value)
+        {
+            // Write the new value through instead: the pending value is dropped once superseded in storage, or if there was none
+            mStats.mWriteThroughCount++;
+            CHIP_ERROR err = mPersister.WriteValue(aPath, aValue);
+            if (err == CHIP_NO_ERROR || !attribute->mValue)
+            {
+                mDirtyAttributes.ReleaseObject(attribute);
+            }
+            return err;
+        }
+        attribute->mValue = std::move(value);
+    }
+
+    memcpy(attribute->mValue.Get(), aValue.data(), aValue.size());
+
+    return ScheduleFlush();
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath,
+                                                              const EmberAfAttributeMetadata * aMetadata, MutableByteSpan & aValue)
+{
+    const DirtyAttribute * attribute = FindDirtyAttribute(aPath);
+    if (attribute == nullptr)
+    {
+        return mPersister.ReadValue(aPath, aMetadata, aValue);
+    }
+
+    ReturnErrorCodeIf(attribute->mValue.AllocatedSize() > aValue.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+    memcpy(aValue.data(), attribute->mValue.Get(), attribute->mValue.AllocatedSize());
+    aValue.reduce_size(attribute->mValue.AllocatedSize());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::Flush()
+{
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+
+    VerifyOrReturnError(HasDirtyValues(), CHIP_NO_ERROR);
+
+    mDirtyAttributes.ForEachActiveObject([&](DirtyAttribute * attribute) {
+        const ByteSpan value(attribute->mValue.Get(), attribute->mValue.AllocatedSize());
+        CHIP_ERROR err = mPersister.WriteValue(attribute->mPath, value);
+        if (err == CHIP_NO_ERROR)
+        {
+            mStats.mFlushedCount++;
+            mDirtyAttributes.ReleaseObject(attribute);
+        }
+        else if (firstError == CHIP_NO_ERROR)
+        {
+            firstError = err;
+        }
+        return Loop::Continue;
+    });
+
+    mStats.mFlushCount++;
+    mLastFlushTime.SetValue(mTimerDelegate.GetCurrentMonotonicTimestamp());
+
+    mTimerDelegate.CancelTimer(this);
+    if (HasDirtyValues())
+    {
+        ReturnErrorOnFailure(ScheduleFlush());
+    }
+
+    return firstError;
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::Shutdown()
+{
+    CHIP_ERROR err = Flush();
+
+    mTimerDelegate.CancelTimer(this);
+    mDirtyAttributes.ReleaseAll();
+
+    return err;
+}
+
+WriteBehindAttributePersistenceProvider::DirtyAttribute *
+WriteBehindAttributePersistenceProvider::FindDirtyAttribute(const ConcreteAttributePath & aPath)
+{
+    DirtyAttribute * found = nullptr;
+
+    mDirtyAttributes.ForEachActiveObject([&](DirtyAttribute * attribute) {
+        if (attribute->mPath == aPath)
+        {
+            found = attribute;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+
+    return found;
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::ScheduleFlush()
+{
+    // The flush of the current batch was scheduled when its first value was written
+    VerifyOrReturnError(!mTimerDelegate.IsTimerActive(this), CHIP_NO_ERROR);
+
+    const System::Clock::Timestamp now = mTimerDelegate.GetCurrentMonotonicTimestamp();
+    System::Clock::Timestamp flushTime = now + mConfig.mFlushDelay;
+
+    if (mLastFlushTime.HasValue())
+    {
+        flushTime = std::max(flushTime, mLastFlushTime.Value() + mConfig.mMinFlushInterval);
+    }
+
+    return mTimerDelegate.StartTimer(this, flushTime - now);
+}
+
+void WriteBehindAttributePersistenceProvider::TimerFired()
+{
+    CHIP_ERROR err = Flush();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to flush attribute values: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,143 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributePersistenceProvider.h>
+#include <app/reporting/ReportScheduler.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Decorator class for the AttributePersistenceProvider implementation that
+ * keeps written attribute values in RAM and writes them behind, in batches.
+ *
+ * Unlike DeferredAttributePersistenceProvider, every attribute is covered.
+ * Only the last value written to an attribute is kept, so an attribute that
+ * changes many times between two flushes, such as the CurrentHue attribute
+ * of the ColorControl cluster during a transition, costs a single write.
+ *
+ * Dirty values are flushed at most FlushDelay after the oldest of them was
+ * written, and flushes are at least MinFlushInterval apart, which bounds the
+ * write rate of the decorated persister to the capacity of this provider per
+ * interval. Values that do not fit in the provider, or that no memory could be
+ * allocated for, are written through.
+ *
+ * Flush() writes the dirty values immediately, and should be called from
+ * power-fail hooks. Shutdown() must be called before the timer delegate stops
+ * working, e.g. from the shutdown of the application: the destructor does not
+ * cancel the flush timer.
+ */
+class WriteBehindAttributePersistenceProvider : public AttributePersistenceProvider, private reporting::TimerContext
+{
+public:
+    using TimerDelegate = reporting::ReportScheduler::TimerDelegate;
+
+    static constexpr size_t kCapacity = CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_CAPACITY;
+
+    struct Config
+    {
+        System::Clock::Milliseconds32 mFlushDelay{ CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_FLUSH_DELAY_MS };
+        System::Clock::Milliseconds32 mMinFlushInterval{ CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_MIN_FLUSH_INTERVAL_MS };
+    };
+
+    struct Stats
+    {
+        uint32_t mWriteCount        = 0; ///< Values written to this provider
+        uint32_t mCoalescedCount    = 0; ///< Values replacing a dirty value of the same attribute
+        uint32_t mWriteThroughCount = 0; ///< Values written through because the provider was full or out of memory
+        uint32_t mFlushedCount      = 0; ///< Dirty values written to the decorated persister
+        uint32_t mFlushCount        = 0; ///< Batches flushed
+    };
+
+    // Passed-in persister and timer delegate must outlive this object.
+    WriteBehindAttributePersistenceProvider(AttributePersistenceProvider & persister, TimerDelegate & timerDelegate,
+                                            const Config & config) :
+        mPersister(persister),
+        mTimerDelegate(timerDelegate), mConfig(config)
+    {}
+    WriteBehindAttributePersistenceProvider(AttributePersistenceProvider & persister, TimerDelegate & timerDelegate) :
+        WriteBehindAttributePersistenceProvider(persister, timerDelegate, Config())
+    {}
+    ~WriteBehindAttributePersistenceProvider() override;
+
+    /*
+     * Keep the value in RAM until the next flush, replacing the dirty value
+     * of the attribute if any, and schedule a flush if none is.
+     */
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override;
+
+    /*
+     * Read the dirty value of the attribute if any, or else read the value from
+     * the decorated persister.
+     */
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override;
+
+    /**
+     * Write every dirty value to the decorated persister now, ignoring the
+     * minimum flush interval.
+     *
+     * Values that fail to be written stay dirty, and are written again by
+     * the next flush.
+     *
+     * @return the first error returned by the decorated persister, if any.
+     */
+    CHIP_ERROR Flush();
+
+    /**
+     * Flush the dirty values and stop the flush timer.
+     *
+     * Values that fail to be written are dropped. Values written afterwards
+     * are kept and flushed as usual.
+     *
+     * @return the first error returned by the decorated persister, if any.
+     */
+    CHIP_ERROR Shutdown();
+
+    bool HasDirtyValues() const { return mDirtyAttributes.Allocated() > 0; }
+    const Stats & GetStats() const { return mStats; }
+
+private:
+    struct DirtyAttribute
+    {
+        explicit DirtyAttribute(const ConcreteAttributePath & path) : mPath(path) {}
+
+        const ConcreteAttributePath mPath;
+        Platform::ScopedMemoryBufferWithSize<uint8_t> mValue;
+    };
+
+    DirtyAttribute * FindDirtyAttribute(const ConcreteAttributePath & aPath);
+    CHIP_ERROR ScheduleFlush();
+    void TimerFired() override;
+
+    AttributePersistenceProvider & mPersister;
+    TimerDelegate & mTimerDelegate;
+    const Config mConfig;
+
+    ObjectPool<DirtyAttribute, kCapacity> mDirtyAttributes;
+    // When the last batch was flushed, if any was
+    Optional<System::Clock::Timestamp> mLastFlushTime;
+    Stats mStats;
+};
+
+} // namespace app
+} // namespace chip
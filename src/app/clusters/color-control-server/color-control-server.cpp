@@ -391,25 +391,24 @@ static DefaultColorControlSceneHandler sColorControlSceneHandler;
  * Matter timer scheduling glue logic
  *********************************************************/
 
-void ColorControlServer::timerCallback(System::Layer *, void * callbackContext)
+void ColorControlServer::timerCallback(EndpointId endpoint)
 {
-    auto control = static_cast<EmberEventControl *>(callbackContext);
+    auto control = ColorControlServer::Instance().getEventControl(endpoint);
+    VerifyOrReturn(control != nullptr);
     (control->callback)(control->endpoint);
 }
 
 void ColorControlServer::scheduleTimerCallbackMs(EmberEventControl * control, uint32_t delayMs)
 {
-    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback, control);
-
-    if (err != CHIP_NO_ERROR)
-    {
-        ChipLogError(Zcl, "Color Control Server failed to schedule event: %" CHIP_ERROR_FORMAT, err.Format());
-    }
+    // Steps of every endpoint are run from the timer of the shared transition engine
+    const size_t index = static_cast<size_t>(control - eventControls);
+    TransitionEngine::Instance().ScheduleStep(transitions[index], timerCallback, control->endpoint,
+                                              chip::System::Clock::Milliseconds32(delayMs));
 }
 
 void ColorControlServer::cancelEndpointTimerCallback(EmberEventControl * control)
 {
-    DeviceLayer::SystemLayer().CancelTimer(timerCallback, control);
+    TransitionEngine::Instance().CancelStep(transitions[static_cast<size_t>(control - eventControls)]);
 }
 
 void ColorControlServer::cancelEndpointTimerCallback(EndpointId endpoint)
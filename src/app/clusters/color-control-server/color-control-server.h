@@ -20,6 +20,7 @@
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
+#include <app/TransitionEngine.h>
 #include <app/cluster-building-blocks/QuieterReporting.h>
 #include <app/data-model/Nullable.h>
 #include <app/util/af-types.h>
@@ -225,7 +226,7 @@ private:
     bool computeNewColor16uValue(Color16uTransitionState * p);
 
     // Matter timer scheduling glue logic
-    static void timerCallback(chip::System::Layer *, void * callbackContext);
+    static void timerCallback(chip::EndpointId endpoint);
     void scheduleTimerCallbackMs(EmberEventControl * control, uint32_t delayMs);
     void cancelEndpointTimerCallback(EmberEventControl * control);
     uint16_t getEndpointIndex(chip::EndpointId);
@@ -305,6 +306,7 @@ private:
 #endif // MATTER_DM_PLUGIN_COLOR_CONTROL_SERVER_TEMP
 
     EmberEventControl eventControls[kColorControlClusterServerMaxEndpointCount];
+    chip::app::TransitionEngine::Transition transitions[kColorControlClusterServerMaxEndpointCount];
     chip::app::QuieterReportingAttribute<uint16_t> quietRemainingTime[kColorControlClusterServerMaxEndpointCount];
 
 #ifdef MATTER_DM_PLUGIN_SCENES_MANAGEMENT
@@ -278,7 +278,6 @@ Status ICDManagementServer::RegisterClient(CommandHandler * commandObj, const Co
     // Check if client is admin
     VerifyOrReturnError(CHIP_NO_ERROR == CheckAdmin(commandObj, commandPath, isClientAdmin), Status::Failure);
 
-    bool isFirstEntryForFabric = false;
     ICDMonitoringTable table(*mStorage, fabricIndex, mICDConfigurationData->GetClientsSupportedPerFabric(), mSymmetricKeystore);
 
     // Get current entry, if exists
@@ -297,9 +296,6 @@ Status ICDManagementServer::RegisterClient(CommandHandler * commandObj, const Co
     {
         // New entry
         VerifyOrReturnError(entry.index < table.Limit(), Status::ResourceExhausted);
-
-        // Check if it's going to be the first entry for fabric
-        isFirstEntryForFabric = table.IsEmpty();
     }
     else
     {
@@ -331,11 +327,8 @@ Status ICDManagementServer::RegisterClient(CommandHandler * commandObj, const Co
     VerifyOrReturnError(CHIP_ERROR_INVALID_ARGUMENT != err, Status::ConstraintError);
     VerifyOrReturnError(CHIP_NO_ERROR == err, Status::Failure);
 
-    if (isFirstEntryForFabric)
-    {
-        // Notify subscribers that the first entry for the fabric was successfully added
-        TriggerICDMTableUpdatedEvent();
-    }
+    // Notify subscribers that an entry was successfully added or updated, the ICDManager caches the registrations
+    TriggerICDMTableUpdatedEvent();
 
     icdCounter = mICDConfigurationData->GetICDCounter().GetValue();
     return Status::Success;
@@ -370,10 +363,7 @@ Status ICDManagementServer::UnregisterClient(CommandHandler * commandObj, const
     err = table.Remove(entry.index);
     VerifyOrReturnError(CHIP_NO_ERROR == err, Status::Failure);
 
-    if (table.IsEmpty())
-    {
-        TriggerICDMTableUpdatedEvent();
-    }
+    TriggerICDMTableUpdatedEvent();
 
     return Status::Success;
 }
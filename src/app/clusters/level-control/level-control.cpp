@@ -25,6 +25,7 @@
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
+#include <app/TransitionEngine.h>
 #include <app/cluster-building-blocks/QuieterReporting.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/config.h>
@@ -100,6 +101,7 @@ struct EmberAfLevelControlState
     uint32_t transitionTimeMs;
     uint32_t elapsedTimeMs;
     CallbackScheduleState callbackSchedule;
+    TransitionEngine::Transition transition;
     QuieterReportingAttribute<uint8_t> quietCurrentLevel{ DataModel::NullNullable };
     QuieterReportingAttribute<uint16_t> quietRemainingTime{ DataModel::MakeNullable<uint16_t>(0) };
 };
@@ -277,11 +279,6 @@ static void reallyUpdateCoupledColorTemp(EndpointId endpoint);
 
 void emberAfLevelControlClusterServerTickCallback(EndpointId endpoint);
 
-static void timerCallback(System::Layer *, void * callbackContext)
-{
-    emberAfLevelControlClusterServerTickCallback(static_cast<EndpointId>(reinterpret_cast<uintptr_t>(callbackContext)));
-}
-
 static uint32_t computeCallbackWaitTimeMs(CallbackScheduleState & callbackSchedule, uint32_t delayMs)
 {
     auto delay             = System::Clock::Milliseconds32(delayMs);
@@ -324,18 +321,20 @@ static uint32_t computeCallbackWaitTimeMs(CallbackScheduleState & callbackSchedu
 
 static void scheduleTimerCallbackMs(EndpointId endpoint, uint32_t delayMs)
 {
-    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback,
-                                                           reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+    EmberAfLevelControlState * state = getState(endpoint);
+    VerifyOrReturn(state != nullptr);
 
-    if (err != CHIP_NO_ERROR)
-    {
-        ChipLogError(Zcl, "Level Control Server failed to schedule event: %" CHIP_ERROR_FORMAT, err.Format());
-    }
+    // Steps of every endpoint are run from the timer of the shared transition engine
+    TransitionEngine::Instance().ScheduleStep(state->transition, emberAfLevelControlClusterServerTickCallback, endpoint,
+                                              chip::System::Clock::Milliseconds32(delayMs));
 }
 
 static void cancelEndpointTimerCallback(EndpointId endpoint)
 {
-    DeviceLayer::SystemLayer().CancelTimer(timerCallback, reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+    EmberAfLevelControlState * state = getState(endpoint);
+    VerifyOrReturn(state != nullptr);
+
+    TransitionEngine::Instance().CancelStep(state->transition);
 }
 
 static EmberAfLevelControlState * getState(EndpointId endpoint)
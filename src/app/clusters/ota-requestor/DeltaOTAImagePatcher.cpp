@@ -0,0 +1,234 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "DeltaOTAImagePatcher.h"
+
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+
+namespace {
+
+enum ControlField : uint8_t
+{
+    kDiffLength,
+    kExtraLength,
+    kSeek,
+};
+
+enum DiffRunField : uint8_t
+{
+    kZeroCount,
+    kLiteralCount,
+};
+
+} // namespace
+
+void DeltaOTAImagePatcher::Init(OTABaseImage * baseImage, uint64_t imageSize)
+{
+    *this      = DeltaOTAImagePatcher();
+    mBaseImage = baseImage;
+    mImageSize = imageSize;
+}
+
+CHIP_ERROR DeltaOTAImagePatcher::Apply(ByteSpan & patch, MutableByteSpan & output)
+{
+    VerifyOrReturnError(mBaseImage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    size_t written  = 0;
+    bool needsPatch = false;
+
+    while (!IsComplete() && written < output.size() && !needsPatch)
+    {
+        uint8_t * out     = output.data() + written;
+        const size_t room = output.size() - written;
+        size_t length     = 0;
+        bool done         = false;
+
+        switch (mState)
+        {
+        case State::kControl:
+            ReturnErrorOnFailure(ReadVarint(patch, done));
+            needsPatch = !done;
+            if (done)
+            {
+                ReturnErrorOnFailure(EndControlField());
+            }
+            break;
+        case State::kDiffRun:
+            ReturnErrorOnFailure(ReadVarint(patch, done));
+            needsPatch = !done;
+            if (done)
+            {
+                ReturnErrorOnFailure(EndDiffRunField());
+            }
+            break;
+        case State::kDiffZeros:
+            // Zero patch bytes: the image data is the base data
+            length = static_cast<size_t>(std::min<uint64_t>(mZeroCount, room));
+            ReturnErrorOnFailure(ReadBase(MutableByteSpan(out, length)));
+            mZeroCount -= length;
+            if (mZeroCount == 0)
+            {
+                mState = State::kDiffLiterals;
+            }
+            break;
+        case State::kDiffLiterals:
+            if (mLiteralCount == 0)
+            {
+                mState = (mDiffLength > 0) ? State::kDiffRun : State::kExtra;
+                break;
+            }
+            needsPatch = patch.empty();
+            length     = static_cast<size_t>(std::min<uint64_t>(std::min<uint64_t>(mLiteralCount, room), patch.size()));
+            ReturnErrorOnFailure(ReadBase(MutableByteSpan(out, length)));
+            for (size_t i = 0; i < length; i++)
+            {
+                out[i] = static_cast<uint8_t>(out[i] + patch[i]);
+            }
+            patch = patch.SubSpan(length);
+            mLiteralCount -= length;
+            break;
+        case State::kExtra:
+            if (mExtraLength == 0)
+            {
+                ReturnErrorOnFailure(EndEntry());
+                break;
+            }
+            needsPatch = patch.empty();
+            length     = static_cast<size_t>(std::min<uint64_t>(std::min<uint64_t>(mExtraLength, room), patch.size()));
+            memcpy(out, patch.data(), length);
+            patch = patch.SubSpan(length);
+            mExtraLength -= length;
+            break;
+        }
+
+        written += length;
+        mImageOffset += length;
+    }
+
+    output.reduce_size(written);
+
+    // The patch ends with the last byte of the image
+    VerifyOrReturnError(!IsComplete() || patch.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DeltaOTAImagePatcher::ReadVarint(ByteSpan & patch, bool & done)
+{
+    done = false;
+
+    while (!patch.empty() && !done)
+    {
+        const uint8_t byte = patch[0];
+        patch              = patch.SubSpan(1);
+
+        VerifyOrReturnError(mVarintShift < 64, CHIP_ERROR_INVALID_ARGUMENT);
+        mVarint |= static_cast<uint64_t>(byte & 0x7F) << mVarintShift;
+        mVarintShift = static_cast<uint8_t>(mVarintShift + 7);
+        done         = (byte & 0x80) == 0;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DeltaOTAImagePatcher::ReadBase(MutableByteSpan buffer)
+{
+    const uint64_t baseSize = mBaseImage->GetSize();
+    VerifyOrReturnError(mBaseOffset <= baseSize && buffer.size() <= baseSize - mBaseOffset, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(mBaseImage->Read(mBaseOffset, buffer));
+    mBaseOffset += buffer.size();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DeltaOTAImagePatcher::EndControlField()
+{
+    const uint64_t value = mVarint;
+    mVarint              = 0;
+    mVarintShift         = 0;
+
+    switch (mField++)
+    {
+    case kDiffLength:
+        mDiffLength = value;
+        return CHIP_NO_ERROR;
+    case kExtraLength:
+        mExtraLength = value;
+        return CHIP_NO_ERROR;
+    default:
+        mSeek  = static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        mField = 0;
+        break;
+    }
+
+    const uint64_t remaining = mImageSize - mImageOffset;
+    VerifyOrReturnError(mDiffLength <= remaining && mExtraLength <= remaining - mDiffLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mState = (mDiffLength > 0) ? State::kDiffRun : State::kExtra;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DeltaOTAImagePatcher::EndDiffRunField()
+{
+    const uint64_t value = mVarint;
+    mVarint              = 0;
+    mVarintShift         = 0;
+
+    if (mField++ == kZeroCount)
+    {
+        mZeroCount = value;
+        return CHIP_NO_ERROR;
+    }
+
+    mLiteralCount = value;
+    mField        = 0;
+
+    VerifyOrReturnError(mZeroCount + mLiteralCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mZeroCount <= mDiffLength && mLiteralCount <= mDiffLength - mZeroCount, CHIP_ERROR_INVALID_ARGUMENT);
+    mDiffLength -= mZeroCount + mLiteralCount;
+
+    mState = State::kDiffZeros;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DeltaOTAImagePatcher::EndEntry()
+{
+    const uint64_t baseSize = mBaseImage->GetSize();
+    const uint64_t distance = (mSeek < 0) ? static_cast<uint64_t>(-(mSeek + 1)) + 1 : static_cast<uint64_t>(mSeek);
+
+    if (mSeek < 0)
+    {
+        VerifyOrReturnError(distance <= mBaseOffset, CHIP_ERROR_INVALID_ARGUMENT);
+        mBaseOffset -= distance;
+    }
+    else
+    {
+        VerifyOrReturnError(mBaseOffset <= baseSize && distance <= baseSize - mBaseOffset, CHIP_ERROR_INVALID_ARGUMENT);
+        mBaseOffset += distance;
+    }
+
+    mState = State::kControl;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace chip
@@ -0,0 +1,112 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+#include <cstdint>
+
+namespace chip {
+
+/**
+ * Read access to the image a delta image applies to, usually the running one.
+ */
+class OTABaseImage
+{
+public:
+    virtual ~OTABaseImage() = default;
+
+    /// Software version of the image
+    virtual uint32_t GetSoftwareVersion() = 0;
+
+    /// Size of the image
+    virtual uint64_t GetSize() = 0;
+
+    /// Read buffer.size() bytes of the image, starting at offset
+    virtual CHIP_ERROR Read(uint64_t offset, MutableByteSpan buffer) = 0;
+};
+
+/**
+ * Rebuilds an image from a base image and the patch payload of a delta image, as the patch streams in.
+ *
+ * The patch is a bsdiff-style sequence of entries, each made of:
+ *   - a control tuple of three LEB128 varints: diff length, extra length and base seek (zigzag-encoded),
+ *   - the diff: diff length bytes, each the sum of a base byte and a patch byte. The patch bytes are
+ *     run-length encoded as pairs of varints (number of zero bytes, number of literal bytes), each
+ *     followed by the literal bytes,
+ *   - the extra: extra length bytes copied from the patch.
+ *
+ * The diff reads the base image from the base offset, which starts at 0 and advances with the diff.
+ * The seek is then added to the base offset. The patch ends with the last byte of the image.
+ */
+class DeltaOTAImagePatcher
+{
+public:
+    void Init(OTABaseImage * baseImage, uint64_t imageSize);
+
+    /**
+     * @brief Consume patch data and write the rebuilt image data it produces.
+     *
+     * @param patch   Patch data. On return, the part of the data that was not consumed because the
+     *                output is full.
+     * @param output  Buffer to write image data to. On return, the image data that was written.
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT  The patch is malformed or does not fit the base image.
+     */
+    CHIP_ERROR Apply(ByteSpan & patch, MutableByteSpan & output);
+
+    bool IsComplete() const { return mImageOffset == mImageSize; }
+
+private:
+    enum class State : uint8_t
+    {
+        kControl,
+        kDiffRun,
+        kDiffZeros,
+        kDiffLiterals,
+        kExtra,
+    };
+
+    CHIP_ERROR ReadVarint(ByteSpan & patch, bool & done);
+    CHIP_ERROR ReadBase(MutableByteSpan buffer);
+    CHIP_ERROR EndControlField();
+    CHIP_ERROR EndDiffRunField();
+    CHIP_ERROR EndEntry();
+
+    OTABaseImage * mBaseImage = nullptr;
+    uint64_t mImageSize       = 0;
+    uint64_t mImageOffset     = 0;
+    uint64_t mBaseOffset      = 0;
+
+    State mState = State::kControl;
+
+    // Varint being decoded, and index of the field it belongs to within a control tuple or diff run
+    uint64_t mVarint     = 0;
+    uint8_t mVarintShift = 0;
+    uint8_t mField       = 0;
+
+    uint64_t mDiffLength   = 0;
+    uint64_t mExtraLength  = 0;
+    int64_t mSeek          = 0;
+    uint64_t mZeroCount    = 0;
+    uint64_t mLiteralCount = 0;
+};
+
+} // namespace chip
@@ -0,0 +1,280 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "DeltaOTAImageProcessor.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <inttypes.h>
+#include <string.h>
+
+namespace chip {
+
+CHIP_ERROR DeltaOTAImageProcessor::ImageProcessorDownloader::SkipData(uint32_t numBytes)
+{
+    // Offsets of the rebuilt image do not map to offsets of the downloaded one
+    VerifyOrReturnError(mOwner.mMode == Mode::kPassThrough, CHIP_ERROR_NOT_IMPLEMENTED);
+    return mOwner.mDownloader->SkipData(numBytes);
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::PrepareDownload()
+{
+    VerifyOrReturnError(mImageProcessor != nullptr && mBaseImage != nullptr && mDownloader != nullptr,
+                        CHIP_ERROR_INCORRECT_STATE);
+
+    Reset();
+    mHeaderParser.Init(/* acceptDeltaImages = */ true);
+
+    return mImageProcessor->PrepareDownload();
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::Finalize()
+{
+    switch (mMode)
+    {
+    case Mode::kHeader:
+        // The image is shorter than its header, which the decorated image processor reports
+        mMode = Mode::kPassThrough;
+        ReturnErrorOnFailure(PassThroughInput());
+        return mImageProcessor->Finalize();
+    case Mode::kPassThrough:
+        return mImageProcessor->Finalize();
+    case Mode::kDelta:
+        // The decorated image processor is finalized once it has processed all the rebuilt image data
+        mFinalizePending = true;
+        if (mAwaitingInput)
+        {
+            ProcessDelta();
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    return CHIP_ERROR_INCORRECT_STATE;
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::Apply()
+{
+    return mImageProcessor->Apply();
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::Abort()
+{
+    Reset();
+    return mImageProcessor->Abort();
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::ProcessBlock(ByteSpan & block)
+{
+    if (mMode == Mode::kPassThrough)
+    {
+        return mImageProcessor->ProcessBlock(block);
+    }
+
+    // The block is only valid for the duration of the call, while the decorated image processor may
+    // take several calls to process the data it produces.
+    ReturnErrorOnFailure(AppendInput(block));
+    mAwaitingInput = false;
+    mParams.downloadedBytes += block.size();
+
+    if (mMode == Mode::kHeader)
+    {
+        return ProcessHeader(block);
+    }
+
+    ProcessDelta();
+    return CHIP_NO_ERROR;
+}
+
+app::DataModel::Nullable<uint8_t> DeltaOTAImageProcessor::GetPercentComplete()
+{
+    return (mMode == Mode::kPassThrough) ? mImageProcessor->GetPercentComplete()
+                                         : OTAImageProcessorInterface::GetPercentComplete();
+}
+
+uint64_t DeltaOTAImageProcessor::GetBytesDownloaded()
+{
+    return (mMode == Mode::kPassThrough) ? mImageProcessor->GetBytesDownloaded() : OTAImageProcessorInterface::GetBytesDownloaded();
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::FetchNextData()
+{
+    switch (mMode)
+    {
+    case Mode::kPassThrough:
+        return mDownloader->FetchNextData();
+    case Mode::kDelta:
+        ProcessDelta();
+        return CHIP_NO_ERROR;
+    default:
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::AppendInput(ByteSpan block)
+{
+    const size_t pendingSize = mInputSize - mInputOffset;
+
+    if (pendingSize == 0)
+    {
+        VerifyOrReturnError(mInput.Alloc(block.size()), CHIP_ERROR_NO_MEMORY);
+        memcpy(mInput.Get(), block.data(), block.size());
+    }
+    else
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> input;
+        VerifyOrReturnError(input.Alloc(pendingSize + block.size()), CHIP_ERROR_NO_MEMORY);
+        memcpy(input.Get(), mInput.Get() + mInputOffset, pendingSize);
+        memcpy(input.Get() + pendingSize, block.data(), block.size());
+        mInput = std::move(input);
+    }
+
+    mInputSize   = pendingSize + block.size();
+    mInputOffset = 0;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::ProcessHeader(ByteSpan & block)
+{
+    OTAImageHeader header;
+    ByteSpan remaining = block;
+    CHIP_ERROR error   = mHeaderParser.AccumulateAndDecode(remaining, header);
+
+    if (error == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        mAwaitingInput = true;
+        return mDownloader->FetchNextData();
+    }
+
+    if (error != CHIP_NO_ERROR || !header.mDelta.HasValue())
+    {
+        // A full image, or an invalid header which the decorated image processor reports
+        mHeaderParser.Clear();
+        mMode = Mode::kPassThrough;
+        return PassThroughInput();
+    }
+
+    // The rebuilt image comes with a header of its own
+    ByteSpan imageHeader;
+    mInputOffset = mInputSize - remaining.size();
+    error        = StartDelta(header, imageHeader);
+    mHeaderParser.Clear();
+
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot apply delta image: %" CHIP_ERROR_FORMAT, error.Format());
+        mDownloader->EndDownload(error);
+        return CHIP_NO_ERROR;
+    }
+
+    mMode = Mode::kDelta;
+    return mImageProcessor->ProcessBlock(imageHeader);
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::StartDelta(const OTAImageHeader & header, ByteSpan & imageHeader)
+{
+    const OTAImageDeltaHeader & delta = header.mDelta.Value();
+    const uint32_t baseVersion        = mBaseImage->GetSoftwareVersion();
+
+    VerifyOrReturnError(delta.mBaseSoftwareVersion == baseVersion, CHIP_ERROR_INVALID_FILE_IDENTIFIER,
+                        ChipLogError(SoftwareUpdate, "Delta image applies to version %" PRIu32 ", not %" PRIu32,
+                                     delta.mBaseSoftwareVersion, baseVersion));
+
+    OTAImageHeader fullHeader = header;
+    fullHeader.mPayloadSize   = delta.mImageSize;
+    fullHeader.mImageDigest   = delta.mImageDigest;
+    fullHeader.mDelta.ClearValue();
+
+    VerifyOrReturnError(mOutput.Alloc(kOutputBlockSize), CHIP_ERROR_NO_MEMORY);
+    MutableByteSpan output(mOutput.Get(), kOutputBlockSize);
+    ReturnErrorOnFailure(EncodeOTAImageHeader(fullHeader, output));
+    imageHeader = output;
+
+    mPatcher.Init(mBaseImage, delta.mImageSize);
+    mParams.totalFileBytes  = header.mPayloadSize;
+    mParams.downloadedBytes = mInputSize - mInputOffset;
+
+    ChipLogProgress(SoftwareUpdate, "Rebuilding a %" PRIu64 "-byte image from a %" PRIu64 "-byte delta image", delta.mImageSize,
+                    header.mPayloadSize);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::PassThroughInput()
+{
+    ByteSpan input(mInput.Get(), mInputSize);
+    mInputSize   = 0;
+    mInputOffset = 0;
+
+    ReturnErrorCodeIf(input.empty(), CHIP_NO_ERROR);
+    return mImageProcessor->ProcessBlock(input);
+}
+
+void DeltaOTAImageProcessor::ProcessDelta()
+{
+    ByteSpan patch(mInput.Get() + mInputOffset, mInputSize - mInputOffset);
+    MutableByteSpan output(mOutput.Get(), kOutputBlockSize);
+
+    CHIP_ERROR error = mPatcher.Apply(patch, output);
+    mInputOffset     = mInputSize - patch.size();
+
+    if (error == CHIP_NO_ERROR && !output.empty())
+    {
+        ByteSpan block = output;
+        error          = mImageProcessor->ProcessBlock(block);
+    }
+    else if (error == CHIP_NO_ERROR && mFinalizePending)
+    {
+        error = FinishDelta();
+    }
+    else if (error == CHIP_NO_ERROR)
+    {
+        mAwaitingInput = true;
+        error          = mDownloader->FetchNextData();
+    }
+
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot apply delta image: %" CHIP_ERROR_FORMAT, error.Format());
+        mDownloader->EndDownload(error);
+    }
+}
+
+CHIP_ERROR DeltaOTAImageProcessor::FinishDelta()
+{
+    VerifyOrReturnError(mPatcher.IsComplete(), CHIP_ERROR_INVALID_ARGUMENT,
+                        ChipLogError(SoftwareUpdate, "Delta image is truncated"));
+
+    mFinalizePending = false;
+    return mImageProcessor->Finalize();
+}
+
+void DeltaOTAImageProcessor::Reset()
+{
+    mMode = Mode::kHeader;
+    mHeaderParser.Clear();
+    mInput.Free();
+    mInputSize   = 0;
+    mInputOffset = 0;
+    mOutput.Free();
+    mAwaitingInput   = false;
+    mFinalizePending = false;
+    mParams          = OTAImageProgress();
+}
+
+} // namespace chip
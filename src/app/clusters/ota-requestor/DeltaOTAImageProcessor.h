@@ -0,0 +1,135 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include "DeltaOTAImagePatcher.h"
+#include "OTADownloader.h"
+
+#include <lib/core/OTAImageHeader.h>
+#include <lib/support/ScopedBuffer.h>
+#include <platform/OTAImageProcessor.h>
+
+namespace chip {
+
+/**
+ * Image processor decorator adding support for delta images.
+ *
+ * Full images are passed through to the decorated image processor unchanged. The patch of a delta image
+ * is applied to the base image as it streams in, and the decorated image processor is given the full
+ * image it rebuilds: a header built from the delta image header, with the size and digest of the rebuilt
+ * image, followed by the rebuilt image. The decorated image processor therefore verifies and stores the
+ * rebuilt image exactly as it would a downloaded one.
+ *
+ * The decorated image processor must be given GetImageProcessorDownloader() as its downloader, to pace
+ * the rebuilt image data, which is larger than the downloaded data, to its processing of blocks:
+ *
+ *     imageProcessor.SetOTADownloader(deltaImageProcessor.GetImageProcessorDownloader());
+ *     deltaImageProcessor.Init(&imageProcessor, &baseImage);
+ *     deltaImageProcessor.SetOTADownloader(&downloader);
+ *     downloader.SetImageProcessorDelegate(&deltaImageProcessor);
+ */
+class DeltaOTAImageProcessor : public OTAImageProcessorInterface
+{
+public:
+    /// Size of the blocks of rebuilt image data given to the decorated image processor
+    static constexpr size_t kOutputBlockSize = 1024;
+
+    DeltaOTAImageProcessor() : mImageProcessorDownloader(*this) {}
+
+    void Init(OTAImageProcessorInterface * imageProcessor, OTABaseImage * baseImage)
+    {
+        mImageProcessor = imageProcessor;
+        mBaseImage      = baseImage;
+    }
+
+    void SetOTADownloader(OTADownloader * downloader) { mDownloader = downloader; }
+
+    /// Downloader to give the decorated image processor in place of the actual one
+    OTADownloader * GetImageProcessorDownloader() { return &mImageProcessorDownloader; }
+
+    //////////// OTAImageProcessorInterface Implementation ///////////////
+    CHIP_ERROR PrepareDownload() override;
+    CHIP_ERROR Finalize() override;
+    CHIP_ERROR Apply() override;
+    CHIP_ERROR Abort() override;
+    CHIP_ERROR ProcessBlock(ByteSpan & block) override;
+    app::DataModel::Nullable<uint8_t> GetPercentComplete() override;
+    uint64_t GetBytesDownloaded() override;
+    bool IsFirstImageRun() override { return mImageProcessor->IsFirstImageRun(); }
+    CHIP_ERROR ConfirmCurrentImage() override { return mImageProcessor->ConfirmCurrentImage(); }
+
+private:
+    enum class Mode : uint8_t
+    {
+        kHeader,      ///< Decoding the image header
+        kPassThrough, ///< Processing a full image
+        kDelta,       ///< Processing a delta image
+    };
+
+    /**
+     * Downloader given to the decorated image processor, which forwards everything but requests for more data
+     * to the actual downloader.
+     */
+    class ImageProcessorDownloader : public OTADownloader
+    {
+    public:
+        ImageProcessorDownloader(DeltaOTAImageProcessor & owner) : mOwner(owner) {}
+
+        CHIP_ERROR BeginPrepareDownload() override { return mOwner.mDownloader->BeginPrepareDownload(); }
+        CHIP_ERROR OnPreparedForDownload(CHIP_ERROR status) override { return mOwner.mDownloader->OnPreparedForDownload(status); }
+        void OnDownloadTimeout() override { mOwner.mDownloader->OnDownloadTimeout(); }
+        void EndDownload(CHIP_ERROR reason = CHIP_NO_ERROR) override { mOwner.mDownloader->EndDownload(reason); }
+        CHIP_ERROR FetchNextData() override { return mOwner.FetchNextData(); }
+        CHIP_ERROR SkipData(uint32_t numBytes) override;
+
+    private:
+        DeltaOTAImageProcessor & mOwner;
+    };
+
+    CHIP_ERROR FetchNextData();
+    CHIP_ERROR AppendInput(ByteSpan block);
+    CHIP_ERROR ProcessHeader(ByteSpan & block);
+    CHIP_ERROR StartDelta(const OTAImageHeader & header, ByteSpan & imageHeader);
+    CHIP_ERROR PassThroughInput();
+    void ProcessDelta();
+    CHIP_ERROR FinishDelta();
+    void Reset();
+
+    OTAImageProcessorInterface * mImageProcessor = nullptr;
+    OTABaseImage * mBaseImage                    = nullptr;
+    OTADownloader * mDownloader                  = nullptr;
+    ImageProcessorDownloader mImageProcessorDownloader;
+
+    Mode mMode = Mode::kHeader;
+    OTAImageHeaderParser mHeaderParser;
+    DeltaOTAImagePatcher mPatcher;
+
+    // Downloaded data not processed yet
+    Platform::ScopedMemoryBuffer<uint8_t> mInput;
+    size_t mInputSize   = 0;
+    size_t mInputOffset = 0;
+
+    // Header of the rebuilt image, then blocks of rebuilt image data
+    Platform::ScopedMemoryBuffer<uint8_t> mOutput;
+
+    bool mAwaitingInput   = false;
+    bool mFinalizePending = false;
+};
+
+} // namespace chip
@@ -0,0 +1,136 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/clusters/scenes-server/SceneRecallScheduler.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace scenes {
+
+CHIP_ERROR SceneRecallScheduler::Init(Delegate & delegate, TimerDelegate & timerDelegate, Span<PendingRecall> pendingRecalls,
+                                      System::Clock::Milliseconds32 batchWindow)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!pendingRecalls.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mDelegate       = &delegate;
+    mTimerDelegate  = &timerDelegate;
+    mPendingRecalls = pendingRecalls;
+    mBatchWindow    = batchWindow;
+
+    for (PendingRecall & recall : mPendingRecalls)
+    {
+        recall.mEndpoint = kInvalidEndpointId;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void SceneRecallScheduler::Shutdown()
+{
+    VerifyOrReturn(IsInitialized());
+
+    mTimerDelegate->CancelTimer(this);
+    mDelegate       = nullptr;
+    mTimerDelegate  = nullptr;
+    mPendingRecalls = Span<PendingRecall>();
+}
+
+CHIP_ERROR SceneRecallScheduler::ScheduleScene(FabricIndex fabric, EndpointId endpoint, const SceneTableEntry & scene)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(kInvalidEndpointId != endpoint, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Only the last scene recalled on an endpoint is applied
+    PendingRecall * slot = nullptr;
+    for (PendingRecall & recall : mPendingRecalls)
+    {
+        if (recall.mEndpoint == endpoint)
+        {
+            slot = &recall;
+            break;
+        }
+        if (slot == nullptr && recall.mEndpoint == kInvalidEndpointId)
+        {
+            slot = &recall;
+        }
+    }
+    VerifyOrReturnError(nullptr != slot, CHIP_ERROR_NO_MEMORY);
+
+    if (!mTimerDelegate->IsTimerActive(this))
+    {
+        ReturnErrorOnFailure(mTimerDelegate->StartTimer(this, mBatchWindow));
+    }
+
+    slot->mEndpoint = endpoint;
+    slot->mFabric   = fabric;
+    slot->mScene    = scene;
+
+    return CHIP_NO_ERROR;
+}
+
+void SceneRecallScheduler::ApplyPendingScenes()
+{
+    VerifyOrReturn(IsInitialized());
+
+    mTimerDelegate->CancelTimer(this);
+
+    for (PendingRecall & recall : mPendingRecalls)
+    {
+        if (kInvalidEndpointId == recall.mEndpoint)
+        {
+            continue;
+        }
+
+        // The slot is released first, so that the delegate can schedule scenes again
+        const EndpointId endpoint = recall.mEndpoint;
+        recall.mEndpoint          = kInvalidEndpointId;
+
+        CHIP_ERROR err = mDelegate->ApplyScheduledScene(recall.mFabric, endpoint, recall.mScene);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Zcl, "Failed to apply scene 0x%02x on endpoint %u: %" CHIP_ERROR_FORMAT, recall.mScene.mStorageId.mSceneId,
+                         endpoint, err.Format());
+        }
+    }
+}
+
+void SceneRecallScheduler::CancelPendingScene(EndpointId endpoint)
+{
+    for (PendingRecall & recall : mPendingRecalls)
+    {
+        if (recall.mEndpoint == endpoint)
+        {
+            recall.mEndpoint = kInvalidEndpointId;
+        }
+    }
+}
+
+size_t SceneRecallScheduler::GetPendingSceneCount() const
+{
+    size_t count = 0;
+    for (const PendingRecall & recall : mPendingRecalls)
+    {
+        count += (kInvalidEndpointId != recall.mEndpoint) ? 1 : 0;
+    }
+    return count;
+}
+
+} // namespace scenes
+} // namespace chip
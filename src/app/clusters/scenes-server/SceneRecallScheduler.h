@@ -0,0 +1,99 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/clusters/scenes-server/ExtensionFieldSetsImpl.h>
+#include <app/clusters/scenes-server/SceneTable.h>
+#include <app/reporting/ReportScheduler.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace scenes {
+
+/**
+ * @brief Applies recalled scenes in batches, so that a scene recalled on many endpoints at once, such as by a group RecallScene
+ * command, is applied to all of them together.
+ *
+ * Recalled scenes are queued with the values of all their extension field sets already loaded from the scene table, and the queue
+ * is applied from a single timer, started by the first scene of the batch. The transitions of every endpoint therefore start from
+ * the same task instead of being staggered by the scene table accesses of the endpoints recalled before them, and the attributes
+ * they change are all marked dirty within that task, which the reporting engine handles in a single reporting run.
+ */
+class SceneRecallScheduler : private app::reporting::TimerContext
+{
+public:
+    using TimerDelegate   = app::reporting::ReportScheduler::TimerDelegate;
+    using SceneTableEntry = SceneTable<ExtensionFieldSetsImpl>::SceneTableEntry;
+
+    struct PendingRecall
+    {
+        EndpointId mEndpoint = kInvalidEndpointId;
+        FabricIndex mFabric  = kUndefinedFabricIndex;
+        SceneTableEntry mScene;
+    };
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /// @brief Applies the extension field sets of a scene recalled on an endpoint
+        virtual CHIP_ERROR ApplyScheduledScene(FabricIndex fabric, EndpointId endpoint, const SceneTableEntry & scene) = 0;
+    };
+
+    SceneRecallScheduler() = default;
+    ~SceneRecallScheduler() { Shutdown(); }
+
+    /// @brief Initializes the scheduler
+    /// @param delegate Delegate applying the scenes, must outlive the scheduler
+    /// @param timerDelegate Timer delegate, must outlive the scheduler
+    /// @param pendingRecalls Storage for the scenes of a batch, must outlive the scheduler
+    /// @param batchWindow Time during which recalled scenes are gathered before being applied
+    CHIP_ERROR Init(Delegate & delegate, TimerDelegate & timerDelegate, Span<PendingRecall> pendingRecalls,
+                    System::Clock::Milliseconds32 batchWindow);
+
+    /// @brief Drops the pending scenes and stops the scheduler
+    void Shutdown();
+
+    bool IsInitialized() const { return mDelegate != nullptr; }
+
+    /// @brief Queues a scene recalled on an endpoint, replacing the scene pending on the endpoint if any
+    /// @return CHIP_ERROR_NO_MEMORY if the batch is full, in which case the scene should be applied by the caller
+    CHIP_ERROR ScheduleScene(FabricIndex fabric, EndpointId endpoint, const SceneTableEntry & scene);
+
+    /// @brief Applies every pending scene now
+    void ApplyPendingScenes();
+
+    /// @brief Drops the scene pending on an endpoint, if any
+    void CancelPendingScene(EndpointId endpoint);
+
+    size_t GetPendingSceneCount() const;
+
+private:
+    void TimerFired() override { ApplyPendingScenes(); }
+
+    Delegate * mDelegate           = nullptr;
+    TimerDelegate * mTimerDelegate = nullptr;
+    Span<PendingRecall> mPendingRecalls;
+    System::Clock::Milliseconds32 mBatchWindow;
+};
+
+} // namespace scenes
+} // namespace chip
@@ -51,10 +51,13 @@ static constexpr size_t kPersistentBufferSceneCountBytes = 8;
 
 struct EndpointSceneCount : public PersistentData<kPersistentBufferSceneCountBytes>
 {
+    SceneTableIndex & index;
     EndpointId endpoint_id = kInvalidEndpointId;
     uint8_t count_value    = 0;
 
-    EndpointSceneCount(EndpointId endpoint, uint8_t count = 0) : endpoint_id(endpoint), count_value(count) {}
+    EndpointSceneCount(SceneTableIndex & sceneIndex, EndpointId endpoint, uint8_t count = 0) :
+        index(sceneIndex), endpoint_id(endpoint), count_value(count)
+    {}
     ~EndpointSceneCount() {}
 
     void Clear() override { count_value = 0; }
@@ -87,6 +90,9 @@ struct EndpointSceneCount : public PersistentData<kPersistentBufferSceneCountByt
 
     CHIP_ERROR Load(PersistentStorageDelegate * storage) override
     {
+        VerifyOrReturnError(nullptr != storage, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnValue(!index.FindEndpointSceneCount(endpoint_id, count_value), CHIP_NO_ERROR);
+
         CHIP_ERROR err = PersistentData::Load(storage);
         VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
         if (CHIP_ERROR_NOT_FOUND == err)
@@ -94,6 +100,21 @@ struct EndpointSceneCount : public PersistentData<kPersistentBufferSceneCountByt
             count_value = 0;
         }
 
+        index.IndexEndpointSceneCount(endpoint_id, count_value);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR Save(PersistentStorageDelegate * storage) override
+    {
+        CHIP_ERROR err = PersistentData::Save(storage);
+        if (CHIP_NO_ERROR != err)
+        {
+            // The count held in storage is unknown, it is loaded again when needed
+            index.RemoveEndpointSceneCount(endpoint_id);
+            return err;
+        }
+
+        index.IndexEndpointSceneCount(endpoint_id, count_value);
         return CHIP_NO_ERROR;
     }
 };
@@ -201,17 +222,22 @@ static constexpr size_t kPersistentFabricBufferMax = 128;
  */
 struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
 {
+    SceneTableIndex & index;
     EndpointId endpoint_id;
     FabricIndex fabric_index;
     uint8_t scene_count = 0;
     uint16_t max_scenes_per_fabric;
     uint16_t max_scenes_per_endpoint;
+    // Number of entries of the scene map held in storage
+    uint16_t map_size = 0;
     SceneStorageId scene_map[CHIP_CONFIG_MAX_SCENES_TABLE_SIZE];
 
-    FabricSceneData(EndpointId endpoint = kInvalidEndpointId, FabricIndex fabric = kUndefinedFabricIndex,
-                    uint16_t maxScenesPerFabric = kMaxScenesPerFabric, uint16_t maxScenesPerEndpoint = kMaxScenesPerEndpoint) :
-        endpoint_id(endpoint),
-        fabric_index(fabric), max_scenes_per_fabric(maxScenesPerFabric), max_scenes_per_endpoint(maxScenesPerEndpoint)
+    FabricSceneData(SceneTableIndex & sceneIndex, EndpointId endpoint = kInvalidEndpointId,
+                    FabricIndex fabric = kUndefinedFabricIndex, uint16_t maxScenesPerFabric = kMaxScenesPerFabric,
+                    uint16_t maxScenesPerEndpoint = kMaxScenesPerEndpoint) :
+        index(sceneIndex),
+        endpoint_id(endpoint), fabric_index(fabric), max_scenes_per_fabric(maxScenesPerFabric),
+        max_scenes_per_endpoint(maxScenesPerEndpoint)
     {}
 
     CHIP_ERROR UpdateKey(StorageKeyName & key) override
@@ -315,6 +341,7 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
 
         VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
         ReturnErrorOnFailure(reader.ExitContainer(sceneMapContainer));
+        map_size = min(i, max_scenes_per_fabric);
         return reader.ExitContainer(fabricSceneContainer);
     }
 
@@ -368,7 +395,7 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
         if (CHIP_ERROR_NOT_FOUND == err) // If not found, scene.index should be the first free index
         {
             // Update the global scene count
-            EndpointSceneCount endpoint_scene_count(endpoint_id);
+            EndpointSceneCount endpoint_scene_count(index, endpoint_id);
             ReturnErrorOnFailure(endpoint_scene_count.Load(storage));
             VerifyOrReturnError(endpoint_scene_count.count_value < max_scenes_per_endpoint, CHIP_ERROR_NO_MEMORY);
             endpoint_scene_count.count_value++;
@@ -421,7 +448,7 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
             VerifyOrReturnValue(this->Find(scene_id, scene.index) == CHIP_NO_ERROR, CHIP_NO_ERROR);
 
             // Update the global scene count
-            EndpointSceneCount endpoint_scene_count(endpoint_id);
+            EndpointSceneCount endpoint_scene_count(index, endpoint_id);
             ReturnErrorOnFailure(endpoint_scene_count.Load(storage));
             endpoint_scene_count.count_value--;
             ReturnErrorOnFailure(endpoint_scene_count.Save(storage));
@@ -460,6 +487,21 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
         VerifyOrReturnError(nullptr != storage, CHIP_ERROR_INVALID_ARGUMENT);
         uint8_t deleted_scenes_count = 0;
 
+        // A scene map holding more entries than allowed is loaded from storage, which trims it
+        const SceneTableIndex::FabricSceneMap * indexed = index.FindFabricSceneMap(endpoint_id, fabric_index);
+        if (nullptr != indexed && indexed->mMapSize <= max_scenes_per_fabric)
+        {
+            Clear();
+            VerifyOrReturnError(indexed->mStored, CHIP_ERROR_NOT_FOUND);
+            scene_count = min(indexed->mSceneCount, static_cast<uint8_t>(max_scenes_per_fabric));
+            map_size    = indexed->mMapSize;
+            for (uint16_t i = 0; i < map_size; i++)
+            {
+                scene_map[i] = indexed->mSceneMap[i];
+            }
+            return CHIP_NO_ERROR;
+        }
+
         uint8_t buffer[kPersistentFabricBufferMax] = { 0 };
         StorageKeyName key                         = StorageKeyName::Uninitialized();
 
@@ -472,7 +514,11 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
         // Load the serialized data
         uint16_t size  = static_cast<uint16_t>(sizeof(buffer));
         CHIP_ERROR err = storage->SyncGetKeyValue(key.KeyName(), buffer, size);
-        VerifyOrReturnError(CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND != err, CHIP_ERROR_NOT_FOUND);
+        if (CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND == err)
+        {
+            IndexAsNotStored();
+            return CHIP_ERROR_NOT_FOUND;
+        }
         ReturnErrorOnFailure(err);
 
         // Decode serialized data
@@ -486,17 +532,177 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
         // be updated
         if (deleted_scenes_count)
         {
-            EndpointSceneCount global_count(endpoint_id);
+            EndpointSceneCount global_count(index, endpoint_id);
             ReturnErrorOnFailure(global_count.Load(storage));
             global_count.count_value = static_cast<uint8_t>(global_count.count_value - deleted_scenes_count);
             ReturnErrorOnFailure(global_count.Save(storage));
             ReturnErrorOnFailure(this->Save(storage));
         }
 
+        if (CHIP_NO_ERROR == err)
+        {
+            IndexAsStored();
+        }
+
         return err;
     }
+
+    CHIP_ERROR Save(PersistentStorageDelegate * storage) override
+    {
+        CHIP_ERROR err = PersistentData::Save(storage);
+        if (CHIP_NO_ERROR != err)
+        {
+            // The scene map held in storage is unknown, it is loaded again when needed
+            index.RemoveFabricSceneMap(endpoint_id, fabric_index);
+            return err;
+        }
+
+        map_size = max_scenes_per_fabric;
+        IndexAsStored();
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR Delete(PersistentStorageDelegate * storage) override
+    {
+        CHIP_ERROR err = PersistentData::Delete(storage);
+        if (CHIP_NO_ERROR != err)
+        {
+            index.RemoveFabricSceneMap(endpoint_id, fabric_index);
+            return err;
+        }
+
+        IndexAsNotStored();
+        return CHIP_NO_ERROR;
+    }
+
+    void IndexAsStored()
+    {
+        // Scene maps from a configuration allowing more scenes per fabric are trimmed on load, before being indexed
+        VerifyOrReturn(map_size <= kMaxScenesPerFabric);
+
+        SceneTableIndex::FabricSceneMap & indexed = index.IndexFabricSceneMap(endpoint_id, fabric_index);
+        indexed.mStored                           = true;
+        indexed.mSceneCount                       = scene_count;
+        indexed.mMapSize                          = static_cast<uint8_t>(map_size);
+        for (uint16_t i = 0; i < map_size; i++)
+        {
+            indexed.mSceneMap[i] = scene_map[i];
+        }
+    }
+
+    void IndexAsNotStored()
+    {
+        SceneTableIndex::FabricSceneMap & indexed = index.IndexFabricSceneMap(endpoint_id, fabric_index);
+        indexed.mStored                           = false;
+        indexed.mSceneCount                       = 0;
+        indexed.mMapSize                          = 0;
+    }
 };
 
+namespace {
+
+// Gets the entry matching the predicate, or else the least recently used entry, which is a free entry if any is
+template <typename Entry, size_t N, typename Predicate>
+Entry & FindOrEvict(Entry (&entries)[N], Predicate matches)
+{
+    Entry * leastRecentlyUsed = &entries[0];
+    for (Entry & entry : entries)
+    {
+        if (matches(entry))
+        {
+            return entry;
+        }
+        if (entry.mLastUsed < leastRecentlyUsed->mLastUsed)
+        {
+            leastRecentlyUsed = &entry;
+        }
+    }
+    return *leastRecentlyUsed;
+}
+
+} // namespace
+
+SceneTableIndex::FabricSceneMap * SceneTableIndex::FindFabricSceneMap(EndpointId endpoint, FabricIndex fabric)
+{
+    VerifyOrReturnValue(kInvalidEndpointId != endpoint, nullptr);
+
+    auto matches         = [&](const FabricSceneMap & entry) { return entry.mEndpoint == endpoint && entry.mFabric == fabric; };
+    FabricSceneMap & map = FindOrEvict(mFabricSceneMaps, matches);
+    VerifyOrReturnValue(map.mEndpoint == endpoint && map.mFabric == fabric, nullptr);
+
+    map.mLastUsed = ++mUseCount;
+    return &map;
+}
+
+SceneTableIndex::FabricSceneMap & SceneTableIndex::IndexFabricSceneMap(EndpointId endpoint, FabricIndex fabric)
+{
+    auto matches         = [&](const FabricSceneMap & entry) { return entry.mEndpoint == endpoint && entry.mFabric == fabric; };
+    FabricSceneMap & map = FindOrEvict(mFabricSceneMaps, matches);
+    if (map.mEndpoint != endpoint || map.mFabric != fabric)
+    {
+        map           = FabricSceneMap();
+        map.mEndpoint = endpoint;
+        map.mFabric   = fabric;
+    }
+
+    map.mLastUsed = ++mUseCount;
+    return map;
+}
+
+void SceneTableIndex::RemoveFabricSceneMap(EndpointId endpoint, FabricIndex fabric)
+{
+    FabricSceneMap * map = FindFabricSceneMap(endpoint, fabric);
+    VerifyOrReturn(nullptr != map);
+    *map = FabricSceneMap();
+}
+
+bool SceneTableIndex::FindEndpointSceneCount(EndpointId endpoint, uint8_t & count)
+{
+    VerifyOrReturnValue(kInvalidEndpointId != endpoint, false);
+
+    EndpointSceneCount & sceneCount =
+        FindOrEvict(mEndpointSceneCounts, [&](const EndpointSceneCount & entry) { return entry.mEndpoint == endpoint; });
+    VerifyOrReturnValue(sceneCount.mEndpoint == endpoint, false);
+
+    sceneCount.mLastUsed = ++mUseCount;
+    count                = sceneCount.mCount;
+    return true;
+}
+
+void SceneTableIndex::IndexEndpointSceneCount(EndpointId endpoint, uint8_t count)
+{
+    EndpointSceneCount & sceneCount =
+        FindOrEvict(mEndpointSceneCounts, [&](const EndpointSceneCount & entry) { return entry.mEndpoint == endpoint; });
+
+    sceneCount.mEndpoint = endpoint;
+    sceneCount.mCount    = count;
+    sceneCount.mLastUsed = ++mUseCount;
+}
+
+void SceneTableIndex::RemoveEndpointSceneCount(EndpointId endpoint)
+{
+    for (EndpointSceneCount & sceneCount : mEndpointSceneCounts)
+    {
+        if (sceneCount.mEndpoint == endpoint)
+        {
+            sceneCount = EndpointSceneCount();
+        }
+    }
+}
+
+void SceneTableIndex::Clear()
+{
+    for (FabricSceneMap & map : mFabricSceneMaps)
+    {
+        map = FabricSceneMap();
+    }
+    for (EndpointSceneCount & sceneCount : mEndpointSceneCounts)
+    {
+        sceneCount = EndpointSceneCount();
+    }
+    mUseCount = 0;
+}
+
 CHIP_ERROR DefaultSceneTableImpl::Init(PersistentStorageDelegate * storage)
 {
     if (storage == nullptr)
@@ -508,6 +714,7 @@ CHIP_ERROR DefaultSceneTableImpl::Init(PersistentStorageDelegate * storage)
     VerifyOrReturnError(mMaxScenesPerFabric <= kMaxScenesPerFabric && mMaxScenesPerEndpoint <= kMaxScenesPerEndpoint,
                         CHIP_ERROR_INVALID_INTEGER_VALUE);
     mStorage = storage;
+    mIndex.Clear();
     return CHIP_NO_ERROR;
 }
 
@@ -515,12 +722,13 @@ void DefaultSceneTableImpl::Finish()
 {
     UnregisterAllHandlers();
     mSceneEntryIterators.ReleaseAll();
+    mIndex.Clear();
 }
 CHIP_ERROR DefaultSceneTableImpl::GetFabricSceneCount(FabricIndex fabric_index, uint8_t & scene_count)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    FabricSceneData fabric(mEndpointId, fabric_index);
+    FabricSceneData fabric(mIndex, mEndpointId, fabric_index);
     CHIP_ERROR err = fabric.Load(mStorage);
     VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
 
@@ -533,7 +741,7 @@ CHIP_ERROR DefaultSceneTableImpl::GetEndpointSceneCount(uint8_t & scene_count)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    EndpointSceneCount endpoint_scene_count(mEndpointId);
+    EndpointSceneCount endpoint_scene_count(mIndex, mEndpointId);
 
     ReturnErrorOnFailure(endpoint_scene_count.Load(mStorage));
     scene_count = endpoint_scene_count.count_value;
@@ -545,7 +753,7 @@ CHIP_ERROR DefaultSceneTableImpl::SetEndpointSceneCount(const uint8_t & scene_co
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    EndpointSceneCount endpoint_scene_count(mEndpointId, scene_count);
+    EndpointSceneCount endpoint_scene_count(mIndex, mEndpointId, scene_count);
     return endpoint_scene_count.Save(mStorage);
 }
 
@@ -566,7 +774,7 @@ CHIP_ERROR DefaultSceneTableImpl::GetRemainingCapacity(FabricIndex fabric_index,
     uint8_t remaining_capacity_global = static_cast<uint8_t>(mMaxScenesPerEndpoint - endpoint_scene_count);
     uint8_t remaining_capacity_fabric = static_cast<uint8_t>(mMaxScenesPerFabric);
 
-    FabricSceneData fabric(mEndpointId, fabric_index);
+    FabricSceneData fabric(mIndex, mEndpointId, fabric_index);
 
     // Load fabric data (defaults to zero)
     CHIP_ERROR err = fabric.Load(mStorage);
@@ -586,7 +794,7 @@ CHIP_ERROR DefaultSceneTableImpl::SetSceneTableEntry(FabricIndex fabric_index, c
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    FabricSceneData fabric(mIndex, mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
 
     // Load fabric data (defaults to zero)
     CHIP_ERROR err = fabric.Load(mStorage);
@@ -600,7 +808,7 @@ CHIP_ERROR DefaultSceneTableImpl::GetSceneTableEntry(FabricIndex fabric_index, S
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    FabricSceneData fabric(mIndex, mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
     SceneTableData scene(mEndpointId, fabric_index);
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
@@ -625,7 +833,7 @@ CHIP_ERROR DefaultSceneTableImpl::GetSceneTableEntry(FabricIndex fabric_index, S
 CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntry(FabricIndex fabric_index, SceneStorageId scene_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    FabricSceneData fabric(mIndex, mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
 
@@ -643,7 +851,7 @@ CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntryAtPosition(EndpointId end
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     CHIP_ERROR err = CHIP_NO_ERROR;
-    FabricSceneData fabric(endpoint, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    FabricSceneData fabric(mIndex, endpoint, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
     SceneTableData scene(endpoint, fabric_index, scene_idx);
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
@@ -656,29 +864,26 @@ CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntryAtPosition(EndpointId end
 
 CHIP_ERROR DefaultSceneTableImpl::GetAllSceneIdsInGroup(FabricIndex fabric_index, GroupId group_id, Span<SceneId> & scene_list)
 {
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
-    SceneTableData scene(mEndpointId, fabric_index);
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    auto * iterator = this->IterateSceneEntries(fabric_index);
-    VerifyOrReturnError(nullptr != iterator, CHIP_ERROR_INTERNAL);
+    FabricSceneData fabric(mIndex, mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
     SceneId * list      = scene_list.data();
     uint8_t scene_count = 0;
 
-    while (iterator->Next(scene))
+    // The scene IDs are all in the scene map, so none of the scenes needs to be loaded
+    CHIP_ERROR err = fabric.Load(mStorage);
+    VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
+
+    for (uint16_t i = 0; i < mMaxScenesPerFabric; i++)
     {
-        if (scene.mStorageId.mGroupId == group_id)
+        if (fabric.scene_map[i].IsValid() && fabric.scene_map[i].mGroupId == group_id)
         {
-            if (scene_count >= scene_list.size())
-            {
-                iterator->Release();
-                return CHIP_ERROR_BUFFER_TOO_SMALL;
-            }
-            list[scene_count] = scene.mStorageId.mSceneId;
+            VerifyOrReturnError(scene_count < scene_list.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+            list[scene_count] = fabric.scene_map[i].mSceneId;
             scene_count++;
         }
     }
     scene_list.reduce_size(scene_count);
-    iterator->Release();
     return CHIP_NO_ERROR;
 }
 
@@ -686,7 +891,7 @@ CHIP_ERROR DefaultSceneTableImpl::DeleteAllScenesInGroup(FabricIndex fabric_inde
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    FabricSceneData fabric(mIndex, mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
     SceneTableData scene(mEndpointId, fabric_index);
 
     CHIP_ERROR err = fabric.Load(mStorage);
@@ -804,7 +1009,7 @@ CHIP_ERROR DefaultSceneTableImpl::RemoveFabric(FabricIndex fabric_index)
 
     for (auto endpoint : app::EnabledEndpointsWithServerCluster(chip::app::Clusters::ScenesManagement::Id))
     {
-        FabricSceneData fabric(endpoint, fabric_index);
+        FabricSceneData fabric(mIndex, endpoint, fabric_index);
         SceneIndex idx = 0;
         CHIP_ERROR err = fabric.Load(mStorage);
         VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
@@ -833,7 +1038,7 @@ CHIP_ERROR DefaultSceneTableImpl::RemoveEndpoint()
 
     for (FabricIndex fabric_index = kMinValidFabricIndex; fabric_index < kMaxValidFabricIndex; fabric_index++)
     {
-        FabricSceneData fabric(mEndpointId, fabric_index);
+        FabricSceneData fabric(mIndex, mEndpointId, fabric_index);
         CHIP_ERROR err = fabric.Load(mStorage);
         VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
         if (CHIP_ERROR_NOT_FOUND == err)
@@ -896,7 +1101,7 @@ DefaultSceneTableImpl::SceneEntryIteratorImpl::SceneEntryIteratorImpl(DefaultSce
     mProvider(provider),
     mFabric(fabricIdx), mEndpoint(endpoint), mMaxScenesPerFabric(maxScenesPerFabric), mMaxScenesPerEndpoint(maxScenesEndpoint)
 {
-    FabricSceneData fabric(mEndpoint, fabricIdx, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    FabricSceneData fabric(provider.mIndex, mEndpoint, fabricIdx, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
     ReturnOnFailure(fabric.Load(provider.mStorage));
     mTotalScenes = fabric.scene_count;
     mSceneIndex  = 0;
@@ -909,7 +1114,7 @@ size_t DefaultSceneTableImpl::SceneEntryIteratorImpl::Count()
 
 bool DefaultSceneTableImpl::SceneEntryIteratorImpl::Next(SceneTableEntry & output)
 {
-    FabricSceneData fabric(mEndpoint, mFabric);
+    FabricSceneData fabric(mProvider.mIndex, mEndpoint, mFabric);
     SceneTableData scene(mEndpoint, mFabric);
 
     VerifyOrReturnError(fabric.Load(mProvider.mStorage) == CHIP_NO_ERROR, false);
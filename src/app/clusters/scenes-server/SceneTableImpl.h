@@ -41,11 +41,62 @@ static_assert(kMaxScenesPerEndpoint <= CHIP_CONFIG_MAX_SCENES_TABLE_SIZE,
 static_assert(kMaxScenesPerEndpoint >= 16, "Per spec, kMaxScenesPerEndpoint must be at least 16");
 static constexpr uint16_t kMaxScenesPerFabric = (kMaxScenesPerEndpoint - 1) / 2;
 
+/**
+ * @brief RAM-resident index of the scene maps and scene counts of the scene table.
+ *
+ * Finding, counting and listing scenes is served from the index, so that storage is only read for the scenes themselves, which
+ * hold the extension field sets, and only when a scene is retrieved. Storage is always written first and the index only mirrors
+ * what storage holds, so entries can be evicted at any time: the least recently used entry is replaced when the index is full.
+ */
+class SceneTableIndex
+{
+public:
+    using SceneStorageId = SceneTable<ExtensionFieldSetsImpl>::SceneStorageId;
+
+    static constexpr size_t kSize = CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE;
+
+    struct FabricSceneMap
+    {
+        EndpointId mEndpoint = kInvalidEndpointId;
+        FabricIndex mFabric  = kUndefinedFabricIndex;
+        bool mStored         = false; ///< Whether storage holds a scene map for the fabric on the endpoint
+        uint8_t mSceneCount  = 0;
+        uint8_t mMapSize     = 0; ///< Number of entries of the scene map held in storage
+        SceneStorageId mSceneMap[kMaxScenesPerFabric];
+        uint32_t mLastUsed = 0;
+    };
+
+    FabricSceneMap * FindFabricSceneMap(EndpointId endpoint, FabricIndex fabric);
+    /// @brief Gets the scene map of a fabric on an endpoint, replacing the least recently used scene map if it is not indexed
+    FabricSceneMap & IndexFabricSceneMap(EndpointId endpoint, FabricIndex fabric);
+    void RemoveFabricSceneMap(EndpointId endpoint, FabricIndex fabric);
+
+    bool FindEndpointSceneCount(EndpointId endpoint, uint8_t & count);
+    void IndexEndpointSceneCount(EndpointId endpoint, uint8_t count);
+    void RemoveEndpointSceneCount(EndpointId endpoint);
+
+    void Clear();
+
+private:
+    struct EndpointSceneCount
+    {
+        EndpointId mEndpoint = kInvalidEndpointId;
+        uint8_t mCount       = 0;
+        uint32_t mLastUsed   = 0;
+    };
+
+    FabricSceneMap mFabricSceneMaps[kSize];
+    EndpointSceneCount mEndpointSceneCounts[kSize];
+    uint32_t mUseCount = 0;
+};
+
 /**
  * @brief Implementation of a storage in nonvolatile storage of the scene table.
  *
  * DefaultSceneTableImpl is an implementation that allows to store scenes using PersistentStorageDelegate.
  * It handles the storage of scenes by their ID, GroupID and EnpointID over multiple fabrics.
+ * Scene maps and scene counts are looked up in a SceneTableIndex, which must be cleared by calling Finish() and Init() if the
+ * storage is modified by anything else than this table.
  * It is meant to be used exclusively when the scene cluster is enable for at least one endpoint
  * on the device.
  */
@@ -133,6 +184,7 @@ protected:
     uint16_t mMaxScenesPerEndpoint             = kMaxScenesPerEndpoint;
     EndpointId mEndpointId                     = kInvalidEndpointId;
     chip::PersistentStorageDelegate * mStorage = nullptr;
+    SceneTableIndex mIndex;
     ObjectPool<SceneEntryIteratorImpl, kIteratorsMax> mSceneEntryIterators;
 }; // class DefaultSceneTableImpl
 
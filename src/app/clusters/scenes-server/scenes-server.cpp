@@ -177,6 +177,22 @@ CHIP_ERROR UpdateFabricSceneInfo(EndpointId endpoint, FabricIndex fabric, Option
     return CHIP_NO_ERROR;
 }
 
+/// @brief Applies the extension field sets of a recalled scene and marks the scene as valid for the fabric that recalled it
+CHIP_ERROR ApplySceneNow(FabricIndex fabric, EndpointId endpoint, const SceneTableEntry & scene)
+{
+    uint16_t endpointTableSize = 0;
+    ReturnErrorOnFailure(StatusIB(Attributes::SceneTableSize::Get(endpoint, &endpointTableSize)).ToChipError());
+
+    SceneTable * sceneTable = scenes::GetSceneTableImpl(endpoint, endpointTableSize);
+    VerifyOrReturnError(nullptr != sceneTable, CHIP_ERROR_INTERNAL);
+
+    ReturnErrorOnFailure(sceneTable->SceneApplyEFS(scene));
+
+    // Update FabricSceneInfo, at this point the scene is considered valid
+    return UpdateFabricSceneInfo(endpoint, fabric, Optional<GroupId>(scene.mStorageId.mGroupId),
+                                 Optional<SceneId>(scene.mStorageId.mSceneId), Optional<bool>(true));
+}
+
 } // namespace
 
 /// @brief Gets the SceneInfoStruct array associated to an endpoint
@@ -352,6 +368,12 @@ CHIP_ERROR ScenesServer::Init()
     ReturnErrorOnFailure(sceneTable->Init(&chip::Server::GetInstance().GetPersistentStorage()));
     ReturnErrorOnFailure(chip::Server::GetInstance().GetFabricTable().AddFabricDelegate(&gFabricDelegate));
 
+#if CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+    Span<scenes::SceneRecallScheduler::PendingRecall> pendingRecalls(mPendingRecalls);
+    ReturnErrorOnFailure(mRecallScheduler.Init(*this, mRecallTimerDelegate, pendingRecalls,
+                                               System::Clock::Milliseconds32(CHIP_CONFIG_SCENES_RECALL_BATCH_WINDOW_MS)));
+#endif // CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+
     mIsInitialized = true;
     return CHIP_NO_ERROR;
 }
@@ -360,6 +382,10 @@ void ScenesServer::Shutdown()
 {
     chip::app::CommandHandlerInterfaceRegistry::Instance().UnregisterCommandHandler(this);
 
+#if CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+    mRecallScheduler.Shutdown();
+#endif // CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+
     mGroupProvider = nullptr;
     mIsInitialized = false;
 }
@@ -644,18 +670,18 @@ CHIP_ERROR RecallSceneParse(const FabricIndex & fabricIdx, const EndpointId & en
         }
     }
 
-    ReturnErrorOnFailure(sceneTable->SceneApplyEFS(scene));
-
-    // Update FabricSceneInfo, at this point the scene is considered valid
-    ReturnErrorOnFailure(
-        UpdateFabricSceneInfo(endpointID, fabricIdx, Optional<GroupId>(groupID), Optional<SceneId>(sceneID), Optional<bool>(true)));
-
-    return CHIP_NO_ERROR;
+    return ScenesServer::Instance().ApplyRecalledScene(fabricIdx, endpointID, scene);
 }
 
 // CommandHanlerInterface
 void ScenesServer::InvokeCommand(HandlerContext & ctxt)
 {
+    // Other commands must see the scenes recalled before them applied
+    if (Commands::RecallScene::Id != ctxt.mRequestPath.mCommandId)
+    {
+        ApplyPendingScenes();
+    }
+
     switch (ctxt.mRequestPath.mCommandId)
     {
     case Commands::AddScene::Id:
@@ -774,6 +800,7 @@ void ScenesServer::MakeSceneInvalidForAllFabrics(EndpointId aEndpointId)
 
 void ScenesServer::StoreCurrentScene(FabricIndex aFabricIx, EndpointId aEndpointId, GroupId aGroupId, SceneId aSceneId)
 {
+    ApplyPendingScenes();
     StoreSceneParse(aFabricIx, aEndpointId, aGroupId, aSceneId, mGroupProvider);
 }
 void ScenesServer::RecallScene(FabricIndex aFabricIx, EndpointId aEndpointId, GroupId aGroupId, SceneId aSceneId)
@@ -783,6 +810,35 @@ void ScenesServer::RecallScene(FabricIndex aFabricIx, EndpointId aEndpointId, Gr
     RecallSceneParse(aFabricIx, aEndpointId, aGroupId, aSceneId, transitionTime, mGroupProvider);
 }
 
+CHIP_ERROR ScenesServer::ApplyRecalledScene(FabricIndex aFabricIx, EndpointId aEndpointId, const SceneTableEntry & aScene)
+{
+#if CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+    // Scenes are applied immediately if the batch is full
+    VerifyOrReturnError(CHIP_NO_ERROR != mRecallScheduler.ScheduleScene(aFabricIx, aEndpointId, aScene), CHIP_NO_ERROR);
+#endif // CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+
+    return ApplySceneNow(aFabricIx, aEndpointId, aScene);
+}
+
+void ScenesServer::ApplyPendingScenes()
+{
+#if CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+    mRecallScheduler.ApplyPendingScenes();
+#endif // CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+}
+
+void ScenesServer::CancelPendingScene(EndpointId aEndpointId)
+{
+#if CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+    mRecallScheduler.CancelPendingScene(aEndpointId);
+#endif // CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+}
+
+CHIP_ERROR ScenesServer::ApplyScheduledScene(FabricIndex fabric, EndpointId endpoint, const SceneTableEntry & scene)
+{
+    return ApplySceneNow(fabric, endpoint, scene);
+}
+
 bool ScenesServer::IsHandlerRegistered(EndpointId aEndpointId, scenes::SceneHandler * handler)
 {
     SceneTable * sceneTable = scenes::GetSceneTableImpl(aEndpointId);
@@ -1190,6 +1246,8 @@ void MatterScenesManagementClusterServerShutdownCallback(EndpointId endpoint)
     // Get Scene Table Instance
     SceneTable * sceneTable = scenes::GetSceneTableImpl(endpoint, endpointTableSize);
     sceneTable->RemoveEndpoint();
+
+    ScenesServer::Instance().CancelPendingScene(endpoint);
 }
 
 void MatterScenesManagementPluginServerInitCallback()
@@ -21,6 +21,8 @@
 #include <app/AttributeAccessInterface.h>
 #include <app/CommandHandlerInterface.h>
 #include <app/ConcreteCommandPath.h>
+#include <app/TimerDelegates.h>
+#include <app/clusters/scenes-server/SceneRecallScheduler.h>
 #include <app/clusters/scenes-server/SceneTableImpl.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Nullable.h>
@@ -33,7 +35,9 @@ namespace app {
 namespace Clusters {
 namespace ScenesManagement {
 
-class ScenesServer : public CommandHandlerInterface, public AttributeAccessInterface
+class ScenesServer : public CommandHandlerInterface,
+                     public AttributeAccessInterface,
+                     private scenes::SceneRecallScheduler::Delegate
 {
 public:
     static constexpr size_t kScenesServerMaxEndpointCount =
@@ -94,6 +98,12 @@ public:
     void StoreCurrentScene(FabricIndex aFabricIx, EndpointId aEndpointId, GroupId aGroupId, SceneId aSceneId);
     void RecallScene(FabricIndex aFabricIx, EndpointId aEndpointId, GroupId aGroupId, SceneId aSceneId);
 
+    // Recalled scenes
+    CHIP_ERROR ApplyRecalledScene(FabricIndex aFabricIx, EndpointId aEndpointId,
+                                  const scenes::SceneRecallScheduler::SceneTableEntry & aScene);
+    void ApplyPendingScenes();
+    void CancelPendingScene(EndpointId aEndpointId);
+
     // Handlers for extension field sets
     bool IsHandlerRegistered(EndpointId aEndpointId, scenes::SceneHandler * handler);
     void RegisterSceneHandler(EndpointId aEndpointId, scenes::SceneHandler * handler);
@@ -124,6 +134,17 @@ private:
     // FabricSceneInfo
     FabricSceneInfo mFabricSceneInfo;
 
+    // SceneRecallScheduler::Delegate
+    CHIP_ERROR ApplyScheduledScene(FabricIndex fabric, EndpointId endpoint,
+                                   const scenes::SceneRecallScheduler::SceneTableEntry & scene) override;
+
+#if CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+    // Recalled scenes waiting to be applied together
+    scenes::SceneRecallScheduler mRecallScheduler;
+    scenes::SceneRecallScheduler::PendingRecall mPendingRecalls[CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE];
+    DefaultTimerDelegate mRecallTimerDelegate;
+#endif // CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+
     // Instance
     static ScenesServer mInstance;
 };
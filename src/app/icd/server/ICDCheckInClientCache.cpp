@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/icd/server/ICDCheckInClientCache.h>
+
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+
+using namespace Protocols::SecureChannel;
+
+ByteSpan ICDCheckInClientCache::Client::GetPayload(uint32_t counter, uint16_t activeModeThreshold_ms) const
+{
+    VerifyOrReturnValue(mPayloadValid && mPayloadCounter == counter && mPayloadActiveModeThreshold == activeModeThreshold_ms,
+                        ByteSpan());
+    return ByteSpan(mPayload);
+}
+
+void ICDCheckInClientCache::Client::CopyTo(ICDMonitoringEntry & entry) const
+{
+    entry.fabricIndex       = mFabricIndex;
+    entry.checkInNodeID     = mCheckInNodeID;
+    entry.monitoredSubject  = mMonitoredSubject;
+    entry.clientType        = mClientType;
+    entry.keyHandleValid    = true;
+    entry.symmetricKeystore = mSymmetricKeystore;
+    memcpy(entry.aesKeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
+           mAesKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
+    memcpy(entry.hmacKeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
+           mHmacKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
+}
+
+CHIP_ERROR ICDCheckInClientCache::LoadFabric(PersistentStorageDelegate & storage, FabricIndex fabricIndex,
+                                             uint16_t clientsSupportedPerFabric, Crypto::SymmetricKeystore * symmetricKeystore)
+{
+    ICDMonitoringTable table(storage, fabricIndex, clientsSupportedPerFabric /*Table entry limit*/, symmetricKeystore);
+    VerifyOrReturnError(!table.IsEmpty(), CHIP_NO_ERROR);
+
+    for (uint16_t i = 0; i < table.Limit(); i++)
+    {
+        ICDMonitoringEntry entry(symmetricKeystore);
+        CHIP_ERROR err = table.Get(i, entry);
+        if (err == CHIP_ERROR_NOT_FOUND)
+        {
+            break;
+        }
+
+        if (err != CHIP_NO_ERROR)
+        {
+            // Try to fetch the next entry upon failure (should not happen).
+            ChipLogError(AppServer, "Failed to retrieved ICDMonitoring entry for the Check-In cache, will try next entry.");
+            continue;
+        }
+
+        VerifyOrReturnError(mClientCount < kMaxClients, CHIP_ERROR_NO_MEMORY);
+
+        Client & client           = mClients[mClientCount++];
+        client.mFabricIndex       = entry.fabricIndex;
+        client.mCheckInNodeID     = entry.checkInNodeID;
+        client.mMonitoredSubject  = entry.monitoredSubject;
+        client.mClientType        = entry.clientType;
+        client.mSymmetricKeystore = symmetricKeystore;
+        client.mPayloadValid      = false;
+        memcpy(client.mAesKeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
+               entry.aesKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
+        memcpy(client.mHmacKeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
+               entry.hmacKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void ICDCheckInClientCache::Clear()
+{
+    for (Client & client : *this)
+    {
+        // Do not keep copies of the keys of removed registrations around
+        Crypto::ClearSecretData(client.mAesKeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
+                                sizeof(Crypto::Symmetric128BitsKeyByteArray));
+        Crypto::ClearSecretData(client.mHmacKeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
+                                sizeof(Crypto::Symmetric128BitsKeyByteArray));
+        client.mPayloadValid = false;
+    }
+
+    mClientCount = 0;
+    mLoaded      = false;
+}
+
+CHIP_ERROR ICDCheckInClientCache::ComputePayloads(uint32_t counter, uint16_t activeModeThreshold_ms)
+{
+    CHIP_ERROR lastError = CHIP_NO_ERROR;
+
+    uint8_t applicationDataBuffer[kApplicationDataSize];
+    ByteSpan applicationData = EncodeApplicationData(activeModeThreshold_ms, applicationDataBuffer);
+
+    for (Client & client : *this)
+    {
+        if (!client.GetPayload(counter, activeModeThreshold_ms).empty())
+        {
+            continue;
+        }
+
+        MutableByteSpan output(client.mPayload);
+        client.mPayloadValid = false;
+
+        CHIP_ERROR err = CheckinMessage::GenerateCheckinMessagePayload(client.mAesKeyHandle, client.mHmacKeyHandle, counter,
+                                                                       applicationData, output);
+        if (err != CHIP_NO_ERROR || output.size() != sizeof(client.mPayload))
+        {
+            ChipLogError(AppServer, "Failed to compute the Check-In message payload of node " ChipLogFormatX64,
+                         ChipLogValueX64(client.mCheckInNodeID));
+            lastError = (err != CHIP_NO_ERROR) ? err : CHIP_ERROR_INTERNAL;
+            continue;
+        }
+
+        client.mPayloadCounter             = counter;
+        client.mPayloadActiveModeThreshold = activeModeThreshold_ms;
+        client.mPayloadValid               = true;
+    }
+
+    return lastError;
+}
+
+ByteSpan ICDCheckInClientCache::EncodeApplicationData(uint16_t activeModeThreshold_ms, uint8_t (&buffer)[kApplicationDataSize])
+{
+    // Encoded ActiveModeThreshold in littleEndian for Check-In message application data
+    Encoding::LittleEndian::BufferWriter writer(buffer, sizeof(buffer));
+    writer.Put16(activeModeThreshold_ms);
+    return ByteSpan(buffer, writer.Needed());
+}
+
+} // namespace app
+} // namespace chip
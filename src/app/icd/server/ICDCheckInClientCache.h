@@ -0,0 +1,122 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/icd/server/ICDMonitoringTable.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/support/Span.h>
+#include <protocols/secure_channel/CheckinMessage.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief ICDCheckInClientCache keeps the registrations of the ICDMonitoringTable of every fabric in RAM, together with the
+ *        Check-In message payload of each registration for the next Check-In counter value.
+ *
+ *        The payload of a Check-In message only depends on the keys of the registration, the counter and the
+ *        ActiveModeThreshold. The ICDManager computes the payloads of the next Check-In messages while the ICD is idle, so that
+ *        sending them when the ICD wakes up does not require to read the monitoring tables from persistent storage nor to run
+ *        the AES-CCM and HMAC operations while the radio is active.
+ *
+ *        The cache holds copies of the key handles of the monitoring tables. It is considered unloaded once any table was
+ *        modified after it was loaded, and must then be cleared before being loaded again.
+ */
+class ICDCheckInClientCache
+{
+public:
+    static constexpr size_t kMaxClients           = CHIP_CONFIG_ICD_CLIENTS_SUPPORTED_PER_FABRIC * CHIP_CONFIG_MAX_FABRICS;
+    static constexpr uint8_t kApplicationDataSize = 2; // ActiveModeThreshold is 2 bytes
+    static constexpr size_t kPayloadSize          =
+        Protocols::SecureChannel::CheckinMessage::kMinPayloadSize + kApplicationDataSize;
+
+    struct Client
+    {
+        /**
+         * @brief Get the precomputed Check-In message payload of the client
+         *
+         * @return ByteSpan The payload, or an empty span when no payload was computed for this counter and threshold
+         */
+        ByteSpan GetPayload(uint32_t counter, uint16_t activeModeThreshold_ms) const;
+
+        /// @brief Copy the registration of the client to a monitoring entry, as used by the Check-In BackOff strategy
+        void CopyTo(ICDMonitoringEntry & entry) const;
+
+        FabricIndex mFabricIndex                            = kUndefinedFabricIndex;
+        NodeId mCheckInNodeID                               = kUndefinedNodeId;
+        uint64_t mMonitoredSubject                          = 0;
+        Clusters::IcdManagement::ClientTypeEnum mClientType = Clusters::IcdManagement::ClientTypeEnum::kPermanent;
+        Crypto::Aes128KeyHandle mAesKeyHandle               = Crypto::Aes128KeyHandle();
+        Crypto::Hmac128KeyHandle mHmacKeyHandle             = Crypto::Hmac128KeyHandle();
+        Crypto::SymmetricKeystore * mSymmetricKeystore      = nullptr;
+
+        uint32_t mPayloadCounter             = 0;
+        uint16_t mPayloadActiveModeThreshold = 0;
+        bool mPayloadValid                   = false;
+        uint8_t mPayload[kPayloadSize];
+    };
+
+    /**
+     * @brief Load the registrations of a fabric from its ICDMonitoringTable, after the ones already in the cache.
+     *        Once the registrations of every fabric are loaded, MarkLoaded must be called.
+     *
+     * @return CHIP_ERROR_NO_MEMORY if the cache cannot hold every registration of the fabric
+     */
+    CHIP_ERROR LoadFabric(PersistentStorageDelegate & storage, FabricIndex fabricIndex, uint16_t clientsSupportedPerFabric,
+                          Crypto::SymmetricKeystore * symmetricKeystore);
+    void MarkLoaded()
+    {
+        mLoaded           = true;
+        mLoadedGeneration = ICDMonitoringTable::GetGeneration();
+    }
+    bool IsLoaded() const { return mLoaded && mLoadedGeneration == ICDMonitoringTable::GetGeneration(); }
+
+    /// @brief Drop every registration, the cache must be loaded again before being used
+    void Clear();
+
+    /**
+     * @brief Compute the Check-In message payload of every client for the given counter value and ActiveModeThreshold,
+     *        skipping clients which already have it.
+     *
+     * @return CHIP_ERROR The last error returned by the generation of a payload. Clients for which the generation failed have
+     *         no payload, and their message is generated when it is sent.
+     */
+    CHIP_ERROR ComputePayloads(uint32_t counter, uint16_t activeModeThreshold_ms);
+
+    /// @brief Encode the ActiveModeThreshold as the application data of a Check-In message
+    static ByteSpan EncodeApplicationData(uint16_t activeModeThreshold_ms, uint8_t (&buffer)[kApplicationDataSize]);
+
+    bool IsEmpty() const { return mClientCount == 0; }
+    size_t Count() const { return mClientCount; }
+
+    Client * begin() { return mClients; }
+    Client * end() { return mClients + mClientCount; }
+    const Client * begin() const { return mClients; }
+    const Client * end() const { return mClients + mClientCount; }
+
+private:
+    Client mClients[kMaxClients];
+    size_t mClientCount        = 0;
+    bool mLoaded               = false;
+    uint32_t mLoadedGeneration = 0;
+};
+
+} // namespace app
+} // namespace chip
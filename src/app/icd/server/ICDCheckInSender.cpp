@@ -53,22 +53,21 @@ void ICDCheckInSender::OnNodeAddressResolutionFailed(const PeerId & peerId, CHIP
 
 CHIP_ERROR ICDCheckInSender::SendCheckInMsg(const Transport::PeerAddress & addr)
 {
-    System::PacketBufferHandle buffer = MessagePacketBuffer::New(CheckinMessage::kMinPayloadSize);
+    System::PacketBufferHandle buffer = MessagePacketBuffer::New(ICDCheckInClientCache::kPayloadSize);
 
     VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
     MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
 
-    // Encoded ActiveModeThreshold in littleEndian for Check-In message application data
+    if (mPayloadPrecomputed)
     {
-        uint8_t activeModeThresholdBuffer[kApplicationDataSize] = { 0 };
-        size_t writtenBytes                                     = 0;
-        Encoding::LittleEndian::BufferWriter writer(activeModeThresholdBuffer, sizeof(activeModeThresholdBuffer));
-
+        ReturnErrorOnFailure(CopySpanToMutableSpan(ByteSpan(mPayload), output));
+    }
+    else
+    {
+        uint8_t activeModeThresholdBuffer[ICDCheckInClientCache::kApplicationDataSize];
         uint16_t activeModeThreshold_ms = ICDConfigurationData::GetInstance().GetActiveModeThreshold().count();
-        writer.Put16(activeModeThreshold_ms);
-        VerifyOrReturnError(writer.Fit(writtenBytes), CHIP_ERROR_INTERNAL);
-
-        ByteSpan activeModeThresholdByteSpan(writer.Buffer(), writtenBytes);
+        ByteSpan activeModeThresholdByteSpan =
+            ICDCheckInClientCache::EncodeApplicationData(activeModeThreshold_ms, activeModeThresholdBuffer);
 
         ReturnErrorOnFailure(CheckinMessage::GenerateCheckinMessagePayload(mAes128KeyHandle, mHmac128KeyHandle, mICDCounter,
                                                                            activeModeThresholdByteSpan, output));
@@ -90,22 +89,33 @@ CHIP_ERROR ICDCheckInSender::SendCheckInMsg(const Transport::PeerAddress & addr)
     return exchangeContext->SendMessage(MsgType::ICD_CheckIn, std::move(buffer), Messaging::SendMessageFlags::kNoAutoRequestAck);
 }
 
-CHIP_ERROR ICDCheckInSender::RequestResolve(ICDMonitoringEntry & entry, FabricTable * fabricTable, uint32_t counter)
+CHIP_ERROR ICDCheckInSender::RequestResolve(const ICDCheckInClientCache::Client & client, FabricTable * fabricTable,
+                                            uint32_t counter)
 {
-    VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(client.mFabricIndex != kUndefinedFabricIndex && client.mCheckInNodeID != kUndefinedNodeId,
+                        CHIP_ERROR_INTERNAL);
     VerifyOrReturnError(fabricTable != nullptr, CHIP_ERROR_INTERNAL);
-    const FabricInfo * fabricInfo = fabricTable->FindFabricWithIndex(entry.fabricIndex);
-    PeerId peerId(fabricInfo->GetCompressedFabricId(), entry.checkInNodeID);
+    const FabricInfo * fabricInfo = fabricTable->FindFabricWithIndex(client.mFabricIndex);
+    PeerId peerId(fabricInfo->GetCompressedFabricId(), client.mCheckInNodeID);
 
     mICDCounter = counter;
 
     AddressResolve::NodeLookupRequest request(peerId);
 
     memcpy(mAes128KeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
-           entry.aesKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
+           client.mAesKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
 
     memcpy(mHmac128KeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
-           entry.hmacKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
+           client.mHmacKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
+
+    // The payload computed while the ICD was idle is only valid for this counter and the current ActiveModeThreshold
+    uint16_t activeModeThreshold_ms = ICDConfigurationData::GetInstance().GetActiveModeThreshold().count();
+    ByteSpan payload                = client.GetPayload(counter, activeModeThreshold_ms);
+    mPayloadPrecomputed             = (payload.size() == sizeof(mPayload));
+    if (mPayloadPrecomputed)
+    {
+        memcpy(mPayload, payload.data(), sizeof(mPayload));
+    }
 
     CHIP_ERROR err = AddressResolve::Resolver::Instance().LookupNode(request, mAddressLookupHandle);
 
@@ -16,7 +16,7 @@
  */
 #pragma once
 
-#include <app/icd/server/ICDMonitoringTable.h>
+#include <app/icd/server/ICDCheckInClientCache.h>
 #include <credentials/FabricTable.h>
 #include <lib/address_resolve/AddressResolve.h>
 
@@ -34,7 +34,12 @@ public:
     ICDCheckInSender(Messaging::ExchangeManager * exchangeManager);
     ~ICDCheckInSender() = default;
 
-    CHIP_ERROR RequestResolve(ICDMonitoringEntry & entry, FabricTable * fabricTable, uint32_t counter);
+    /**
+     * @brief Resolve the address of the client and send it a Check-In message with the given counter value.
+     *        The payload precomputed by the cache is sent when it matches the counter, otherwise the payload is generated
+     *        once the address is resolved.
+     */
+    CHIP_ERROR RequestResolve(const ICDCheckInClientCache::Client & client, FabricTable * fabricTable, uint32_t counter);
 
     // AddressResolve::NodeListener - notifications when dnssd finds a node IP address
     void OnNodeAddressResolved(const PeerId & peerId, const AddressResolve::ResolveResult & result) override;
@@ -43,8 +48,6 @@ public:
     bool mResolveInProgress = false;
 
 private:
-    static constexpr uint8_t kApplicationDataSize = 2; // ActiveModeThreshold is 2 bytes
-
     CHIP_ERROR SendCheckInMsg(const Transport::PeerAddress & addr);
 
     // This is used when a node address is required.
@@ -56,6 +59,9 @@ private:
     Crypto::Hmac128KeyHandle mHmac128KeyHandle = Crypto::Hmac128KeyHandle();
 
     uint32_t mICDCounter = 0;
+
+    uint8_t mPayload[ICDCheckInClientCache::kPayloadSize];
+    bool mPayloadPrecomputed = false;
 };
 
 } // namespace app
@@ -107,6 +107,7 @@ void ICDManager::Shutdown()
     mFabricTable     = nullptr;
     mSubInfoProvider = nullptr;
     mICDSenderPool.ReleaseAll();
+    mCheckInClientCache.Clear();
 
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && !CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     mIsBootUpResumeSubscriptionExecuted = false;
@@ -152,110 +153,100 @@ void ICDManager::SendCheckInMsgs()
     uint32_t counterValue   = ICDConfigurationData::GetInstance().GetICDCounter().GetNextCheckInCounterValue();
     bool counterIncremented = false;
 
-    for (const auto & fabricInfo : *mFabricTable)
+    // Every sender is started from this loop so that all Check-In messages are sent within the same active period.
+    // Their payloads were computed for this counter value when the ICD went idle.
+    for (const ICDCheckInClientCache::Client & client : GetCheckInClients())
     {
-        uint16_t supported_clients = ICDConfigurationData::GetInstance().GetClientsSupportedPerFabric();
-
-        ICDMonitoringTable table(*mStorage, fabricInfo.GetFabricIndex(), supported_clients /*Table entry limit*/,
-                                 mSymmetricKeystore);
+        if (!ShouldCheckInMsgsBeSentAtActiveModeFunction(client.mFabricIndex, client.mMonitoredSubject))
+        {
+            continue;
+        }
 
-        if (table.IsEmpty())
+        ICDMonitoringEntry entry(mSymmetricKeystore);
+        client.CopyTo(entry);
+        if (!mICDCheckInBackOffStrategy->ShouldSendCheckInMessage(entry))
         {
+            // continue to next entry
             continue;
         }
 
-        for (uint16_t i = 0; i < table.Limit(); i++)
+        // Increment counter only once to prevent depletion of the available range.
+        if (!counterIncremented)
         {
-            ICDMonitoringEntry entry(mSymmetricKeystore);
-            CHIP_ERROR err = table.Get(i, entry);
-            if (err == CHIP_ERROR_NOT_FOUND)
-            {
-                break;
-            }
+            counterIncremented = true;
 
-            if (err != CHIP_NO_ERROR)
+            if (CHIP_NO_ERROR != ICDConfigurationData::GetInstance().GetICDCounter().Advance())
             {
-                // Try to fetch the next entry upon failure (should not happen).
-                ChipLogError(AppServer, "Failed to retrieved ICDMonitoring entry for Check-In msg, will try next entry.");
-                continue;
+                ChipLogError(AppServer, "Incremented ICDCounter but failed to access/save to Persistent storage");
             }
+        }
 
-            if (!ShouldCheckInMsgsBeSentAtActiveModeFunction(entry.fabricIndex, entry.monitoredSubject))
-            {
-                continue;
-            }
+        // SenderPool will be released upon transition from active to idle state
+        // This will happen when all ICD Check-In messages are sent on the network
+        ICDCheckInSender * sender = mICDSenderPool.CreateObject(mExchangeManager);
+        VerifyOrReturn(sender != nullptr, ChipLogError(AppServer, "Failed to allocate ICDCheckinSender"));
 
-            if (!mICDCheckInBackOffStrategy->ShouldSendCheckInMessage(entry))
-            {
-                // continue to next entry
-                continue;
-            }
+        if (CHIP_NO_ERROR != sender->RequestResolve(client, mFabricTable, counterValue))
+        {
+            ChipLogError(AppServer, "Failed to send ICD Check-In");
+        }
+    }
+#endif // !(CONFIG_BUILD_FOR_HOST_UNIT_TEST)
+}
 
-            // Increment counter only once to prevent depletion of the available range.
-            if (!counterIncremented)
-            {
-                counterIncremented = true;
+ICDCheckInClientCache & ICDManager::GetCheckInClients()
+{
+    VerifyOrReturnValue(!mCheckInClientCache.IsLoaded(), mCheckInClientCache);
 
-                if (CHIP_NO_ERROR != ICDConfigurationData::GetInstance().GetICDCounter().Advance())
-                {
-                    ChipLogError(AppServer, "Incremented ICDCounter but failed to access/save to Persistent storage");
-                }
-            }
+    VerifyOrDie(mStorage != nullptr);
+    VerifyOrDie(mFabricTable != nullptr);
 
-            // SenderPool will be released upon transition from active to idle state
-            // This will happen when all ICD Check-In messages are sent on the network
-            ICDCheckInSender * sender = mICDSenderPool.CreateObject(mExchangeManager);
-            VerifyOrReturn(sender != nullptr, ChipLogError(AppServer, "Failed to allocate ICDCheckinSender"));
+    uint16_t supported_clients = ICDConfigurationData::GetInstance().GetClientsSupportedPerFabric();
 
-            if (CHIP_NO_ERROR != sender->RequestResolve(entry, mFabricTable, counterValue))
-            {
-                ChipLogError(AppServer, "Failed to send ICD Check-In");
-            }
+    // Drop the registrations loaded before a monitoring table was modified
+    mCheckInClientCache.Clear();
+    for (const auto & fabricInfo : *mFabricTable)
+    {
+        CHIP_ERROR err =
+            mCheckInClientCache.LoadFabric(*mStorage, fabricInfo.GetFabricIndex(), supported_clients, mSymmetricKeystore);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(AppServer, "Failed to load the ICDMonitoring entries of fabric %u: %" CHIP_ERROR_FORMAT,
+                         fabricInfo.GetFabricIndex(), err.Format());
         }
     }
-#endif // !(CONFIG_BUILD_FOR_HOST_UNIT_TEST)
+
+    mCheckInClientCache.MarkLoaded();
+    return mCheckInClientCache;
+}
+
+void ICDManager::PrecomputeCheckInMsgs()
+{
+    uint32_t counterValue           = ICDConfigurationData::GetInstance().GetICDCounter().GetNextCheckInCounterValue();
+    uint16_t activeModeThreshold_ms = ICDConfigurationData::GetInstance().GetActiveModeThreshold().count();
+
+    // Failures are not fatal, the payloads that could not be computed are generated when the messages are sent
+    CHIP_ERROR err = GetCheckInClients().ComputePayloads(counterValue, activeModeThreshold_ms);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Failed to precompute ICD Check-In messages: %" CHIP_ERROR_FORMAT, err.Format());
+    }
 }
 
 bool ICDManager::CheckInMessagesWouldBeSent(const std::function<ShouldCheckInMsgsBeSentFunction> & shouldCheckInMsgsBeSentFunction)
 {
     VerifyOrReturnValue(shouldCheckInMsgsBeSentFunction, false);
 
-    for (const auto & fabricInfo : *mFabricTable)
+    for (const ICDCheckInClientCache::Client & client : GetCheckInClients())
     {
-        uint16_t supported_clients = ICDConfigurationData::GetInstance().GetClientsSupportedPerFabric();
-
-        ICDMonitoringTable table(*mStorage, fabricInfo.GetFabricIndex(), supported_clients /*Table entry limit*/,
-                                 mSymmetricKeystore);
-        if (table.IsEmpty())
+        if (client.mClientType == ClientTypeEnum::kEphemeral)
         {
+            // If the registered client is ephemeral, no Check-In message would be sent to this client
             continue;
         }
 
-        for (uint16_t i = 0; i < table.Limit(); i++)
-        {
-            ICDMonitoringEntry entry(mSymmetricKeystore);
-            CHIP_ERROR err = table.Get(i, entry);
-            if (err == CHIP_ERROR_NOT_FOUND)
-            {
-                break;
-            }
-
-            if (err != CHIP_NO_ERROR)
-            {
-                // Try to fetch the next entry upon failure (should not happen).
-                ChipLogError(AppServer, "Failed to retrieved ICDMonitoring entry, will try next entry.");
-                continue;
-            }
-
-            if (entry.clientType == ClientTypeEnum::kEphemeral)
-            {
-                // If the registered client is ephemeral, no Check-In message would be sent to this client
-                continue;
-            }
-
-            // At least one registration would require a Check-In message
-            VerifyOrReturnValue(!shouldCheckInMsgsBeSentFunction(entry.fabricIndex, entry.monitoredSubject), true);
-        }
+        // At least one registration would require a Check-In message
+        VerifyOrReturnValue(!shouldCheckInMsgsBeSentFunction(client.mFabricIndex, client.mMonitoredSubject), true);
     }
 
     // None of the registrations would require a Check-In message
@@ -372,18 +363,10 @@ void ICDManager::UpdateICDMode()
         {
 #endif // CHIP_CONFIG_ENABLE_ICD_DSLS
 
-            VerifyOrDie(mStorage != nullptr);
-            VerifyOrDie(mFabricTable != nullptr);
             // We can only get to LIT Mode, if at least one client is registered with the ICD device
-            for (const auto & fabricInfo : *mFabricTable)
+            if (!GetCheckInClients().IsEmpty())
             {
-                // We only need 1 valid entry to ensure LIT compliance
-                ICDMonitoringTable table(*mStorage, fabricInfo.GetFabricIndex(), 1 /*Table entry limit*/, mSymmetricKeystore);
-                if (!table.IsEmpty())
-                {
-                    tempMode = ICDConfigurationData::ICDMode::LIT;
-                    break;
-                }
+                tempMode = ICDConfigurationData::ICDMode::LIT;
             }
 #if CHIP_CONFIG_ENABLE_ICD_DSLS
         }
@@ -443,6 +426,11 @@ void ICDManager::UpdateOperationState(OperationalState state)
 #if CHIP_CONFIG_ENABLE_ICD_CIP
         // Going back to Idle, all Check-In messages are sent
         mICDSenderPool.ReleaseAll();
+
+        if (SupportsFeature(Feature::kCheckInProtocolSupport))
+        {
+            PrecomputeCheckInMsgs();
+        }
 #endif // CHIP_CONFIG_ENABLE_ICD_CIP
 
         CHIP_ERROR err = DeviceLayer::ConnectivityMgr().SetPollingInterval(slowPollInterval);
@@ -658,6 +646,8 @@ void ICDManager::OnICDManagementServerEvent(ICDManagementEvents event)
     switch (event)
     {
     case ICDManagementEvents::kTableUpdated:
+        // The registrations are loaded again the next time they are needed
+        mCheckInClientCache.Clear();
         this->UpdateICDMode();
         break;
     default:
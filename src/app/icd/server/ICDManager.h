@@ -34,6 +34,7 @@
 
 #if CHIP_CONFIG_ENABLE_ICD_CIP
 #include <app/icd/server/ICDCheckInBackOffStrategy.h> // nogncheck
+#include <app/icd/server/ICDCheckInClientCache.h>     // nogncheck
 #include <app/icd/server/ICDCheckInSender.h>          // nogncheck
 #include <app/icd/server/ICDMonitoringTable.h>        // nogncheck
 #endif                                                // CHIP_CONFIG_ENABLE_ICD_CIP
@@ -337,6 +338,18 @@ private:
      */
     void SendCheckInMsgs();
 
+    /**
+     * @brief Function returns the client registrations of every fabric, loading them from the ICDMonitoringTables
+     *        if they were modified since they were last loaded.
+     */
+    ICDCheckInClientCache & GetCheckInClients();
+
+    /**
+     * @brief Function computes the Check-In message payloads for the next Check-In counter value while the ICD is idle,
+     *        so that SendCheckInMsgs only has to resolve the clients and send the payloads when the ICD wakes up.
+     */
+    void PrecomputeCheckInMsgs();
+
     /**
      * @brief See function implementation in .cpp for details on this function.
      */
@@ -380,6 +393,7 @@ private:
     SubscriptionsInfoProvider * mSubInfoProvider           = nullptr;
     ICDCheckInBackOffStrategy * mICDCheckInBackOffStrategy = nullptr;
     ObjectPool<ICDCheckInSender, (CHIP_CONFIG_ICD_CLIENTS_SUPPORTED_PER_FABRIC * CHIP_CONFIG_MAX_FABRICS)> mICDSenderPool;
+    ICDCheckInClientCache mCheckInClientCache;
 #endif // CHIP_CONFIG_ENABLE_ICD_CIP
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
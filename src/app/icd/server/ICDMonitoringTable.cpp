@@ -231,6 +231,8 @@ ICDMonitoringEntry & ICDMonitoringEntry::operator=(const ICDMonitoringEntry & ic
     return *this;
 }
 
+uint32_t ICDMonitoringTable::sGeneration = 0;
+
 CHIP_ERROR ICDMonitoringTable::Get(uint16_t index, ICDMonitoringEntry & entry) const
 {
     entry.fabricIndex = this->mFabric;
@@ -269,6 +271,8 @@ CHIP_ERROR ICDMonitoringTable::Set(uint16_t index, const ICDMonitoringEntry & en
     VerifyOrReturnError(kUndefinedNodeId != entry.monitoredSubject, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(entry.keyHandleValid, CHIP_ERROR_INVALID_ARGUMENT);
 
+    sGeneration++;
+
     ICDMonitoringEntry e(this->mFabric, index);
     e.checkInNodeID     = entry.checkInNodeID;
     e.monitoredSubject  = entry.monitoredSubject;
@@ -297,6 +301,8 @@ CHIP_ERROR ICDMonitoringTable::Remove(uint16_t index)
 {
     ICDMonitoringEntry entry(mSymmetricKeystore, this->mFabric);
 
+    sGeneration++;
+
     // Retrieve entry and delete the keyHandle first as to not
     // cause any key leaks.
     this->Get(index, entry);
@@ -320,6 +326,8 @@ CHIP_ERROR ICDMonitoringTable::RemoveAll()
 {
     ICDMonitoringEntry entry(mSymmetricKeystore, this->mFabric);
     uint16_t index = 0;
+
+    sGeneration++;
     while (index < this->Limit())
     {
         CHIP_ERROR err = this->Get(index++, entry);
@@ -199,7 +199,15 @@ struct ICDMonitoringTable
      */
     uint16_t Limit() const;
 
+    /**
+     * @brief Returns a number changed by every modification of the table of any fabric, through Set, Remove or RemoveAll,
+     *        so that copies of the registrations, such as the ICDCheckInClientCache, can tell they are stale.
+     */
+    static uint32_t GetGeneration() { return sGeneration; }
+
 private:
+    static uint32_t sGeneration;
+
     PersistentStorageDelegate * mStorage;
     FabricIndex mFabric;
     uint16_t mLimit                                = 0;
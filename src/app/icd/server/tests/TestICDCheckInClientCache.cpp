@@ -0,0 +1,286 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/icd/server/ICDCheckInClientCache.h>
+#include <app/icd/server/ICDMonitoringTable.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/ClusterEnums.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <protocols/secure_channel/CheckinMessage.h>
+
+#include <chrono>
+
+#if CHIP_CRYPTO_PSA
+#include <psa/crypto.h>
+#endif
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters::IcdManagement;
+using namespace chip::Protocols::SecureChannel;
+
+using TestSessionKeystoreImpl = Crypto::DefaultSessionKeystore;
+
+namespace {
+
+constexpr uint16_t kMaxTestClients         = 2;
+constexpr FabricIndex kTestFabricCount     = 4;
+constexpr uint16_t kActiveModeThreshold_ms = 5000;
+constexpr uint32_t kTestCounter            = 0x1000;
+
+constexpr uint8_t kKeyBuffer[] = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+NodeId TestNodeId(FabricIndex fabricIndex, uint16_t client)
+{
+    return (static_cast<NodeId>(fabricIndex) << 16) | (client + 1u);
+}
+
+struct TestICDCheckInClientCache : public ::testing::Test
+{
+    void SetUp() override
+    {
+#if CHIP_CRYPTO_PSA
+        ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+#endif
+    }
+
+    void TearDown() override
+    {
+        // Delete the keys of the registrations
+        for (FabricIndex fabricIndex = 1; fabricIndex <= kTestFabricCount; fabricIndex++)
+        {
+            ICDMonitoringTable table(mStorage, fabricIndex, kMaxTestClients, &mKeystore);
+            EXPECT_EQ(table.RemoveAll(), CHIP_NO_ERROR);
+        }
+    }
+
+    // Registers kMaxTestClients clients on each of the first kTestFabricCount fabrics, the second client being ephemeral
+    void RegisterClients()
+    {
+        for (FabricIndex fabricIndex = 1; fabricIndex <= kTestFabricCount; fabricIndex++)
+        {
+            ICDMonitoringTable table(mStorage, fabricIndex, kMaxTestClients, &mKeystore);
+            for (uint16_t i = 0; i < kMaxTestClients; i++)
+            {
+                ICDMonitoringEntry entry(&mKeystore);
+                entry.checkInNodeID    = TestNodeId(fabricIndex, i);
+                entry.monitoredSubject = TestNodeId(fabricIndex, i) + 1;
+                entry.clientType       = (i == 0) ? ClientTypeEnum::kPermanent : ClientTypeEnum::kEphemeral;
+                ASSERT_EQ(entry.SetKey(ByteSpan(kKeyBuffer)), CHIP_NO_ERROR);
+                ASSERT_EQ(table.Set(i, entry), CHIP_NO_ERROR);
+            }
+        }
+    }
+
+    void LoadClients(ICDCheckInClientCache & cache)
+    {
+        for (FabricIndex fabricIndex = 1; fabricIndex <= kTestFabricCount; fabricIndex++)
+        {
+            EXPECT_EQ(cache.LoadFabric(mStorage, fabricIndex, kMaxTestClients, &mKeystore), CHIP_NO_ERROR);
+        }
+        cache.MarkLoaded();
+    }
+
+    TestPersistentStorageDelegate mStorage;
+    TestSessionKeystoreImpl mKeystore;
+};
+
+TEST_F(TestICDCheckInClientCache, TestLoadAndClear)
+{
+    ICDCheckInClientCache cache;
+    EXPECT_FALSE(cache.IsLoaded());
+    EXPECT_TRUE(cache.IsEmpty());
+
+    RegisterClients();
+
+    // Fabrics without registrations do not add clients
+    EXPECT_EQ(cache.LoadFabric(mStorage, kTestFabricCount + 1, kMaxTestClients, &mKeystore), CHIP_NO_ERROR);
+    EXPECT_TRUE(cache.IsEmpty());
+
+    LoadClients(cache);
+    EXPECT_TRUE(cache.IsLoaded());
+    ASSERT_EQ(cache.Count(), static_cast<size_t>(kTestFabricCount * kMaxTestClients));
+
+    size_t i = 0;
+    for (const ICDCheckInClientCache::Client & client : cache)
+    {
+        const FabricIndex fabricIndex = static_cast<FabricIndex>(1 + i / kMaxTestClients);
+        const uint16_t clientIndex    = static_cast<uint16_t>(i % kMaxTestClients);
+
+        EXPECT_EQ(client.mFabricIndex, fabricIndex);
+        EXPECT_EQ(client.mCheckInNodeID, TestNodeId(fabricIndex, clientIndex));
+        EXPECT_EQ(client.mMonitoredSubject, TestNodeId(fabricIndex, clientIndex) + 1);
+        EXPECT_EQ(client.mClientType, (clientIndex == 0) ? ClientTypeEnum::kPermanent : ClientTypeEnum::kEphemeral);
+        EXPECT_TRUE(client.GetPayload(kTestCounter, kActiveModeThreshold_ms).empty());
+
+        // The copied entry is usable by a Check-In BackOff strategy
+        ICDMonitoringEntry entry(&mKeystore);
+        client.CopyTo(entry);
+        EXPECT_TRUE(entry.IsValid());
+        EXPECT_EQ(entry.checkInNodeID, client.mCheckInNodeID);
+        i++;
+    }
+
+    cache.Clear();
+    EXPECT_FALSE(cache.IsLoaded());
+    EXPECT_TRUE(cache.IsEmpty());
+}
+
+TEST_F(TestICDCheckInClientCache, TestTableModificationUnloads)
+{
+    ICDCheckInClientCache cache;
+    RegisterClients();
+
+    // Any modification of a monitoring table, even of another fabric, makes the loaded registrations stale
+    LoadClients(cache);
+    EXPECT_TRUE(cache.IsLoaded());
+    {
+        ICDMonitoringTable table(mStorage, 1, kMaxTestClients, &mKeystore);
+        EXPECT_EQ(table.Remove(0), CHIP_NO_ERROR);
+    }
+    EXPECT_FALSE(cache.IsLoaded());
+
+    cache.Clear();
+    LoadClients(cache);
+    EXPECT_TRUE(cache.IsLoaded());
+    EXPECT_EQ(cache.Count(), static_cast<size_t>(kTestFabricCount * kMaxTestClients - 1));
+    {
+        ICDMonitoringTable table(mStorage, kTestFabricCount, kMaxTestClients, &mKeystore);
+        EXPECT_EQ(table.RemoveAll(), CHIP_NO_ERROR);
+    }
+    EXPECT_FALSE(cache.IsLoaded());
+
+    cache.Clear();
+    RegisterClients();
+    EXPECT_FALSE(cache.IsLoaded());
+}
+
+TEST_F(TestICDCheckInClientCache, TestComputePayloads)
+{
+    ICDCheckInClientCache cache;
+    RegisterClients();
+    LoadClients(cache);
+
+    EXPECT_EQ(cache.ComputePayloads(kTestCounter, kActiveModeThreshold_ms), CHIP_NO_ERROR);
+
+    for (const ICDCheckInClientCache::Client & client : cache)
+    {
+        // The payload is only valid for the counter and threshold it was computed for
+        EXPECT_TRUE(client.GetPayload(kTestCounter + 1, kActiveModeThreshold_ms).empty());
+        EXPECT_TRUE(client.GetPayload(kTestCounter, kActiveModeThreshold_ms + 1).empty());
+
+        ByteSpan payload = client.GetPayload(kTestCounter, kActiveModeThreshold_ms);
+        ASSERT_EQ(payload.size(), ICDCheckInClientCache::kPayloadSize);
+
+        // The client decrypts the precomputed payload as a regular Check-In message
+        CounterType counter = 0;
+        uint8_t appDataBuffer[ICDCheckInClientCache::kApplicationDataSize + sizeof(CounterType)];
+        MutableByteSpan appData(appDataBuffer);
+        CHIP_ERROR err =
+            CheckinMessage::ParseCheckinMessagePayload(client.mAesKeyHandle, client.mHmacKeyHandle, payload, counter, appData);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_EQ(counter, kTestCounter);
+        ASSERT_EQ(appData.size(), static_cast<size_t>(ICDCheckInClientCache::kApplicationDataSize));
+        EXPECT_EQ(appData.data()[0] | (appData.data()[1] << 8), kActiveModeThreshold_ms);
+    }
+
+    // Payloads are computed again for the next counter value
+    EXPECT_EQ(cache.ComputePayloads(kTestCounter + 1, kActiveModeThreshold_ms), CHIP_NO_ERROR);
+    for (const ICDCheckInClientCache::Client & client : cache)
+    {
+        EXPECT_TRUE(client.GetPayload(kTestCounter, kActiveModeThreshold_ms).empty());
+        EXPECT_FALSE(client.GetPayload(kTestCounter + 1, kActiveModeThreshold_ms).empty());
+    }
+}
+
+/**
+ * @brief Measures the work done when the ICD wakes up to send its Check-In messages, with the monitoring tables read from
+ *        storage and the payloads generated at wakeup, and with the payloads computed from the cache while the ICD was idle.
+ */
+TEST_F(TestICDCheckInClientCache, TestCheckInCycleActiveTimeBenchmark)
+{
+    constexpr uint32_t kCycleCount = 200;
+
+    RegisterClients();
+
+    uint8_t applicationDataBuffer[ICDCheckInClientCache::kApplicationDataSize];
+    ByteSpan applicationData = ICDCheckInClientCache::EncodeApplicationData(kActiveModeThreshold_ms, applicationDataBuffer);
+    uint8_t messageBuffer[ICDCheckInClientCache::kPayloadSize];
+    size_t messageCount = 0;
+
+    // Wakeup work without the cache: read every table from storage and generate each payload
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t cycle = 0; cycle < kCycleCount; cycle++)
+    {
+        for (FabricIndex fabricIndex = 1; fabricIndex <= kTestFabricCount; fabricIndex++)
+        {
+            ICDMonitoringTable table(mStorage, fabricIndex, kMaxTestClients, &mKeystore);
+            for (uint16_t i = 0; i < table.Limit(); i++)
+            {
+                ICDMonitoringEntry entry(&mKeystore);
+                ASSERT_EQ(table.Get(i, entry), CHIP_NO_ERROR);
+
+                MutableByteSpan output(messageBuffer);
+                CHIP_ERROR err = CheckinMessage::GenerateCheckinMessagePayload(entry.aesKeyHandle, entry.hmacKeyHandle,
+                                                                               kTestCounter + cycle, applicationData, output);
+                ASSERT_EQ(err, CHIP_NO_ERROR);
+                messageCount++;
+            }
+        }
+    }
+    const auto uncachedActiveTime = std::chrono::steady_clock::now() - start;
+
+    // Wakeup work with the cache: copy the payloads computed while idle
+    ICDCheckInClientCache cache;
+    LoadClients(cache);
+    std::chrono::steady_clock::duration cachedActiveTime{};
+    std::chrono::steady_clock::duration idleTime{};
+    for (uint32_t cycle = 0; cycle < kCycleCount; cycle++)
+    {
+        start = std::chrono::steady_clock::now();
+        EXPECT_EQ(cache.ComputePayloads(kTestCounter + cycle, kActiveModeThreshold_ms), CHIP_NO_ERROR);
+        const auto wakeup = std::chrono::steady_clock::now();
+        idleTime += wakeup - start;
+
+        for (const ICDCheckInClientCache::Client & client : cache)
+        {
+            ByteSpan payload = client.GetPayload(kTestCounter + cycle, kActiveModeThreshold_ms);
+            ASSERT_EQ(payload.size(), sizeof(messageBuffer));
+            memcpy(messageBuffer, payload.data(), payload.size());
+        }
+        cachedActiveTime += std::chrono::steady_clock::now() - wakeup;
+    }
+
+    EXPECT_EQ(messageCount, kCycleCount * cache.Count());
+    EXPECT_LT(cachedActiveTime, uncachedActiveTime);
+
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    ChipLogProgress(AppServer, "%u Check-In messages per cycle: %u ns active per cycle uncached, %u ns cached (%u ns while idle)",
+                    static_cast<unsigned>(cache.Count()),
+                    static_cast<unsigned>(duration_cast<nanoseconds>(uncachedActiveTime).count() / kCycleCount),
+                    static_cast<unsigned>(duration_cast<nanoseconds>(cachedActiveTime).count() / kCycleCount),
+                    static_cast<unsigned>(duration_cast<nanoseconds>(idleTime).count() / kCycleCount));
+}
+
+} // namespace
@@ -25,6 +25,9 @@ Usage examples:
 Creating OTA image file:
 ./ota_image_tool.py create -v 0xDEAD -p 0xBEEF -vn 1 -vs "1.0" -da sha256 my-firmware.bin my-firmware.ota
 
+Creating delta OTA image file, which rebuilds my-firmware-v2.ota from my-firmware-v1.ota:
+./ota_image_tool.py create_delta my-firmware-v1.ota my-firmware-v2.ota my-firmware-v2-delta.ota
+
 Showing OTA image file info:
 ./ota_image_tool.py show my-firmware.ota
 """
@@ -41,6 +44,8 @@ sys.path.insert(0, os.path.join(
 from chip.tlv import TLVReader, TLVWriter, uint  # noqa: E402 isort:skip
 
 HEADER_MAGIC = 0x1BEEF11E
+# Delta images use their own magic so that requestors which do not support them reject them
+DELTA_HEADER_MAGIC = 0x1BEEF1DE
 FIXED_HEADER_FORMAT = '<IQI'
 
 DIGEST_ALGORITHM_ID = dict(
@@ -65,6 +70,12 @@ DIGEST_ALL_ALGORITHMS = hashlib.algorithms_available.intersection(
 # into memory fully before processing.
 PAYLOAD_BUFFER_SIZE = 16 * 1024
 
+# Length of the exact matches between the base and new payloads that delta patches are built around
+DELTA_MIN_MATCH_SIZE = 16
+
+# Number of bytes a match may extend past its last matching byte when its share of matching bytes decreases
+DELTA_MAX_MISMATCH_SIZE = 64
+
 
 class HeaderTag(IntEnum):
     VENDOR_ID = 0
@@ -77,6 +88,10 @@ class HeaderTag(IntEnum):
     RELEASE_NOTES_URL = 7
     DIGEST_TYPE = 8
     DIGEST = 9
+    # Delta image header extension
+    DELTA_BASE_VERSION = 10
+    DELTA_IMAGE_SIZE = 11
+    DELTA_IMAGE_DIGEST = 12
 
 
 def warn(message: str):
@@ -142,9 +157,12 @@ def generate_payload_summary(args: object):
     return total_size, digest.digest()
 
 
-def generate_header_tlv(args: object, payload_size: int, payload_digest: bytes):
+def generate_header_tlv(args: object, payload_size: int, payload_digest: bytes, delta: tuple = None):
     """
     Generate anonymous TLV structure with fields describing the OTA image contents
+
+    For a delta image, delta holds the base software version, and the size and digest of the image
+    rebuilt by the patch payload.
     """
 
     fields = {
@@ -166,19 +184,27 @@ def generate_header_tlv(args: object, payload_size: int, payload_digest: bytes):
     if args.release_notes is not None:
         fields.update({HeaderTag.RELEASE_NOTES_URL: args.release_notes})
 
+    if delta is not None:
+        base_version, image_size, image_digest = delta
+        fields.update({
+            HeaderTag.DELTA_BASE_VERSION: uint(base_version),
+            HeaderTag.DELTA_IMAGE_SIZE: uint(image_size),
+            HeaderTag.DELTA_IMAGE_DIGEST: image_digest,
+        })
+
     writer = TLVWriter()
     writer.put(None, fields)
 
     return writer.encoding
 
 
-def generate_header(header_tlv: bytes, payload_size: int):
+def generate_header(header_tlv: bytes, payload_size: int, magic: int = HEADER_MAGIC):
     """
     Generate OTA image header
     """
 
     fixed_header = struct.pack(FIXED_HEADER_FORMAT,
-                               HEADER_MAGIC,
+                               magic,
                                struct.calcsize(FIXED_HEADER_FORMAT) +
                                len(header_tlv) + payload_size,
                                len(header_tlv))
@@ -287,6 +313,12 @@ def update_header_args(args: object) -> None:
 
     payload_size = header_tlv[HeaderTag.PAYLOAD_SIZE]
     payload_digest = header_tlv[HeaderTag.DIGEST]
+    delta = None
+
+    if HeaderTag.DELTA_BASE_VERSION in header_tlv:
+        delta = (header_tlv[HeaderTag.DELTA_BASE_VERSION],
+                 header_tlv[HeaderTag.DELTA_IMAGE_SIZE],
+                 header_tlv[HeaderTag.DELTA_IMAGE_DIGEST])
 
     if args.vendor_id is None:
         args.vendor_id = header_tlv[HeaderTag.VENDOR_ID]
@@ -306,8 +338,8 @@ def update_header_args(args: object) -> None:
     if args.release_notes is None and HeaderTag.RELEASE_NOTES_URL in header_tlv:
         args.release_notes = header_tlv[HeaderTag.RELEASE_NOTES_URL]
 
-    new_header_tlv = generate_header_tlv(args, payload_size, payload_digest)
-    header = generate_header(new_header_tlv, payload_size)
+    new_header_tlv = generate_header_tlv(args, payload_size, payload_digest, delta)
+    header = generate_header(new_header_tlv, payload_size, HEADER_MAGIC if delta is None else DELTA_HEADER_MAGIC)
 
     with open(args.image_file, 'rb') as infile:
         with open(args.output_file, 'wb') as outfile:
@@ -317,6 +349,189 @@ def update_header_args(args: object) -> None:
                 outfile.write(chunk)
 
 
+def read_image(path: str):
+    """
+    Read header TLV and payload of OTA image
+    """
+
+    with open(path, 'rb') as file:
+        _magic, _total_size, header_size = struct.unpack(
+            FIXED_HEADER_FORMAT, file.read(struct.calcsize(FIXED_HEADER_FORMAT)))
+        header_tlv = TLVReader(file.read(header_size)).get()['Any']
+
+        return header_tlv, file.read()
+
+
+def encode_varint(value: int) -> bytes:
+    """
+    Encode unsigned integer as LEB128 varint
+    """
+
+    encoding = bytearray()
+
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if not value:
+            encoding.append(byte)
+            return bytes(encoding)
+        encoding.append(byte | 0x80)
+
+
+def encode_delta_entry(diff: bytes, extra: bytes, seek: int) -> bytes:
+    """
+    Encode delta patch entry: control tuple, run-length encoded diff and extra
+    """
+
+    entry = bytearray()
+    entry += encode_varint(len(diff))
+    entry += encode_varint(len(extra))
+    entry += encode_varint((seek << 1) ^ (seek >> 63))
+
+    pos = 0
+    while pos < len(diff):
+        start = pos
+        while start < len(diff) and diff[start] == 0:
+            start += 1
+
+        # Runs of fewer than 3 zeros are cheaper as literals
+        end = diff.find(b'\0\0\0', start)
+        end = len(diff) if end < 0 else end
+        while end > start and diff[end - 1] == 0:
+            end -= 1
+
+        entry += encode_varint(start - pos)
+        entry += encode_varint(end - start)
+        entry += diff[start:end]
+        pos = end
+
+    return bytes(entry + extra)
+
+
+def extend_match(base: bytes, base_start: int, image: bytes, image_start: int) -> int:
+    """
+    Return length of approximate match between base and image at given offsets
+
+    Like in bsdiff, the match extends as long as most bytes are equal, so that small changes, such as
+    relocated addresses, end up in the diff rather than breaking the match.
+    """
+
+    limit = min(len(base) - base_start, len(image) - image_start)
+    length = score = best_score = 0
+    pos = 0
+
+    while pos < limit and pos - length <= DELTA_MAX_MISMATCH_SIZE:
+        # Skip equal data quickly
+        step = PAYLOAD_BUFFER_SIZE
+        while step >= DELTA_MIN_MATCH_SIZE:
+            base_chunk = base[base_start + pos:base_start + pos + step]
+            if pos + step <= limit and base_chunk == image[image_start + pos:image_start + pos + step]:
+                pos += step
+                score += step
+            else:
+                step //= 2
+
+        if pos < limit:
+            score += 1 if base[base_start + pos] == image[image_start + pos] else -1
+            pos += 1
+
+        if score > best_score:
+            best_score = score
+            length = pos
+
+    return length
+
+
+def generate_delta_patch(base: bytes, image: bytes) -> bytes:
+    """
+    Generate patch rebuilding image from base
+
+    The format of the patch is described in src/app/clusters/ota-requestor/DeltaOTAImagePatcher.h.
+    """
+
+    if not image:
+        return b''
+
+    index = {}
+    for pos in range(len(base) - DELTA_MIN_MATCH_SIZE, -1, -1):
+        index[base[pos:pos + DELTA_MIN_MATCH_SIZE]] = pos
+
+    # Find matches, as (base offset, image offset, length) tuples
+    matches = []
+    pos = 0
+    while pos + DELTA_MIN_MATCH_SIZE <= len(image):
+        base_start = index.get(image[pos:pos + DELTA_MIN_MATCH_SIZE])
+        if base_start is None:
+            pos += 1
+            continue
+
+        length = extend_match(base, base_start, image, pos)
+        matches.append((base_start, pos, length))
+        pos += length
+
+    # Each match is the diff of an entry, whose extra is the data up to the next match
+    patch = bytearray()
+    base_pos = 0
+    image_pos = 0
+
+    if not matches or matches[0][:2] != (0, 0):
+        matches.insert(0, (0, 0, 0))
+
+    for i, (base_start, image_start, length) in enumerate(matches):
+        next_base_start, next_image_start = matches[i + 1][:2] if i + 1 < len(matches) else (base_start + length, len(image))
+        diff = bytes((image[image_start + j] - base[base_start + j]) & 0xFF for j in range(length))
+        extra = image[image_start + length:next_image_start]
+        patch += encode_delta_entry(diff, extra, next_base_start - base_start - length)
+        base_pos = base_start + length
+        image_pos = next_image_start
+
+    assert image_pos == len(image) and base_pos <= len(base)
+    return bytes(patch)
+
+
+def generate_delta_image(args: object):
+    """
+    Generate delta OTA image rebuilding args.image_file from args.base_image_file
+    """
+
+    base_header, base_payload = read_image(args.base_image_file)
+    header, payload = read_image(args.image_file)
+
+    for tag in [HeaderTag.VENDOR_ID, HeaderTag.PRODUCT_ID]:
+        if base_header[tag] != header[tag]:
+            error('Images are for different products')
+
+    if HeaderTag.DELTA_BASE_VERSION in base_header or HeaderTag.DELTA_BASE_VERSION in header:
+        error('Images must be full images')
+
+    base_version = base_header[HeaderTag.VERSION]
+    if base_version >= header[HeaderTag.VERSION]:
+        error('Base image software version is greater or equal to image software version')
+
+    args.vendor_id = header[HeaderTag.VENDOR_ID]
+    args.product_id = header[HeaderTag.PRODUCT_ID]
+    args.version = header[HeaderTag.VERSION]
+    args.version_str = header[HeaderTag.VERSION_STRING]
+    args.digest_algorithm = next(key for key, value in DIGEST_ALGORITHM_ID.items()
+                                 if value == header[HeaderTag.DIGEST_TYPE])
+    # The patch only applies to the base image
+    args.min_version = base_version
+    args.max_version = base_version
+    args.release_notes = header.get(HeaderTag.RELEASE_NOTES_URL)
+
+    patch = generate_delta_patch(base_payload, payload)
+    patch_digest = hashlib.new(args.digest_algorithm, patch).digest()
+
+    delta = (base_version, len(payload), header[HeaderTag.DIGEST])
+    header_tlv = generate_header_tlv(args, len(patch), patch_digest, delta)
+
+    with open(args.output_file, 'wb') as out_file:
+        out_file.write(generate_header(header_tlv, len(patch), DELTA_HEADER_MAGIC))
+        out_file.write(patch)
+
+    print(f'Delta image payload: {len(patch)} bytes, rebuilding a {len(payload)}-byte image')
+
+
 def main():
     def any_base_int(s): return int(s, 0)
 
@@ -346,6 +561,13 @@ def main():
                                help='Path to input image payload file')
     create_parser.add_argument('output_file', help='Path to output image file')
 
+    delta_parser = subcommands.add_parser('create_delta', help='Create delta OTA image')
+    delta_parser.add_argument('base_image_file',
+                              help='Path to OTA image file of the software version to update from')
+    delta_parser.add_argument('image_file',
+                              help='Path to OTA image file of the software version to update to')
+    delta_parser.add_argument('output_file', help='Path to output delta image file')
+
     show_parser = subcommands.add_parser('show', help='Show OTA image info')
     show_parser.add_argument('image_file', help='Path to OTA image file')
 
@@ -379,6 +601,8 @@ def main():
     if args.subcommand == 'create':
         validate_header_attributes(args)
         generate_image(args)
+    elif args.subcommand == 'create_delta':
+        generate_delta_image(args)
     elif args.subcommand == 'show':
         show_header(args)
     elif args.subcommand == 'extract':
@@ -20,6 +20,7 @@
 #include <app/ConcreteEventPath.h>
 #include <app/InteractionModelEngine.h>
 #include <app/RequiredPrivilege.h>
+#include <app/StatusResponse.h>
 #include <app/data-model-provider/ActionReturnStatus.h>
 #include <app/data-model-provider/Provider.h>
 #include <app/icd/server/ICDServerConfig.h>
@@ -534,6 +535,15 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     reportBufferMaxSize = apReadHandler->GetReportBufferMaxSize();
 
     bufHandle = System::PacketBufferHandle::New(reportBufferMaxSize);
+    if (bufHandle.IsNull() && reportBufferMaxSize > kMaxSecureSduLengthBytes)
+    {
+        // Large buffers may be scarce (or unavailable from a buffer pool): rather than failing the report,
+        // chunk it as for a session that does not allow large payloads.
+        ChipLogDetail(DataManagement, "<RE> No large report buffer, falling back to %u bytes",
+                      static_cast<unsigned>(kMaxSecureSduLengthBytes));
+        reportBufferMaxSize = kMaxSecureSduLengthBytes;
+        bufHandle           = System::PacketBufferHandle::New(reportBufferMaxSize);
+    }
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
     if (bufHandle->AvailableDataLength() > reportBufferMaxSize)
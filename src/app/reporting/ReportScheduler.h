@@ -147,6 +147,16 @@ public:
                      IsEngineRunScheduled()));
         }
 
+        /// @brief Check if the report of the Node can be deferred to a later report, meaning it would only carry dirty attribute
+        /// data. Reports forced by urgent events, chunked reports, reports already scheduled for an engine run and reports due on
+        /// the max interval cannot be deferred.
+        /// @param now current time to use for the check, the user must ensure to provide a valid time for this to be reliable
+        bool CanDeferReport(const Timestamp & now) const
+        {
+            return !IsEngineRunScheduled() && !mReadHandler->IsChunkedReport() && !mReadHandler->IsForceDirty() &&
+                now < mMaxTimestamp;
+        }
+
         bool CanStartReporting() const { return mReadHandler->CanStartReporting(); }
         bool IsChunkedReport() const { return mReadHandler->IsChunkedReport(); }
         bool IsEngineRunScheduled() const { return mFlags.Has(ReadHandlerNodeFlags::EngineRunScheduled); }
@@ -57,6 +57,35 @@ void SynchronizedReportSchedulerImpl::OnTransitionToIdle()
     }
 }
 
+void SynchronizedReportSchedulerImpl::OnEnterActiveMode()
+{
+    ReportSchedulerImpl::OnEnterActiveMode();
+
+    mIsIdle = false;
+    VerifyOrReturn(mIdleCoalescing);
+
+    // Reports deferred during idle mode no longer wait for the next max interval
+    RescheduleReport(mTimerDelegate->GetCurrentMonotonicTimestamp());
+}
+
+void SynchronizedReportSchedulerImpl::OnEnterIdleMode()
+{
+    mIsIdle = true;
+    VerifyOrReturn(mIdleCoalescing);
+
+    // A report scheduled on the common min interval might now be deferred to the next max interval
+    RescheduleReport(mTimerDelegate->GetCurrentMonotonicTimestamp());
+}
+
+void SynchronizedReportSchedulerImpl::RescheduleReport(const Timestamp & now)
+{
+    VerifyOrReturn(mNodesPool.Allocated());
+
+    Timeout timeout = Milliseconds32(0);
+    ReturnOnFailure(CalculateNextReportTimeout(timeout, nullptr, now));
+    ScheduleReport(timeout, nullptr, now);
+}
+
 CHIP_ERROR SynchronizedReportSchedulerImpl::ScheduleReport(Timeout timeout, ReadHandlerNode * node, const Timestamp & now)
 {
     // Cancel Report if it is currently scheduled
@@ -132,11 +161,19 @@ CHIP_ERROR SynchronizedReportSchedulerImpl::CalculateNextReportTimeout(Timeout &
 {
     ReturnErrorOnFailure(FindNextMaxInterval(now));
     ReturnErrorOnFailure(FindNextMinInterval(now));
-    bool reportableNow   = false;
-    bool reportableAtMin = false;
+    bool reportableNow      = false;
+    bool reportableAtMin    = false;
+    const bool deferReports = ShouldDeferReports();
 
     // Find out if any handler is reportable now or at the next min interval
-    mNodesPool.ForEachActiveObject([&reportableNow, &reportableAtMin, this, now](ReadHandlerNode * node) {
+    mNodesPool.ForEachActiveObject([&reportableNow, &reportableAtMin, deferReports, this, now](ReadHandlerNode * node) {
+        // While the ICD is idle, a handler that only has dirty attribute data does not wake the ICD up, it reports with the next
+        // handler reaching its max interval
+        if (deferReports && node->CanDeferReport(now))
+        {
+            return Loop::Continue;
+        }
+
         // If a node is already scheduled, we don't need to check if it is reportable now unless a chunked report is in progress.
         // In this case, the node will be Reportable, as it is impossible to have node->IsChunkedReport() == true without being
         // reportable, therefore we need to keep scheduling engine runs until the report is complete
@@ -176,13 +213,14 @@ CHIP_ERROR SynchronizedReportSchedulerImpl::CalculateNextReportTimeout(Timeout &
 
 void SynchronizedReportSchedulerImpl::TimerFired()
 {
-    Timestamp now   = mTimerDelegate->GetCurrentMonotonicTimestamp();
-    bool firedEarly = true;
+    Timestamp now           = mTimerDelegate->GetCurrentMonotonicTimestamp();
+    bool firedEarly         = true;
+    const bool deferReports = ShouldDeferReports();
 
     // If there are no handlers registered, no need to do anything.
     VerifyOrReturn(mNodesPool.Allocated());
 
-    mNodesPool.ForEachActiveObject([now, &firedEarly](ReadHandlerNode * node) {
+    mNodesPool.ForEachActiveObject([now, deferReports, &firedEarly](ReadHandlerNode * node) {
         if (node->GetMinTimestamp() <= now && node->CanStartReporting())
         {
             // Since this handler can now report whenever it wants to, mark it as allowed to report if any other handler is
@@ -190,14 +228,11 @@ void SynchronizedReportSchedulerImpl::TimerFired()
             node->SetCanBeSynced(true);
         }
 
-        if (node->IsReportableNow(now))
+        // We set firedEarly false here because we assume we fired the timer early if no handler is reportable at the moment,
+        // which becomes false if we find a handler that is reportable and whose report cannot be deferred
+        if (node->IsReportableNow(now) && !(deferReports && node->CanDeferReport(now)))
         {
-            // We set firedEarly false here because we assume we fired the timer early if no handler is reportable at the
-            // moment, which becomes false if we find a handler that is reportable
             firedEarly = false;
-            node->SetEngineRunScheduled(true);
-            ChipLogProgress(DataManagement, "Handler: %p with min: 0x" ChipLogFormatX64 " and max: 0x" ChipLogFormatX64 "", (node),
-                            ChipLogValueX64(node->GetMinTimestamp().count()), ChipLogValueX64(node->GetMaxTimestamp().count()));
         }
 
         return Loop::Continue;
@@ -215,6 +250,19 @@ void SynchronizedReportSchedulerImpl::TimerFired()
     }
     else
     {
+        // Every reportable handler, including the ones whose report was deferred, reports with this engine run
+        mNodesPool.ForEachActiveObject([now](ReadHandlerNode * node) {
+            if (node->IsReportableNow(now))
+            {
+                node->SetEngineRunScheduled(true);
+                ChipLogProgress(DataManagement, "Handler: %p with min: 0x" ChipLogFormatX64 " and max: 0x" ChipLogFormatX64 "",
+                                (node), ChipLogValueX64(node->GetMinTimestamp().count()),
+                                ChipLogValueX64(node->GetMaxTimestamp().count()));
+            }
+
+            return Loop::Continue;
+        });
+
         // If we have a reportable handler, we can schedule an engine run
         InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
     }
@@ -18,7 +18,9 @@
 
 #pragma once
 
+#include <app/icd/server/ICDServerConfig.h>
 #include <app/reporting/ReportSchedulerImpl.h>
+#include <lib/core/CHIPConfig.h>
 
 namespace chip {
 namespace app {
@@ -69,6 +71,18 @@ using TimerDelegate   = ReportScheduler::TimerDelegate;
  * - The next report timeout is calculated in CalculatedNextReportTimeout based on the next min and max interval timestamps, as well
  * as the status of each ReadHandlerNode in the pool.
  *
+ * ## ICD Idle Mode Coalescing
+ *
+ * When CHIP_CONFIG_SYNCHRONOUS_REPORTS_IDLE_COALESCING is enabled, the scheduler tracks the ICD operating mode through the
+ * ICDStateObserver callbacks. While the ICD is in idle mode, ReadHandlers that would only report dirty attribute data are not
+ * considered reportable at their min interval (see ReadHandlerNode::CanDeferReport):
+ *     * Their reports are sent together with the next report due on a max interval, which is never delayed.
+ *     * Reports forced by urgent events are still sent on the common min interval, and the deferred reports are sent with them.
+ *     * When the ICD enters active mode for any other reason, all deferred reports are sent right away within that active period.
+ *
+ * This groups attribute changes and the events they carry in the fewest active periods while staying within the max interval of
+ * each subscriber.
+ *
  * @note Unlike the non-synchronized implementation, the Synchronized Scheduler will reschedule itself in the event that a timer
  * fires before a reportable timestamp is reached.
  *
@@ -84,6 +98,18 @@ public:
 
     void OnTransitionToIdle() override;
 
+    /** @brief Sends the reports deferred while the ICD was in idle mode, since the ICD is now active anyway.
+     */
+    void OnEnterActiveMode() override;
+
+    /** @brief Reschedules the next report so that the reports which can be deferred wait for the next max interval.
+     */
+    void OnEnterIdleMode() override;
+
+    /// @brief Enable or disable the deferral of reports while the ICD is in idle mode.
+    /// CHIP_CONFIG_SYNCHRONOUS_REPORTS_IDLE_COALESCING sets the default.
+    void SetIdleCoalescing(bool aEnabled) { mIdleCoalescing = aEnabled; }
+
     bool IsReportScheduled(ReadHandler * ReadHandler) override;
 
     /** @brief Callback called when the report timer expires to schedule an engine run regardless of the state of the ReadHandlers,
@@ -139,6 +165,12 @@ private:
      */
     CHIP_ERROR FindNextMaxInterval(const Timestamp & now);
 
+    /// @brief Whether the reports that only carry dirty attribute data are currently deferred
+    bool ShouldDeferReports() const { return mIdleCoalescing && mIsIdle; }
+
+    /// @brief Calculate the next report timeout and schedule the report if any handler is registered
+    void RescheduleReport(const Timestamp & now);
+
     /**
      *  @brief Calculate the next report timeout for all ReadHandlerNodes
      *
@@ -149,6 +181,8 @@ private:
      *  The next report timeout is calculated by looping through all the ReadHandlerNodes and finding if any are reportable now
      *      or at min.
      *   * If a ReadHandlerNode is reportable now, the timeout is set to 0.
+     *   * While the ICD is in idle mode, ReadHandlerNodes whose report can be deferred are ignored by the two checks below, their
+     *      reports are then sent with the next report due on the Scheduler's max timestamp.
      *   * If a ReadHandlerNode is reportable at min, the timeout is set to the difference between the Scheduler's  min timestamp
      *      and the current time.
      *   * If no ReadHandlerNode is reportable, the timeout is set to the difference between the Scheduler's max timestamp and the
@@ -179,6 +213,15 @@ private:
     // Timestamp of the next report to be scheduled, used by OnTransitionToIdle to determine whether we should emit a report before
     // the device goes to idle mode
     Timestamp mNextReportTimestamp = Milliseconds64(0);
+
+    // Operating mode of the ICD, as notified by the ICDStateObserver callbacks. The ICDManager starts in idle mode, and a
+    // scheduler registered after it was initialized is not notified of that mode.
+#if CHIP_CONFIG_ENABLE_ICD_SERVER
+    bool mIsIdle = true;
+#else
+    bool mIsIdle = false;
+#endif // CHIP_CONFIG_ENABLE_ICD_SERVER
+    bool mIdleCoalescing = CHIP_CONFIG_SYNCHRONOUS_REPORTS_IDLE_COALESCING;
 };
 
 } // namespace reporting
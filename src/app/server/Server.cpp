@@ -21,6 +21,7 @@
 
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
+#include <app/TransitionEngine.h>
 #include <app/server/Dnssd.h>
 #include <app/server/EchoHandler.h>
 #include <app/util/DataModelHandler.h>
@@ -622,6 +623,8 @@ void Server::Shutdown()
 #endif // CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY
 
     chip::Dnssd::Resolver::Instance().Shutdown();
+    // The transition engine runs its timer on the system layer of the interaction model engine
+    chip::app::TransitionEngine::Instance().Shutdown();
     chip::app::InteractionModelEngine::GetInstance()->Shutdown();
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
     app::InteractionModelEngine::GetInstance()->SetICDManager(nullptr);
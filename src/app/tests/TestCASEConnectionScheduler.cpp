@@ -0,0 +1,535 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstdio>
+#include <deque>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include <app/CASEConnectionScheduler.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+
+using Request = CASEConnectionScheduler::Request;
+
+void OnConnected(void * context, Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle) {}
+
+/// Records started setups; optionally completes them synchronously.
+class RecordingDelegate : public CASEConnectionScheduler::Delegate
+{
+public:
+    void StartSessionSetup(Request & request) override
+    {
+        // Take the callbacks, as CASESessionManager does
+        CASEConnectionScheduler::SuccessFailureCallbackList callbacks;
+        callbacks.EnqueueTakeAll(request.callbacks);
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+        mAttemptCounts.push_back(request.attemptCount);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+
+        const ScopedNodeId peerId = request.peerId;
+        mStarted.push_back(peerId);
+        mCapabilities.push_back(request.transportPayloadCapability);
+        if (mScheduler != nullptr)
+        {
+            mScheduler->OnSessionSetupComplete(peerId);
+        }
+    }
+
+    std::vector<ScopedNodeId> mStarted;
+    std::vector<TransportPayloadCapability> mCapabilities;
+    std::vector<uint8_t> mAttemptCounts;
+    CASEConnectionScheduler * mScheduler = nullptr; // complete synchronously if set
+};
+
+class TestCASEConnectionScheduler : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+protected:
+    static CASEConnectionScheduler::Config MakeConfig(uint16_t window, uint16_t udpRate = 0, uint16_t udpBurst = 1)
+    {
+        CASEConnectionScheduler::Config config;
+        config.window     = window;
+        config.buckets[0] = { udpRate, udpBurst };
+        config.buckets[1] = { 0, 1 };
+        return config;
+    }
+
+    CHIP_ERROR Enqueue(const ScopedNodeId & peerId, ConnectionPriority priority = ConnectionPriority::kNormal,
+                       TransportPayloadCapability capability = TransportPayloadCapability::kMRPPayload, uint8_t attemptCount = 1)
+    {
+        mCallbacks.emplace_back(OnConnected, nullptr);
+        return mScheduler.Enqueue(peerId, priority, capability, &mCallbacks.back(), nullptr, nullptr
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                  ,
+                                  attemptCount, nullptr
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+        );
+    }
+
+    CASEConnectionScheduler mScheduler;
+    RecordingDelegate mDelegate;
+    std::deque<Callback::Callback<OnDeviceConnected>> mCallbacks;
+};
+
+TEST_F(TestCASEConnectionScheduler, TestDisabledByZeroWindow)
+{
+    mScheduler.Init(&mDelegate, MakeConfig(0));
+    EXPECT_FALSE(mScheduler.IsEnabled());
+    EXPECT_EQ(Enqueue(ScopedNodeId(1, 1)), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_FALSE(mScheduler.Process(0_ms64).HasValue());
+    EXPECT_TRUE(mDelegate.mStarted.empty());
+}
+
+TEST_F(TestCASEConnectionScheduler, TestWindowLimitsConcurrency)
+{
+    mScheduler.Init(&mDelegate, MakeConfig(2));
+
+    for (NodeId node = 1; node <= 5; node++)
+    {
+        EXPECT_EQ(Enqueue(ScopedNodeId(node, 1)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(mScheduler.QueuedCount(), 5u);
+
+    EXPECT_FALSE(mScheduler.Process(0_ms64).HasValue());
+    ASSERT_EQ(mDelegate.mStarted.size(), 2u);
+    EXPECT_EQ(mScheduler.InProgressCount(), 2u);
+    EXPECT_EQ(mScheduler.QueuedCount(), 3u);
+
+    // Nothing more until a setup completes
+    mScheduler.Process(0_ms64);
+    EXPECT_EQ(mDelegate.mStarted.size(), 2u);
+
+    // Unknown peers do not release a slot
+    EXPECT_FALSE(mScheduler.OnSessionSetupComplete(ScopedNodeId(5, 1)));
+    EXPECT_TRUE(mScheduler.OnSessionSetupComplete(mDelegate.mStarted[0]));
+    mScheduler.Process(0_ms64);
+    ASSERT_EQ(mDelegate.mStarted.size(), 3u);
+
+    // Requests are served in order within a class and fabric
+    EXPECT_EQ(mDelegate.mStarted[0], ScopedNodeId(1, 1));
+    EXPECT_EQ(mDelegate.mStarted[1], ScopedNodeId(2, 1));
+    EXPECT_EQ(mDelegate.mStarted[2], ScopedNodeId(3, 1));
+
+    // Synchronous completion keeps admitting within the same Process() call
+    mDelegate.mScheduler = &mScheduler;
+    EXPECT_TRUE(mScheduler.OnSessionSetupComplete(ScopedNodeId(2, 1)));
+    mScheduler.Process(0_ms64);
+    EXPECT_EQ(mDelegate.mStarted.size(), 5u);
+    EXPECT_EQ(mScheduler.QueuedCount(), 0u);
+    EXPECT_EQ(mScheduler.InProgressCount(), 1u);
+
+    mScheduler.CancelAll();
+    EXPECT_EQ(mScheduler.InProgressCount(), 0u);
+}
+
+TEST_F(TestCASEConnectionScheduler, TestPriorityClasses)
+{
+    mScheduler.Init(&mDelegate, MakeConfig(1));
+    mDelegate.mScheduler = &mScheduler;
+
+    EXPECT_EQ(Enqueue(ScopedNodeId(1, 1), ConnectionPriority::kBackground), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(2, 1), ConnectionPriority::kNormal), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(3, 1), ConnectionPriority::kHigh), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(4, 1), ConnectionPriority::kBackground), CHIP_NO_ERROR);
+
+    // A later request for a queued peer merges into it and can promote it
+    EXPECT_EQ(Enqueue(ScopedNodeId(4, 1), ConnectionPriority::kHigh), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.QueuedCount(), 4u);
+
+    mScheduler.Process(0_ms64);
+
+    const std::vector<ScopedNodeId> expected = { ScopedNodeId(3, 1), ScopedNodeId(4, 1), ScopedNodeId(2, 1), ScopedNodeId(1, 1) };
+    EXPECT_EQ(mDelegate.mStarted, expected);
+}
+
+TEST_F(TestCASEConnectionScheduler, TestFairQueuingAcrossFabrics)
+{
+    mScheduler.Init(&mDelegate, MakeConfig(1));
+    mDelegate.mScheduler = &mScheduler;
+
+    // A fabric with a large backlog does not starve the others
+    for (NodeId node = 1; node <= 4; node++)
+    {
+        EXPECT_EQ(Enqueue(ScopedNodeId(node, 1)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(Enqueue(ScopedNodeId(10, 2)), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(11, 2)), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(20, 3)), CHIP_NO_ERROR);
+
+    mScheduler.Process(0_ms64);
+
+    const std::vector<ScopedNodeId> expected = {
+        ScopedNodeId(1, 1),  ScopedNodeId(10, 2), ScopedNodeId(20, 3), ScopedNodeId(2, 1),
+        ScopedNodeId(11, 2), ScopedNodeId(3, 1),  ScopedNodeId(4, 1),
+    };
+    EXPECT_EQ(mDelegate.mStarted, expected);
+}
+
+TEST_F(TestCASEConnectionScheduler, TestTokenBucketPacing)
+{
+    // 10 setups per second over UDP, bursts of 2; TCP is not limited
+    mScheduler.Init(&mDelegate, MakeConfig(100, 10, 2));
+
+    for (NodeId node = 1; node <= 5; node++)
+    {
+        EXPECT_EQ(Enqueue(ScopedNodeId(node, 1)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(Enqueue(ScopedNodeId(100, 1), ConnectionPriority::kNormal, TransportPayloadCapability::kLargePayload), CHIP_NO_ERROR);
+
+    // The burst goes out at once; the TCP request is not held back by the empty UDP bucket
+    auto retryAfter = mScheduler.Process(1000_ms64);
+    EXPECT_EQ(mDelegate.mStarted.size(), 3u);
+    ASSERT_TRUE(retryAfter.HasValue());
+    EXPECT_EQ(retryAfter.Value(), 100_ms);
+
+    // Too early: no token yet
+    retryAfter = mScheduler.Process(1050_ms64);
+    EXPECT_EQ(mDelegate.mStarted.size(), 3u);
+    ASSERT_TRUE(retryAfter.HasValue());
+    EXPECT_EQ(retryAfter.Value(), 50_ms);
+
+    mScheduler.Process(1100_ms64);
+    EXPECT_EQ(mDelegate.mStarted.size(), 4u);
+
+    // Tokens accumulate up to the burst size only
+    retryAfter = mScheduler.Process(5000_ms64);
+    EXPECT_EQ(mDelegate.mStarted.size(), 6u);
+    EXPECT_FALSE(retryAfter.HasValue());
+
+    mScheduler.CancelAll();
+}
+
+TEST_F(TestCASEConnectionScheduler, TestMergeCancelAndAbandon)
+{
+    mScheduler.Init(&mDelegate, MakeConfig(4));
+
+    EXPECT_EQ(Enqueue(ScopedNodeId(1, 1), ConnectionPriority::kNormal, TransportPayloadCapability::kMRPPayload, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(1, 1), ConnectionPriority::kNormal, TransportPayloadCapability::kMRPPayload, 3), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(2, 1)), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(3, 2)), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(4, 2)), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.QueuedCount(), 4u);
+
+    // The caller for node 2 goes away while queued: nothing is started for it
+    mCallbacks[2].Cancel();
+
+    // Fabric 2 is removed
+    mScheduler.CancelFabric(2);
+    EXPECT_EQ(mScheduler.QueuedCount(), 2u);
+
+    mScheduler.Process(0_ms64);
+    ASSERT_EQ(mDelegate.mStarted.size(), 1u);
+    EXPECT_EQ(mDelegate.mStarted[0], ScopedNodeId(1, 1));
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    EXPECT_EQ(mDelegate.mAttemptCounts[0], 3);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    EXPECT_EQ(mScheduler.QueuedCount(), 0u);
+    EXPECT_EQ(mScheduler.InProgressCount(), 1u);
+
+    mScheduler.CancelFabric(1);
+    EXPECT_EQ(mScheduler.InProgressCount(), 0u);
+}
+
+TEST_F(TestCASEConnectionScheduler, TestMergeKeepsTransportCapability)
+{
+    mScheduler.Init(&mDelegate, MakeConfig(4));
+
+    // Requests for the same peer are only merged when they need the same transport
+    EXPECT_EQ(Enqueue(ScopedNodeId(1, 1), ConnectionPriority::kNormal, TransportPayloadCapability::kMRPPayload), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(1, 1), ConnectionPriority::kNormal, TransportPayloadCapability::kLargePayload), CHIP_NO_ERROR);
+    EXPECT_EQ(Enqueue(ScopedNodeId(1, 1), ConnectionPriority::kNormal, TransportPayloadCapability::kMRPPayload), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.QueuedCount(), 2u);
+
+    mScheduler.Process(0_ms64);
+    ASSERT_EQ(mDelegate.mStarted.size(), 2u);
+    EXPECT_EQ(mDelegate.mCapabilities[0], TransportPayloadCapability::kMRPPayload);
+    EXPECT_EQ(mDelegate.mCapabilities[1], TransportPayloadCapability::kLargePayload);
+    EXPECT_EQ(mScheduler.InProgressCount(), 2u);
+
+    // Both share the session setup of the peer, and complete with it
+    EXPECT_TRUE(mScheduler.OnSessionSetupComplete(ScopedNodeId(1, 1)));
+    EXPECT_EQ(mScheduler.InProgressCount(), 0u);
+}
+
+struct FailureRecorder
+{
+    static void OnFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+    {
+        static_cast<FailureRecorder *>(context)->mFailures.push_back({ peerId, error });
+    }
+    static void OnSetupFailure(void * context, const OperationalSessionSetup::ConnectionFailureInfo & failureInfo)
+    {
+        static_cast<FailureRecorder *>(context)->mSetupFailures.push_back({ failureInfo.peerId, failureInfo.error });
+    }
+
+    std::vector<std::pair<ScopedNodeId, CHIP_ERROR>> mFailures;
+    std::vector<std::pair<ScopedNodeId, CHIP_ERROR>> mSetupFailures;
+};
+
+TEST_F(TestCASEConnectionScheduler, TestCancelNotifiesQueuedRequests)
+{
+    mScheduler.Init(&mDelegate, MakeConfig(1));
+
+    FailureRecorder recorder;
+    Callback::Callback<OnDeviceConnected> onConnected[3] = { { OnConnected, nullptr },
+                                                             { OnConnected, nullptr },
+                                                             { OnConnected, nullptr } };
+    Callback::Callback<OnDeviceConnectionFailure> onFailure[3] = { { FailureRecorder::OnFailure, &recorder },
+                                                                   { FailureRecorder::OnFailure, &recorder },
+                                                                   { FailureRecorder::OnFailure, &recorder } };
+    Callback::Callback<OperationalSessionSetup::OnSetupFailure> onSetupFailure(FailureRecorder::OnSetupFailure, &recorder);
+
+    const ScopedNodeId peers[3] = { ScopedNodeId(1, 1), ScopedNodeId(2, 1), ScopedNodeId(3, 2) };
+    for (size_t i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(mScheduler.Enqueue(peers[i], ConnectionPriority::kNormal, TransportPayloadCapability::kMRPPayload,
+                                     &onConnected[i], &onFailure[i], (i == 1) ? &onSetupFailure : nullptr
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                     ,
+                                     1, nullptr
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                     ),
+                  CHIP_NO_ERROR);
+    }
+
+    // Node 1 is admitted: its callbacks now belong to the session setup, not to the scheduler
+    mScheduler.Process(0_ms64);
+    ASSERT_EQ(mDelegate.mStarted.size(), 1u);
+    EXPECT_EQ(mScheduler.QueuedCount(), 2u);
+
+    // Node 2 is still queued when its fabric is removed
+    mScheduler.CancelFabric(1);
+    EXPECT_EQ(mScheduler.QueuedCount(), 1u);
+    EXPECT_EQ(mScheduler.InProgressCount(), 0u);
+    ASSERT_EQ(recorder.mFailures.size(), 1u);
+    EXPECT_EQ(recorder.mFailures[0].first, peers[1]);
+    EXPECT_EQ(recorder.mFailures[0].second, CHIP_ERROR_CANCELLED);
+    ASSERT_EQ(recorder.mSetupFailures.size(), 1u);
+    EXPECT_EQ(recorder.mSetupFailures[0].first, peers[1]);
+    EXPECT_EQ(recorder.mSetupFailures[0].second, CHIP_ERROR_CANCELLED);
+
+    // Node 3 is still queued when all sessions are released
+    mScheduler.CancelAll();
+    EXPECT_EQ(mScheduler.QueuedCount(), 0u);
+    ASSERT_EQ(recorder.mFailures.size(), 2u);
+    EXPECT_EQ(recorder.mFailures[1].first, peers[2]);
+    EXPECT_EQ(recorder.mFailures[1].second, CHIP_ERROR_CANCELLED);
+    EXPECT_EQ(recorder.mSetupFailures.size(), 1u);
+    EXPECT_EQ(mDelegate.mStarted.size(), 1u);
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP // the simulation queues more requests than a static pool holds
+
+/**
+ * Simulates session setup with many peers over a lossy, congestible link.
+ *
+ * Each setup needs kMessagesPerSetup message exchanges (address resolution and the CASE handshake).
+ * Every message is lost with a probability that grows with the number of handshakes competing for
+ * the link; losses are retransmitted with MRP-like backoff, and a setup whose message exhausts its
+ * retransmissions fails and is attempted again later, keeping its window slot.
+ */
+class LossyLinkSimulation : public CASEConnectionScheduler::Delegate
+{
+public:
+    static constexpr size_t kNodes                             = 200;
+    static constexpr int kMessagesPerSetup                     = 4;
+    static constexpr int kMaxRetransmissions                   = 4;
+    static constexpr System::Clock::Milliseconds64 kHop        = 30_ms64;
+    static constexpr System::Clock::Milliseconds64 kRetryDelay = 1000_ms64;
+    static constexpr System::Clock::Milliseconds64 kGiveUp     = 600000_ms64;
+
+    /// Returns the time it took for all nodes to connect
+    System::Clock::Milliseconds64 Run(const CASEConnectionScheduler::Config & config)
+    {
+        mScheduler.Init(this, config);
+        for (size_t i = 0; i < kNodes; i++)
+        {
+            mCallbacks.emplace_back(OnConnected, nullptr);
+            EXPECT_EQ(mScheduler.Enqueue(ScopedNodeId(i + 1, 1), ConnectionPriority::kBackground,
+                                         TransportPayloadCapability::kMRPPayload, &mCallbacks.back(), nullptr, nullptr
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                         ,
+                                         1, nullptr
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                         ),
+                      CHIP_NO_ERROR);
+        }
+
+        Schedule(0_ms64, kProcess);
+        while (!mEvents.empty() && mConnected < kNodes && mEvents.top().time < kGiveUp)
+        {
+            const Event event = mEvents.top();
+            mEvents.pop();
+            mNow = event.time;
+
+            if (event.node == kProcess)
+            {
+                ProcessScheduler();
+            }
+            else
+            {
+                HandleMessage(mNodes[event.node]);
+            }
+        }
+
+        EXPECT_EQ(mConnected, kNodes);
+        return mLastConnected;
+    }
+
+    void StartSessionSetup(Request & request) override
+    {
+        CASEConnectionScheduler::SuccessFailureCallbackList callbacks;
+        callbacks.EnqueueTakeAll(request.callbacks);
+
+        const size_t index = static_cast<size_t>(request.peerId.GetNodeId() - 1);
+        Node & node        = mNodes[index];
+        node.index         = index;
+        StartAttempt(node);
+    }
+
+private:
+    static constexpr size_t kProcess = SIZE_MAX;
+
+    struct Node
+    {
+        size_t index        = 0;
+        int messagesLeft    = 0;
+        int retransmissions = 0;
+    };
+
+    struct Event
+    {
+        System::Clock::Milliseconds64 time;
+        uint64_t sequence;
+        size_t node;
+        bool operator>(const Event & other) const
+        {
+            return (time != other.time) ? (time > other.time) : (sequence > other.sequence);
+        }
+    };
+
+    void Schedule(System::Clock::Milliseconds64 delay, size_t node) { mEvents.push({ mNow + delay, mSequence++, node }); }
+
+    void ProcessScheduler()
+    {
+        auto retryAfter = mScheduler.Process(mNow);
+        if (retryAfter.HasValue())
+        {
+            Schedule(retryAfter.Value(), kProcess);
+        }
+    }
+
+    void StartAttempt(Node & node)
+    {
+        node.messagesLeft    = kMessagesPerSetup;
+        node.retransmissions = 0;
+        mActive++;
+        Schedule(kHop, node.index);
+    }
+
+    void HandleMessage(Node & node)
+    {
+        // Retry attempt timer
+        if (node.messagesLeft == 0)
+        {
+            StartAttempt(node);
+            return;
+        }
+
+        // Loss grows with the number of handshakes sharing the link
+        const uint32_t lossPerMille = std::min<uint32_t>(900, 20 + 5 * static_cast<uint32_t>(mActive));
+        if (mRandom() % 1000 < lossPerMille)
+        {
+            if (node.retransmissions < kMaxRetransmissions)
+            {
+                // MRP-like exponential backoff starting at 300 ms
+                System::Clock::Milliseconds64 backoff(300);
+                for (int i = 0; i < node.retransmissions; i++)
+                {
+                    backoff = backoff * 8 / 5;
+                }
+                node.retransmissions++;
+                Schedule(backoff, node.index);
+                return;
+            }
+
+            // The attempt failed; try again later
+            node.messagesLeft = 0;
+            mActive--;
+            Schedule(kRetryDelay, node.index);
+            return;
+        }
+
+        node.retransmissions = 0;
+        if (--node.messagesLeft > 0)
+        {
+            Schedule(kHop, node.index);
+            return;
+        }
+
+        mActive--;
+        mConnected++;
+        mLastConnected    = mNow;
+        node.messagesLeft = -1; // done
+        if (mScheduler.OnSessionSetupComplete(ScopedNodeId(node.index + 1, 1)))
+        {
+            ProcessScheduler();
+        }
+    }
+
+    CASEConnectionScheduler mScheduler;
+    std::deque<Callback::Callback<OnDeviceConnected>> mCallbacks;
+    Node mNodes[kNodes];
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> mEvents;
+    std::minstd_rand mRandom{ 42 };
+    System::Clock::Milliseconds64 mNow{ 0 };
+    System::Clock::Milliseconds64 mLastConnected{ 0 };
+    uint64_t mSequence = 0;
+    size_t mActive     = 0;
+    size_t mConnected  = 0;
+};
+
+TEST_F(TestCASEConnectionScheduler, TestTimeToAllConnectedUnderLoss)
+{
+    // Without admission control every setup starts at once
+    LossyLinkSimulation unpaced;
+    const auto unpacedTime = unpaced.Run(MakeConfig(static_cast<uint16_t>(LossyLinkSimulation::kNodes)));
+
+    // A window of 16 setups, started at up to 50 per second
+    LossyLinkSimulation paced;
+    const auto pacedTime = paced.Run(MakeConfig(16, 50, 16));
+
+    printf("Time to connect %u nodes: %u ms without admission control, %u ms with\n",
+           static_cast<unsigned>(LossyLinkSimulation::kNodes), static_cast<unsigned>(unpacedTime.count()),
+           static_cast<unsigned>(pacedTime.count()));
+
+    EXPECT_LT(pacedTime, unpacedTime);
+}
+
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace
@@ -16,6 +16,7 @@
  *    limitations under the License.
  */
 
+#include <set>
 #include <string.h>
 #include <vector>
 
@@ -28,6 +29,7 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app/ClusterStateCache.h>
+#include <app/MessageDef/DataVersionFilterIB.h>
 #include <app/MessageDef/DataVersionFilterIBs.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
@@ -771,4 +773,157 @@ TEST_F(TestClusterStateCache, TestCache)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+
+class NullCacheCallback : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+// A bridged device: a large and a small cluster that do not change, and a measurement cluster that changes all the time.
+struct BridgedCluster
+{
+    ClusterId mClusterId;
+    uint32_t mSize;
+    bool mChanging;
+};
+
+const BridgedCluster kBridgedClusters[] = {
+    { Clusters::Descriptor::Id, 200, false },
+    { Clusters::BridgedDeviceBasicInformation::Id, 80, false },
+    { Clusters::TemperatureMeasurement::Id, 40, true },
+};
+
+// Report a cluster as a single octet string attribute of the given size.
+void ReportCluster(ReadClient::Callback & callback, EndpointId endpointId, const BridgedCluster & cluster, DataVersion dataVersion)
+{
+    uint8_t value[256] = {};
+    uint8_t buffer[300];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    EXPECT_EQ(writer.PutBytes(TLV::AnonymousTag(), value, cluster.mSize), CHIP_NO_ERROR);
+
+    TLV::TLVReader reader;
+    reader.Init(buffer, writer.GetLengthWritten());
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+    ConcreteDataAttributePath path(endpointId, cluster.mClusterId, 0);
+    path.mDataVersion.SetValue(dataVersion);
+    callback.OnAttributeData(path, &reader, StatusIB());
+}
+
+/*
+ * Simulates resubscribing to a 100-endpoint bridge after priming the cache, and measures how much of the
+ * priming data would be transferred again, with the filters that fit in an MTU-sized request and in a
+ * large-payload request.
+ */
+TEST_F(TestClusterStateCache, TestDataVersionFiltersOnResubscribe)
+{
+    constexpr EndpointId kEndpointCount    = 100;
+    constexpr DataVersion kInitialVersion  = 0x12345678;
+    constexpr unsigned kMeasurementReports = 5;
+
+    NullCacheCallback callback;
+    ClusterStateCache cache(callback);
+    ReadClient::Callback & readCallback = cache.GetBufferedCallback();
+
+    AttributePathParams wildcardPath;
+    const Span<AttributePathParams> pathSpan(&wildcardPath, 1);
+    {
+        uint8_t buf[20];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        DataVersionFilterIBs::Builder builder;
+        EXPECT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+        bool encodedDataVersionList = false;
+        EXPECT_EQ(readCallback.OnUpdateDataVersionFilterList(builder, pathSpan, encodedDataVersionList), CHIP_NO_ERROR);
+    }
+
+    // Priming, then a few reports of the measurement clusters.
+    size_t primingBytes = 0;
+    readCallback.OnReportBegin();
+    for (EndpointId endpointId = 1; endpointId <= kEndpointCount; endpointId++)
+    {
+        for (const auto & cluster : kBridgedClusters)
+        {
+            ReportCluster(readCallback, endpointId, cluster, kInitialVersion);
+            primingBytes += cluster.mSize;
+        }
+    }
+    readCallback.OnReportEnd();
+
+    for (DataVersion version = kInitialVersion + 1; version <= kInitialVersion + kMeasurementReports; version++)
+    {
+        readCallback.OnReportBegin();
+        for (EndpointId endpointId = 1; endpointId <= kEndpointCount; endpointId++)
+        {
+            ReportCluster(readCallback, endpointId, kBridgedClusters[2], version);
+        }
+        readCallback.OnReportEnd();
+    }
+
+    size_t resubscribeBytes[2] = {};
+    size_t filterCount[2]      = {};
+    bool filtersChanging[2]    = {};
+    const size_t budgets[]     = { 1024, 8192 }; // About what is left of an MTU-sized request, and of a large one
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> buf;
+        ASSERT_TRUE(buf.Calloc(budgets[i]));
+
+        TLV::TLVWriter writer;
+        writer.Init(buf.Get(), static_cast<uint32_t>(budgets[i]));
+        EXPECT_EQ(writer.ReserveBuffer(1), CHIP_NO_ERROR);
+        DataVersionFilterIBs::Builder builder;
+        EXPECT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+        bool encodedDataVersionList = false;
+        EXPECT_EQ(readCallback.OnUpdateDataVersionFilterList(builder, pathSpan, encodedDataVersionList), CHIP_NO_ERROR);
+        EXPECT_TRUE(encodedDataVersionList);
+        EXPECT_EQ(writer.UnreserveBuffer(1), CHIP_NO_ERROR);
+        EXPECT_EQ(builder.EndOfDataVersionFilterIBs(), CHIP_NO_ERROR);
+
+        std::set<std::pair<EndpointId, ClusterId>> filtered;
+        TLV::TLVReader reader;
+        TLV::TLVType containerType;
+        reader.Init(buf.Get(), writer.GetLengthWritten());
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.EnterContainer(containerType), CHIP_NO_ERROR);
+        while (reader.Next() == CHIP_NO_ERROR)
+        {
+            DataVersionFilterIB::Parser filter;
+            ClusterPathIB::Parser path;
+            EndpointId endpointId;
+            ClusterId clusterId;
+            EXPECT_EQ(filter.Init(reader), CHIP_NO_ERROR);
+            EXPECT_EQ(filter.GetPath(&path), CHIP_NO_ERROR);
+            EXPECT_EQ(path.GetEndpoint(&endpointId), CHIP_NO_ERROR);
+            EXPECT_EQ(path.GetCluster(&clusterId), CHIP_NO_ERROR);
+            filtered.insert(std::make_pair(endpointId, clusterId));
+        }
+        filterCount[i] = filtered.size();
+
+        // Clusters without a filter are sent again, and so are the measurement clusters, which will have changed.
+        for (EndpointId endpointId = 1; endpointId <= kEndpointCount; endpointId++)
+        {
+            for (const auto & cluster : kBridgedClusters)
+            {
+                const bool hasFilter = filtered.count(std::make_pair(endpointId, cluster.mClusterId)) != 0;
+                filtersChanging[i] |= hasFilter && cluster.mChanging;
+                resubscribeBytes[i] += (hasFilter && !cluster.mChanging) ? 0 : cluster.mSize;
+            }
+        }
+
+        ChipLogProgress(DataManagement, "Resubscribe with a %u-byte filter budget: %u filters, %u of %u priming bytes sent again",
+                        static_cast<unsigned>(budgets[i]), static_cast<unsigned>(filterCount[i]),
+                        static_cast<unsigned>(resubscribeBytes[i]), static_cast<unsigned>(primingBytes));
+    }
+
+    // Filters go to the largest clusters that are likely unchanged first, and all fit in a large payload.
+    EXPECT_GT(filterCount[0], 50u);
+    EXPECT_FALSE(filtersChanging[0]);
+    EXPECT_LT(resubscribeBytes[0], primingBytes);
+    EXPECT_EQ(filterCount[1], kEndpointCount * ArraySize(kBridgedClusters));
+    EXPECT_LT(resubscribeBytes[1] * 5, primingBytes);
+}
+
 } // namespace
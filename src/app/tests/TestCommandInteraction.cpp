@@ -1065,6 +1065,49 @@ TEST_F(TestCommandInteraction, TestCommandHandler_WithSendEmptyCommand)
     EXPECT_FALSE(commandHandler.mMockCommandResponder.mChunks.IsNull());
 }
 
+TEST_F(TestCommandInteraction, TestCommandHandler_PreparedResponsesShareInvokeResponseMessage)
+{
+    // Responses started with PrepareInvokeResponseCommand only move to a new InvokeResponseMessage once the
+    // current one runs out of space, so responding to a batch does not cost one message per command.
+    constexpr uint16_t kCommandCount = 8;
+
+    BasicCommandPathRegistry<kCommandCount> basicCommandPathRegistry;
+    MockCommandResponder mockCommandResponder;
+    CommandHandlerImpl::TestOnlyOverrides testOnlyOverrides{ &basicCommandPathRegistry, &mockCommandResponder };
+    CommandHandlerImpl commandHandler(testOnlyOverrides, &mockCommandHandlerDelegate);
+
+    for (uint16_t i = 0; i < kCommandCount; i++)
+    {
+        ConcreteCommandPath requestCommandPath = { kTestEndpointId, kTestClusterId,
+                                                   static_cast<CommandId>(kTestCommandIdWithData + i) };
+        EXPECT_EQ(basicCommandPathRegistry.Add(requestCommandPath, std::make_optional(i)), CHIP_NO_ERROR);
+    }
+
+    {
+        // This simulates how cluster would call CommandHandler APIs synchronously. There would
+        // be handle already acquired on the callers behalf.
+        CommandHandler::Handle handle(&commandHandler);
+
+        for (uint16_t i = 0; i < kCommandCount; i++)
+        {
+            ConcreteCommandPath requestCommandPath = { kTestEndpointId, kTestClusterId,
+                                                       static_cast<CommandId>(kTestCommandIdWithData + i) };
+            const CommandHandlerImpl::InvokeResponseParameters prepareParams(requestCommandPath);
+            EXPECT_EQ(commandHandler.PrepareInvokeResponseCommand(requestCommandPath, prepareParams), CHIP_NO_ERROR);
+            EXPECT_EQ(commandHandler.GetCommandDataIBTLVWriter()->PutBoolean(TLV::ContextTag(1), true), CHIP_NO_ERROR);
+            EXPECT_EQ(commandHandler.FinishCommand(), CHIP_NO_ERROR);
+        }
+    }
+
+    size_t messageCount = 0;
+    while (!mockCommandResponder.mChunks.IsNull())
+    {
+        mockCommandResponder.mChunks.PopHead();
+        messageCount++;
+    }
+    EXPECT_EQ(messageCount, 1u);
+}
+
 TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandSender_WithProcessReceivedMsg)
 {
 
@@ -0,0 +1,396 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/clusters/ota-requestor/DeltaOTAImageProcessor.h>
+#include <lib/core/OTAImageHeader.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <string.h>
+#include <vector>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint32_t kBaseVersion  = 1;
+constexpr uint32_t kImageVersion = 2;
+constexpr size_t kBlockSize      = 1024;
+
+const uint8_t kDeltaImageDigest[32] = { 0xd1, 0xd2, 0xd3, 0xd4 };
+const uint8_t kImageDigest[32]      = { 0x11, 0x12, 0x13, 0x14 };
+
+class TestBaseImage : public OTABaseImage
+{
+public:
+    TestBaseImage(const std::vector<uint8_t> & data, uint32_t version = kBaseVersion) : mData(data), mVersion(version) {}
+
+    uint32_t GetSoftwareVersion() override { return mVersion; }
+    uint64_t GetSize() override { return mData.size(); }
+    CHIP_ERROR Read(uint64_t offset, MutableByteSpan buffer) override
+    {
+        VerifyOrReturnError(offset + buffer.size() <= mData.size(), CHIP_ERROR_INVALID_ARGUMENT);
+        memcpy(buffer.data(), mData.data() + offset, buffer.size());
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    const std::vector<uint8_t> & mData;
+    uint32_t mVersion;
+};
+
+class TestDownloader : public OTADownloader
+{
+public:
+    CHIP_ERROR BeginPrepareDownload() override { return CHIP_NO_ERROR; }
+    CHIP_ERROR OnPreparedForDownload(CHIP_ERROR status) override { return CHIP_NO_ERROR; }
+    void OnDownloadTimeout() override {}
+    void EndDownload(CHIP_ERROR reason) override
+    {
+        mEnded     = true;
+        mEndReason = reason;
+        mImageProcessor->Abort();
+    }
+    CHIP_ERROR FetchNextData() override
+    {
+        mFetchRequested = true;
+        return CHIP_NO_ERROR;
+    }
+
+    bool mFetchRequested  = false;
+    bool mEnded           = false;
+    CHIP_ERROR mEndReason = CHIP_NO_ERROR;
+};
+
+/// Image processor storing the image it is given, which processes blocks asynchronously like actual ones
+class TestImageProcessor : public OTAImageProcessorInterface
+{
+public:
+    CHIP_ERROR PrepareDownload() override { return CHIP_NO_ERROR; }
+    CHIP_ERROR Finalize() override
+    {
+        mFinalized = true;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR Apply() override { return CHIP_NO_ERROR; }
+    CHIP_ERROR Abort() override
+    {
+        mAborted = true;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ProcessBlock(ByteSpan & block) override
+    {
+        EXPECT_FALSE(mBlockPending);
+        EXPECT_FALSE(mFinalized);
+        mImage.insert(mImage.end(), block.begin(), block.end());
+        mBlockPending = true;
+        return CHIP_NO_ERROR;
+    }
+    bool IsFirstImageRun() override { return false; }
+    CHIP_ERROR ConfirmCurrentImage() override { return CHIP_NO_ERROR; }
+
+    OTADownloader * mDownloader = nullptr;
+    std::vector<uint8_t> mImage;
+    bool mBlockPending = false;
+    bool mFinalized    = false;
+    bool mAborted      = false;
+};
+
+std::vector<uint8_t> MakeFirmware(size_t size, uint32_t seed)
+{
+    std::vector<uint8_t> firmware(size);
+    for (uint8_t & byte : firmware)
+    {
+        seed = seed * 1103515245 + 12345;
+        byte = static_cast<uint8_t>(seed >> 16);
+    }
+    return firmware;
+}
+
+void AppendVarint(std::vector<uint8_t> & out, uint64_t value)
+{
+    do
+    {
+        const uint8_t byte = static_cast<uint8_t>(value & 0x7F);
+        value >>= 7;
+        out.push_back(static_cast<uint8_t>(byte | (value != 0 ? 0x80 : 0)));
+    } while (value != 0);
+}
+
+/// Append a patch entry rebuilding diffImage from the base data at base, followed by extra, then seeking by seek
+void AppendPatchEntry(std::vector<uint8_t> & patch, const uint8_t * base, ByteSpan diffImage, ByteSpan extra, int64_t seek)
+{
+    AppendVarint(patch, diffImage.size());
+    AppendVarint(patch, extra.size());
+    AppendVarint(patch, (static_cast<uint64_t>(seek) << 1) ^ static_cast<uint64_t>(seek >> 63));
+
+    size_t offset = 0;
+    while (offset < diffImage.size())
+    {
+        size_t zeros = 0;
+        while (offset + zeros < diffImage.size() && diffImage[offset + zeros] == base[offset + zeros])
+        {
+            zeros++;
+        }
+
+        // Short runs of zeros are cheaper as literals
+        size_t literals = 0;
+        size_t matches  = 0;
+        while (offset + zeros + literals + matches < diffImage.size() && matches < 3)
+        {
+            const size_t i = offset + zeros + literals + matches;
+            if (diffImage[i] == base[i])
+            {
+                matches++;
+                continue;
+            }
+            literals += matches + 1;
+            matches = 0;
+        }
+
+        AppendVarint(patch, zeros);
+        AppendVarint(patch, literals);
+        for (size_t i = offset + zeros; i < offset + zeros + literals; i++)
+        {
+            patch.push_back(static_cast<uint8_t>(diffImage[i] - base[i]));
+        }
+        offset += zeros + literals;
+    }
+
+    patch.insert(patch.end(), extra.begin(), extra.end());
+}
+
+std::vector<uint8_t> MakeImage(const std::vector<uint8_t> & payload, const Optional<OTAImageDeltaHeader> & delta = NullOptional)
+{
+    OTAImageHeader header;
+    header.mVendorId              = 0xFFF1;
+    header.mProductId             = 0x8000;
+    header.mSoftwareVersion       = kImageVersion;
+    header.mSoftwareVersionString = CharSpan::fromCharString("2.0");
+    header.mPayloadSize           = payload.size();
+    header.mImageDigestType       = OTAImageDigestType::kSha256;
+    header.mImageDigest           = delta.HasValue() ? ByteSpan(kDeltaImageDigest) : ByteSpan(kImageDigest);
+    header.mDelta                 = delta;
+
+    std::vector<uint8_t> image(256);
+    MutableByteSpan headerSpan(image.data(), image.size());
+    EXPECT_EQ(EncodeOTAImageHeader(header, headerSpan), CHIP_NO_ERROR);
+    image.resize(headerSpan.size());
+    image.insert(image.end(), payload.begin(), payload.end());
+    return image;
+}
+
+std::vector<uint8_t> MakeDeltaImage(const std::vector<uint8_t> & patch, uint64_t imageSize, uint32_t baseVersion = kBaseVersion)
+{
+    OTAImageDeltaHeader delta;
+    delta.mBaseSoftwareVersion = baseVersion;
+    delta.mImageSize           = imageSize;
+    delta.mImageDigest         = ByteSpan(kImageDigest);
+    return MakeImage(patch, MakeOptional(delta));
+}
+
+class TestDeltaOTAImageProcessor : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mImageProcessor.mDownloader = mDeltaImageProcessor.GetImageProcessorDownloader();
+        mDeltaImageProcessor.Init(&mImageProcessor, &mBaseImage);
+        mDeltaImageProcessor.SetOTADownloader(&mDownloader);
+        mDownloader.SetImageProcessorDelegate(&mDeltaImageProcessor);
+    }
+
+    // Download an image in blocks, as BDXDownloader does, and return the number of bytes downloaded
+    size_t Download(const std::vector<uint8_t> & image, size_t blockSize = kBlockSize)
+    {
+        size_t offset = 0;
+
+        EXPECT_EQ(mDeltaImageProcessor.PrepareDownload(), CHIP_NO_ERROR);
+        mDownloader.mFetchRequested = true;
+
+        while (!mDownloader.mEnded)
+        {
+            if (mImageProcessor.mBlockPending)
+            {
+                mImageProcessor.mBlockPending = false;
+                EXPECT_EQ(mImageProcessor.mDownloader->FetchNextData(), CHIP_NO_ERROR);
+            }
+            else if (mDownloader.mFetchRequested && offset < image.size())
+            {
+                ByteSpan block(image.data() + offset, std::min(blockSize, image.size() - offset));
+                mDownloader.mFetchRequested = false;
+                offset += block.size();
+
+                EXPECT_EQ(mDeltaImageProcessor.ProcessBlock(block), CHIP_NO_ERROR);
+                if (offset == image.size())
+                {
+                    EXPECT_EQ(mDeltaImageProcessor.Finalize(), CHIP_NO_ERROR);
+                }
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        return offset;
+    }
+
+    // Check that the image processor was given a full image of the given payload
+    void ExpectImage(const std::vector<uint8_t> & payload)
+    {
+        OTAImageHeaderParser parser;
+        OTAImageHeader header;
+        ByteSpan image(mImageProcessor.mImage.data(), mImageProcessor.mImage.size());
+
+        parser.Init();
+        ASSERT_EQ(parser.AccumulateAndDecode(image, header), CHIP_NO_ERROR);
+        EXPECT_EQ(header.mSoftwareVersion, kImageVersion);
+        EXPECT_EQ(header.mPayloadSize, payload.size());
+        EXPECT_TRUE(header.mImageDigest.data_equal(ByteSpan(kImageDigest)));
+        EXPECT_FALSE(header.mDelta.HasValue());
+        EXPECT_TRUE(image.data_equal(ByteSpan(payload.data(), payload.size())));
+        parser.Clear();
+    }
+
+    std::vector<uint8_t> mBase = MakeFirmware(256 * 1024, 1);
+    TestBaseImage mBaseImage{ mBase };
+    TestDownloader mDownloader;
+    TestImageProcessor mImageProcessor;
+    DeltaOTAImageProcessor mDeltaImageProcessor;
+};
+
+TEST_F(TestDeltaOTAImageProcessor, TestFullImage)
+{
+    const std::vector<uint8_t> payload = MakeFirmware(10000, 2);
+    const std::vector<uint8_t> image   = MakeImage(payload);
+
+    EXPECT_EQ(Download(image), image.size());
+    EXPECT_FALSE(mDownloader.mEnded);
+    EXPECT_TRUE(mImageProcessor.mFinalized);
+    EXPECT_TRUE(mImageProcessor.mImage == image);
+    EXPECT_EQ(mDeltaImageProcessor.GetBytesDownloaded(), mImageProcessor.GetBytesDownloaded());
+}
+
+// A typical patch release: a few scattered changes and some inserted code. The delta image is compared
+// to the full image in terms of bytes transferred.
+TEST_F(TestDeltaOTAImageProcessor, TestDeltaImage)
+{
+    constexpr size_t kInsertOffset     = 100 * 1024;
+    constexpr size_t kChangedOffsets[] = { 1000, 1004, 50000, 50001, 99999, 150000, 200000, 262000 };
+
+    const std::vector<uint8_t> inserted = MakeFirmware(2048, 3);
+    std::vector<uint8_t> payload        = mBase;
+    for (size_t offset : kChangedOffsets)
+    {
+        payload[offset] = static_cast<uint8_t>(payload[offset] ^ 0x5A);
+    }
+    payload.insert(payload.begin() + kInsertOffset, inserted.begin(), inserted.end());
+
+    std::vector<uint8_t> patch;
+    AppendPatchEntry(patch, mBase.data(), ByteSpan(payload.data(), kInsertOffset), ByteSpan(inserted.data(), inserted.size()), 0);
+    AppendPatchEntry(patch, mBase.data() + kInsertOffset,
+                     ByteSpan(payload.data() + kInsertOffset + inserted.size(), mBase.size() - kInsertOffset), ByteSpan(), 0);
+
+    const std::vector<uint8_t> fullImage  = MakeImage(payload);
+    const std::vector<uint8_t> deltaImage = MakeDeltaImage(patch, payload.size());
+
+    for (size_t blockSize : { kBlockSize, size_t{ 7 } })
+    {
+        mImageProcessor.mImage.clear();
+        mImageProcessor.mFinalized = false;
+
+        const size_t transferred = Download(deltaImage, blockSize);
+        EXPECT_FALSE(mDownloader.mEnded);
+        EXPECT_TRUE(mImageProcessor.mFinalized);
+        ExpectImage(payload);
+        EXPECT_EQ(mDeltaImageProcessor.GetBytesDownloaded(), patch.size());
+        EXPECT_EQ(mDeltaImageProcessor.GetPercentComplete().Value(), 100);
+
+        ChipLogProgress(SoftwareUpdate, "Transferred %u bytes for a %u-byte full image", static_cast<unsigned>(transferred),
+                        static_cast<unsigned>(fullImage.size()));
+        EXPECT_EQ(transferred, deltaImage.size());
+        EXPECT_LT(transferred * 20, fullImage.size());
+    }
+}
+
+TEST_F(TestDeltaOTAImageProcessor, TestSeek)
+{
+    const uint8_t hello[] = { 'h', 'e', 'l', 'l', 'o' };
+    std::vector<uint8_t> payload(mBase.begin() + 100, mBase.begin() + 200);
+    payload.insert(payload.end(), std::begin(hello), std::end(hello));
+    payload.insert(payload.end(), mBase.begin(), mBase.begin() + 50);
+
+    std::vector<uint8_t> patch;
+    AppendPatchEntry(patch, mBase.data(), ByteSpan(), ByteSpan(), 100);
+    AppendPatchEntry(patch, mBase.data() + 100, ByteSpan(payload.data(), 100), ByteSpan(hello), -200);
+    AppendPatchEntry(patch, mBase.data(), ByteSpan(payload.data() + 105, 50), ByteSpan(), 0);
+
+    Download(MakeDeltaImage(patch, payload.size()), 3);
+    EXPECT_FALSE(mDownloader.mEnded);
+    EXPECT_TRUE(mImageProcessor.mFinalized);
+    ExpectImage(payload);
+}
+
+TEST_F(TestDeltaOTAImageProcessor, TestBaseVersionMismatch)
+{
+    std::vector<uint8_t> patch;
+    AppendPatchEntry(patch, mBase.data(), ByteSpan(mBase.data(), 1000), ByteSpan(), 0);
+
+    Download(MakeDeltaImage(patch, 1000, kBaseVersion + 1));
+    EXPECT_TRUE(mDownloader.mEnded);
+    EXPECT_EQ(mDownloader.mEndReason, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+    EXPECT_TRUE(mImageProcessor.mAborted);
+    EXPECT_TRUE(mImageProcessor.mImage.empty());
+}
+
+TEST_F(TestDeltaOTAImageProcessor, TestInvalidPatch)
+{
+    // Reads past the end of the base image
+    std::vector<uint8_t> patch;
+    AppendPatchEntry(patch, mBase.data(), ByteSpan(), ByteSpan(), static_cast<int64_t>(mBase.size()) - 10);
+    AppendPatchEntry(patch, mBase.data() + mBase.size() - 10, ByteSpan(mBase.data() + mBase.size() - 10, 10), ByteSpan(), 0);
+    AppendPatchEntry(patch, mBase.data(), ByteSpan(mBase.data(), 10), ByteSpan(), 0);
+
+    Download(MakeDeltaImage(patch, 30));
+    EXPECT_TRUE(mDownloader.mEnded);
+    EXPECT_EQ(mDownloader.mEndReason, CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_TRUE(mImageProcessor.mAborted);
+    EXPECT_FALSE(mImageProcessor.mFinalized);
+}
+
+TEST_F(TestDeltaOTAImageProcessor, TestTruncatedPatch)
+{
+    std::vector<uint8_t> patch;
+    AppendPatchEntry(patch, mBase.data(), ByteSpan(), ByteSpan(mBase.data(), 5000), 0);
+    patch.resize(patch.size() - 1);
+
+    Download(MakeDeltaImage(patch, 5000));
+    EXPECT_TRUE(mDownloader.mEnded);
+    EXPECT_EQ(mDownloader.mEndReason, CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_FALSE(mImageProcessor.mFinalized);
+}
+
+} // namespace
@@ -0,0 +1,216 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/util/EndpointIndexMap.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <pw_unit_test/framework.h>
+
+#include <chrono>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr uint16_t kInvalidIndex = EndpointIndexMap<1>::kInvalidIndex;
+
+// Size of a PartsList report listing the given number of consecutive endpoints starting at firstEndpoint
+uint32_t PartsListSize(EndpointId firstEndpoint, uint16_t endpointCount)
+{
+    uint8_t buffer[4096];
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+    writer.Init(buffer);
+
+    EXPECT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType), CHIP_NO_ERROR);
+    for (uint16_t i = 0; i < endpointCount; i++)
+    {
+        EXPECT_EQ(writer.Put(TLV::AnonymousTag(), static_cast<EndpointId>(firstEndpoint + i)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(writer.EndContainer(outerType), CHIP_NO_ERROR);
+    return writer.GetLengthWritten();
+}
+
+TEST(TestEndpointIndexMap, TestInsertFindRemove)
+{
+    EndpointIndexMap<8> map;
+
+    EXPECT_EQ(map.Find(1), kInvalidIndex);
+    EXPECT_EQ(map.Insert(1, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(map.Insert(5, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(map.Count(), 2u);
+    EXPECT_EQ(map.Find(1), 0u);
+    EXPECT_EQ(map.Find(5), 1u);
+    EXPECT_EQ(map.Find(2), kInvalidIndex);
+
+    EXPECT_EQ(map.Insert(1, 3), CHIP_ERROR_ENDPOINT_EXISTS);
+    EXPECT_EQ(map.Find(1), 0u);
+    EXPECT_EQ(map.Insert(kInvalidEndpointId, 3), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(map.Find(kInvalidEndpointId), kInvalidIndex);
+
+    map.Remove(1);
+    map.Remove(1);
+    map.Remove(7);
+    EXPECT_EQ(map.Count(), 1u);
+    EXPECT_EQ(map.Find(1), kInvalidIndex);
+    EXPECT_EQ(map.Find(5), 1u);
+
+    map.Clear();
+    EXPECT_EQ(map.Count(), 0u);
+    EXPECT_EQ(map.Find(5), kInvalidIndex);
+}
+
+TEST(TestEndpointIndexMap, TestCollisions)
+{
+    // 16 buckets: all these endpoints share the same home bucket and form a single probe sequence, wrapping around the table
+    EndpointIndexMap<8> map;
+    const EndpointId endpoints[] = { 15, 31, 47, 63, 0xFFEF, 0 };
+
+    for (uint16_t i = 0; i < ArraySize(endpoints); i++)
+    {
+        EXPECT_EQ(map.Insert(endpoints[i], i), CHIP_NO_ERROR);
+    }
+    // Endpoints 0 and 16 start probing from bucket 0, already taken by the sequence wrapping around
+    EXPECT_EQ(map.Insert(16, 6), CHIP_NO_ERROR);
+
+    // Removing from the middle of the sequence must keep the following entries reachable
+    map.Remove(31);
+    EXPECT_EQ(map.Find(31), kInvalidIndex);
+    for (uint16_t i = 0; i < ArraySize(endpoints); i++)
+    {
+        if (endpoints[i] != 31)
+        {
+            EXPECT_EQ(map.Find(endpoints[i]), i);
+        }
+    }
+    EXPECT_EQ(map.Find(16), 6u);
+
+    map.Remove(15);
+    map.Remove(0);
+    EXPECT_EQ(map.Find(47), 2u);
+    EXPECT_EQ(map.Find(63), 3u);
+    EXPECT_EQ(map.Find(0xFFEF), 4u);
+    EXPECT_EQ(map.Find(16), 6u);
+    EXPECT_EQ(map.Count(), 4u);
+}
+
+TEST(TestEndpointIndexMap, TestFull)
+{
+    EndpointIndexMap<4> map;
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(map.Insert(static_cast<EndpointId>(100 + i), i), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(map.Insert(200, 4), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(map.Insert(101, 4), CHIP_ERROR_ENDPOINT_EXISTS);
+
+    map.Remove(102);
+    EXPECT_EQ(map.Insert(200, 2), CHIP_NO_ERROR);
+    EXPECT_EQ(map.Find(200), 2u);
+}
+
+TEST(TestEndpointIndexMap, TestBridgeRegistrationBenchmark)
+{
+    // A bridge registering 1000 devices on dynamic endpoints under its aggregator endpoint, as emberAfSetDynamicEndpoint does:
+    // check that the endpoint id is free, then look up the parent endpoint to report the change of its PartsList.
+    constexpr uint16_t kFixedEndpointCount = 2;
+    constexpr uint16_t kBridgedCount       = 1000;
+    constexpr uint16_t kSlotCount          = kFixedEndpointCount + kBridgedCount;
+    constexpr EndpointId kAggregator       = 1;
+    constexpr EndpointId kFirstBridged     = 3;
+
+    static EndpointId slots[kSlotCount];
+    static EndpointIndexMap<kSlotCount> map;
+
+    auto linearFind = [](EndpointId endpoint) -> uint16_t {
+        for (uint16_t i = 0; i < kSlotCount; i++)
+        {
+            if (slots[i] == endpoint)
+            {
+                return i;
+            }
+        }
+        return kInvalidIndex;
+    };
+
+    // Linear slot scans
+    for (EndpointId & slot : slots)
+    {
+        slot = kInvalidEndpointId;
+    }
+    slots[0] = 0;
+    slots[1] = kAggregator;
+
+    uint32_t found         = 0;
+    const auto linearStart = std::chrono::steady_clock::now();
+    for (uint16_t i = 0; i < kBridgedCount; i++)
+    {
+        const EndpointId endpoint = static_cast<EndpointId>(kFirstBridged + i);
+        VerifyOrDie(linearFind(endpoint) == kInvalidIndex);
+        slots[kFixedEndpointCount + i] = endpoint;
+        found += (linearFind(kAggregator) != kInvalidIndex) ? 1 : 0;
+    }
+    const auto linearElapsed = std::chrono::steady_clock::now() - linearStart;
+    EXPECT_EQ(found, kBridgedCount);
+
+    // Index map lookups
+    map.Clear();
+    EXPECT_EQ(map.Insert(0, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(map.Insert(kAggregator, 1), CHIP_NO_ERROR);
+
+    found               = 0;
+    const auto mapStart = std::chrono::steady_clock::now();
+    for (uint16_t i = 0; i < kBridgedCount; i++)
+    {
+        const EndpointId endpoint = static_cast<EndpointId>(kFirstBridged + i);
+        VerifyOrDie(map.Find(endpoint) == kInvalidIndex);
+        VerifyOrDie(map.Insert(endpoint, static_cast<uint16_t>(kFixedEndpointCount + i)) == CHIP_NO_ERROR);
+        found += (map.Find(kAggregator) != kInvalidIndex) ? 1 : 0;
+    }
+    const auto mapElapsed = std::chrono::steady_clock::now() - mapStart;
+    EXPECT_EQ(found, kBridgedCount);
+    EXPECT_EQ(map.Count(), kSlotCount);
+
+    for (uint16_t i = 0; i < kBridgedCount; i++)
+    {
+        EXPECT_EQ(map.Find(static_cast<EndpointId>(kFirstBridged + i)), kFixedEndpointCount + i);
+    }
+
+    // The PartsList of the aggregator lists every bridged endpoint. Reporting it after each registration re-encodes the whole
+    // list every time, whereas a registration grouped by emberAfBeginDynamicEndpointUpdate reports it once. The per-registration
+    // total is an upper bound: reports of consecutive changes may be merged while the min interval of a subscription elapses.
+    const uint32_t batchedSize   = PartsListSize(kFirstBridged, kBridgedCount);
+    uint64_t perRegistrationSize = 0;
+    for (uint16_t count = 1; count <= kBridgedCount; count++)
+    {
+        perRegistrationSize += PartsListSize(kFirstBridged, count);
+    }
+    EXPECT_LT(static_cast<uint64_t>(batchedSize) * 100, perRegistrationSize);
+
+    const auto linearNs = std::chrono::duration_cast<std::chrono::nanoseconds>(linearElapsed).count();
+    const auto mapNs    = std::chrono::duration_cast<std::chrono::nanoseconds>(mapElapsed).count();
+    ChipLogProgress(Zcl, "%u bridged endpoints: %u ns per registration with slot scans, %u ns with the index map",
+                    static_cast<unsigned>(kBridgedCount), static_cast<unsigned>(linearNs / kBridgedCount),
+                    static_cast<unsigned>(mapNs / kBridgedCount));
+    ChipLogProgress(Zcl, "PartsList of %u endpoints: %u bytes reported once, up to %u bytes reported per registration",
+                    static_cast<unsigned>(kBridgedCount), static_cast<unsigned>(batchedSize),
+                    static_cast<unsigned>(perRegistrationSize));
+}
+
+} // namespace
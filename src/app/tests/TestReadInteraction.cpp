@@ -17,6 +17,7 @@
  */
 #include <access/examples/PermissiveAccessControlDelegate.h>
 #include <app/AttributeValueEncoder.h>
+#include <app/BufferedReadCallback.h>
 #include <app/InteractionModelEngine.h>
 #include <app/InteractionModelHelper.h>
 #include <app/MessageDef/AttributeReportIBs.h>
@@ -43,6 +44,8 @@
 #include <protocols/interaction_model/Constants.h>
 #include <pw_unit_test/framework.h>
 
+#include <vector>
+
 namespace {
 uint8_t gDebugEventBuffer[128];
 uint8_t gInfoEventBuffer[128];
@@ -1323,6 +1326,99 @@ TEST_F(TestReadInteraction, TestReadChunking)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+// Make a session look like a session over TCP, which allows large payloads, or like one over UDP again.
+void SetSessionTransport(const SessionHandle & session, Transport::Type type)
+{
+    Transport::SecureSession * secureSession = session->AsSecureSession();
+    Transport::PeerAddress address           = secureSession->GetPeerAddress();
+    secureSession->SetPeerAddress(address.SetTransportType(type));
+    secureSession->SetTCPConnection(nullptr);
+}
+
+TEST_F(TestReadInteraction, TestReadLargeBridgeOverUdpAndTcp)
+{
+    using namespace chip::app::Clusters::Globals::Attributes;
+    using namespace chip::Test;
+
+    constexpr EndpointId kBridgedEndpointCount = 200;
+
+    // A bridge with many endpoints, each with a list attribute too large for a single MTU-sized report.
+    std::vector<MockEndpointConfig> endpoints;
+    for (EndpointId endpoint = 1; endpoint <= kBridgedEndpointCount; endpoint++)
+    {
+        // clang-format off
+        endpoints.emplace_back(endpoint, std::initializer_list<MockClusterConfig>{
+            MockClusterConfig(MockClusterId(1), {
+                ClusterRevision::Id, FeatureMap::Id, MockAttributeId(1),
+            }),
+            MockClusterConfig(MockClusterId(2), {
+                ClusterRevision::Id, MockAttributeId(2), MockAttributeId(4),
+            }),
+        });
+        // clang-format on
+    }
+    const MockNodeConfig bridgeConfig(std::move(endpoints));
+    SetMockNodeConfig(bridgeConfig);
+
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    int numAttributes[2]      = {};
+    int numArrayItems[2]      = {};
+    uint32_t numMessages[2]   = {};
+    const char * transports[] = { "UDP", "TCP" };
+
+    for (int largePayload = 0; largePayload < 2; largePayload++)
+    {
+        const Transport::Type type = largePayload ? Transport::Type::kTcp : Transport::Type::kUdp;
+        SetSessionTransport(GetSessionBobToAlice(), type);
+        SetSessionTransport(GetSessionAliceToBob(), type);
+
+        MockInteractionModelApp delegate;
+        app::BufferedReadCallback bufferedCallback(delegate);
+
+        // Wildcard read of everything.
+        chip::app::AttributePathParams attributePathParams[1];
+        ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+
+        const uint32_t sentBefore = GetLoopback().mSentMessageCount;
+        const uint64_t startUs    = gRealClock->GetMonotonicMicroseconds64().count();
+        {
+            app::ReadClient readClient(engine, &GetExchangeManager(), bufferedCallback,
+                                       chip::app::ReadClient::InteractionType::Read);
+
+            EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+            DrainAndServiceIO();
+        }
+        const uint64_t elapsedUs = gRealClock->GetMonotonicMicroseconds64().count() - startUs;
+
+        EXPECT_FALSE(delegate.mReadError);
+        numAttributes[largePayload] = delegate.mNumAttributeResponse;
+        numArrayItems[largePayload] = delegate.mNumArrayItems;
+        numMessages[largePayload]   = GetLoopback().mSentMessageCount - sentBefore;
+
+        ChipLogProgress(DataManagement, "Read of %u endpoints over %s: %d attributes in %u messages, %u us",
+                        static_cast<unsigned>(kBridgedEndpointCount), transports[largePayload], numAttributes[largePayload],
+                        static_cast<unsigned>(numMessages[largePayload]), static_cast<unsigned>(elapsedUs));
+    }
+
+    SetSessionTransport(GetSessionBobToAlice(), Transport::Type::kUdp);
+    SetSessionTransport(GetSessionAliceToBob(), Transport::Type::kUdp);
+    SetMockNodeConfig(TestMockNodeConfig());
+
+    // Both reads see the same data, with every list delivered whole, but larger chunks need far fewer messages.
+    EXPECT_EQ(numAttributes[0], numAttributes[1]);
+    EXPECT_EQ(numArrayItems[0], kBridgedEndpointCount * kMockAttribute4ListLength);
+    EXPECT_EQ(numArrayItems[1], kBridgedEndpointCount * kMockAttribute4ListLength);
+    EXPECT_LT(numMessages[1] * 10, numMessages[0]);
+
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 TEST_F(TestReadInteraction, TestSetDirtyBetweenChunks)
 {
 
@@ -25,6 +25,9 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <pw_unit_test/framework.h>
+
+#include <algorithm>
+
 namespace {
 
 class NullReadHandlerCallback : public chip::app::ReadHandler::ManagementCallback
@@ -58,13 +61,26 @@ public:
     void TestReportTiming();
     void TestObserverCallbacks();
     void TestSynchronizedScheduler();
+    void TestSynchronizedSchedulerIdleCoalescing();
+    void TestSynchronizedSchedulerIdleWorkload();
+
+    struct WorkloadStats
+    {
+        uint32_t mActiveModeTransitions = 0;
+        uint32_t mReports               = 0;
+        Milliseconds64 mMaxUrgentEventLatency{ 0 };
+        bool mMaxIntervalExceeded = false;
+    };
+
+    /// @brief Simulates an hour of a sensor ICD with several subscribers and reports the active mode periods it needed.
+    WorkloadStats SimulateSensorWorkload(bool idleCoalescing);
 
     /// @brief Mimicks the various operations that happen on a subscription transaction after a read handler was created so that
     /// readhandlers are in the expected state for further tests.
     /// @param readHandler
     /// @param scheduler
     static CHIP_ERROR MockReadHandlerSubscriptionTransaction(ReadHandler * readHandler, ReportScheduler * scheduler,
-                                                             uint8_t min_interval_seconds, uint8_t max_interval_seconds)
+                                                             uint16_t min_interval_seconds, uint16_t max_interval_seconds)
     {
         ReturnErrorOnFailure(readHandler->SetMaxReportingInterval(max_interval_seconds));
         ReturnErrorOnFailure(readHandler->SetMinReportingIntervalForTests(min_interval_seconds));
@@ -76,6 +92,21 @@ public:
         return CHIP_NO_ERROR;
     }
 
+    /// @brief Mimicks an attribute change on a path of the subscription, which only makes the read handler dirty
+    static void MockAttributeChange(ReadHandler * readHandler)
+    {
+        readHandler->mDirtyGeneration = readHandler->mPreviousReportsBeginGeneration + 1;
+        readHandler->mObserver->OnBecameReportable(readHandler);
+    }
+
+    /// @brief Mimicks the emission of a report by the reporting engine, which clears the dirty state of the read handler
+    static void MockReportSent(ReadHandler * readHandler)
+    {
+        readHandler->mPreviousReportsBeginGeneration = readHandler->mDirtyGeneration;
+        readHandler->ClearForceDirtyFlag();
+        readHandler->mObserver->OnSubscriptionReportSent(readHandler);
+    }
+
     static ReadHandler * GetReadHandlerFromPool(ReportScheduler * scheduler, uint32_t target)
     {
         uint32_t i        = 0;
@@ -807,6 +838,264 @@ TEST_F_FROM_FIXTURE(TestReportScheduler, TestSynchronizedScheduler)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE(TestReportScheduler, TestSynchronizedSchedulerIdleCoalescing)
+{
+    NullReadHandlerCallback nullCallback;
+    // exchange context
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+
+    // Read handler pool
+    ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+
+    // Initialize the mock system time
+    sTestTimerSynchronizedDelegate.SetMockSystemTimestamp(System::Clock::Milliseconds64(0));
+    syncScheduler.SetIdleCoalescing(true);
+
+    ReadHandler * readHandler1 = readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe,
+                                                              &syncScheduler, CodegenDataModelProviderInstance());
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler1, &syncScheduler, 0, 10));
+    ReadHandlerNode * node1 = syncScheduler.FindReadHandlerNode(readHandler1);
+
+    ReadHandler * readHandler2 = readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe,
+                                                              &syncScheduler, CodegenDataModelProviderInstance());
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler2, &syncScheduler, 1, 20));
+    ReadHandlerNode * node2 = syncScheduler.FindReadHandlerNode(readHandler2);
+
+    syncScheduler.OnEnterIdleMode();
+    EXPECT_EQ(syncScheduler.mNextReportTimestamp, node1->GetMaxTimestamp());
+
+    // An attribute change during idle mode does not trigger a report, it is deferred to the next max interval
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(2000));
+    MockAttributeChange(readHandler2);
+    EXPECT_FALSE(node2->IsEngineRunScheduled());
+    EXPECT_EQ(syncScheduler.mNextReportTimestamp, node1->GetMaxTimestamp());
+
+    // Both handlers report on the max interval of readHandler1
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(8000));
+    EXPECT_TRUE(node1->IsEngineRunScheduled());
+    EXPECT_TRUE(node2->IsEngineRunScheduled());
+    MockReportSent(readHandler1);
+    MockReportSent(readHandler2);
+    EXPECT_EQ(syncScheduler.mNextReportTimestamp, node1->GetMaxTimestamp());
+
+    // An urgent event is reported right away during idle mode, together with the deferred attribute changes
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(1000));
+    MockAttributeChange(readHandler1);
+    EXPECT_FALSE(node1->IsEngineRunScheduled());
+    readHandler2->ForceDirtyState();
+    EXPECT_TRUE(node1->IsEngineRunScheduled());
+    EXPECT_TRUE(node2->IsEngineRunScheduled());
+    MockReportSent(readHandler1);
+    MockReportSent(readHandler2);
+
+    // An urgent event on a handler which report was already deferred is also reported right away
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(2000));
+    MockAttributeChange(readHandler2);
+    EXPECT_FALSE(node2->IsEngineRunScheduled());
+    readHandler2->ForceDirtyState();
+    EXPECT_TRUE(node2->IsEngineRunScheduled());
+    MockReportSent(readHandler1);
+    MockReportSent(readHandler2);
+
+    // Deferred reports are sent as soon as the ICD enters active mode
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(2000));
+    MockAttributeChange(readHandler1);
+    EXPECT_FALSE(node1->IsEngineRunScheduled());
+    syncScheduler.OnEnterActiveMode();
+    EXPECT_TRUE(node1->IsEngineRunScheduled());
+    // readHandler2 is past its min interval and reports with readHandler1
+    EXPECT_TRUE(node2->IsEngineRunScheduled());
+    MockReportSent(readHandler1);
+    MockReportSent(readHandler2);
+
+    // Attribute changes are reported on the min interval during active mode
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(2000));
+    MockAttributeChange(readHandler2);
+    EXPECT_TRUE(node2->IsEngineRunScheduled());
+    MockReportSent(readHandler1);
+    MockReportSent(readHandler2);
+
+    // Attribute changes are reported on the min interval during idle mode when the coalescing is disabled
+    syncScheduler.SetIdleCoalescing(false);
+    syncScheduler.OnEnterIdleMode();
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(2000));
+    MockAttributeChange(readHandler1);
+    EXPECT_TRUE(node1->IsEngineRunScheduled());
+    MockReportSent(readHandler1);
+    MockReportSent(readHandler2);
+
+    syncScheduler.UnregisterAllHandlers();
+    syncScheduler.OnEnterActiveMode();
+    syncScheduler.SetIdleCoalescing(CHIP_CONFIG_SYNCHRONOUS_REPORTS_IDLE_COALESCING);
+    readHandlerPool.ReleaseAll();
+    exchangeCtx->Close();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+// Subscribers of the simulated sensor: a hub, a controller and a phone application
+static const struct
+{
+    uint16_t mMinInterval_s;
+    uint16_t mMaxInterval_s;
+} kSensorSubscriptions[] = { { 0, 300 }, { 1, 600 }, { 10, 900 } };
+
+// Periods of the attribute changes of the simulated sensor: temperature, humidity and battery level
+static const uint32_t kSensorAttributeChangePeriods_ms[] = { 30 * 1000, 45 * 1000, 900 * 1000 };
+
+// Times of the urgent events of the simulated sensor, such as a tamper alarm
+static const uint32_t kSensorUrgentEventTimes_ms[] = { 1234560, 2500070 };
+
+static const Milliseconds64 kSensorSimulationDuration = Milliseconds64(3600 * 1000);
+static const Milliseconds64 kSensorSimulationStep     = Milliseconds64(10);
+
+TestReportScheduler::WorkloadStats TestReportScheduler::SimulateSensorWorkload(bool idleCoalescing)
+{
+    constexpr size_t kSubscriptionCount = ArraySize(kSensorSubscriptions);
+
+    NullReadHandlerCallback nullCallback;
+    // exchange context
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+
+    // Read handler pool
+    ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+    ReadHandler * readHandlers[kSubscriptionCount];
+    System::Clock::Timestamp lastReportTimestamps[kSubscriptionCount];
+    WorkloadStats stats;
+
+    // Initialize the mock system time
+    sTestTimerSynchronizedDelegate.SetMockSystemTimestamp(System::Clock::Milliseconds64(0));
+    syncScheduler.SetIdleCoalescing(idleCoalescing);
+
+    for (size_t i = 0; i < kSubscriptionCount; i++)
+    {
+        readHandlers[i] = readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe,
+                                                       &syncScheduler, CodegenDataModelProviderInstance());
+        // The max intervals are requested by the subscribers, as they can exceed the idle mode duration of the ICD
+        readHandlers[i]->mSubscriberRequestedMaxInterval = kSensorSubscriptions[i].mMaxInterval_s;
+        EXPECT_EQ(CHIP_NO_ERROR,
+                  MockReadHandlerSubscriptionTransaction(readHandlers[i], &syncScheduler, kSensorSubscriptions[i].mMinInterval_s,
+                                                         kSensorSubscriptions[i].mMaxInterval_s));
+        lastReportTimestamps[i] = sTestTimerSynchronizedDelegate.GetCurrentMonotonicTimestamp();
+    }
+
+    auto isEngineRunScheduled = [&readHandlers]() {
+        for (ReadHandler * readHandler : readHandlers)
+        {
+            if (syncScheduler.FindReadHandlerNode(readHandler)->IsEngineRunScheduled())
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // The ICD starts in idle mode, and only enters active mode to send reports
+    bool isActive = false;
+    System::Clock::Timestamp activeModeEnd;
+    System::Clock::Timestamp lastUrgentEventTimestamp;
+    syncScheduler.OnEnterIdleMode();
+
+    for (Milliseconds64 elapsed = kSensorSimulationStep; elapsed <= kSensorSimulationDuration; elapsed += kSensorSimulationStep)
+    {
+        sTestTimerSynchronizedDelegate.IncrementMockTimestamp(kSensorSimulationStep);
+        const System::Clock::Timestamp now = sTestTimerSynchronizedDelegate.GetCurrentMonotonicTimestamp();
+
+        for (uint32_t period : kSensorAttributeChangePeriods_ms)
+        {
+            if (now.count() % period == 0)
+            {
+                for (ReadHandler * readHandler : readHandlers)
+                {
+                    MockAttributeChange(readHandler);
+                }
+            }
+        }
+
+        for (uint32_t eventTime : kSensorUrgentEventTimes_ms)
+        {
+            if (now.count() == eventTime)
+            {
+                // As done by Engine::ScheduleEventDelivery for urgent events
+                lastUrgentEventTimestamp = now;
+                for (ReadHandler * readHandler : readHandlers)
+                {
+                    readHandler->ForceDirtyState();
+                }
+            }
+        }
+
+        // Simulate the engine run scheduled by the scheduler, which requires the ICD to be in active mode
+        if (isEngineRunScheduled())
+        {
+            if (!isActive)
+            {
+                isActive = true;
+                stats.mActiveModeTransitions++;
+                syncScheduler.OnEnterActiveMode();
+            }
+            activeModeEnd = now + System::Clock::Milliseconds64(CHIP_CONFIG_ICD_ACTIVE_MODE_DURATION_MS);
+
+            for (size_t i = 0; i < kSubscriptionCount; i++)
+            {
+                if (!syncScheduler.IsReportableNow(readHandlers[i]))
+                {
+                    continue;
+                }
+
+                if (readHandlers[i]->IsForceDirty())
+                {
+                    stats.mMaxUrgentEventLatency = std::max(stats.mMaxUrgentEventLatency, now - lastUrgentEventTimestamp);
+                }
+                if (now - lastReportTimestamps[i] >
+                    System::Clock::Seconds16(kSensorSubscriptions[i].mMaxInterval_s) + kSensorSimulationStep)
+                {
+                    stats.mMaxIntervalExceeded = true;
+                }
+                lastReportTimestamps[i] = now;
+                stats.mReports++;
+                MockReportSent(readHandlers[i]);
+            }
+        }
+
+        if (isActive && now >= activeModeEnd)
+        {
+            isActive = false;
+            syncScheduler.OnEnterIdleMode();
+        }
+    }
+
+    syncScheduler.UnregisterAllHandlers();
+    syncScheduler.OnEnterActiveMode();
+    syncScheduler.SetIdleCoalescing(CHIP_CONFIG_SYNCHRONOUS_REPORTS_IDLE_COALESCING);
+    readHandlerPool.ReleaseAll();
+    exchangeCtx->Close();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+
+    return stats;
+}
+
+TEST_F_FROM_FIXTURE(TestReportScheduler, TestSynchronizedSchedulerIdleWorkload)
+{
+    const WorkloadStats baseline  = SimulateSensorWorkload(false);
+    const WorkloadStats coalesced = SimulateSensorWorkload(true);
+
+    ChipLogProgress(DataManagement,
+                    "Sensor workload: %u active mode transitions per hour (%u reports) without idle coalescing, %u (%u reports) "
+                    "with idle coalescing",
+                    static_cast<unsigned>(baseline.mActiveModeTransitions), static_cast<unsigned>(baseline.mReports),
+                    static_cast<unsigned>(coalesced.mActiveModeTransitions), static_cast<unsigned>(coalesced.mReports));
+
+    // No subscriber misses a report on its max interval, and urgent events still wait at most for the min intervals
+    EXPECT_FALSE(baseline.mMaxIntervalExceeded);
+    EXPECT_FALSE(coalesced.mMaxIntervalExceeded);
+    EXPECT_LE(coalesced.mMaxUrgentEventLatency, System::Clock::Seconds16(10) + kSensorSimulationStep);
+
+    // Attribute changes no longer wake the ICD up, it only enters active mode for the shortest max interval and the urgent events
+    EXPECT_LT(coalesced.mActiveModeTransitions * 4, baseline.mActiveModeTransitions);
+    const auto maxIntervalCount = kSensorSimulationDuration / System::Clock::Seconds16(kSensorSubscriptions[0].mMaxInterval_s);
+    EXPECT_LE(coalesced.mActiveModeTransitions, static_cast<uint32_t>(maxIntervalCount + ArraySize(kSensorUrgentEventTimes_ms)));
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
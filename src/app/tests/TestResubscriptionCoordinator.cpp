@@ -0,0 +1,455 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <queue>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <app/ResubscriptionCoordinator.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/FibonacciUtils.h>
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+using Participant = ResubscriptionCoordinator::Participant;
+
+class FakeParticipant : public Participant
+{
+public:
+    explicit FakeParticipant(NodeId nodeId, bool hasSession = false) : mPeer(nodeId, 1), mHasSession(hasSession) {}
+
+    ScopedNodeId GetResubscriptionPeer() const override { return mPeer; }
+    bool HasActiveResubscriptionSession() const override { return mHasSession; }
+    void OnResubscriptionAdmitted() override
+    {
+        mAdmittedCount++;
+        if (mOnAdmitted)
+        {
+            mOnAdmitted(*this);
+        }
+    }
+
+    ScopedNodeId mPeer;
+    bool mHasSession   = false;
+    int mAdmittedCount = 0;
+    std::function<void(FakeParticipant &)> mOnAdmitted;
+};
+
+ResubscriptionCoordinator::Config MakeConfig(uint16_t maxConcurrentAttempts, uint32_t baseDelayMs = 1000,
+                                             uint32_t maxDelayMs = 60000)
+{
+    ResubscriptionCoordinator::Config config;
+    config.baseDelayMs           = baseDelayMs;
+    config.maxDelayMs            = maxDelayMs;
+    config.maxConcurrentAttempts = maxConcurrentAttempts;
+    return config;
+}
+
+TEST(TestResubscriptionCoordinator, TestJitteredDelays)
+{
+    ResubscriptionCoordinator coordinator;
+    coordinator.Init(nullptr, MakeConfig(0, 1000, 20000));
+
+    // First attempts are spread over [1, base]
+    std::set<uint32_t> firstDelays;
+    for (int i = 0; i < 100; i++)
+    {
+        const uint32_t delay = coordinator.ComputeResubscriptionDelay(0);
+        EXPECT_GE(delay, 1u);
+        EXPECT_LE(delay, 1000u);
+        firstDelays.insert(delay);
+    }
+    EXPECT_GT(firstDelays.size(), 50u);
+
+    // Later attempts are in [base, 3 * previous], capped
+    for (uint32_t previous : { 1u, 500u, 2000u, 10000u })
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            const uint32_t delay = coordinator.ComputeResubscriptionDelay(previous);
+            EXPECT_GE(delay, 1000u);
+            EXPECT_LE(delay, std::min(std::max(3 * previous, 1001u), 20000u));
+        }
+    }
+}
+
+TEST(TestResubscriptionCoordinator, TestConcurrencyCap)
+{
+    ResubscriptionCoordinator coordinator;
+    coordinator.Init(nullptr, MakeConfig(2));
+
+    FakeParticipant a(1), b(2), c(3), d(4);
+    EXPECT_TRUE(coordinator.RequestResubscription(a));
+    EXPECT_TRUE(coordinator.RequestResubscription(b));
+    EXPECT_FALSE(coordinator.RequestResubscription(c));
+    EXPECT_FALSE(coordinator.RequestResubscription(d));
+    EXPECT_EQ(coordinator.InProgressCount(), 2u);
+    EXPECT_EQ(coordinator.QueuedCount(), 2u);
+
+    // Asking again keeps the queue position
+    EXPECT_FALSE(coordinator.RequestResubscription(c));
+    EXPECT_EQ(coordinator.QueuedCount(), 2u);
+
+    // Completing an attempt admits the oldest queued one
+    coordinator.Release(a);
+    EXPECT_EQ(c.mAdmittedCount, 1);
+    EXPECT_EQ(d.mAdmittedCount, 0);
+    EXPECT_EQ(coordinator.InProgressCount(), 2u);
+    EXPECT_EQ(coordinator.QueuedCount(), 1u);
+
+    // A new request queues behind d even though nothing changed
+    FakeParticipant e(5);
+    EXPECT_FALSE(coordinator.RequestResubscription(e));
+    coordinator.Release(b);
+    EXPECT_EQ(d.mAdmittedCount, 1);
+    EXPECT_EQ(e.mAdmittedCount, 0);
+
+    // Releasing a queued participant just removes it
+    coordinator.Release(e);
+    EXPECT_EQ(coordinator.QueuedCount(), 0u);
+    coordinator.Release(c);
+    coordinator.Release(d);
+    EXPECT_EQ(coordinator.InProgressCount(), 0u);
+    EXPECT_EQ(e.mAdmittedCount, 0);
+
+    // Participants going away release their slot
+    {
+        FakeParticipant f(6);
+        EXPECT_TRUE(coordinator.RequestResubscription(f));
+        EXPECT_EQ(coordinator.InProgressCount(), 1u);
+    }
+    EXPECT_EQ(coordinator.InProgressCount(), 0u);
+}
+
+TEST(TestResubscriptionCoordinator, TestPrefersSessionReuse)
+{
+    ResubscriptionCoordinator coordinator;
+    coordinator.Init(nullptr, MakeConfig(1));
+
+    std::vector<NodeId> admitted;
+    auto record = [&](FakeParticipant & participant) { admitted.push_back(participant.mPeer.GetNodeId()); };
+
+    FakeParticipant first(1);
+    FakeParticipant noSession(2);
+    FakeParticipant samePeer(1);
+    FakeParticipant withSession(3, /* hasSession = */ true);
+    for (auto * participant : { &noSession, &samePeer, &withSession })
+    {
+        participant->mOnAdmitted = record;
+    }
+
+    EXPECT_TRUE(coordinator.RequestResubscription(first));
+    EXPECT_FALSE(coordinator.RequestResubscription(noSession));
+    EXPECT_FALSE(coordinator.RequestResubscription(samePeer));
+    EXPECT_FALSE(coordinator.RequestResubscription(withSession));
+
+    // An attempt with a session goes first, then one for the peer just connected to
+    coordinator.Release(first, /* established = */ true);
+    ASSERT_EQ(admitted.size(), 1u);
+    EXPECT_EQ(admitted[0], 3u);
+    coordinator.Release(withSession, true);
+    ASSERT_EQ(admitted.size(), 2u);
+    EXPECT_EQ(admitted[1], 1u);
+    coordinator.Release(samePeer, true);
+    ASSERT_EQ(admitted.size(), 3u);
+    EXPECT_EQ(admitted[2], 2u);
+    coordinator.Release(noSession);
+}
+
+TEST(TestResubscriptionCoordinator, TestDefersAttemptsWaitingForHandshake)
+{
+    ResubscriptionCoordinator coordinator;
+    coordinator.Init(nullptr, MakeConfig(2));
+
+    FakeParticipant connecting(7), other(9), waiting(7), idle(8);
+    EXPECT_TRUE(coordinator.RequestResubscription(connecting));
+    EXPECT_TRUE(coordinator.RequestResubscription(other));
+    EXPECT_FALSE(coordinator.RequestResubscription(waiting));
+    EXPECT_FALSE(coordinator.RequestResubscription(idle));
+
+    // The attempt for peer 7 would just wait for the handshake in progress
+    coordinator.Release(other);
+    EXPECT_EQ(idle.mAdmittedCount, 1);
+    EXPECT_EQ(waiting.mAdmittedCount, 0);
+
+    coordinator.Release(connecting, /* established = */ true);
+    EXPECT_EQ(waiting.mAdmittedCount, 1);
+    coordinator.Release(idle);
+    coordinator.Release(waiting);
+}
+
+TEST(TestResubscriptionCoordinator, TestShutdownForgetsParticipants)
+{
+    FakeParticipant a(1), b(2);
+    {
+        ResubscriptionCoordinator coordinator;
+        coordinator.Init(nullptr, MakeConfig(1));
+        EXPECT_TRUE(coordinator.RequestResubscription(a));
+        EXPECT_FALSE(coordinator.RequestResubscription(b));
+    }
+    // Destroying the participants after the coordinator must be safe
+    EXPECT_EQ(a.mAdmittedCount, 0);
+    EXPECT_EQ(b.mAdmittedCount, 0);
+}
+
+/**
+ * Discrete event simulation of a controller recovering kPeers * kSubscriptionsPerPeer
+ * subscriptions after a network blip that dropped all of them at once.
+ *
+ * A subscription whose peer has no session first needs a CASE handshake, which is shared by
+ * all subscriptions to that peer. Every handshake and subscribe request in flight loads the
+ * network and the peers: beyond kCapacity operations in flight, operations fail with a
+ * growing probability, after an MRP-like timeout. Failed subscriptions back off either with
+ * the default fibonacci policy of ReadClient, or through a ResubscriptionCoordinator.
+ */
+class RecoverySimulation
+{
+public:
+    static constexpr size_t kPeers                = 100;
+    static constexpr size_t kSubscriptionsPerPeer = 5;
+    static constexpr size_t kSubscriptions        = kPeers * kSubscriptionsPerPeer;
+    static constexpr size_t kCapacity             = 40;
+    static constexpr uint64_t kCASEMs             = 800;
+    static constexpr uint64_t kSubscribeMs        = 150;
+    static constexpr uint64_t kTimeoutMs          = 2000;
+    static constexpr uint64_t kGiveUpMs           = 3600000;
+
+    struct Result
+    {
+        uint64_t recoveryTimeMs = 0;
+        size_t peakInFlight     = 0;
+        size_t handshakes       = 0;
+    };
+
+    /// Run the simulation, with the given coordinator or with the default policy if it is null.
+    Result Run(ResubscriptionCoordinator * coordinator)
+    {
+        mCoordinator = coordinator;
+        for (size_t i = 0; i < kSubscriptions; i++)
+        {
+            mSubscriptions.emplace_back(*this, i % kPeers);
+        }
+
+        // The blip: every subscription drops at the same time
+        for (auto & subscription : mSubscriptions)
+        {
+            ScheduleRetry(subscription);
+        }
+
+        while (!mEvents.empty() && mRecovered < kSubscriptions && mEvents.top().timeMs < kGiveUpMs)
+        {
+            Event event = mEvents.top();
+            mEvents.pop();
+            mNowMs = event.timeMs;
+            event.action();
+        }
+
+        EXPECT_EQ(mRecovered, kSubscriptions);
+        mResult.recoveryTimeMs = mNowMs;
+        return mResult;
+    }
+
+private:
+    struct Subscription : public Participant
+    {
+        Subscription(RecoverySimulation & simulation, size_t peer) : mSimulation(simulation), mPeerIndex(peer) {}
+
+        ScopedNodeId GetResubscriptionPeer() const override { return ScopedNodeId(mPeerIndex + 1, 1); }
+        bool HasActiveResubscriptionSession() const override { return mSimulation.mPeers[mPeerIndex].sessionUp; }
+        void OnResubscriptionAdmitted() override { mSimulation.StartAttempt(*this); }
+
+        RecoverySimulation & mSimulation;
+        size_t mPeerIndex;
+        uint32_t mNumRetries      = 0;
+        uint32_t mPreviousDelayMs = 0;
+    };
+
+    struct Peer
+    {
+        bool sessionUp  = false;
+        bool connecting = false;
+        std::vector<Subscription *> waiting;
+    };
+
+    struct Event
+    {
+        uint64_t timeMs;
+        uint64_t sequence;
+        std::function<void()> action;
+        bool operator>(const Event & other) const
+        {
+            return (timeMs != other.timeMs) ? (timeMs > other.timeMs) : (sequence > other.sequence);
+        }
+    };
+
+    void Schedule(uint64_t delayMs, std::function<void()> action)
+    {
+        mEvents.push({ mNowMs + delayMs, mSequence++, std::move(action) });
+    }
+
+    uint32_t DefaultPolicyDelay(const Subscription & subscription)
+    {
+        // ReadClient::ComputeTimeTillNextSubscription without a coordinator
+        const uint32_t maxWaitMs = GetFibonacciForIndex(subscription.mNumRetries) * CHIP_RESUBSCRIBE_WAIT_TIME_MULTIPLIER_MS;
+        VerifyOrReturnValue(maxWaitMs != 0, 0);
+        const uint32_t minWaitMs = (CHIP_RESUBSCRIBE_MIN_WAIT_TIME_INTERVAL_PERCENT_PER_STEP * maxWaitMs) / 100;
+        return minWaitMs + static_cast<uint32_t>(mRandom() % (maxWaitMs - minWaitMs));
+    }
+
+    void ScheduleRetry(Subscription & subscription)
+    {
+        uint32_t delayMs;
+        if (mCoordinator != nullptr)
+        {
+            delayMs                       = mCoordinator->ComputeResubscriptionDelay(subscription.mPreviousDelayMs);
+            subscription.mPreviousDelayMs = delayMs;
+        }
+        else
+        {
+            delayMs = DefaultPolicyDelay(subscription);
+        }
+
+        Schedule(delayMs, [this, &subscription] {
+            subscription.mNumRetries++;
+            if (mCoordinator == nullptr || mCoordinator->RequestResubscription(subscription))
+            {
+                StartAttempt(subscription);
+            }
+        });
+    }
+
+    /// Starts an operation loading the network; returns whether it will succeed.
+    bool StartOperation()
+    {
+        mInFlight++;
+        mResult.peakInFlight = std::max(mResult.peakInFlight, mInFlight);
+        VerifyOrReturnValue(mInFlight > kCapacity, true);
+        return mRandom() % mInFlight < kCapacity;
+    }
+
+    void StartAttempt(Subscription & subscription)
+    {
+        Peer & peer = mPeers[subscription.mPeerIndex];
+        if (peer.sessionUp)
+        {
+            Subscribe(subscription);
+            return;
+        }
+
+        peer.waiting.push_back(&subscription);
+        VerifyOrReturn(!peer.connecting);
+
+        peer.connecting = true;
+        mResult.handshakes++;
+        const bool success = StartOperation();
+        Schedule(success ? kCASEMs : kTimeoutMs, [this, &peer, success] {
+            mInFlight--;
+            peer.connecting = false;
+            peer.sessionUp  = success;
+
+            std::vector<Subscription *> waiting;
+            waiting.swap(peer.waiting);
+            for (auto * subscription : waiting)
+            {
+                if (success)
+                {
+                    Subscribe(*subscription);
+                }
+                else
+                {
+                    Fail(*subscription);
+                }
+            }
+        });
+    }
+
+    void Subscribe(Subscription & subscription)
+    {
+        const bool success = StartOperation();
+        Schedule(success ? kSubscribeMs : kTimeoutMs, [this, &subscription, success] {
+            mInFlight--;
+            if (!success)
+            {
+                Fail(subscription);
+                return;
+            }
+
+            mRecovered++;
+            subscription.mNumRetries      = 0;
+            subscription.mPreviousDelayMs = 0;
+            if (mCoordinator != nullptr)
+            {
+                mCoordinator->Release(subscription, /* established = */ true);
+            }
+        });
+    }
+
+    void Fail(Subscription & subscription)
+    {
+        if (mCoordinator != nullptr)
+        {
+            mCoordinator->Release(subscription);
+        }
+        ScheduleRetry(subscription);
+    }
+
+    ResubscriptionCoordinator * mCoordinator = nullptr;
+    std::deque<Subscription> mSubscriptions;
+    Peer mPeers[kPeers];
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> mEvents;
+    std::minstd_rand mRandom{ 42 };
+    uint64_t mNowMs     = 0;
+    uint64_t mSequence  = 0;
+    size_t mInFlight    = 0;
+    size_t mRecovered   = 0;
+    Result mResult;
+};
+
+TEST(TestResubscriptionCoordinator, TestRecoveryOf500Subscriptions)
+{
+    RecoverySimulation uncoordinated;
+    const auto baseline = uncoordinated.Run(nullptr);
+
+    ResubscriptionCoordinator coordinator;
+    coordinator.Init(nullptr, MakeConfig(32, 1000, CHIP_RESUBSCRIBE_MAX_RETRY_WAIT_INTERVAL_MS));
+    RecoverySimulation coordinated;
+    const auto result = coordinated.Run(&coordinator);
+
+    printf("Recovery of %u subscriptions: %u ms, peak %u in flight, %u handshakes without coordination; "
+           "%u ms, peak %u in flight, %u handshakes with\n",
+           static_cast<unsigned>(RecoverySimulation::kSubscriptions), static_cast<unsigned>(baseline.recoveryTimeMs),
+           static_cast<unsigned>(baseline.peakInFlight), static_cast<unsigned>(baseline.handshakes),
+           static_cast<unsigned>(result.recoveryTimeMs), static_cast<unsigned>(result.peakInFlight),
+           static_cast<unsigned>(result.handshakes));
+
+    EXPECT_LT(result.recoveryTimeMs, baseline.recoveryTimeMs);
+    EXPECT_LE(result.peakInFlight, 32u);
+    EXPECT_LT(result.handshakes, baseline.handshakes);
+    EXPECT_EQ(coordinator.InProgressCount(), 0u);
+    EXPECT_EQ(coordinator.QueuedCount(), 0u);
+}
+
+} // namespace
@@ -0,0 +1,280 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/clusters/scenes-server/SceneRecallScheduler.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <pw_unit_test/framework.h>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::scenes;
+
+namespace {
+
+using Milliseconds64  = System::Clock::Milliseconds64;
+using SceneTableEntry = SceneRecallScheduler::SceneTableEntry;
+using PendingRecall   = SceneRecallScheduler::PendingRecall;
+
+constexpr FabricIndex kFabric = 1;
+constexpr GroupId kGroup      = 0x0101;
+
+/// Timer delegate driven by a mock clock, supporting the single timer of the scheduler. Each expiry runs in a new task.
+class TestTimerDelegate : public SceneRecallScheduler::TimerDelegate
+{
+public:
+    CHIP_ERROR StartTimer(reporting::TimerContext * context, System::Clock::Timeout aTimeout) override
+    {
+        mContext    = context;
+        mExpiryTime = mNow + aTimeout;
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(reporting::TimerContext * context) override { mContext = nullptr; }
+    bool IsTimerActive(reporting::TimerContext * context) override { return mContext != nullptr; }
+    System::Clock::Timestamp GetCurrentMonotonicTimestamp() override { return mNow; }
+
+    // Advance the mock clock, firing the timer if it expires meanwhile
+    void AdvanceClock(Milliseconds64 duration)
+    {
+        const System::Clock::Timestamp end = mNow + duration;
+
+        while (mContext != nullptr && mExpiryTime <= end)
+        {
+            reporting::TimerContext * context = mContext;
+            mNow                              = mExpiryTime;
+            mContext                          = nullptr;
+            mTask++;
+            context->TimerFired();
+        }
+
+        mNow = end;
+    }
+
+    System::Clock::Timestamp mNow = System::Clock::kZero;
+    System::Clock::Timestamp mExpiryTime;
+    reporting::TimerContext * mContext = nullptr;
+    uint32_t mTask                     = 0;
+};
+
+/// Delegate recording when, and from which task, the scenes were applied
+class TestDelegate : public SceneRecallScheduler::Delegate
+{
+public:
+    explicit TestDelegate(TestTimerDelegate & timerDelegate) : mTimerDelegate(timerDelegate) {}
+
+    CHIP_ERROR ApplyScheduledScene(FabricIndex fabric, EndpointId endpoint, const SceneTableEntry & scene) override
+    {
+        mApplied.push_back({ endpoint, scene.mStorageId.mSceneId, mTimerDelegate.mNow, mTimerDelegate.mTask });
+        return CHIP_NO_ERROR;
+    }
+
+    struct AppliedScene
+    {
+        EndpointId mEndpoint;
+        SceneId mScene;
+        System::Clock::Timestamp mTime;
+        uint32_t mTask;
+    };
+
+    // Attribute changes marked dirty within a task are reported in a single reporting run
+    size_t ReportRunCount() const
+    {
+        std::set<uint32_t> tasks;
+        for (const AppliedScene & applied : mApplied)
+        {
+            tasks.insert(applied.mTask);
+        }
+        return tasks.size();
+    }
+
+    // Time between the start of the first and of the last transition
+    Milliseconds64 StartSpread() const
+    {
+        auto compare = [](const AppliedScene & a, const AppliedScene & b) { return a.mTime < b.mTime; };
+        auto range   = std::minmax_element(mApplied.begin(), mApplied.end(), compare);
+        return std::chrono::duration_cast<Milliseconds64>(range.second->mTime - range.first->mTime);
+    }
+
+    TestTimerDelegate & mTimerDelegate;
+    std::vector<AppliedScene> mApplied;
+};
+
+SceneTableEntry MakeScene(SceneId sceneId)
+{
+    return SceneTableEntry(SceneTable<ExtensionFieldSetsImpl>::SceneStorageId(sceneId, kGroup));
+}
+
+TEST(TestSceneRecallScheduler, TestBatch)
+{
+    TestTimerDelegate timerDelegate;
+    TestDelegate delegate(timerDelegate);
+    PendingRecall pendingRecalls[4];
+    SceneRecallScheduler scheduler;
+
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 1, MakeScene(1)), CHIP_ERROR_INCORRECT_STATE);
+    ASSERT_EQ(scheduler.Init(delegate, timerDelegate, Span<PendingRecall>(pendingRecalls), System::Clock::Milliseconds32(10)),
+              CHIP_NO_ERROR);
+
+    for (EndpointId endpoint = 1; endpoint <= 3; endpoint++)
+    {
+        EXPECT_EQ(scheduler.ScheduleScene(kFabric, endpoint, MakeScene(1)), CHIP_NO_ERROR);
+        timerDelegate.AdvanceClock(Milliseconds64(2));
+    }
+    EXPECT_EQ(scheduler.GetPendingSceneCount(), 3u);
+    EXPECT_TRUE(delegate.mApplied.empty());
+
+    // The batch is applied once the window opened by its first scene elapses
+    timerDelegate.AdvanceClock(Milliseconds64(4));
+    ASSERT_EQ(delegate.mApplied.size(), 3u);
+    EXPECT_EQ(scheduler.GetPendingSceneCount(), 0u);
+    EXPECT_EQ(delegate.ReportRunCount(), 1u);
+    EXPECT_EQ(delegate.mApplied[0].mTime, System::Clock::Timestamp(10));
+    EXPECT_EQ(delegate.StartSpread(), Milliseconds64(0));
+
+    // The next scene opens a new batch
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 1, MakeScene(2)), CHIP_NO_ERROR);
+    EXPECT_TRUE(timerDelegate.IsTimerActive(nullptr));
+    scheduler.ApplyPendingScenes();
+    EXPECT_FALSE(timerDelegate.IsTimerActive(nullptr));
+    ASSERT_EQ(delegate.mApplied.size(), 4u);
+    EXPECT_EQ(delegate.mApplied[3].mScene, 2);
+}
+
+TEST(TestSceneRecallScheduler, TestLastSceneWins)
+{
+    TestTimerDelegate timerDelegate;
+    TestDelegate delegate(timerDelegate);
+    PendingRecall pendingRecalls[4];
+    SceneRecallScheduler scheduler;
+
+    ASSERT_EQ(scheduler.Init(delegate, timerDelegate, Span<PendingRecall>(pendingRecalls), System::Clock::Milliseconds32(0)),
+              CHIP_NO_ERROR);
+
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 1, MakeScene(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 2, MakeScene(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 1, MakeScene(3)), CHIP_NO_ERROR);
+    EXPECT_EQ(scheduler.GetPendingSceneCount(), 2u);
+
+    timerDelegate.AdvanceClock(Milliseconds64(0));
+    ASSERT_EQ(delegate.mApplied.size(), 2u);
+    EXPECT_EQ(delegate.mApplied[0].mEndpoint, 1);
+    EXPECT_EQ(delegate.mApplied[0].mScene, 3);
+    EXPECT_EQ(delegate.mApplied[1].mEndpoint, 2);
+    EXPECT_EQ(delegate.mApplied[1].mScene, 1);
+}
+
+TEST(TestSceneRecallScheduler, TestFullBatch)
+{
+    TestTimerDelegate timerDelegate;
+    TestDelegate delegate(timerDelegate);
+    PendingRecall pendingRecalls[2];
+    SceneRecallScheduler scheduler;
+
+    ASSERT_EQ(scheduler.Init(delegate, timerDelegate, Span<PendingRecall>(pendingRecalls), System::Clock::Milliseconds32(0)),
+              CHIP_NO_ERROR);
+
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 1, MakeScene(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 2, MakeScene(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 3, MakeScene(1)), CHIP_ERROR_NO_MEMORY);
+
+    // An endpoint already in the batch still has its scene replaced
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 2, MakeScene(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(scheduler.GetPendingSceneCount(), 2u);
+}
+
+TEST(TestSceneRecallScheduler, TestCancelAndShutdown)
+{
+    TestTimerDelegate timerDelegate;
+    TestDelegate delegate(timerDelegate);
+    PendingRecall pendingRecalls[4];
+    SceneRecallScheduler scheduler;
+
+    ASSERT_EQ(scheduler.Init(delegate, timerDelegate, Span<PendingRecall>(pendingRecalls), System::Clock::Milliseconds32(5)),
+              CHIP_NO_ERROR);
+
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 1, MakeScene(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 2, MakeScene(1)), CHIP_NO_ERROR);
+    scheduler.CancelPendingScene(1);
+    EXPECT_EQ(scheduler.GetPendingSceneCount(), 1u);
+
+    timerDelegate.AdvanceClock(Milliseconds64(5));
+    ASSERT_EQ(delegate.mApplied.size(), 1u);
+    EXPECT_EQ(delegate.mApplied[0].mEndpoint, 2);
+
+    // Pending scenes are dropped on shutdown
+    EXPECT_EQ(scheduler.ScheduleScene(kFabric, 3, MakeScene(1)), CHIP_NO_ERROR);
+    scheduler.Shutdown();
+    EXPECT_FALSE(scheduler.IsInitialized());
+    EXPECT_FALSE(timerDelegate.IsTimerActive(nullptr));
+    timerDelegate.AdvanceClock(Milliseconds64(5));
+    EXPECT_EQ(delegate.mApplied.size(), 1u);
+}
+
+TEST(TestSceneRecallScheduler, TestRecallBenchmark)
+{
+    // A controller recalling a scene on the lights of a room, one unicast RecallScene command per endpoint, 2 ms apart
+    constexpr EndpointId kEndpointCount   = 8;
+    constexpr uint32_t kCommandIntervalMs = 2;
+    constexpr uint32_t kBatchWindowMs     = 20;
+
+    // Without the scheduler, every command applies its scene, and has its attribute changes reported, on its own
+    TestTimerDelegate immediateTimerDelegate;
+    TestDelegate immediate(immediateTimerDelegate);
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        immediateTimerDelegate.mTask++;
+        EXPECT_EQ(immediate.ApplyScheduledScene(kFabric, endpoint, MakeScene(1)), CHIP_NO_ERROR);
+        immediateTimerDelegate.AdvanceClock(Milliseconds64(kCommandIntervalMs));
+    }
+
+    TestTimerDelegate timerDelegate;
+    TestDelegate batched(timerDelegate);
+    PendingRecall pendingRecalls[kEndpointCount];
+    SceneRecallScheduler scheduler;
+
+    ASSERT_EQ(scheduler.Init(batched, timerDelegate, Span<PendingRecall>(pendingRecalls),
+                             System::Clock::Milliseconds32(kBatchWindowMs)),
+              CHIP_NO_ERROR);
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        timerDelegate.mTask++;
+        EXPECT_EQ(scheduler.ScheduleScene(kFabric, endpoint, MakeScene(1)), CHIP_NO_ERROR);
+        timerDelegate.AdvanceClock(Milliseconds64(kCommandIntervalMs));
+    }
+    timerDelegate.AdvanceClock(Milliseconds64(kBatchWindowMs));
+
+    ASSERT_EQ(batched.mApplied.size(), static_cast<size_t>(kEndpointCount));
+    EXPECT_EQ(immediate.ReportRunCount(), static_cast<size_t>(kEndpointCount));
+    EXPECT_EQ(batched.ReportRunCount(), 1u);
+    EXPECT_EQ(immediate.StartSpread(), Milliseconds64((kEndpointCount - 1) * kCommandIntervalMs));
+    EXPECT_EQ(batched.StartSpread(), Milliseconds64(0));
+
+    // The first recalled scene waits the whole window, the last one the least
+    const Milliseconds64 maxLatency =
+        std::chrono::duration_cast<Milliseconds64>(batched.mApplied[0].mTime - System::Clock::Timestamp(0));
+    EXPECT_EQ(maxLatency, Milliseconds64(kBatchWindowMs));
+
+    ChipLogProgress(Zcl, "%u recalls: %u report runs over %u ms immediately, %u report run over %u ms after at most %u ms batched",
+                    static_cast<unsigned>(kEndpointCount), static_cast<unsigned>(immediate.ReportRunCount()),
+                    static_cast<unsigned>(immediate.StartSpread().count()), static_cast<unsigned>(batched.ReportRunCount()),
+                    static_cast<unsigned>(batched.StartSpread().count()), static_cast<unsigned>(maxLatency.count()));
+}
+
+} // namespace
@@ -29,6 +29,7 @@
 
 #include <lib/core/StringBuilderAdapters.h>
 #include <pw_unit_test/framework.h>
+#include <system/SystemClock.h>
 using namespace chip;
 using namespace chip::Test;
 using namespace chip::app::Clusters::Globals::Attributes;
@@ -670,6 +671,19 @@ protected:
     uint8_t GetClusterCountFromEndpoint() override { return 3; }
 };
 
+// Storage counting the reads, to check which lookups are served from the scene table index
+class ReadCountingStorageDelegate : public chip::TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        mReadCount++;
+        return TestPersistentStorageDelegate::SyncGetKeyValue(key, buffer, size);
+    }
+
+    size_t mReadCount = 0;
+};
+
 // Test Fixture Class
 class TestSceneTable : public ::testing::Test
 {
@@ -2350,6 +2364,11 @@ TEST_F(TestSceneTable, TestOTAChanges)
 
     ReducedSceneTable.Finish();
 
+    // The original scene table indexed its scene maps before the other scene tables modified the storage, initialize it again as
+    // would happen when rebooting on the original firmware
+    sceneTable->Finish();
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->Init(mpTestStorage));
+
     // The Scene 8 should now have been truncated from the memory and thus not be accessible from both fabrics in the
     // original scene table
     EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable->GetSceneTableEntry(kFabric1, sceneId8, scene));
@@ -2363,4 +2382,133 @@ TEST_F(TestSceneTable, TestOTAChanges)
     EXPECT_EQ(1, fabric_capacity);
 }
 
+TEST_F(TestSceneTable, TestSceneIndex)
+{
+    ReadCountingStorageDelegate storage;
+    TestSceneTableImpl sceneTable;
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.Init(&storage));
+    sceneTable.SetEndpoint(kTestEndpoint1);
+
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene1));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene2));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene5));
+
+    // Counting and listing scenes is served from the index
+    storage.mReadCount  = 0;
+    uint8_t scene_count = 0;
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetEndpointSceneCount(scene_count));
+    EXPECT_EQ(3, scene_count);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetFabricSceneCount(kFabric1, scene_count));
+    EXPECT_EQ(3, scene_count);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetRemainingCapacity(kFabric1, scene_count));
+    EXPECT_EQ(defaultTestFabricCapacity - 3, scene_count);
+
+    SceneId sceneList[defaultTestFabricCapacity];
+    Span<SceneId> sceneListSpan(sceneList);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetAllSceneIdsInGroup(kFabric1, kGroup1, sceneListSpan));
+    EXPECT_EQ(2u, sceneListSpan.size());
+    EXPECT_EQ(kScene1, sceneList[0]);
+    EXPECT_EQ(kScene2, sceneList[1]);
+    EXPECT_EQ(0u, storage.mReadCount);
+
+    // Only the scene itself is read from storage when retrieving it
+    SceneTableEntry scene;
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId2, scene));
+    EXPECT_EQ(scene, scene2);
+    EXPECT_EQ(1u, storage.mReadCount);
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId3, scene));
+    EXPECT_EQ(1u, storage.mReadCount);
+
+    // Fabrics without scenes are indexed too
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetFabricSceneCount(kFabric2, scene_count));
+    EXPECT_EQ(0, scene_count);
+    EXPECT_EQ(2u, storage.mReadCount);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetFabricSceneCount(kFabric2, scene_count));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric2, sceneId1, scene));
+    EXPECT_EQ(2u, storage.mReadCount);
+
+    // The index follows removals
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.RemoveSceneTableEntry(kFabric1, sceneId1));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetEndpointSceneCount(scene_count));
+    EXPECT_EQ(2, scene_count);
+
+    // A new index is loaded from storage
+    sceneTable.Finish();
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.Init(&storage));
+    storage.mReadCount = 0;
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetEndpointSceneCount(scene_count));
+    EXPECT_EQ(2, scene_count);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId5, scene));
+    EXPECT_EQ(scene, scene5);
+    EXPECT_EQ(3u, storage.mReadCount);
+
+    sceneTable.Finish();
+}
+
+TEST_F(TestSceneTable, TestSceneRecallBenchmark)
+{
+    constexpr EndpointId kEndpointCount  = 8;
+    constexpr uint8_t kScenesPerEndpoint = 16;
+    constexpr uint8_t kFabricCount       = (kScenesPerEndpoint + scenes::kMaxScenesPerFabric - 1) / scenes::kMaxScenesPerFabric;
+    constexpr unsigned kRecallCount      = 20 * kEndpointCount * kScenesPerEndpoint;
+
+    ReadCountingStorageDelegate storage;
+    TestSceneTableImpl sceneTable(scenes::kMaxScenesPerFabric, scenes::kMaxScenesPerEndpoint);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.Init(&storage));
+
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        sceneTable.SetEndpoint(endpoint);
+        for (uint8_t i = 0; i < kScenesPerEndpoint; i++)
+        {
+            SceneTableEntry scene(SceneStorageId(static_cast<SceneId>(i + 1), kGroup1), sceneData4);
+            EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(static_cast<FabricIndex>(1 + i % kFabricCount), scene));
+        }
+    }
+
+    // Recalls the scenes of every endpoint in turn, clearing the index before every recall if requested, which reads the scene
+    // map of the fabric along with the scene, as every recall did before the scene maps were indexed
+    auto recallScenes = [&](bool clearIndex, unsigned & reads) {
+        SceneTableEntry scene;
+        storage.mReadCount                        = 0;
+        const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (unsigned recall = 0; recall < kRecallCount; recall++)
+        {
+            const uint8_t i = static_cast<uint8_t>(recall / kEndpointCount % kScenesPerEndpoint);
+            if (clearIndex)
+            {
+                sceneTable.Finish();
+                EXPECT_EQ(CHIP_NO_ERROR, sceneTable.Init(&storage));
+            }
+            sceneTable.SetEndpoint(static_cast<EndpointId>(1 + recall % kEndpointCount));
+            EXPECT_EQ(CHIP_NO_ERROR,
+                      sceneTable.GetSceneTableEntry(static_cast<FabricIndex>(1 + i % kFabricCount),
+                                                    SceneStorageId(static_cast<SceneId>(i + 1), kGroup1), scene));
+        }
+        reads = static_cast<unsigned>(storage.mReadCount);
+        return System::SystemClock().GetMonotonicMicroseconds64() - start;
+    };
+
+    unsigned readsWithoutIndex                           = 0;
+    unsigned readsWithIndex                              = 0;
+    const System::Clock::Microseconds64 timeWithoutIndex = recallScenes(true, readsWithoutIndex);
+    recallScenes(false, readsWithIndex);
+    const System::Clock::Microseconds64 timeWithIndex = recallScenes(false, readsWithIndex);
+
+    ChipLogProgress(Zcl, "%u recalls of %u scenes on %u endpoints: %u storage reads in %u us without index, %u in %u us with index",
+                    kRecallCount, static_cast<unsigned>(kScenesPerEndpoint), static_cast<unsigned>(kEndpointCount),
+                    readsWithoutIndex, static_cast<unsigned>(timeWithoutIndex.count()), readsWithIndex,
+                    static_cast<unsigned>(timeWithIndex.count()));
+
+    EXPECT_EQ(2 * kRecallCount, readsWithoutIndex);
+    if (kEndpointCount * kFabricCount <= scenes::SceneTableIndex::kSize)
+    {
+        // Every scene map is indexed, so only the recalled scenes are read
+        EXPECT_EQ(kRecallCount, readsWithIndex);
+    }
+
+    sceneTable.Finish();
+}
+
 } // namespace TestScenes
@@ -0,0 +1,269 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/TransitionEngine.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <pw_unit_test/framework.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+using Milliseconds32 = System::Clock::Milliseconds32;
+using Milliseconds64 = System::Clock::Milliseconds64;
+
+/// Timer delegate driven by a mock clock, supporting the single timer of the engine
+class TestTimerDelegate : public TransitionEngine::TimerDelegate
+{
+public:
+    CHIP_ERROR StartTimer(reporting::TimerContext * context, System::Clock::Timeout aTimeout) override
+    {
+        mContext    = context;
+        mExpiryTime = mNow + aTimeout;
+        mStartCount++;
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(reporting::TimerContext * context) override { mContext = nullptr; }
+    bool IsTimerActive(reporting::TimerContext * context) override { return mContext != nullptr; }
+    System::Clock::Timestamp GetCurrentMonotonicTimestamp() override { return mNow; }
+
+    // Advance the mock clock, firing the timer if it expires meanwhile
+    void AdvanceClock(Milliseconds64 duration)
+    {
+        const System::Clock::Timestamp end = mNow + duration;
+
+        while (mContext != nullptr && mExpiryTime + mLatency <= end)
+        {
+            reporting::TimerContext * context = mContext;
+            mNow                              = mExpiryTime + mLatency;
+            mContext                          = nullptr;
+            context->TimerFired();
+        }
+
+        mNow = end;
+    }
+
+    System::Clock::Timestamp mNow = System::Clock::kZero;
+    System::Clock::Timestamp mExpiryTime;
+    Milliseconds32 mLatency            = Milliseconds32(0); // Delay of timer events past the expiry time
+    reporting::TimerContext * mContext = nullptr;
+    uint32_t mStartCount               = 0;
+};
+
+/// Transitions of the test endpoints, stepping every StepInterval until they run out of steps
+struct TestTransitions
+{
+    static constexpr size_t kMaxEndpoints = 256;
+
+    static void Step(EndpointId endpoint)
+    {
+        TestTransitions & self = *sInstance;
+        self.mStepTimes.push_back({ endpoint, self.mTimerDelegate.mNow });
+        if (--self.mStepsRemaining[endpoint] > 0)
+        {
+            self.mEngine.ScheduleStep(self.mTransitions[endpoint], Step, endpoint, self.mStepInterval);
+        }
+    }
+
+    TestTransitions(TransitionEngine & engine, TestTimerDelegate & timerDelegate, Milliseconds32 stepInterval) :
+        mEngine(engine), mTimerDelegate(timerDelegate), mStepInterval(stepInterval)
+    {
+        sInstance = this;
+    }
+    ~TestTransitions() { sInstance = nullptr; }
+
+    void Start(EndpointId endpoint, uint32_t steps)
+    {
+        mStepsRemaining[endpoint] = steps;
+        mEngine.ScheduleStep(mTransitions[endpoint], Step, endpoint, mStepInterval);
+    }
+
+    struct StepTime
+    {
+        EndpointId mEndpoint;
+        System::Clock::Timestamp mTime;
+    };
+
+    static TestTransitions * sInstance;
+
+    TransitionEngine & mEngine;
+    TestTimerDelegate & mTimerDelegate;
+    const Milliseconds32 mStepInterval;
+    TransitionEngine::Transition mTransitions[kMaxEndpoints];
+    uint32_t mStepsRemaining[kMaxEndpoints] = {};
+    std::vector<StepTime> mStepTimes;
+};
+
+TestTransitions * TestTransitions::sInstance = nullptr;
+
+TEST(TestTransitionEngine, TestStepsAlignedOnTicks)
+{
+    TestTimerDelegate timerDelegate;
+    TransitionEngine engine(timerDelegate, Milliseconds32(10));
+    TestTransitions transitions(engine, timerDelegate, Milliseconds32(100));
+
+    // Transitions started within the same tick step together, on the tick grid
+    timerDelegate.AdvanceClock(Milliseconds64(1));
+    transitions.Start(1, 3);
+    timerDelegate.AdvanceClock(Milliseconds64(3));
+    transitions.Start(2, 3);
+    EXPECT_TRUE(transitions.mTransitions[1].IsScheduled());
+    EXPECT_TRUE(transitions.mTransitions[2].IsScheduled());
+
+    timerDelegate.AdvanceClock(Milliseconds64(400));
+    ASSERT_EQ(transitions.mStepTimes.size(), 6u);
+    for (size_t i = 0; i < transitions.mStepTimes.size(); i += 2)
+    {
+        const System::Clock::Timestamp expected(100 + 100 * (i / 2));
+        EXPECT_EQ(transitions.mStepTimes[i].mTime, expected);
+        EXPECT_EQ(transitions.mStepTimes[i + 1].mTime, expected);
+    }
+    EXPECT_EQ(engine.GetStats().mTickCount, 3u);
+    EXPECT_EQ(engine.GetStats().mStepCount, 6u);
+
+    EXPECT_FALSE(transitions.mTransitions[1].IsScheduled());
+    EXPECT_FALSE(timerDelegate.IsTimerActive(nullptr));
+}
+
+TEST(TestTransitionEngine, TestChainedStepsDuration)
+{
+    // A transition of 100 steps of 100 ms, each scheduled from the time the previous one ran as the ColorControl server does
+    constexpr uint32_t kStepCount = 100;
+
+    for (uint32_t latencyMs : { 0u, 1u, 4u })
+    {
+        TestTimerDelegate timerDelegate;
+        TransitionEngine engine(timerDelegate, Milliseconds32(10));
+        TestTransitions transitions(engine, timerDelegate, Milliseconds32(100));
+        timerDelegate.mLatency = Milliseconds32(latencyMs);
+
+        timerDelegate.AdvanceClock(Milliseconds64(3));
+        transitions.Start(1, kStepCount);
+        timerDelegate.AdvanceClock(Milliseconds64(20000));
+
+        // Timer latency must not accumulate over the steps: the transition ends within half a tick and the latency of 10 s
+        ASSERT_EQ(transitions.mStepTimes.size(), kStepCount);
+        const int64_t duration = static_cast<int64_t>(transitions.mStepTimes.back().mTime.count()) - 3;
+        EXPECT_LE(std::abs(duration - 10000), static_cast<int64_t>(5 + latencyMs));
+    }
+}
+
+TEST(TestTransitionEngine, TestStepWithoutDelay)
+{
+    TestTimerDelegate timerDelegate;
+    TransitionEngine engine(timerDelegate, Milliseconds32(10));
+    TestTransitions transitions(engine, timerDelegate, Milliseconds32(0));
+
+    // Steps without delay are not rounded, and are run from the next event even when scheduled by a step
+    timerDelegate.AdvanceClock(Milliseconds64(3));
+    transitions.Start(1, 2);
+    timerDelegate.AdvanceClock(Milliseconds64(0));
+    ASSERT_EQ(transitions.mStepTimes.size(), 2u);
+    EXPECT_EQ(transitions.mStepTimes[0].mTime, System::Clock::Timestamp(3));
+    EXPECT_EQ(transitions.mStepTimes[1].mTime, System::Clock::Timestamp(3));
+    EXPECT_EQ(engine.GetStats().mTickCount, 2u);
+}
+
+TEST(TestTransitionEngine, TestRescheduleAndCancel)
+{
+    TestTimerDelegate timerDelegate;
+    TransitionEngine engine(timerDelegate, Milliseconds32(10));
+    TestTransitions transitions(engine, timerDelegate, Milliseconds32(100));
+
+    transitions.Start(1, 1);
+    transitions.Start(2, 1);
+
+    // Scheduling a scheduled transition replaces its step, and an earlier step restarts the timer
+    engine.ScheduleStep(transitions.mTransitions[2], TestTransitions::Step, 2, Milliseconds32(50));
+    EXPECT_EQ(timerDelegate.mExpiryTime, System::Clock::Timestamp(50));
+
+    engine.CancelStep(transitions.mTransitions[2]);
+    EXPECT_FALSE(transitions.mTransitions[2].IsScheduled());
+    EXPECT_TRUE(timerDelegate.IsTimerActive(nullptr));
+
+    // The early timer event finds no due step and waits for the remaining one
+    timerDelegate.AdvanceClock(Milliseconds64(100));
+    ASSERT_EQ(transitions.mStepTimes.size(), 1u);
+    EXPECT_EQ(transitions.mStepTimes[0].mEndpoint, 1);
+    EXPECT_EQ(transitions.mStepTimes[0].mTime, System::Clock::Timestamp(100));
+
+    engine.CancelStep(transitions.mTransitions[1]);
+    transitions.Start(3, 1);
+    engine.CancelStep(transitions.mTransitions[3]);
+    EXPECT_FALSE(timerDelegate.IsTimerActive(nullptr));
+}
+
+TEST(TestTransitionEngine, TestShutdown)
+{
+    TestTimerDelegate timerDelegate;
+    TransitionEngine engine(timerDelegate, Milliseconds32(10));
+    TestTransitions transitions(engine, timerDelegate, Milliseconds32(100));
+
+    transitions.Start(1, 2);
+    transitions.Start(2, 2);
+    EXPECT_TRUE(timerDelegate.IsTimerActive(nullptr));
+
+    // Shutting down cancels the timer along with every scheduled step
+    engine.Shutdown();
+    EXPECT_FALSE(timerDelegate.IsTimerActive(nullptr));
+    EXPECT_FALSE(transitions.mTransitions[1].IsScheduled());
+    EXPECT_FALSE(transitions.mTransitions[2].IsScheduled());
+
+    timerDelegate.AdvanceClock(Milliseconds64(1000));
+    EXPECT_TRUE(transitions.mStepTimes.empty());
+}
+
+TEST(TestTransitionEngine, TestTransitionCpuBenchmark)
+{
+    // A bridge fading 200 lights over 10 s, each stepping every 100 ms as the ColorControl server does, started over 1 s
+    constexpr EndpointId kTransitionCount = 200;
+    constexpr uint32_t kStepCount         = 100;
+
+    TestTimerDelegate timerDelegate;
+    TransitionEngine engine(timerDelegate, Milliseconds32(CHIP_CONFIG_TRANSITION_ENGINE_TICK_MS));
+    TestTransitions transitions(engine, timerDelegate, Milliseconds32(100));
+    transitions.mStepTimes.reserve(kTransitionCount * kStepCount);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (EndpointId endpoint = 0; endpoint < kTransitionCount; endpoint++)
+    {
+        transitions.Start(endpoint, kStepCount);
+        timerDelegate.AdvanceClock(Milliseconds64(5));
+    }
+    timerDelegate.AdvanceClock(Milliseconds64(20000));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const TransitionEngine::Stats & stats = engine.GetStats();
+    EXPECT_EQ(stats.mStepCount, kTransitionCount * kStepCount);
+    EXPECT_EQ(transitions.mStepTimes.size(), static_cast<size_t>(kTransitionCount * kStepCount));
+
+    // One timer per transition step would be one timer event per step
+    EXPECT_LT(stats.mTickCount * 10, stats.mStepCount);
+
+    const auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    ChipLogProgress(Zcl, "%u transitions of %u steps: %u timer events instead of %u, %u timer starts, %u ns per step",
+                    static_cast<unsigned>(kTransitionCount), static_cast<unsigned>(kStepCount),
+                    static_cast<unsigned>(stats.mTickCount), static_cast<unsigned>(stats.mStepCount),
+                    static_cast<unsigned>(timerDelegate.mStartCount), static_cast<unsigned>(elapsedNs / stats.mStepCount));
+}
+
+} // namespace
@@ -0,0 +1,329 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/WriteBehindAttributePersistenceProvider.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <pw_unit_test/framework.h>
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+using Milliseconds64 = System::Clock::Milliseconds64;
+
+const ConcreteAttributePath kCurrentHuePath(1, ColorControl::Id, ColorControl::Attributes::CurrentHue::Id);
+const ConcreteAttributePath kCurrentSaturationPath(1, ColorControl::Id, ColorControl::Attributes::CurrentSaturation::Id);
+const ConcreteAttributePath kCurrentXPath(1, ColorControl::Id, ColorControl::Attributes::CurrentX::Id);
+const ConcreteAttributePath kCurrentYPath(1, ColorControl::Id, ColorControl::Attributes::CurrentY::Id);
+
+/// Persister keeping values in RAM, and counting the writes that would have reached the flash
+class CountingPersister : public AttributePersistenceProvider
+{
+public:
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override
+    {
+        ReturnErrorCodeIf(mFailWrites, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        mWriteCount++;
+        mValues[Key(aPath)].assign(aValue.begin(), aValue.end());
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override
+    {
+        auto value = mValues.find(Key(aPath));
+        ReturnErrorCodeIf(value == mValues.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        return CopySpanToMutableSpan(ByteSpan(value->second.data(), value->second.size()), aValue);
+    }
+
+    uint32_t mWriteCount = 0;
+    bool mFailWrites     = false;
+
+private:
+    using PathKey = std::tuple<EndpointId, ClusterId, AttributeId>;
+
+    static PathKey Key(const ConcreteAttributePath & aPath)
+    {
+        return PathKey(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
+    }
+
+    std::map<PathKey, std::vector<uint8_t>> mValues;
+};
+
+/// Timer delegate driven by a mock clock, supporting the single timer of the provider
+class TestTimerDelegate : public WriteBehindAttributePersistenceProvider::TimerDelegate
+{
+public:
+    CHIP_ERROR StartTimer(reporting::TimerContext * context, System::Clock::Timeout aTimeout) override
+    {
+        mContext    = context;
+        mExpiryTime = mNow + aTimeout;
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(reporting::TimerContext * context) override
+    {
+        mContext = nullptr;
+        mCancelCount++;
+    }
+    bool IsTimerActive(reporting::TimerContext * context) override { return mContext != nullptr; }
+    System::Clock::Timestamp GetCurrentMonotonicTimestamp() override { return mNow; }
+
+    // Advance the mock clock, firing the timer if it expires meanwhile
+    void AdvanceClock(Milliseconds64 duration)
+    {
+        const System::Clock::Timestamp end = mNow + duration;
+
+        while (mContext != nullptr && mExpiryTime <= end)
+        {
+            reporting::TimerContext * context = mContext;
+            mNow                              = mExpiryTime;
+            mContext                          = nullptr;
+            context->TimerFired();
+        }
+
+        mNow = end;
+    }
+
+    System::Clock::Timestamp mNow = System::Clock::kZero;
+    System::Clock::Timestamp mExpiryTime;
+    reporting::TimerContext * mContext = nullptr;
+    uint32_t mCancelCount              = 0;
+};
+
+WriteBehindAttributePersistenceProvider::Config MakeConfig(uint32_t flushDelayMs, uint32_t minFlushIntervalMs)
+{
+    WriteBehindAttributePersistenceProvider::Config config;
+    config.mFlushDelay       = System::Clock::Milliseconds32(flushDelayMs);
+    config.mMinFlushInterval = System::Clock::Milliseconds32(minFlushIntervalMs);
+    return config;
+}
+
+CHIP_ERROR WriteUint16(AttributePersistenceProvider & persister, const ConcreteAttributePath & path, uint16_t value)
+{
+    return persister.WriteValue(path, ByteSpan(reinterpret_cast<const uint8_t *>(&value), sizeof(value)));
+}
+
+uint16_t ReadUint16(AttributePersistenceProvider & persister, const ConcreteAttributePath & path)
+{
+    uint16_t value = 0;
+    MutableByteSpan span(reinterpret_cast<uint8_t *>(&value), sizeof(value));
+    EXPECT_EQ(persister.ReadValue(path, nullptr, span), CHIP_NO_ERROR);
+    EXPECT_EQ(span.size(), sizeof(value));
+    return value;
+}
+
+class TestWriteBehindAttributePersistenceProvider : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestWriteBehindAttributePersistenceProvider, TestLastValueWins)
+{
+    CountingPersister persister;
+    TestTimerDelegate timerDelegate;
+    WriteBehindAttributePersistenceProvider provider(persister, timerDelegate, MakeConfig(1000, 0));
+
+    EXPECT_EQ(WriteUint16(provider, kCurrentHuePath, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(WriteUint16(provider, kCurrentHuePath, 2), CHIP_NO_ERROR);
+    EXPECT_EQ(WriteUint16(provider, kCurrentSaturationPath, 3), CHIP_NO_ERROR);
+    EXPECT_EQ(WriteUint16(provider, kCurrentHuePath, 4), CHIP_NO_ERROR);
+
+    // Dirty values are read back before reaching the persister
+    EXPECT_EQ(persister.mWriteCount, 0u);
+    EXPECT_TRUE(provider.HasDirtyValues());
+    EXPECT_EQ(ReadUint16(provider, kCurrentHuePath), 4);
+    EXPECT_EQ(ReadUint16(provider, kCurrentSaturationPath), 3);
+
+    // The flush deadline runs from the first dirty value, and further writes do not postpone it
+    timerDelegate.AdvanceClock(Milliseconds64(999));
+    EXPECT_EQ(persister.mWriteCount, 0u);
+    timerDelegate.AdvanceClock(Milliseconds64(1));
+    EXPECT_EQ(persister.mWriteCount, 2u);
+    EXPECT_FALSE(provider.HasDirtyValues());
+    EXPECT_EQ(ReadUint16(persister, kCurrentHuePath), 4);
+    EXPECT_EQ(ReadUint16(persister, kCurrentSaturationPath), 3);
+
+    const WriteBehindAttributePersistenceProvider::Stats & stats = provider.GetStats();
+    EXPECT_EQ(stats.mWriteCount, 4u);
+    EXPECT_EQ(stats.mCoalescedCount, 2u);
+    EXPECT_EQ(stats.mFlushedCount, 2u);
+    EXPECT_EQ(stats.mFlushCount, 1u);
+}
+
+TEST_F(TestWriteBehindAttributePersistenceProvider, TestMinFlushInterval)
+{
+    CountingPersister persister;
+    TestTimerDelegate timerDelegate;
+    WriteBehindAttributePersistenceProvider provider(persister, timerDelegate, MakeConfig(1000, 10000));
+
+    EXPECT_EQ(WriteUint16(provider, kCurrentHuePath, 1), CHIP_NO_ERROR);
+    timerDelegate.AdvanceClock(Milliseconds64(1000));
+    EXPECT_EQ(persister.mWriteCount, 1u);
+
+    // The next flush waits for the minimum interval since the last one, rather than the flush delay
+    EXPECT_EQ(WriteUint16(provider, kCurrentHuePath, 2), CHIP_NO_ERROR);
+    timerDelegate.AdvanceClock(Milliseconds64(9999));
+    EXPECT_EQ(persister.mWriteCount, 1u);
+    timerDelegate.AdvanceClock(Milliseconds64(1));
+    EXPECT_EQ(persister.mWriteCount, 2u);
+
+    // Once the interval has elapsed, the flush delay applies again
+    timerDelegate.AdvanceClock(Milliseconds64(20000));
+    EXPECT_EQ(WriteUint16(provider, kCurrentHuePath, 3), CHIP_NO_ERROR);
+    timerDelegate.AdvanceClock(Milliseconds64(1000));
+    EXPECT_EQ(persister.mWriteCount, 3u);
+}
+
+TEST_F(TestWriteBehindAttributePersistenceProvider, TestFlush)
+{
+    CountingPersister persister;
+    TestTimerDelegate timerDelegate;
+    WriteBehindAttributePersistenceProvider provider(persister, timerDelegate, MakeConfig(1000, 0));
+
+    // Nothing to flush
+    EXPECT_EQ(provider.Flush(), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.GetStats().mFlushCount, 0u);
+
+    // Values failing to be written stay dirty, and are written by the next flush
+    EXPECT_EQ(WriteUint16(provider, kCurrentHuePath, 1), CHIP_NO_ERROR);
+    persister.mFailWrites = true;
+    EXPECT_EQ(provider.Flush(), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_TRUE(provider.HasDirtyValues());
+    EXPECT_NE(timerDelegate.mContext, nullptr);
+
+    persister.mFailWrites = false;
+    timerDelegate.AdvanceClock(Milliseconds64(1000));
+    EXPECT_EQ(persister.mWriteCount, 1u);
+    EXPECT_FALSE(provider.HasDirtyValues());
+
+    // A flush from a shutdown hook writes immediately, and cancels the scheduled one
+    EXPECT_EQ(WriteUint16(provider, kCurrentXPath, 2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.Flush(), CHIP_NO_ERROR);
+    EXPECT_EQ(persister.mWriteCount, 2u);
+    EXPECT_EQ(timerDelegate.mContext, nullptr);
+}
+
+TEST_F(TestWriteBehindAttributePersistenceProvider, TestShutdown)
+{
+    CountingPersister persister;
+    TestTimerDelegate timerDelegate;
+
+    {
+        WriteBehindAttributePersistenceProvider provider(persister, timerDelegate, MakeConfig(1000, 0));
+
+        EXPECT_EQ(WriteUint16(provider, kCurrentHuePath, 1), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteUint16(provider, kCurrentXPath, 2), CHIP_NO_ERROR);
+        persister.mFailWrites = true;
+        EXPECT_EQ(provider.Shutdown(), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        EXPECT_FALSE(provider.HasDirtyValues());
+        EXPECT_EQ(timerDelegate.mContext, nullptr);
+
+        persister.mFailWrites = false;
+        EXPECT_EQ(WriteUint16(provider, kCurrentHuePath, 3), CHIP_NO_ERROR);
+        EXPECT_EQ(provider.Shutdown(), CHIP_NO_ERROR);
+        EXPECT_EQ(persister.mWriteCount, 1u);
+        EXPECT_EQ(ReadUint16(persister, kCurrentHuePath), 3u);
+    }
+
+    // The destructor does not use the timer delegate, which may no longer work by then
+    const uint32_t cancelCount = timerDelegate.mCancelCount;
+    {
+        WriteBehindAttributePersistenceProvider provider(persister, timerDelegate, MakeConfig(1000, 0));
+        EXPECT_EQ(WriteUint16(provider, kCurrentHuePath, 4), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(timerDelegate.mCancelCount, cancelCount);
+}
+
+TEST_F(TestWriteBehindAttributePersistenceProvider, TestWriteThroughWhenFull)
+{
+    CountingPersister persister;
+    TestTimerDelegate timerDelegate;
+    WriteBehindAttributePersistenceProvider provider(persister, timerDelegate, MakeConfig(1000, 0));
+
+    for (AttributeId id = 0; id < WriteBehindAttributePersistenceProvider::kCapacity; id++)
+    {
+        EXPECT_EQ(WriteUint16(provider, ConcreteAttributePath(2, ColorControl::Id, id), 1), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(persister.mWriteCount, 0u);
+
+    EXPECT_EQ(WriteUint16(provider, kCurrentYPath, 2), CHIP_NO_ERROR);
+    EXPECT_EQ(persister.mWriteCount, 1u);
+    EXPECT_EQ(provider.GetStats().mWriteThroughCount, 1u);
+    EXPECT_EQ(ReadUint16(provider, kCurrentYPath), 2);
+
+    EXPECT_EQ(provider.Flush(), CHIP_NO_ERROR);
+    EXPECT_EQ(persister.mWriteCount, WriteBehindAttributePersistenceProvider::kCapacity + 1);
+}
+
+TEST_F(TestWriteBehindAttributePersistenceProvider, TestColorTransitionWriteCount)
+{
+    // A 10 s transition updating the color attributes every 100 ms, as the ColorControl server does
+    constexpr uint32_t kTransitionTimeMs = 10000;
+    constexpr uint32_t kStepTimeMs       = 100;
+    const ConcreteAttributePath kPaths[] = { kCurrentHuePath, kCurrentSaturationPath, kCurrentXPath, kCurrentYPath };
+
+    CountingPersister writeThroughPersister;
+    CountingPersister persister;
+    TestTimerDelegate timerDelegate;
+    WriteBehindAttributePersistenceProvider provider(persister, timerDelegate);
+
+    for (uint32_t time = 0; time < kTransitionTimeMs; time += kStepTimeMs)
+    {
+        for (const ConcreteAttributePath & path : kPaths)
+        {
+            const uint16_t value = static_cast<uint16_t>(time / kStepTimeMs + path.mAttributeId);
+            EXPECT_EQ(WriteUint16(writeThroughPersister, path, value), CHIP_NO_ERROR);
+            EXPECT_EQ(WriteUint16(provider, path, value), CHIP_NO_ERROR);
+        }
+        timerDelegate.AdvanceClock(Milliseconds64(kStepTimeMs));
+    }
+
+    // Shutdown hook
+    EXPECT_EQ(provider.Flush(), CHIP_NO_ERROR);
+
+    const WriteBehindAttributePersistenceProvider::Stats & stats = provider.GetStats();
+    ChipLogProgress(DataManagement, "%u ms color transition: %u writes through, %u writes behind in %u flushes",
+                    static_cast<unsigned>(kTransitionTimeMs), static_cast<unsigned>(writeThroughPersister.mWriteCount),
+                    static_cast<unsigned>(persister.mWriteCount), static_cast<unsigned>(stats.mFlushCount));
+
+    // The persisted values are the final ones
+    for (const ConcreteAttributePath & path : kPaths)
+    {
+        EXPECT_EQ(ReadUint16(persister, path), ReadUint16(writeThroughPersister, path));
+    }
+
+    // One write per attribute for each flush, the first one after the flush delay, then at most one per minimum interval
+    const WriteBehindAttributePersistenceProvider::Config config;
+    const uint32_t maxFlushCount =
+        2 + static_cast<uint32_t>((kTransitionTimeMs - config.mFlushDelay.count()) / config.mMinFlushInterval.count());
+
+    EXPECT_EQ(writeThroughPersister.mWriteCount, (kTransitionTimeMs / kStepTimeMs) * ArraySize(kPaths));
+    EXPECT_LE(stats.mFlushCount, maxFlushCount);
+    EXPECT_EQ(persister.mWriteCount, stats.mFlushCount * ArraySize(kPaths));
+}
+
+} // namespace
@@ -0,0 +1,152 @@
+/**
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/CodeUtils.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief EndpointIndexMap maps endpoint ids to the index of their slot in the endpoint table of the attribute storage, so that
+ *        finding an endpoint, or checking that a dynamic endpoint id is free, does not require to scan every slot.
+ *
+ *        It is an open addressing hash table using linear probing, with at least twice as many buckets as endpoints. Endpoint ids
+ *        are used as their own hash: the consecutive ids of bridged endpoints land in consecutive buckets without collisions.
+ *        Removals shift the following entries back instead of leaving tombstones, so that adding and removing endpoints for the
+ *        lifetime of a bridge does not degrade lookups.
+ *
+ * @tparam kMaxEndpoints The maximum number of endpoints in the map, i.e. the number of slots of the endpoint table
+ */
+template <uint16_t kMaxEndpoints>
+class EndpointIndexMap
+{
+public:
+    static constexpr uint16_t kInvalidIndex = 0xFFFF;
+
+    /**
+     * @brief Map an endpoint id to the index of its slot
+     *
+     * @return CHIP_ERROR_INVALID_ARGUMENT if the endpoint id is kInvalidEndpointId
+     *         CHIP_ERROR_ENDPOINT_EXISTS if the endpoint id is already mapped
+     *         CHIP_ERROR_NO_MEMORY if kMaxEndpoints endpoints are already mapped
+     */
+    CHIP_ERROR Insert(EndpointId endpoint, uint16_t index)
+    {
+        VerifyOrReturnError(endpoint != kInvalidEndpointId, CHIP_ERROR_INVALID_ARGUMENT);
+
+        size_t bucket = Hash(endpoint);
+        for (; mBuckets[bucket].mEndpoint != kInvalidEndpointId; bucket = Next(bucket))
+        {
+            VerifyOrReturnError(mBuckets[bucket].mEndpoint != endpoint, CHIP_ERROR_ENDPOINT_EXISTS);
+        }
+        VerifyOrReturnError(mCount < kMaxEndpoints, CHIP_ERROR_NO_MEMORY);
+
+        mBuckets[bucket].mEndpoint = endpoint;
+        mBuckets[bucket].mIndex    = index;
+        mCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    /// @brief Get the index of the slot of an endpoint, or kInvalidIndex if the endpoint is not mapped
+    uint16_t Find(EndpointId endpoint) const
+    {
+        const size_t bucket = FindBucket(endpoint);
+        return (bucket < kBucketCount) ? mBuckets[bucket].mIndex : kInvalidIndex;
+    }
+
+    /// @brief Remove the mapping of an endpoint, if any
+    void Remove(EndpointId endpoint)
+    {
+        size_t hole = FindBucket(endpoint);
+        VerifyOrReturn(hole < kBucketCount);
+
+        // Move back the following entries of the probe sequence which would no longer be found past the hole
+        for (size_t bucket = Next(hole); mBuckets[bucket].mEndpoint != kInvalidEndpointId; bucket = Next(bucket))
+        {
+            const size_t home = Hash(mBuckets[bucket].mEndpoint);
+            if (((bucket - home) & kBucketMask) >= ((bucket - hole) & kBucketMask))
+            {
+                mBuckets[hole] = mBuckets[bucket];
+                hole           = bucket;
+            }
+        }
+
+        mBuckets[hole] = Bucket();
+        mCount--;
+    }
+
+    void Clear()
+    {
+        for (Bucket & bucket : mBuckets)
+        {
+            bucket = Bucket();
+        }
+        mCount = 0;
+    }
+
+    uint16_t Count() const { return mCount; }
+
+private:
+    static constexpr size_t BucketCountFor(size_t maxEndpoints)
+    {
+        size_t count = 1;
+        while (count < 2 * maxEndpoints)
+        {
+            count <<= 1;
+        }
+        return count;
+    }
+
+    static constexpr size_t kBucketCount = BucketCountFor(kMaxEndpoints);
+    static constexpr size_t kBucketMask  = kBucketCount - 1;
+
+    struct Bucket
+    {
+        EndpointId mEndpoint = kInvalidEndpointId;
+        uint16_t mIndex      = kInvalidIndex;
+    };
+
+    static size_t Hash(EndpointId endpoint) { return static_cast<size_t>(endpoint) & kBucketMask; }
+    static size_t Next(size_t bucket) { return (bucket + 1) & kBucketMask; }
+
+    // Returns the bucket of the endpoint, or kBucketCount if the endpoint is not mapped
+    size_t FindBucket(EndpointId endpoint) const
+    {
+        VerifyOrReturnValue(endpoint != kInvalidEndpointId, kBucketCount);
+
+        for (size_t bucket = Hash(endpoint); mBuckets[bucket].mEndpoint != kInvalidEndpointId; bucket = Next(bucket))
+        {
+            if (mBuckets[bucket].mEndpoint == endpoint)
+            {
+                return bucket;
+            }
+        }
+        return kBucketCount;
+    }
+
+    Bucket mBuckets[kBucketCount];
+    uint16_t mCount = 0;
+};
+
+} // namespace app
+} // namespace chip
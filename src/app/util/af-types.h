@@ -192,6 +192,8 @@ enum class EmberAfEndpointOptions : uint8_t
     isEnabled         = 0x1,
     isFlatComposition = 0x2,
     isTreeComposition = 0x3,
+    // The PartsList of the endpoint changed during a dynamic endpoint update and has yet to be reported
+    hasPartsListChange = 0x4,
 };
 
 /**
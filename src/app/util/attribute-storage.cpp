@@ -24,6 +24,7 @@
 #include <app/CommandHandlerInterfaceRegistry.h>
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/reporting.h>
+#include <app/util/EndpointIndexMap.h>
 #include <app/util/config.h>
 #include <app/util/ember-strings.h>
 #include <app/util/endpoint-config-api.h>
@@ -93,6 +94,14 @@ uint8_t singletonAttributeData[ACTUAL_SINGLETONS_SIZE];
 
 uint16_t emberEndpointCount = 0;
 
+// Index of the slot of every configured endpoint in emAfEndpoints, so that endpoint lookups do not scan the slots.
+EndpointIndexMap<MAX_ENDPOINT_COUNT> sEndpointIndexMap;
+static_assert(EndpointIndexMap<MAX_ENDPOINT_COUNT>::kInvalidIndex == kEmberInvalidEndpointIndex,
+              "The endpoint index map must use the invalid endpoint index of the attribute storage");
+
+// Nesting depth of the dynamic endpoint updates, see emberAfBeginDynamicEndpointUpdate
+uint16_t sDynamicEndpointUpdateDepth = 0;
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -153,16 +162,13 @@ uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
+    uint16_t epi = sEndpointIndexMap.Find(endpoint);
+    if (epi >= emberAfEndpointCount() ||
+        (ignoreDisabledEndpoints && !emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
     {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
-            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
-        {
-            return epi;
-        }
+        return kEmberInvalidEndpointIndex;
     }
-    return kEmberInvalidEndpointIndex;
+    return epi;
 }
 
 // Returns the index of a given endpoint.  Considers disabled endpoints.
@@ -182,6 +188,7 @@ void emberAfEndpointConfigure()
                   "FIXED_ENDPOINT_COUNT must not exceed the size of the endpoint data type");
 
     emberEndpointCount = FIXED_ENDPOINT_COUNT;
+    sEndpointIndexMap.Clear();
 
 #if FIXED_ENDPOINT_COUNT > 0
 
@@ -213,6 +220,7 @@ void emberAfEndpointConfigure()
         emAfEndpoints[ep].endpointType     = &generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[ep]];
         emAfEndpoints[ep].dataVersions     = currentDataVersions;
         emAfEndpoints[ep].parentEndpointId = fixedParentEndpoints[ep];
+        LogErrorOnFailure(sEndpointIndexMap.Insert(fixedEndpoints[ep], ep));
 
         emAfEndpoints[ep].bitmask.Set(EmberAfEndpointOptions::isEnabled);
         emAfEndpoints[ep].bitmask.Set(EmberAfEndpointOptions::isFlatComposition);
@@ -250,15 +258,13 @@ uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t index;
-    for (index = FIXED_ENDPOINT_COUNT; index < MAX_ENDPOINT_COUNT; index++)
+    // Fixed endpoints, and unknown endpoints, wrap around past the last dynamic index
+    uint16_t index = static_cast<uint16_t>(sEndpointIndexMap.Find(id) - FIXED_ENDPOINT_COUNT);
+    if (index >= MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT)
     {
-        if (emAfEndpoints[index].endpoint == id)
-        {
-            return static_cast<uint8_t>(index - FIXED_ENDPOINT_COUNT);
-        }
+        return kEmberInvalidEndpointIndex;
     }
-    return kEmberInvalidEndpointIndex;
+    return index;
 }
 
 CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberAfEndpointType * ep,
@@ -283,20 +289,22 @@ CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberA
     }
 
     index = static_cast<uint16_t>(realIndex);
-    for (uint16_t i = FIXED_ENDPOINT_COUNT; i < MAX_ENDPOINT_COUNT; i++)
+    if (sEndpointIndexMap.Find(id) != kEmberInvalidEndpointIndex)
     {
-        if (emAfEndpoints[i].endpoint == id)
-        {
-            return CHIP_ERROR_ENDPOINT_EXISTS;
-        }
+        return CHIP_ERROR_ENDPOINT_EXISTS;
     }
 
+    // The slot may still hold an endpoint which was never enabled, and thus not cleared.
+    sEndpointIndexMap.Remove(emAfEndpoints[index].endpoint);
+    ReturnErrorOnFailure(sEndpointIndexMap.Insert(id, index));
+
     emAfEndpoints[index].endpoint       = id;
     emAfEndpoints[index].deviceTypeList = deviceTypeList;
     emAfEndpoints[index].endpointType   = ep;
     emAfEndpoints[index].dataVersions   = dataVersionStorage.data();
     // Start the endpoint off as disabled.
     emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isEnabled);
+    emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::hasPartsListChange);
     emAfEndpoints[index].parentEndpointId = parentEndpointId;
 
     emberAfSetDynamicEndpointCount(MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT);
@@ -322,19 +330,47 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index)
 {
     EndpointId ep = 0;
 
-    index = static_cast<uint8_t>(index + FIXED_ENDPOINT_COUNT);
+    index = static_cast<uint16_t>(index + FIXED_ENDPOINT_COUNT);
 
     if ((index < MAX_ENDPOINT_COUNT) && (emAfEndpoints[index].endpoint != kInvalidEndpointId) &&
         (emberAfEndpointIndexIsEnabled(index)))
     {
         ep = emAfEndpoints[index].endpoint;
         emberAfEndpointEnableDisable(ep, false);
+        sEndpointIndexMap.Remove(ep);
         emAfEndpoints[index].endpoint = kInvalidEndpointId;
     }
 
     return ep;
 }
 
+void emberAfBeginDynamicEndpointUpdate()
+{
+    sDynamicEndpointUpdateDepth++;
+}
+
+void emberAfEndDynamicEndpointUpdate()
+{
+    VerifyOrReturn(sDynamicEndpointUpdateDepth > 0);
+    VerifyOrReturn(--sDynamicEndpointUpdateDepth == 0);
+
+    for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+    {
+        if (!emAfEndpoints[index].bitmask.Has(EmberAfEndpointOptions::hasPartsListChange))
+        {
+            continue;
+        }
+
+        emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::hasPartsListChange);
+        if (emAfEndpoints[index].endpoint != kInvalidEndpointId)
+        {
+            emberAfAttributeChanged(emAfEndpoints[index].endpoint, Clusters::Descriptor::Id,
+                                    Clusters::Descriptor::Attributes::PartsList::Id,
+                                    emberAfGlobalInteractionModelAttributesChangedListener());
+        }
+    }
+}
+
 uint16_t emberAfFixedEndpointCount()
 {
     return FIXED_ENDPOINT_COUNT;
@@ -896,6 +932,26 @@ bool emberAfEndpointIsEnabled(EndpointId endpoint)
     return emberAfEndpointIndexIsEnabled(index);
 }
 
+namespace {
+
+// Reports the change of the PartsList of an endpoint, or only records it until the end of the dynamic endpoint update in
+// progress. Returns false if the change was already recorded.
+bool partsListChanged(EndpointId endpoint, uint16_t index)
+{
+    if (sDynamicEndpointUpdateDepth > 0 && index != kEmberInvalidEndpointIndex)
+    {
+        VerifyOrReturnValue(!emAfEndpoints[index].bitmask.Has(EmberAfEndpointOptions::hasPartsListChange), false);
+        emAfEndpoints[index].bitmask.Set(EmberAfEndpointOptions::hasPartsListChange);
+        return true;
+    }
+
+    emberAfAttributeChanged(endpoint, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id,
+                            emberAfGlobalInteractionModelAttributesChangedListener());
+    return true;
+}
+
+} // anonymous namespace
+
 bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
 {
     uint16_t index = findIndexFromEndpoint(endpoint, false /* ignoreDisabledEndpoints */);
@@ -929,9 +985,12 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
         EndpointId parentEndpointId = emberAfParentEndpointFromIndex(index);
         while (parentEndpointId != kInvalidEndpointId)
         {
-            emberAfAttributeChanged(parentEndpointId, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id,
-                                    emberAfGlobalInteractionModelAttributesChangedListener());
             uint16_t parentIndex = emberAfIndexFromEndpoint(parentEndpointId);
+            if (!partsListChanged(parentEndpointId, parentIndex))
+            {
+                // The change of the remaining ancestors was recorded along with this one.
+                break;
+            }
             if (parentIndex == kEmberInvalidEndpointIndex)
             {
                 // Something has gone wrong.
@@ -940,8 +999,7 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
             parentEndpointId = emberAfParentEndpointFromIndex(parentIndex);
         }
 
-        emberAfAttributeChanged(/* endpoint = */ 0, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id,
-                                emberAfGlobalInteractionModelAttributesChangedListener());
+        partsListChanged(/* endpoint = */ 0, emberAfIndexFromEndpoint(0));
     }
 
     return true;
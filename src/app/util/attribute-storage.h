@@ -262,6 +262,19 @@ CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, chip::EndpointId id, const
                                      chip::EndpointId parentEndpointId                  = chip::kInvalidEndpointId);
 chip::EndpointId emberAfClearDynamicEndpoint(uint16_t index);
 uint16_t emberAfGetDynamicIndexFromEndpoint(chip::EndpointId id);
+
+//
+// Group the registration and removal of many dynamic endpoints, e.g. when a bridge
+// adds its devices at startup.
+//
+// Between emberAfBeginDynamicEndpointUpdate and emberAfEndDynamicEndpointUpdate, the
+// changes of the Descriptor PartsList of the ancestors of the added or removed
+// endpoints, and of the root endpoint, are only recorded. They are reported once
+// per endpoint by the outermost emberAfEndDynamicEndpointUpdate call, instead of
+// once per added or removed endpoint. Updates can be nested.
+//
+void emberAfBeginDynamicEndpointUpdate();
+void emberAfEndDynamicEndpointUpdate();
 /**
  * @brief Loads attribute defaults and any non-volatile attributes stored
  *
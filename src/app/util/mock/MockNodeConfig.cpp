@@ -193,10 +193,13 @@ MockEndpointConfig::MockEndpointConfig(EndpointId aId, std::initializer_list<Moc
 }
 
 MockEndpointConfig::MockEndpointConfig(const MockEndpointConfig & other) :
-    id(other.id), clusters(other.clusters), mEmberClusters(other.mEmberClusters), mDeviceTypes(other.mDeviceTypes),
-    mEmberEndpoint(other.mEmberEndpoint)
+    id(other.id), clusters(other.clusters), mDeviceTypes(other.mDeviceTypes), mEmberEndpoint(other.mEmberEndpoint)
 {
-    // fix self-referencing pointers
+    // fix self-referencing pointers: the EmberAfClusters reference the attributes of our own copy of the clusters
+    for (const auto & cluster : clusters)
+    {
+        mEmberClusters.push_back(*cluster.emberCluster());
+    }
     mEmberEndpoint.cluster = mEmberClusters.data();
 }
 
@@ -210,6 +213,11 @@ MockNodeConfig::MockNodeConfig(std::initializer_list<MockEndpointConfig> aEndpoi
     VerifyOrDie(aEndpoints.size() < kEmberInvalidEndpointIndex);
 }
 
+MockNodeConfig::MockNodeConfig(std::vector<MockEndpointConfig> && aEndpoints) : endpoints(std::move(aEndpoints))
+{
+    VerifyOrDie(endpoints.size() < kEmberInvalidEndpointIndex);
+}
+
 const MockEndpointConfig * MockNodeConfig::endpointById(EndpointId endpointId, ptrdiff_t * outIndex) const
 {
     return findById(endpoints, endpointId, outIndex);
@@ -127,6 +127,8 @@ private:
 struct MockNodeConfig
 {
     MockNodeConfig(std::initializer_list<MockEndpointConfig> aEndpoints);
+    // For configurations built programmatically, e.g. with many endpoints.
+    MockNodeConfig(std::vector<MockEndpointConfig> && aEndpoints);
 
     const MockEndpointConfig * endpointById(EndpointId endpointId, ptrdiff_t * outIndex = nullptr) const;
     const MockClusterConfig * clusterByIds(EndpointId endpointId, ClusterId clusterId, ptrdiff_t * outClusterIndex = nullptr) const;
@@ -170,6 +170,7 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
                                                         Transport::TcpListenParameters(stateParams.tcpEndPointManager)
                                                             .SetAddressType(IPAddressType::kIPv6)
                                                             .SetListenPort(params.listenPort)
+                                                            .SetMaxActiveConnections(params.maxTCPConnections)
 #endif
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF
                                                             ,
@@ -233,6 +234,10 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
     ReturnErrorOnFailure(stateParams.sessionMgr->Init(stateParams.systemLayer, stateParams.transportMgr,
                                                       stateParams.messageCounterManager, params.fabricIndependentStorage,
                                                       stateParams.fabricTable, *stateParams.sessionKeystore));
+    if (params.maxSecureSessions != 0)
+    {
+        ReturnErrorOnFailure(stateParams.sessionMgr->GetSecureSessions().SetMaxSessionTableSize(params.maxSecureSessions));
+    }
     ReturnErrorOnFailure(stateParams.exchangeMgr->Init(stateParams.sessionMgr));
     ReturnErrorOnFailure(stateParams.messageCounterManager->Init(stateParams.exchangeMgr));
     ReturnErrorOnFailure(stateParams.unsolicitedStatusHandler->Init(stateParams.exchangeMgr));
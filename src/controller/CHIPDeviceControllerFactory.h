@@ -160,6 +160,17 @@ struct FactoryInitParams
     /* The port used for operational communication to listen for and send messages over UDP/TCP.
      * The default value of `0` will pick any available port. */
     uint16_t listenPort = 0;
+
+    /* Maximum number of concurrent secure sessions, before the least useful ones get evicted.
+     * The default value of `0` keeps CHIP_CONFIG_SECURE_SESSION_POOL_SIZE. Controllers managing
+     * large fleets set this to (a bit more than) the number of nodes they stay connected to;
+     * values above CHIP_CONFIG_SECURE_SESSION_POOL_SIZE need heap based pools. */
+    size_t maxSecureSessions = 0;
+
+    /* Maximum number of simultaneous TCP connections. The default value of `0` keeps
+     * CHIP_CONFIG_MAX_ACTIVE_TCP_CONNECTIONS; larger values allocate the connection table
+     * from the heap. */
+    size_t maxTCPConnections = 0;
 };
 
 class DeviceControllerFactory
@@ -0,0 +1,306 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/InvokeInteraction.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <transport/Session.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Controller {
+
+namespace {
+
+/**
+ * Sends the InvokeRequestMessages of a batched invoke and maps the responses back to the requests.
+ *
+ * All messages are encoded up front, each into its own CommandSender. The object deletes itself
+ * (and any remaining CommandSender) once every message has completed.
+ */
+class BatchedInvoke final : public app::CommandSender::ExtendableCallback
+{
+public:
+    BatchedInvoke(Messaging::ExchangeManager * exchangeMgr, BatchedInvokeCallback * callback,
+                  const BatchedInvokeParameters & parameters) :
+        mExchangeMgr(exchangeMgr),
+        mCallback(callback), mParameters(parameters)
+    {}
+
+    ~BatchedInvoke() override
+    {
+        for (size_t i = 0; i < mBatchCount; i++)
+        {
+            Platform::Delete(mBatches[i].sender);
+        }
+    }
+
+    CHIP_ERROR Encode(const SessionHandle & session, Span<const BatchedInvokeRequest> requests);
+    CHIP_ERROR Start();
+
+    void OnResponse(app::CommandSender * commandSender, const app::CommandSender::ResponseData & responseData) override;
+    void OnError(const app::CommandSender * commandSender, const app::CommandSender::ErrorData & errorData) override;
+    void OnDone(app::CommandSender * commandSender) override;
+
+private:
+    struct Batch
+    {
+        app::CommandSender * sender;
+        size_t firstIndex;
+        size_t count;
+        CHIP_ERROR error;
+    };
+
+    CHIP_ERROR StartBatch(size_t firstIndex);
+    CHIP_ERROR AddToBatch(Batch & batch, const BatchedInvokeRequest & request);
+    bool IsInBatch(const Batch & batch, const app::CommandPathParams & path, Span<const BatchedInvokeRequest> requests) const;
+    Batch * FindBatch(const app::CommandSender * commandSender);
+    void FinishBatch(Batch & batch);
+    void SendPendingBatches();
+
+    Messaging::ExchangeManager * mExchangeMgr;
+    BatchedInvokeCallback * mCallback;
+    BatchedInvokeParameters mParameters;
+    SessionHolder mSession;
+
+    Platform::ScopedMemoryBuffer<Batch> mBatches;
+    Platform::ScopedMemoryBuffer<bool> mResponded;
+    size_t mBatchCount      = 0;
+    size_t mNextBatch       = 0;
+    size_t mFinishedBatches = 0;
+    size_t mInFlight        = 0;
+};
+
+CHIP_ERROR BatchedInvoke::Encode(const SessionHandle & session, Span<const BatchedInvokeRequest> requests)
+{
+    mSession.Grab(session);
+
+    if (mParameters.maxPathsPerInvoke == 0)
+    {
+        mParameters.maxPathsPerInvoke = session->GetRemoteSessionParameters().GetMaxPathsPerInvoke();
+    }
+#if !CHIP_CONFIG_COMMAND_SENDER_BUILTIN_SUPPORT_FOR_BATCHED_COMMANDS
+    // Without a pending response tracker, CommandSender can only send one command per message.
+    mParameters.maxPathsPerInvoke = 1;
+#endif // !CHIP_CONFIG_COMMAND_SENDER_BUILTIN_SUPPORT_FOR_BATCHED_COMMANDS
+    mParameters.maxPathsPerInvoke  = std::max<uint16_t>(mParameters.maxPathsPerInvoke, 1);
+    mParameters.maxInvokesInFlight = std::max<uint8_t>(mParameters.maxInvokesInFlight, 1);
+
+    // At worst, every command goes into a message of its own.
+    VerifyOrReturnError(mBatches.Calloc(requests.size()), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mResponded.Calloc(requests.size()), CHIP_ERROR_NO_MEMORY);
+
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        const BatchedInvokeRequest & request = requests[i];
+        VerifyOrReturnError(request.data != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(request.path.mFlags.Has(app::CommandPathFlags::kEndpointIdValid), CHIP_ERROR_INVALID_ARGUMENT);
+
+        if (mBatchCount == 0 || mBatches[mBatchCount - 1].count == mParameters.maxPathsPerInvoke ||
+            IsInBatch(mBatches[mBatchCount - 1], request.path, requests))
+        {
+            ReturnErrorOnFailure(StartBatch(i));
+        }
+
+        CHIP_ERROR err = AddToBatch(mBatches[mBatchCount - 1], request);
+        if ((err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL) && mBatches[mBatchCount - 1].count > 0)
+        {
+            // The message is full: AddRequestData rolled the command back, so it can go into the next one.
+            ReturnErrorOnFailure(StartBatch(i));
+            err = AddToBatch(mBatches[mBatchCount - 1], request);
+        }
+        ReturnErrorOnFailure(err);
+    }
+
+    ChipLogDetail(Controller, "Batched %u commands into %u InvokeRequestMessages", static_cast<unsigned>(requests.size()),
+                  static_cast<unsigned>(mBatchCount));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BatchedInvoke::StartBatch(size_t firstIndex)
+{
+    auto * sender = Platform::New<app::CommandSender>(this, mExchangeMgr, mParameters.timedInvokeTimeoutMs.HasValue());
+    VerifyOrReturnError(sender != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mBatches[mBatchCount] = { sender, firstIndex, 0, CHIP_NO_ERROR };
+    mBatchCount++;
+
+    if (mParameters.maxPathsPerInvoke > 1)
+    {
+        app::CommandSender::ConfigParameters config;
+        config.SetRemoteMaxPathsPerInvoke(mParameters.maxPathsPerInvoke);
+        ReturnErrorOnFailure(sender->SetCommandSenderConfig(config));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BatchedInvoke::AddToBatch(Batch & batch, const BatchedInvokeRequest & request)
+{
+    app::CommandSender::AddRequestDataParameters addRequestDataParams(mParameters.timedInvokeTimeoutMs);
+    if (mParameters.maxPathsPerInvoke > 1)
+    {
+        // The reference is the index of the command within its message.
+        addRequestDataParams.SetCommandRef(static_cast<uint16_t>(batch.count));
+    }
+    ReturnErrorOnFailure(batch.sender->AddRequestData(request.path, *request.data, addRequestDataParams));
+    batch.count++;
+    return CHIP_NO_ERROR;
+}
+
+bool BatchedInvoke::IsInBatch(const Batch & batch, const app::CommandPathParams & path,
+                              Span<const BatchedInvokeRequest> requests) const
+{
+    for (size_t i = batch.firstIndex; i < batch.firstIndex + batch.count; i++)
+    {
+        if (requests[i].path.IsSamePath(path))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR BatchedInvoke::Start()
+{
+    VerifyOrReturnError(mBatchCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Failing to send the first message fails the whole interaction, without any callback.
+    ReturnErrorOnFailure(mBatches[0].sender->SendCommandRequest(mSession.Get().Value(), mParameters.responseTimeout));
+    mNextBatch = 1;
+    mInFlight  = 1;
+
+    // With the first message in flight, this cannot complete (and delete) us.
+    SendPendingBatches();
+    return CHIP_NO_ERROR;
+}
+
+BatchedInvoke::Batch * BatchedInvoke::FindBatch(const app::CommandSender * commandSender)
+{
+    for (size_t i = 0; i < mBatchCount; i++)
+    {
+        if (mBatches[i].sender == commandSender)
+        {
+            return &mBatches[i];
+        }
+    }
+    return nullptr;
+}
+
+void BatchedInvoke::OnResponse(app::CommandSender * commandSender, const app::CommandSender::ResponseData & responseData)
+{
+    Batch * batch = FindBatch(commandSender);
+    VerifyOrReturn(batch != nullptr);
+
+    // Messages with a single command carry no reference.
+    const size_t ref = responseData.commandRef.ValueOr(0);
+    VerifyOrReturn(ref < batch->count, ChipLogError(Controller, "Unexpected command reference %u", static_cast<unsigned>(ref)));
+
+    const size_t index = batch->firstIndex + ref;
+    VerifyOrReturn(!mResponded[index]);
+    mResponded[index] = true;
+    mCallback->OnResponse(index, responseData);
+}
+
+void BatchedInvoke::OnError(const app::CommandSender * commandSender, const app::CommandSender::ErrorData & errorData)
+{
+    Batch * batch = FindBatch(commandSender);
+    VerifyOrReturn(batch != nullptr);
+    batch->error = errorData.error;
+}
+
+void BatchedInvoke::OnDone(app::CommandSender * commandSender)
+{
+    Batch * batch = FindBatch(commandSender);
+    VerifyOrDie(batch != nullptr);
+
+    FinishBatch(*batch);
+    mInFlight--;
+    SendPendingBatches();
+}
+
+void BatchedInvoke::FinishBatch(Batch & batch)
+{
+    const CHIP_ERROR error =
+        (batch.error != CHIP_NO_ERROR) ? batch.error : CHIP_IM_GLOBAL_STATUS(Failure);
+    for (size_t index = batch.firstIndex; index < batch.firstIndex + batch.count; index++)
+    {
+        if (!mResponded[index])
+        {
+            mResponded[index] = true;
+            mCallback->OnError(index, error);
+        }
+    }
+
+    Platform::Delete(batch.sender);
+    batch.sender = nullptr;
+    mFinishedBatches++;
+}
+
+void BatchedInvoke::SendPendingBatches()
+{
+    while (mNextBatch < mBatchCount && mInFlight < mParameters.maxInvokesInFlight)
+    {
+        Batch & batch  = mBatches[mNextBatch++];
+        CHIP_ERROR err = CHIP_ERROR_NOT_CONNECTED;
+        if (mSession)
+        {
+            err = batch.sender->SendCommandRequest(mSession.Get().Value(), mParameters.responseTimeout);
+        }
+        if (err == CHIP_NO_ERROR)
+        {
+            mInFlight++;
+            continue;
+        }
+
+        batch.error = err;
+        FinishBatch(batch);
+    }
+
+    if (mFinishedBatches == mBatchCount)
+    {
+        mCallback->OnDone();
+        Platform::Delete(this);
+    }
+}
+
+} // namespace
+
+CHIP_ERROR InvokeCommandRequests(Messaging::ExchangeManager * exchangeMgr, const SessionHandle & sessionHandle,
+                                 Span<const BatchedInvokeRequest> requests, BatchedInvokeCallback * callback,
+                                 const BatchedInvokeParameters & parameters)
+{
+    VerifyOrReturnError(exchangeMgr != nullptr && callback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!requests.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    // Batched invokes expect responses, so cannot happen over a group session.
+    VerifyOrReturnError(!sessionHandle->IsGroupSession(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    auto invoke = Platform::MakeUnique<BatchedInvoke>(exchangeMgr, callback, parameters);
+    VerifyOrReturnError(invoke != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    ReturnErrorOnFailure(invoke->Encode(sessionHandle, requests));
+    ReturnErrorOnFailure(invoke->Start());
+
+    // Deletes itself once all messages completed
+    invoke.release();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Controller
+} // namespace chip
@@ -18,8 +18,10 @@
 
 #pragma once
 
+#include <app/data-model/EncodableToTLV.h>
 #include <controller/TypedCommandCallback.h>
 #include <lib/core/Optional.h>
+#include <lib/support/Span.h>
 
 #include <functional>
 
@@ -158,5 +160,71 @@ InvokeCommandRequest(Messaging::ExchangeManager * exchangeMgr, const SessionHand
                                 responseTimeout);
 }
 
+/**
+ * A command to send as part of a batched invoke: the (endpoint) path of the command and its request data.
+ *
+ * The request data only needs to stay valid until InvokeCommandRequests() returns, as all requests are
+ * encoded before it does.
+ */
+struct BatchedInvokeRequest
+{
+    app::CommandPathParams path;
+    const app::DataModel::EncodableToTLV * data = nullptr;
+};
+
+/**
+ * Receives the outcome of every command of a batched invoke. Commands are identified by their index
+ * in the list of requests passed to InvokeCommandRequests().
+ */
+class BatchedInvokeCallback
+{
+public:
+    virtual ~BatchedInvokeCallback() = default;
+
+    /**
+     * Called with the response to a command: a status (which may be a path-specific error) or data.
+     */
+    virtual void OnResponse(size_t index, const app::CommandSender::ResponseData & response) = 0;
+
+    /**
+     * Called for a command no response was received for. `error` is the error that ended the
+     * InvokeRequestMessage the command was part of (e.g. CHIP_ERROR_TIMEOUT), or a Failure status if
+     * the peer completed the interaction without responding to the command.
+     */
+    virtual void OnError(size_t index, CHIP_ERROR error) = 0;
+
+    /**
+     * Called once OnResponse or OnError was called for every command. The callback may be destroyed
+     * from here.
+     */
+    virtual void OnDone() = 0;
+};
+
+struct BatchedInvokeParameters
+{
+    Optional<uint16_t> timedInvokeTimeoutMs;
+    Optional<System::Clock::Timeout> responseTimeout;
+    // Maximum number of commands per InvokeRequestMessage. 0 uses the MaxPathsPerInvoke the peer
+    // advertised for the session.
+    uint16_t maxPathsPerInvoke = 0;
+    // Maximum number of InvokeRequestMessages awaiting a response at any time.
+    uint8_t maxInvokesInFlight = 1;
+};
+
+/*
+ * Invoke a list of commands on a peer, using as few round trips as the peer allows.
+ *
+ * The commands are split into InvokeRequestMessages of at most the peer's MaxPathsPerInvoke commands,
+ * starting a new message whenever a command would not fit into the current one or its path is already
+ * part of it, as paths must be unique within a message. Messages are sent in order, with up to
+ * maxInvokesInFlight of them awaiting a response at the same time.
+ *
+ * On success, the callback, which must outlive the interaction, receives exactly one OnResponse or OnError
+ * call per command, followed by OnDone. On failure, no callback is called.
+ */
+CHIP_ERROR InvokeCommandRequests(Messaging::ExchangeManager * exchangeMgr, const SessionHandle & sessionHandle,
+                                 Span<const BatchedInvokeRequest> requests, BatchedInvokeCallback * callback,
+                                 const BatchedInvokeParameters & parameters = BatchedInvokeParameters());
+
 } // namespace Controller
 } // namespace chip
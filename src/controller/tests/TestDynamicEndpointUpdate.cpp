@@ -0,0 +1,165 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/InteractionModelEngine.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/DataModelHandler.h>
+#include <app/util/attribute-storage.h>
+#include <app/util/endpoint-config-api.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+//
+// The generated endpoint_config for the controller app has a single fixed endpoint, Endpoint 1, and a single
+// dynamic endpoint slot. The dynamic test endpoints are children of the fixed endpoint. There is no Endpoint 0:
+// the change of its PartsList cannot be recorded during an update and is reported right away.
+//
+constexpr EndpointId kTestEndpointId  = 2;
+constexpr EndpointId kOtherEndpointId = 3;
+
+//clang-format off
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(testClusterAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(0x00000001, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpointClusters)
+DECLARE_DYNAMIC_CLUSTER(Clusters::UnitTesting::Id, testClusterAttrs, ZAP_CLUSTER_MASK(SERVER), nullptr, nullptr),
+    DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(testEndpoint, testEndpointClusters);
+//clang-format on
+
+DataVersion dataVersionStorage[ArraySize(testEndpointClusters)];
+
+class TestDynamicEndpointUpdate : public chip::Test::AppContext
+{
+protected:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        // Initialize the ember side server logic
+        InitDataModelHandler();
+    }
+
+    static EndpointId FixedEndpoint() { return emberAfEndpointFromIndex(0); }
+
+    static CHIP_ERROR SetTestEndpoint(EndpointId id)
+    {
+        return emberAfSetDynamicEndpoint(0, id, &testEndpoint, Span<DataVersion>(dataVersionStorage), {}, FixedEndpoint());
+    }
+
+    // Number of attribute paths marked dirty so far
+    static uint64_t DirtySetGeneration()
+    {
+        return InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
+    }
+};
+
+TEST_F(TestDynamicEndpointUpdate, TestSetClearAndResetSlot)
+{
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+
+    EXPECT_EQ(SetTestEndpoint(kTestEndpointId), CHIP_NO_ERROR);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), 0u);
+    EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId), emberAfFixedEndpointCount());
+    EXPECT_EQ(emberAfParentEndpointFromIndex(emberAfIndexFromEndpoint(kTestEndpointId)), FixedEndpoint());
+
+    // The ids of existing endpoints, dynamic or fixed, cannot be reused
+    EXPECT_EQ(SetTestEndpoint(kTestEndpointId), CHIP_ERROR_ENDPOINT_EXISTS);
+    EXPECT_EQ(SetTestEndpoint(FixedEndpoint()), CHIP_ERROR_ENDPOINT_EXISTS);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(FixedEndpoint()), kEmberInvalidEndpointIndex);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), 0u);
+
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kTestEndpointId);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+    EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+
+    // The cleared slot can be set with another endpoint, and then with the first one again
+    EXPECT_EQ(SetTestEndpoint(kOtherEndpointId), CHIP_NO_ERROR);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kOtherEndpointId), 0u);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kOtherEndpointId);
+
+    EXPECT_EQ(SetTestEndpoint(kTestEndpointId), CHIP_NO_ERROR);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), 0u);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kOtherEndpointId), kEmberInvalidEndpointIndex);
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kTestEndpointId);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+}
+
+TEST_F(TestDynamicEndpointUpdate, TestClearInsideUpdate)
+{
+    emberAfBeginDynamicEndpointUpdate();
+
+    EXPECT_EQ(SetTestEndpoint(kTestEndpointId), CHIP_NO_ERROR);
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kTestEndpointId);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+
+    // The slot can be reused within the update
+    EXPECT_EQ(SetTestEndpoint(kOtherEndpointId), CHIP_NO_ERROR);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kOtherEndpointId), 0u);
+
+    // The PartsList of the parent changed three times, and is reported once
+    const uint64_t generation = DirtySetGeneration();
+    emberAfEndDynamicEndpointUpdate();
+    EXPECT_EQ(DirtySetGeneration(), generation + 1);
+
+    // Outside of an update, changes are reported right away
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kOtherEndpointId);
+    EXPECT_GT(DirtySetGeneration(), generation + 1);
+}
+
+TEST_F(TestDynamicEndpointUpdate, TestNestedUpdates)
+{
+    emberAfBeginDynamicEndpointUpdate();
+    emberAfBeginDynamicEndpointUpdate();
+
+    EXPECT_EQ(SetTestEndpoint(kTestEndpointId), CHIP_NO_ERROR);
+
+    // Only the outermost update reports the recorded changes
+    uint64_t generation = DirtySetGeneration();
+    emberAfEndDynamicEndpointUpdate();
+    EXPECT_EQ(DirtySetGeneration(), generation);
+
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kTestEndpointId);
+    generation = DirtySetGeneration();
+    emberAfEndDynamicEndpointUpdate();
+    EXPECT_EQ(DirtySetGeneration(), generation + 1);
+
+    // Unbalanced end calls are ignored
+    emberAfEndDynamicEndpointUpdate();
+    EXPECT_EQ(DirtySetGeneration(), generation + 1);
+
+    // A later update reports its own changes
+    emberAfBeginDynamicEndpointUpdate();
+    EXPECT_EQ(SetTestEndpoint(kTestEndpointId), CHIP_NO_ERROR);
+    generation = DirtySetGeneration();
+    emberAfEndDynamicEndpointUpdate();
+    EXPECT_EQ(DirtySetGeneration(), generation + 1);
+
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kTestEndpointId);
+}
+
+} // namespace
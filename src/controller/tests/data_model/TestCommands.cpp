@@ -42,6 +42,8 @@
 #include <protocols/interaction_model/Constants.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <vector>
+
 using namespace chip;
 using namespace chip::app;
 using namespace chip::app::Clusters;
@@ -427,4 +429,176 @@ TEST_F(TestCommands, TestFailureWithClusterStatus)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+class BatchedInvokeRecorder : public Controller::BatchedInvokeCallback
+{
+public:
+    explicit BatchedInvokeRecorder(size_t commandCount) : mStatuses(commandCount), mErrors(commandCount) {}
+
+    void OnResponse(size_t index, const CommandSender::ResponseData & response) override
+    {
+        ASSERT_LT(index, mStatuses.size());
+        mStatuses[index].push_back(response.statusIB.mStatus);
+    }
+
+    void OnError(size_t index, CHIP_ERROR error) override
+    {
+        ASSERT_LT(index, mErrors.size());
+        mErrors[index].push_back(error);
+    }
+
+    void OnDone() override { mDoneCalls++; }
+
+    // Whether every command got exactly one outcome, and it is `status`.
+    bool AllResponded(Protocols::InteractionModel::Status status) const
+    {
+        for (size_t i = 0; i < mStatuses.size(); i++)
+        {
+            if (mStatuses[i].size() != 1 || mStatuses[i][0] != status || !mErrors[i].empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<std::vector<Protocols::InteractionModel::Status>> mStatuses;
+    std::vector<std::vector<CHIP_ERROR>> mErrors;
+    size_t mDoneCalls = 0;
+};
+
+TEST_F(TestCommands, TestBatchedInvokeSplitsPerPeerMaxPaths)
+{
+    // The peer advertises the default MaxPathsPerInvoke of 1, and repeated paths can never share a
+    // message anyway, so every command goes into an InvokeRequestMessage of its own.
+    constexpr size_t kCommandCount = 8;
+
+    Clusters::UnitTesting::Commands::TestSimpleArgumentRequest::Type request;
+    request.arg1 = true;
+    DataModel::EncodableType<decltype(request)> encodable(request);
+
+    CommandPathParams path(kTestEndpointId, 0, request.GetClusterId(), request.GetCommandId(), CommandPathFlags::kEndpointIdValid);
+    std::vector<Controller::BatchedInvokeRequest> requests(kCommandCount, Controller::BatchedInvokeRequest{ path, &encodable });
+
+    for (uint8_t maxInvokesInFlight : { 1, 4 })
+    {
+        BatchedInvokeRecorder recorder(kCommandCount);
+        Controller::BatchedInvokeParameters parameters;
+        parameters.maxInvokesInFlight = maxInvokesInFlight;
+
+        ScopedChange directive(gCommandResponseDirective, CommandResponseDirective::kSendSuccessStatusCode);
+
+        EXPECT_EQ(Controller::InvokeCommandRequests(&GetExchangeManager(), GetSessionBobToAlice(),
+                                                    Span<const Controller::BatchedInvokeRequest>(requests.data(), requests.size()),
+                                                    &recorder, parameters),
+                  CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+
+        EXPECT_TRUE(recorder.AllResponded(Protocols::InteractionModel::Status::Success));
+        EXPECT_EQ(recorder.mDoneCalls, 1u);
+        EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+    }
+}
+
+TEST_F(TestCommands, TestBatchedInvokeReportsPathErrors)
+{
+    Clusters::UnitTesting::Commands::TestSimpleArgumentRequest::Type request;
+    request.arg1 = true;
+    DataModel::EncodableType<decltype(request)> encodable(request);
+
+    CommandPathParams path(kTestEndpointId, 0, request.GetClusterId(), request.GetCommandId(), CommandPathFlags::kEndpointIdValid);
+    Controller::BatchedInvokeRequest requests[] = { { path, &encodable }, { path, &encodable } };
+
+    BatchedInvokeRecorder recorder(ArraySize(requests));
+    ScopedChange directive(gCommandResponseDirective, CommandResponseDirective::kSendError);
+
+    EXPECT_EQ(Controller::InvokeCommandRequests(&GetExchangeManager(), GetSessionBobToAlice(),
+                                                Span<const Controller::BatchedInvokeRequest>(requests), &recorder),
+              CHIP_NO_ERROR);
+
+    DrainAndServiceIO();
+
+    EXPECT_TRUE(recorder.AllResponded(Protocols::InteractionModel::Status::Failure));
+    EXPECT_EQ(recorder.mDoneCalls, 1u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestCommands, TestBatchedInvokeRejectsInvalidRequests)
+{
+    Clusters::UnitTesting::Commands::TestSimpleArgumentRequest::Type request;
+    DataModel::EncodableType<decltype(request)> encodable(request);
+
+    CommandPathParams path(kTestEndpointId, 0, request.GetClusterId(), request.GetCommandId(), CommandPathFlags::kEndpointIdValid);
+    Controller::BatchedInvokeRequest requests[] = { { path, &encodable }, { path, nullptr } };
+
+    BatchedInvokeRecorder recorder(ArraySize(requests));
+    EXPECT_EQ(Controller::InvokeCommandRequests(&GetExchangeManager(), GetSessionBobToAlice(),
+                                                Span<const Controller::BatchedInvokeRequest>(requests), &recorder),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(Controller::InvokeCommandRequests(&GetExchangeManager(), GetSessionBobToAlice(),
+                                                Span<const Controller::BatchedInvokeRequest>(), &recorder),
+              CHIP_ERROR_INVALID_ARGUMENT);
+
+    DrainAndServiceIO();
+
+    EXPECT_EQ(recorder.mDoneCalls, 0u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestCommands, BatchedInvokeLatency)
+{
+    // Compare invoking 1, 8 and 32 commands one at a time, waiting for each response before sending
+    // the next command, with a batched invoke that keeps several InvokeRequestMessages in flight. The
+    // number in flight is bounded by the exchanges both ends of the loopback session can have open.
+    constexpr uint8_t kMaxInvokesInFlight = 4;
+
+    Clusters::UnitTesting::Commands::TestSimpleArgumentRequest::Type request;
+    request.arg1 = true;
+    DataModel::EncodableType<decltype(request)> encodable(request);
+
+    CommandPathParams path(kTestEndpointId, 0, request.GetClusterId(), request.GetCommandId(), CommandPathFlags::kEndpointIdValid);
+    ScopedChange directive(gCommandResponseDirective, CommandResponseDirective::kSendSuccessStatusCode);
+
+    for (size_t commandCount : { 1, 8, 32 })
+    {
+        size_t successCalls = 0;
+        auto onSuccessCb    = [&successCalls](const ConcreteCommandPath &, const StatusIB &, const auto &) { ++successCalls; };
+        auto onFailureCb    = [](CHIP_ERROR) {};
+
+        uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (size_t i = 0; i < commandCount; i++)
+        {
+            EXPECT_EQ(Controller::InvokeCommandRequest(&GetExchangeManager(), GetSessionBobToAlice(), kTestEndpointId, request,
+                                                       onSuccessCb, onFailureCb),
+                      CHIP_NO_ERROR);
+            DrainAndServiceIO();
+        }
+        const uint64_t sequentialUs = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+        EXPECT_EQ(successCalls, commandCount);
+
+        std::vector<Controller::BatchedInvokeRequest> requests(commandCount, Controller::BatchedInvokeRequest{ path, &encodable });
+        BatchedInvokeRecorder recorder(commandCount);
+        Controller::BatchedInvokeParameters parameters;
+        parameters.maxInvokesInFlight = kMaxInvokesInFlight;
+
+        start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        EXPECT_EQ(Controller::InvokeCommandRequests(&GetExchangeManager(), GetSessionBobToAlice(),
+                                                    Span<const Controller::BatchedInvokeRequest>(requests.data(), requests.size()),
+                                                    &recorder, parameters),
+                  CHIP_NO_ERROR);
+        DrainAndServiceIO();
+        const uint64_t batchedUs = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+        EXPECT_TRUE(recorder.AllResponded(Protocols::InteractionModel::Status::Success));
+        EXPECT_EQ(recorder.mDoneCalls, 1u);
+        EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+
+        const size_t batchedRoundTrips = (commandCount + kMaxInvokesInFlight - 1) / kMaxInvokesInFlight;
+        ChipLogProgress(Test, "%u commands: %u round trips in %u us one at a time, %u round trips in %u us batched",
+                        static_cast<unsigned>(commandCount), static_cast<unsigned>(commandCount),
+                        static_cast<unsigned>(sequentialUs), static_cast<unsigned>(batchedRoundTrips),
+                        static_cast<unsigned>(batchedUs));
+    }
+}
+
 } // namespace
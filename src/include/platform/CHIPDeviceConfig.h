@@ -91,6 +91,16 @@
 #define CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE 100
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE
+ *
+ * The maximum number of events that can be held in the chip Platform event queue on POSIX platforms, where
+ * many application threads may post events or schedule work at once. Must be a power of two.
+ */
+#ifndef CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE
+#define CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE 1024
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
  *
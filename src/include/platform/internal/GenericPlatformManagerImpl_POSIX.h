@@ -97,6 +97,15 @@ protected:
     bool _IsChipStackLockedByCurrentThread() const;
 #endif
 
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV
+public:
+    /**
+     * Statistics of the event queue backing PostEvent() and ScheduleWork(). Must be called with the CHIP stack lock held.
+     */
+    DeviceSafeQueue::Stats GetEventQueueStats() const { return mChipEventQueue.GetStats(); }
+
+protected:
+#endif
     // ===== Methods available to the implementation subclass.
 
 private:
@@ -167,9 +167,14 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDev
     SystemLayer().ScheduleWork(&_DispatchEventViaScheduleWork, eventCopyP);
     return CHIP_NO_ERROR;
 #else
-    mChipEventQueue.Push(*event);
+    bool wakeChipThread = false;
+    CHIP_ERROR err      = mChipEventQueue.Push(*event, wakeChipThread);
+    VerifyOrReturnError(err == CHIP_NO_ERROR, err, ChipLogError(DeviceLayer, "Failed to post event to CHIP Platform event queue"));
 
-    SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
+    if (wakeChipThread)
+    {
+        SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
+    }
     return CHIP_NO_ERROR;
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
@@ -179,10 +184,16 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDev
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.Empty())
+    ChipDeviceEvent event;
+
+    // Events posted while dispatching, from this thread or others, may not wake this thread again, so keep
+    // draining until no event was posted since the last pass.
+    while (mChipEventQueue.BeginDrain())
     {
-        const ChipDeviceEvent event = mChipEventQueue.PopFront();
-        Impl()->DispatchEvent(&event);
+        while (mChipEventQueue.PopFront(event))
+        {
+            Impl()->DispatchEvent(&event);
+        }
     }
 }
 
@@ -67,6 +67,13 @@
 namespace chip {
 namespace Inet {
 
+namespace {
+
+// Maximum number of queued buffers handed to the kernel in a single sendmsg() call.
+constexpr size_t kMaxSendIOVecs = 16;
+
+} // namespace
+
 CHIP_ERROR TCPEndPointImplSockets::BindImpl(IPAddressType addrType, const IPAddress & addr, uint16_t port, bool reuseAddr)
 {
     CHIP_ERROR res = GetSocket(addrType);
@@ -485,9 +492,29 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
-        size_t bufLen = mSendQueue->DataLength();
+        // Gather the queued buffers, so that a chain of messages queued while the socket was not
+        // writable goes out in one system call instead of one per buffer.
+        struct iovec sendIOV[kMaxSendIOVecs];
+        size_t iovCount = 0;
+        size_t bufLen   = 0;
+        for (System::PacketBufferHandle buf = mSendQueue.Retain(); !buf.IsNull() && iovCount < kMaxSendIOVecs; buf.Advance())
+        {
+            if (buf->DataLength() == 0)
+            {
+                continue;
+            }
+            sendIOV[iovCount].iov_base = buf->Start();
+            sendIOV[iovCount].iov_len  = buf->DataLength();
+            bufLen += buf->DataLength();
+            iovCount++;
+        }
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = sendIOV;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
+
+        ssize_t lenSentRaw = (iovCount > 0) ? sendmsg(mSocket, &msgHeader, sendFlags) : 0;
 
         if (lenSentRaw == -1)
         {
@@ -509,21 +536,25 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Release the buffers that were sent completely, and consume what was sent of the next one.
+        for (size_t remaining = lenSent; !mSendQueue.IsNull();)
         {
-            mSendQueue->ConsumeHead(lenSent);
+            if (mSendQueue->DataLength() > remaining)
+            {
+                mSendQueue->ConsumeHead(remaining);
+                break;
+            }
+            remaining -= mSendQueue->DataLength();
+            mSendQueue.FreeHead();
         }
-        else
+
+        if (mSendQueue.IsNull())
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
@@ -34,6 +34,15 @@ void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLo
     mRequestStartTime = now;
     mRequest          = request;
     mResults          = NodeLookupResults();
+    mServedFromCache  = false;
+}
+
+void NodeLookupHandle::UseCachedResult(const ResolveResult & result)
+{
+    mServedFromCache    = true;
+    mResults.results[0] = result;
+    mResults.count      = 1;
+    mResults.consumed   = 0;
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -65,6 +74,11 @@ System::Clock::Timeout NodeLookupHandle::NextEventTimeout(System::Clock::Timesta
 {
     const System::Clock::Timestamp elapsed = now - mRequestStartTime;
 
+    if (mServedFromCache)
+    {
+        return System::Clock::Timeout::zero();
+    }
+
     if (elapsed < mRequest.GetMinLookupTime())
     {
         return mRequest.GetMinLookupTime() - elapsed;
@@ -104,7 +118,8 @@ NodeLookupAction NodeLookupHandle::NextAction(System::Clock::Timestamp now)
                     ChipLogValuePeerId(mRequest.GetPeerId()), static_cast<unsigned long>(elapsed.count()));
 
     // We are still within the minimal search time. Wait for more results.
-    if (elapsed < mRequest.GetMinLookupTime())
+    // Cached results are final already: there is no DNSSD operation to wait for.
+    if (elapsed < mRequest.GetMinLookupTime() && !mServedFromCache)
     {
         ChipLogProgress(Discovery, "Keeping DNSSD lookup active");
         return NodeLookupAction::KeepSearching();
@@ -189,8 +204,33 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 
     VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
+    const System::Clock::Timestamp now = mTimeSource.GetMonotonicTimestamp();
+    handle.ResetForLookup(now, request);
     auto & peerId = request.GetPeerId();
+
+    const ResolveResult * cachedResult = mAddressCache.Lookup(peerId, now);
+    if (cachedResult != nullptr)
+    {
+        handle.UseCachedResult(*cachedResult);
+        mActiveLookups.PushBack(&handle);
+        ReArmTimer();
+        ChipLogProgress(Discovery, "Lookup for " ChipLogFormatPeerId " served from cache", ChipLogValuePeerId(peerId));
+
+        if (mAddressCache.StartRefresh(peerId, now))
+        {
+            // Refresh the entry before it expires; the result updates the cache
+            // through OnOperationalNodeResolved.
+            CHIP_ERROR err = Dnssd::Resolver::Instance().ResolveNodeId(peerId);
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(Discovery, "Failed to refresh cached address for " ChipLogFormatPeerId ": %" CHIP_ERROR_FORMAT,
+                             ChipLogValuePeerId(peerId), err.Format());
+                mAddressCache.RefreshFailed(peerId);
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
     ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
     mActiveLookups.PushBack(&handle);
     ReArmTimer();
@@ -201,6 +241,17 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 CHIP_ERROR Resolver::TryNextResult(Impl::NodeLookupHandle & handle)
 {
     VerifyOrReturnError(!mActiveLookups.Contains(&handle), CHIP_ERROR_INCORRECT_STATE);
+
+    // The previous result was not usable, so it must not be served to other lookups.
+    mAddressCache.Invalidate(handle.GetRequest().GetPeerId());
+
+    if (handle.IsServedFromCache() && !handle.HasLookupResult())
+    {
+        // The cached address is stale: fall back to a real DNSSD lookup.
+        const NodeLookupRequest request = handle.GetRequest();
+        return LookupNode(request, handle);
+    }
+
     VerifyOrReturnError(handle.HasLookupResult(), CHIP_ERROR_NOT_FOUND);
 
     auto listener = handle.GetListener();
@@ -217,7 +268,7 @@ CHIP_ERROR Resolver::CancelLookup(Impl::NodeLookupHandle & handle, FailureCallba
 {
     VerifyOrReturnError(handle.IsActive(), CHIP_ERROR_INVALID_ARGUMENT);
     mActiveLookups.Remove(&handle);
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    ReleaseDnssdResolve(handle);
 
     // Adjust any timing updates.
     ReArmTimer();
@@ -259,11 +310,11 @@ void Resolver::Shutdown()
         const PeerId peerId     = current->GetRequest().GetPeerId();
         NodeListener * listener = current->GetListener();
 
+        ReleaseDnssdResolve(*current);
         mActiveLookups.Erase(current);
 
         MATTER_LOG_NODE_DISCOVERY_FAILED(&peerId, CHIP_ERROR_SHUT_DOWN);
 
-        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
         // Failure callback only called after iterator was cleared:
         // This allows failure handlers to deallocate structures that may
         // contain the active lookup data as a member (intrusive lists members)
@@ -274,35 +325,38 @@ void Resolver::Shutdown()
     // internal list of active lookups is empty at this point.
     ReArmTimer();
 
+    mAddressCache.Clear();
     mSystemLayer = nullptr;
     Dnssd::Resolver::Instance().SetOperationalDelegate(nullptr);
 }
 
 void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData)
 {
+    ResolveResult result;
+
+    result.address.SetPort(nodeData.resolutionData.port);
+    result.address.SetInterface(nodeData.resolutionData.interfaceId);
+    result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
+    result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
+    result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
+
+    if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
+    {
+        result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
+    }
+
+    UpdateAddressCache(nodeData, result);
+
     auto it = mActiveLookups.begin();
     while (it != mActiveLookups.end())
     {
         auto current = it;
         it++;
-        if (current->GetRequest().GetPeerId() != nodeData.operationalData.peerId)
+        if (current->GetRequest().GetPeerId() != nodeData.operationalData.peerId || current->IsServedFromCache())
         {
             continue;
         }
 
-        ResolveResult result;
-
-        result.address.SetPort(nodeData.resolutionData.port);
-        result.address.SetInterface(nodeData.resolutionData.interfaceId);
-        result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
-        result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
-        result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
-
-        if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
-        {
-            result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
-        }
-
         for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
         {
 #if !INET_CONFIG_ENABLE_IPV4
@@ -322,6 +376,44 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
     ReArmTimer();
 }
 
+void Resolver::UpdateAddressCache(const Dnssd::ResolvedNodeData & nodeData, const ResolveResult & baseResult)
+{
+    const PeerId & peerId = nodeData.operationalData.peerId;
+
+    if (nodeData.operationalData.hasZeroTTL)
+    {
+        // Goodbye packet: the node withdrew its operational record.
+        mAddressCache.Invalidate(peerId);
+        return;
+    }
+
+    // Rank the addresses the same way lookups do, and keep the best one.
+    NodeLookupResults ranked;
+    ResolveResult result = baseResult;
+    for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
+    {
+#if !INET_CONFIG_ENABLE_IPV4
+        if (!nodeData.resolutionData.ipAddress[i].IsIPv6())
+        {
+            continue;
+        }
+#endif
+        result.address.SetIPAddress(nodeData.resolutionData.ipAddress[i]);
+        ranked.UpdateResults(result, Dnssd::IPAddressSorter::ScoreIpAddress(result.address.GetIPAddress(),
+                                                                            result.address.GetInterface()));
+    }
+
+    if (!ranked.HasValidResult())
+    {
+        mAddressCache.RefreshFailed(peerId);
+        return;
+    }
+
+    const System::Clock::Seconds32 ttl(
+        nodeData.operationalData.ttlSeconds.value_or(CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL_SEC));
+    mAddressCache.Update(peerId, ranked.ConsumeResult(), mTimeSource.GetMonotonicTimestamp(), ttl);
+}
+
 void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
 {
     const NodeLookupAction action = current->NextAction(mTimeSource.GetMonotonicTimestamp());
@@ -335,10 +427,9 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
     // final result, handle either success or failure
     const PeerId peerId     = current->GetRequest().GetPeerId();
     NodeListener * listener = current->GetListener();
+    ReleaseDnssdResolve(*current);
     mActiveLookups.Erase(current);
 
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
-
     // ensure action is taken AFTER the current current lookup is marked complete
     // This allows failure handlers to deallocate structures that may
     // contain the active lookup data as a member (intrusive lists members)
@@ -374,12 +465,14 @@ void Resolver::HandleTimer()
 
 void Resolver::OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERROR error)
 {
+    mAddressCache.RefreshFailed(peerId);
+
     auto it = mActiveLookups.begin();
     while (it != mActiveLookups.end())
     {
         auto current = it;
         it++;
-        if (current->GetRequest().GetPeerId() != peerId)
+        if (current->GetRequest().GetPeerId() != peerId || current->IsServedFromCache())
         {
             continue;
         }
@@ -432,10 +525,10 @@ void Resolver::ReArmTimer()
             const PeerId peerId     = it->GetRequest().GetPeerId();
             NodeListener * listener = it->GetListener();
 
+            ReleaseDnssdResolve(*it);
             mActiveLookups.Erase(it);
             it = mActiveLookups.begin();
 
-            Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
             // Callback only called after active lookup is cleared
             // This allows failure handlers to deallocate structures that may
             // contain the active lookup data as a member (intrusive lists members)
@@ -444,6 +537,14 @@ void Resolver::ReArmTimer()
     }
 }
 
+void Resolver::ReleaseDnssdResolve(const NodeLookupHandle & handle)
+{
+    if (!handle.IsServedFromCache())
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    }
+}
+
 } // namespace Impl
 
 Resolver & Resolver::Instance()
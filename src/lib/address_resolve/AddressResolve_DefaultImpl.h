@@ -22,11 +22,14 @@
 #include <system/TimeSource.h>
 #include <transport/raw/PeerAddress.h>
 
+#include <array>
+
 namespace chip {
 namespace AddressResolve {
 namespace Impl {
 
 inline constexpr uint8_t kNodeLookupResultsLen = CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS;
+inline constexpr size_t kNodeAddressCacheSize  = CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE;
 
 enum class NodeLookupResult
 {
@@ -64,6 +67,132 @@ struct NodeLookupResults
 #endif // CHIP_DETAIL_LOGGING
 };
 
+/// Remembers the best address of recently resolved nodes, so that lookups can
+/// be answered without a new DNSSD operation while the address is within its
+/// TTL.
+///
+/// Entries are refreshed in the background once most of their TTL has
+/// elapsed and they are still being looked up, and are dropped when the
+/// caller reports the address as unusable (see Resolver::TryNextResult).
+template <size_t kSize>
+class NodeAddressCache
+{
+public:
+    /// Percentage of the TTL after which a lookup hit asks for a refresh.
+    static constexpr uint32_t kRefreshThresholdPercent = 75;
+
+    /// Returns the cached result for the given peer, or nullptr if there is
+    /// none or it has expired.
+    const ResolveResult * Lookup(const PeerId & peerId, System::Clock::Timestamp now) const
+    {
+        const Entry * entry = Find(peerId);
+        VerifyOrReturnValue(entry != nullptr && now < entry->expiresAt, nullptr);
+        return &entry->result;
+    }
+
+    /// Returns true if the entry for the given peer should be refreshed now,
+    /// i.e. it is past its refresh threshold and no refresh is in progress.
+    /// The entry is then considered as being refreshed until Update() or
+    /// RefreshFailed() is called for that peer.
+    bool StartRefresh(const PeerId & peerId, System::Clock::Timestamp now)
+    {
+        Entry * entry = Find(peerId);
+        VerifyOrReturnValue(entry != nullptr && !entry->refreshing, false);
+        VerifyOrReturnValue(now >= entry->refreshAt, false);
+        entry->refreshing = true;
+        return true;
+    }
+
+    void RefreshFailed(const PeerId & peerId)
+    {
+        Entry * entry = Find(peerId);
+        if (entry != nullptr)
+        {
+            entry->refreshing = false;
+        }
+    }
+
+    void Update(const PeerId & peerId, const ResolveResult & result, System::Clock::Timestamp now, System::Clock::Seconds32 ttl)
+    {
+        Entry * entry = Find(peerId);
+        if (entry == nullptr)
+        {
+            entry = FindReplacementSlot(now);
+        }
+        VerifyOrReturn(entry != nullptr);
+
+        const System::Clock::Milliseconds64 lifetime = ttl;
+        entry->inUse                                 = true;
+        entry->refreshing                            = false;
+        entry->peerId                                = peerId;
+        entry->result                                = result;
+        entry->expiresAt                             = now + lifetime;
+        entry->refreshAt                             = now + lifetime * kRefreshThresholdPercent / 100;
+    }
+
+    void Invalidate(const PeerId & peerId)
+    {
+        Entry * entry = Find(peerId);
+        if (entry != nullptr)
+        {
+            entry->inUse = false;
+        }
+    }
+
+    void Clear()
+    {
+        for (auto & entry : mEntries)
+        {
+            entry.inUse = false;
+        }
+    }
+
+private:
+    struct Entry
+    {
+        PeerId peerId;
+        ResolveResult result;
+        System::Clock::Timestamp refreshAt;
+        System::Clock::Timestamp expiresAt;
+        bool inUse      = false;
+        bool refreshing = false;
+    };
+
+    const Entry * Find(const PeerId & peerId) const
+    {
+        for (auto & entry : mEntries)
+        {
+            if (entry.inUse && entry.peerId == peerId)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    Entry * Find(const PeerId & peerId) { return const_cast<Entry *>(static_cast<const NodeAddressCache *>(this)->Find(peerId)); }
+
+    /// Returns a free or expired slot, or else the one closest to expiry.
+    Entry * FindReplacementSlot(System::Clock::Timestamp now)
+    {
+        Entry * candidate = nullptr;
+        for (auto & entry : mEntries)
+        {
+            if (!entry.inUse || now >= entry.expiresAt)
+            {
+                return &entry;
+            }
+            if (candidate == nullptr || entry.expiresAt < candidate->expiresAt)
+            {
+                candidate = &entry;
+            }
+        }
+        return candidate;
+    }
+
+    std::array<Entry, kSize> mEntries;
+};
+
 /// Action to take when some resolve data
 /// has been received by an active lookup
 class NodeLookupAction
@@ -136,6 +265,13 @@ public:
     /// Mark that a specific IP address has been found
     void LookupResult(const ResolveResult & result);
 
+    /// Complete the lookup with a result known from an earlier resolve,
+    /// without waiting for the minimum lookup time.
+    void UseCachedResult(const ResolveResult & result);
+
+    /// Was the lookup answered from the address cache instead of DNSSD?
+    bool IsServedFromCache() const { return mServedFromCache; }
+
     /// Called after timeouts or after a series of IP addresses have been
     /// marked as found.
     ///
@@ -161,6 +297,7 @@ private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    bool mServedFromCache = false;
 };
 
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
@@ -200,9 +337,17 @@ private:
     /// be used after calling this method.
     void HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current);
 
+    /// Tells DNSSD that the lookup for `handle` is finished, unless the
+    /// lookup never started a DNSSD operation.
+    void ReleaseDnssdResolve(const NodeLookupHandle & handle);
+
+    /// Remembers the best address in nodeData for future lookups.
+    void UpdateAddressCache(const Dnssd::ResolvedNodeData & nodeData, const ResolveResult & baseResult);
+
     System::Layer * mSystemLayer = nullptr;
     Time::TimeSource<Time::Source::kSystem> mTimeSource;
     IntrusiveList<NodeLookupHandle> mActiveLookups;
+    NodeAddressCache<kNodeAddressCacheSize> mAddressCache;
 };
 
 } // namespace Impl
@@ -199,4 +199,128 @@ TEST(TestAddressResolveDefaultImpl, TestLookupResult)
     // Check that the results has been consumed properly.
     EXPECT_FALSE(handle.HasLookupResult());
 }
+
+TEST(TestAddressResolveDefaultImpl, TestCachedLookupResult)
+{
+    ResolveResult cachedResult;
+    cachedResult.address = GetAddressWithMediumScore();
+
+    AddressResolve::NodeLookupHandle handle;
+
+    auto now = System::SystemClock().GetMonotonicTimestamp();
+    handle.ResetForLookup(now, NodeLookupRequest(chip::PeerId(1, 2)));
+    EXPECT_FALSE(handle.IsServedFromCache());
+
+    handle.UseCachedResult(cachedResult);
+    EXPECT_TRUE(handle.IsServedFromCache());
+
+    // A cached result is final right away: no need to wait for the minimum lookup time.
+    EXPECT_EQ(handle.NextAction(now).Type(), Impl::NodeLookupResult::kLookupSuccess);
+
+    // Starting a new lookup forgets about the cache.
+    handle.ResetForLookup(now, NodeLookupRequest(chip::PeerId(1, 2)));
+    EXPECT_FALSE(handle.IsServedFromCache());
+}
+
+TEST(TestAddressResolveDefaultImpl, TestNodeAddressCache)
+{
+    using namespace System::Clock::Literals;
+
+    Impl::NodeAddressCache<2> cache;
+
+    const PeerId peer1(1, 2);
+    const PeerId peer2(1, 3);
+    const PeerId peer3(1, 4);
+
+    ResolveResult result1;
+    result1.address = GetAddressWithHighScore();
+    ResolveResult result2;
+    result2.address = GetAddressWithMediumScore();
+
+    const System::Clock::Timestamp start = System::Clock::Timestamp(1000);
+
+    EXPECT_EQ(cache.Lookup(peer1, start), nullptr);
+
+    cache.Update(peer1, result1, start, System::Clock::Seconds32(100));
+    ASSERT_NE(cache.Lookup(peer1, start), nullptr);
+    EXPECT_EQ(cache.Lookup(peer1, start)->address, result1.address);
+    EXPECT_EQ(cache.Lookup(peer2, start), nullptr);
+
+    // No refresh before the threshold, a single refresh after it.
+    EXPECT_FALSE(cache.StartRefresh(peer1, start + 74_s));
+    EXPECT_TRUE(cache.StartRefresh(peer1, start + 75_s));
+    EXPECT_FALSE(cache.StartRefresh(peer1, start + 76_s));
+
+    // A failed refresh may be retried; the entry itself stays usable until expiry.
+    cache.RefreshFailed(peer1);
+    EXPECT_TRUE(cache.StartRefresh(peer1, start + 76_s));
+    EXPECT_NE(cache.Lookup(peer1, start + 99_s), nullptr);
+    EXPECT_EQ(cache.Lookup(peer1, start + 100_s), nullptr);
+
+    // A successful refresh extends the lifetime.
+    cache.Update(peer1, result2, start + 90_s, System::Clock::Seconds32(100));
+    ASSERT_NE(cache.Lookup(peer1, start + 150_s), nullptr);
+    EXPECT_EQ(cache.Lookup(peer1, start + 150_s)->address, result2.address);
+    EXPECT_FALSE(cache.StartRefresh(peer1, start + 150_s));
+
+    cache.Invalidate(peer1);
+    EXPECT_EQ(cache.Lookup(peer1, start + 100_s), nullptr);
+
+    // When full, the entry closest to expiry is replaced.
+    cache.Update(peer1, result1, start, System::Clock::Seconds32(10));
+    cache.Update(peer2, result2, start, System::Clock::Seconds32(100));
+    cache.Update(peer3, result2, start, System::Clock::Seconds32(100));
+    EXPECT_EQ(cache.Lookup(peer1, start), nullptr);
+    EXPECT_NE(cache.Lookup(peer2, start), nullptr);
+    EXPECT_NE(cache.Lookup(peer3, start), nullptr);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Lookup(peer2, start), nullptr);
+    EXPECT_EQ(cache.Lookup(peer3, start), nullptr);
+}
+
+TEST(TestAddressResolveDefaultImpl, TestNodeAddressCacheReconnectStorm)
+{
+    using namespace System::Clock::Literals;
+
+    // Simulates a controller reconnecting to a fleet of nodes every 30 seconds
+    // for 10 minutes, and counts how many DNSSD resolves are needed.
+    constexpr size_t kNodeCount                   = 200;
+    constexpr uint32_t kRounds                    = 20;
+    const System::Clock::Seconds32 kTtl           = System::Clock::Seconds32(120);
+    const System::Clock::Milliseconds64 kInterval = 30_s;
+
+    static Impl::NodeAddressCache<kNodeCount> cache;
+    cache.Clear();
+
+    ResolveResult result;
+    result.address = GetAddressWithHighScore();
+
+    size_t blockingResolves   = 0;
+    size_t backgroundResolves = 0;
+
+    for (uint32_t round = 0; round < kRounds; round++)
+    {
+        const System::Clock::Timestamp now = System::Clock::Timestamp(1) + kInterval * round;
+        for (uint64_t node = 1; node <= kNodeCount; node++)
+        {
+            const PeerId peer(1, node);
+            if (cache.Lookup(peer, now) == nullptr)
+            {
+                blockingResolves++;
+                cache.Update(peer, result, now, kTtl);
+                continue;
+            }
+            if (cache.StartRefresh(peer, now))
+            {
+                backgroundResolves++;
+                cache.Update(peer, result, now, kTtl);
+            }
+        }
+    }
+
+    // Without the cache, every connection attempt would wait for DNSSD.
+    EXPECT_EQ(blockingResolves, kNodeCount);
+    EXPECT_LT(blockingResolves + backgroundResolves, kNodeCount * kRounds / 2);
+}
 } // namespace
@@ -802,6 +802,48 @@
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_INDEX
+ *
+ * @brief Maintain an index from local session ID to secure session, so that
+ * the session of an incoming message (and a free ID for a new session) is
+ * found in constant time instead of by scanning the whole session table.
+ *
+ * The index is allocated on the heap in pages of 256 session IDs as they
+ * get used. It is meant for controllers that hold thousands of sessions
+ * (see FactoryInitParams::maxSecureSessions).
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_INDEX
+#define CHIP_CONFIG_SECURE_SESSION_INDEX 0
+#endif // CHIP_CONFIG_SECURE_SESSION_INDEX
+
+/**
+ * @def CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS
+ *
+ * @brief Number of worker threads decrypting secure unicast messages received
+ * over UDP, off the thread running the CHIP stack, or 0 to decrypt them on that
+ * thread.
+ *
+ * Decrypted messages are handed back to the CHIP stack thread, in the order they
+ * were received, for message counter verification and dispatch. Requires POSIX
+ * locking, and a crypto backend whose session keys may be used from several
+ * threads at once.
+ */
+#ifndef CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS
+#define CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS 0
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS
+
+/**
+ * @def CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_QUEUE_SIZE
+ *
+ * @brief Maximum number of received messages waiting for, or going through,
+ * decryption by worker threads (see CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS).
+ * Messages received while the queue is full are dropped.
+ */
+#ifndef CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_QUEUE_SIZE
+#define CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_QUEUE_SIZE 64
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_QUEUE_SIZE
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -1099,6 +1141,71 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_DEVICE_MAX_ACTIVE_DEVICES 4
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_SETUP_WINDOW
+ *
+ * @brief Default number of operational session setups (address resolution
+ *        and CASE handshake) a CASESessionManager runs concurrently. Further
+ *        FindOrEstablishSession requests are queued by priority and admitted
+ *        as earlier setups complete.
+ *
+ *        0 disables admission control: every request starts immediately.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_SETUP_WINDOW
+#define CHIP_CONFIG_CASE_SESSION_SETUP_WINDOW 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_SETUP_UDP_RATE
+ *
+ * @brief Default number of session setups per second a CASESessionManager
+ *        may start over UDP (MRP) when admission control is enabled. Up to
+ *        CHIP_CONFIG_CASE_SESSION_SETUP_UDP_BURST setups can start at once.
+ *
+ *        0 disables rate limiting for the transport.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_SETUP_UDP_RATE
+#define CHIP_CONFIG_CASE_SESSION_SETUP_UDP_RATE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_SETUP_UDP_BURST
+ *
+ * @brief See CHIP_CONFIG_CASE_SESSION_SETUP_UDP_RATE.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_SETUP_UDP_BURST
+#define CHIP_CONFIG_CASE_SESSION_SETUP_UDP_BURST 1
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_SETUP_TCP_RATE
+ *
+ * @brief Like CHIP_CONFIG_CASE_SESSION_SETUP_UDP_RATE, for setups of sessions
+ *        that need to carry large payloads (TCP).
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_SETUP_TCP_RATE
+#define CHIP_CONFIG_CASE_SESSION_SETUP_TCP_RATE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_SETUP_TCP_BURST
+ *
+ * @brief See CHIP_CONFIG_CASE_SESSION_SETUP_TCP_RATE.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_SETUP_TCP_BURST
+#define CHIP_CONFIG_CASE_SESSION_SETUP_TCP_BURST 1
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_SETUP_MAX_QUEUED
+ *
+ * @brief Maximum number of peers with a queued session setup request when
+ *        admission control is enabled. Only used by statically allocated pools.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_SETUP_MAX_QUEUED
+#define CHIP_CONFIG_CASE_SESSION_SETUP_MAX_QUEUED 16
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_ENDPOINTS_PER_FABRIC
  *
@@ -1381,6 +1488,30 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_RESUBSCRIBE_WAIT_TIME_MULTIPLIER_MS 10000
 #endif
 
+/**
+ *  @def CHIP_CONFIG_RESUBSCRIPTION_JITTER_BASE_MS
+ *
+ *  @brief
+ *    If a ResubscriptionCoordinator is installed, the base of its decorrelated
+ *    jitter backoff: the first re-subscription attempt after a subscription drops
+ *    is spread uniformly over [0, CHIP_CONFIG_RESUBSCRIPTION_JITTER_BASE_MS).
+ */
+#ifndef CHIP_CONFIG_RESUBSCRIPTION_JITTER_BASE_MS
+#define CHIP_CONFIG_RESUBSCRIPTION_JITTER_BASE_MS 1000
+#endif
+
+/**
+ *  @def CHIP_CONFIG_RESUBSCRIPTION_MAX_CONCURRENT
+ *
+ *  @brief
+ *    If a ResubscriptionCoordinator is installed, the default maximum number of
+ *    re-subscription attempts in progress at the same time. Further attempts
+ *    are queued until one completes. 0 means no limit.
+ */
+#ifndef CHIP_CONFIG_RESUBSCRIPTION_MAX_CONCURRENT
+#define CHIP_CONFIG_RESUBSCRIPTION_MAX_CONCURRENT 8
+#endif
+
 /*
  * @def CHIP_CONFIG_MAX_ATTRIBUTE_STORE_ELEMENT_SIZE
  *
@@ -1424,6 +1555,54 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESOLVE_QUEUE_SIZE
+ *
+ * @brief Maximum number of pending minmdns queries (node resolves, browses and
+ *        AAAA lookups) tracked at the same time. Pending queries that are due
+ *        together are packed into as few packets as possible, so controllers
+ *        resolving many nodes at once benefit from a larger queue.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESOLVE_QUEUE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESOLVE_QUEUE_SIZE 4
+#endif // CHIP_CONFIG_MINMDNS_RESOLVE_QUEUE_SIZE
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_RETRY_JITTER_MS
+ *
+ * @brief Maximum random delay, in milliseconds, added to the retry interval of
+ *        minmdns queries so that queries started at the same time by
+ *        different hosts spread out over time.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RETRY_JITTER_MS
+#define CHIP_CONFIG_MINMDNS_RETRY_JITTER_MS 100
+#endif // CHIP_CONFIG_MINMDNS_RETRY_JITTER_MS
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+ *
+ * @brief Number of PTR records received while browsing that minmdns remembers
+ *        and lists as known answers in later browse queries (RFC 6762 section
+ *        7.1), so that already discovered nodes do not answer again.
+ *        Set to 0 to disable known-answer lists.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+#define CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS 8
+#endif // CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+ *
+ * @brief Number of complete replies the minmdns responder keeps, already
+ *        compressed, so that repeated identical queries are answered by
+ *        copying a packet instead of rebuilding every record.
+ *        The cache is flushed whenever advertised services or interfaces
+ *        change. Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
 /**
  * def CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
  *
@@ -1457,6 +1636,28 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS 45000
 #endif // CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS
 
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+ *
+ * @brief Number of resolved operational node addresses remembered by the
+ *        default address resolver. While a cached address is within its DNSSD
+ *        TTL, lookups for that node complete immediately without a new DNSSD
+ *        operation. Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL_SEC
+ *
+ * @brief Lifetime of an address resolve cache entry when the DNSSD backend
+ *        does not report the TTL of the operational record, in seconds.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL_SEC
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL_SEC 120
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL_SEC
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1624,6 +1825,43 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #endif // CHIP_CONFIG_TEST
 #endif // CHIP_CONFIG_MAX_SCENES_TABLE_SIZE
 
+/**
+ * @def CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE
+ *
+ * @brief Number of per-endpoint fabric scene maps, and of endpoint scene counts, kept in RAM by the scene table so that looking
+ * scenes up does not read them from storage. Each scene map takes about 4 bytes per scene a fabric can hold on an endpoint.
+ * Least recently used entries are evicted, and read again from storage when needed.
+ */
+#ifndef CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE
+#define CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE 16
+#endif // CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE
+
+/**
+ * @def CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+ *
+ * @brief Number of recalled scenes the scenes server can hold to apply them together, so that a scene recalled on many endpoints,
+ * such as by a group RecallScene command, starts the transitions of every endpoint at the same time and has the attributes they
+ * change reported in a single reporting run. Each pending scene takes the size of a scene table entry.
+ *
+ * Batching is opt-in, as it changes the semantics of RecallScene: the command succeeds once the scene is read from the scene
+ * table, before it is applied, so errors applying its extension field sets are only logged, and commands to other clusters in
+ * the same invoke request run before the scene is applied. Set to 0, the default, to apply every recalled scene immediately.
+ */
+#ifndef CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+#define CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE 0
+#endif // CHIP_CONFIG_SCENES_RECALL_BATCH_SIZE
+
+/**
+ * @def CHIP_CONFIG_SCENES_RECALL_BATCH_WINDOW_MS
+ *
+ * @brief Time, in milliseconds, during which the scenes server gathers recalled scenes before applying them. With 0, the scenes
+ * recalled by a single group command are applied together, right after the command is processed, while a longer window also
+ * gathers the scenes recalled by separate unicast commands, at the cost of delaying them.
+ */
+#ifndef CHIP_CONFIG_SCENES_RECALL_BATCH_WINDOW_MS
+#define CHIP_CONFIG_SCENES_RECALL_BATCH_WINDOW_MS 0
+#endif // CHIP_CONFIG_SCENES_RECALL_BATCH_WINDOW_MS
+
 /**
  * @def CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS
  *
@@ -1803,6 +2041,23 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED 0
 #endif
 
+/**
+ * @def CHIP_CONFIG_SYNCHRONOUS_REPORTS_IDLE_COALESCING
+ *
+ * @brief Controls whether the synchronized report scheduler defers, while the ICD is in idle mode, the reports of subscriptions
+ *        that only have dirty attribute data to send.
+ *
+ * Deferred reports are sent with the next report due on a max interval, or as soon as the ICD enters active mode for any other
+ * reason, so that attribute changes do not wake the ICD up on their own. Urgent events are still reported on their min interval.
+ *
+ * This trades report latency for fewer active periods: an attribute change made while the ICD is idle can reach subscribers up
+ * to a whole max interval late, which is up to an hour for a LIT ICD. Only enable it for devices whose subscribers tolerate that
+ * latency, such as sensors reporting slowly changing measurements.
+ */
+#ifndef CHIP_CONFIG_SYNCHRONOUS_REPORTS_IDLE_COALESCING
+#define CHIP_CONFIG_SYNCHRONOUS_REPORTS_IDLE_COALESCING 0
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS
  *
@@ -1857,6 +2112,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #error "CHIP_CONFIG_MAX_PATHS_PER_INVOKE is not allowed to be a number less than 1 or greater than 65535"
 #endif
 
+/**
+ * @def CHIP_CONFIG_COMMAND_RESPONSE_MIN_FREE_SPACE
+ *
+ * @brief The free space, in bytes, an InvokeResponseMessage needs to have left for a response started with
+ *        CommandHandlerImpl::PrepareInvokeResponseCommand to be added to it, rather than to a new message.
+ *
+ * Responses added with AddResponse or AddStatus always go into the current message while they fit. With a
+ * batched invoke, responses started directly would otherwise cost one InvokeResponseMessage (and one packet
+ * buffer) each.
+ */
+#ifndef CHIP_CONFIG_COMMAND_RESPONSE_MIN_FREE_SPACE
+#define CHIP_CONFIG_COMMAND_RESPONSE_MIN_FREE_SPACE 512
+#endif
+
 /**
  * @def CHIP_CONFIG_ICD_OBSERVERS_POOL_SIZE
  *
@@ -1888,6 +2157,63 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_BDX_LOG_TRANSFERS 5
 #endif // CHIP_CONFIG_MAX_BDX_LOG_TRANSFERS
 
+/**
+ *  @def CHIP_CONFIG_BDX_BLOCKS_IN_FLIGHT_VENDOR_ID
+ *
+ *  @brief
+ *    Vendor ID of the vendor-specific TransferInit and Accept metadata element in which a
+ *    bdx::TransferSession advertises the number of Blocks it allows in flight (see
+ *    TransferSession::SetMaxBlocksInFlight()). Both nodes must use the same vendor ID to
+ *    pipeline transfers.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_BLOCKS_IN_FLIGHT_VENDOR_ID
+#define CHIP_CONFIG_BDX_BLOCKS_IN_FLIGHT_VENDOR_ID 0xFFF1
+#endif // CHIP_CONFIG_BDX_BLOCKS_IN_FLIGHT_VENDOR_ID
+
+/**
+ * @def CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_CAPACITY
+ *
+ * @brief Maximum number of attributes whose values WriteBehindAttributePersistenceProvider
+ *        keeps in RAM between two flushes. Values of other attributes are written through.
+ */
+#ifndef CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_CAPACITY
+#define CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_CAPACITY 16
+#endif // CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_CAPACITY
+
+/**
+ * @def CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_FLUSH_DELAY_MS
+ *
+ * @brief Default longest time, in milliseconds, an attribute value written to
+ *        WriteBehindAttributePersistenceProvider stays in RAM before being flushed.
+ */
+#ifndef CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_FLUSH_DELAY_MS
+#define CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_FLUSH_DELAY_MS 5000
+#endif // CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_FLUSH_DELAY_MS
+
+/**
+ * @def CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_MIN_FLUSH_INTERVAL_MS
+ *
+ * @brief Default shortest time, in milliseconds, between two flushes of
+ *        WriteBehindAttributePersistenceProvider, bounding its write rate.
+ */
+#ifndef CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_MIN_FLUSH_INTERVAL_MS
+#define CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_MIN_FLUSH_INTERVAL_MS 10000
+#endif // CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_PERSISTENCE_MIN_FLUSH_INTERVAL_MS
+
+/**
+ * @def CHIP_CONFIG_TRANSITION_ENGINE_TICK_MS
+ *
+ * @brief Period, in milliseconds, of the grid TransitionEngine aligns the steps
+ *        of the level and color transitions on. Steps due around the same point
+ *        of the grid are run from a single timer event, at the cost of moving a
+ *        step by up to half a period. Set to 0 to run every step exactly when it
+ *        is due.
+ */
+#ifndef CHIP_CONFIG_TRANSITION_ENGINE_TICK_MS
+#define CHIP_CONFIG_TRANSITION_ENGINE_TICK_MS 10
+#endif // CHIP_CONFIG_TRANSITION_ENGINE_TICK_MS
+
 /**
  * @}
  */
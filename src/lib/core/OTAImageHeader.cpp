@@ -21,7 +21,9 @@
 #include <lib/core/TLVReader.h>
 #include <lib/core/TLVTags.h>
 #include <lib/core/TLVTypes.h>
+#include <lib/core/TLVWriter.h>
 #include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/Span.h>
@@ -44,6 +46,10 @@ enum class Tag : uint8_t
     kReleaseNotesURL       = 7,
     kImageDigestType       = 8,
     kImageDigest           = 9,
+    // Delta image header extension
+    kDeltaBaseVersion = 10,
+    kDeltaImageSize   = 11,
+    kDeltaImageDigest = 12,
 };
 
 /// Length of the fixed portion of the Matter OTA image header: FileIdentifier (4B), TotalSize (8B) and HeaderSize (4B)
@@ -60,9 +66,65 @@ constexpr size_t kMaxReleaseNotesURLSize = 256;
 
 } // namespace
 
-void OTAImageHeaderParser::Init()
+CHIP_ERROR EncodeOTAImageHeader(const OTAImageHeader & header, MutableByteSpan & buffer)
+{
+    ReturnErrorCodeIf(buffer.size() < kFixedHeaderSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    TLV::TLVWriter tlvWriter;
+    TLV::TLVType outerType;
+    tlvWriter.Init(buffer.data() + kFixedHeaderSize, chip::min(buffer.size() - kFixedHeaderSize, size_t{ kMaxHeaderSize }));
+
+    ReturnErrorOnFailure(tlvWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kVendorId), header.mVendorId));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kProductId), header.mProductId));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kSoftwareVersion), header.mSoftwareVersion));
+    ReturnErrorOnFailure(tlvWriter.PutString(TLV::ContextTag(Tag::kSoftwareVersionString), header.mSoftwareVersionString));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kPayloadSize), header.mPayloadSize));
+
+    if (header.mMinApplicableVersion.HasValue())
+    {
+        ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kMinApplicableVersion), header.mMinApplicableVersion.Value()));
+    }
+
+    if (header.mMaxApplicableVersion.HasValue())
+    {
+        ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kMaxApplicableVersion), header.mMaxApplicableVersion.Value()));
+    }
+
+    if (!header.mReleaseNotesURL.empty())
+    {
+        ReturnErrorOnFailure(tlvWriter.PutString(TLV::ContextTag(Tag::kReleaseNotesURL), header.mReleaseNotesURL));
+    }
+
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kImageDigestType), header.mImageDigestType));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kImageDigest), header.mImageDigest));
+
+    if (header.mDelta.HasValue())
+    {
+        const OTAImageDeltaHeader & delta = header.mDelta.Value();
+        ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kDeltaBaseVersion), delta.mBaseSoftwareVersion));
+        ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kDeltaImageSize), delta.mImageSize));
+        ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(Tag::kDeltaImageDigest), delta.mImageDigest));
+    }
+
+    ReturnErrorOnFailure(tlvWriter.EndContainer(outerType));
+    ReturnErrorOnFailure(tlvWriter.Finalize());
+
+    const uint32_t headerTlvSize  = tlvWriter.GetLengthWritten();
+    const uint32_t fileIdentifier = header.mDelta.HasValue() ? kOTADeltaImageFileIdentifier : kOTAImageFileIdentifier;
+    Encoding::LittleEndian::BufferWriter writer(buffer.data(), kFixedHeaderSize);
+    writer.Put32(fileIdentifier).Put64(kFixedHeaderSize + headerTlvSize + header.mPayloadSize).Put32(headerTlvSize);
+    ReturnErrorCodeIf(!writer.Fit(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    buffer.reduce_size(kFixedHeaderSize + headerTlvSize);
+    return CHIP_NO_ERROR;
+}
+
+void OTAImageHeaderParser::Init(bool acceptDeltaImages)
 {
     mState         = State::kInitialized;
+    mAcceptDelta   = acceptDeltaImages;
+    mIsDelta       = false;
     mBufferOffset  = 0;
     mHeaderTlvSize = 0;
     mBuffer.Alloc(kFixedHeaderSize);
@@ -71,6 +133,8 @@ void OTAImageHeaderParser::Init()
 void OTAImageHeaderParser::Clear()
 {
     mState         = State::kNotInitialized;
+    mAcceptDelta   = false;
+    mIsDelta       = false;
     mBufferOffset  = 0;
     mHeaderTlvSize = 0;
     mBuffer.Free();
@@ -116,7 +180,8 @@ CHIP_ERROR OTAImageHeaderParser::DecodeFixed()
     uint32_t fileIdentifier;
     uint64_t totalSize;
     ReturnErrorOnFailure(reader.Read32(&fileIdentifier).Read64(&totalSize).Read32(&mHeaderTlvSize).StatusCode());
-    ReturnErrorCodeIf(fileIdentifier != kOTAImageFileIdentifier, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+    mIsDelta = mAcceptDelta && (fileIdentifier == kOTADeltaImageFileIdentifier);
+    ReturnErrorCodeIf(fileIdentifier != kOTAImageFileIdentifier && !mIsDelta, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
     // Safety check against malicious headers.
     ReturnErrorCodeIf(mHeaderTlvSize > kMaxHeaderSize, CHIP_ERROR_NO_MEMORY);
     ReturnErrorCodeIf(!mBuffer.Alloc(mHeaderTlvSize), CHIP_ERROR_NO_MEMORY);
@@ -175,6 +240,19 @@ CHIP_ERROR OTAImageHeaderParser::DecodeTlv(OTAImageHeader & header)
     ReturnErrorOnFailure(tlvReader.Next(TLV::ContextTag(Tag::kImageDigest)));
     ReturnErrorOnFailure(tlvReader.Get(header.mImageDigest));
 
+    // The delta image header extension is mandatory in delta images, and not looked for in full images
+    if (mIsDelta)
+    {
+        OTAImageDeltaHeader & delta = header.mDelta.Emplace();
+        ReturnErrorOnFailure(tlvReader.Next(TLV::ContextTag(Tag::kDeltaBaseVersion)));
+        ReturnErrorOnFailure(tlvReader.Get(delta.mBaseSoftwareVersion));
+        ReturnErrorOnFailure(tlvReader.Next(TLV::ContextTag(Tag::kDeltaImageSize)));
+        ReturnErrorOnFailure(tlvReader.Get(delta.mImageSize));
+        ReturnErrorOnFailure(tlvReader.Next(TLV::ContextTag(Tag::kDeltaImageDigest)));
+        ReturnErrorOnFailure(tlvReader.Get(delta.mImageDigest));
+        ReturnErrorCodeIf(delta.mImageDigest.size() != header.mImageDigest.size(), CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
     ReturnErrorOnFailure(tlvReader.ExitContainer(outerType));
 
     return CHIP_NO_ERROR;
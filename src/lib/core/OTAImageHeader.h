@@ -29,6 +29,10 @@ namespace chip {
 /// File signature (aka magic number) of a valid Matter OTA image
 inline constexpr uint32_t kOTAImageFileIdentifier = 0x1BEEF11E;
 
+/// File signature of a delta image, distinct from the one of a full image so that parsers which do not
+/// accept delta images reject them instead of installing the patch as a firmware image
+inline constexpr uint32_t kOTADeltaImageFileIdentifier = 0x1BEEF1DE;
+
 enum class OTAImageDigestType : uint8_t
 {
     kSha256     = 1,
@@ -45,6 +49,21 @@ enum class OTAImageDigestType : uint8_t
     kSha3_512   = 12,
 };
 
+/**
+ * Header extension of a delta image.
+ *
+ * The payload of a delta image is a patch that rebuilds a new image from the image of the software
+ * version it applies to (see src/app/clusters/ota-requestor/DeltaOTAImagePatcher.h). The extension is not
+ * part of the Matter specification. Delta images are identified by kOTADeltaImageFileIdentifier, which
+ * parsers that do not support them reject as an invalid file identifier.
+ */
+struct OTAImageDeltaHeader
+{
+    uint32_t mBaseSoftwareVersion; ///< Software version of the image the patch applies to
+    uint64_t mImageSize;           ///< Size of the image rebuilt by the patch
+    ByteSpan mImageDigest;         ///< Digest of the image rebuilt by the patch, of the header digest type
+};
+
 struct OTAImageHeader
 {
     uint16_t mVendorId;
@@ -57,8 +76,22 @@ struct OTAImageHeader
     CharSpan mReleaseNotesURL;
     OTAImageDigestType mImageDigestType;
     ByteSpan mImageDigest;
+    Optional<OTAImageDeltaHeader> mDelta;
 };
 
+/**
+ * @brief Encode a Matter OTA image header.
+ *
+ * @param header Header to encode, including the delta image header extension if present. The total
+ *               size of the image is computed from the payload size.
+ * @param buffer Buffer to encode the header into. When the method returns CHIP_NO_ERROR, the byte
+ *               span is reduced to the encoded header.
+ *
+ * @retval CHIP_NO_ERROR                Header has been encoded successfully.
+ * @retval CHIP_ERROR_BUFFER_TOO_SMALL  The buffer is too small for the header.
+ */
+CHIP_ERROR EncodeOTAImageHeader(const OTAImageHeader & header, MutableByteSpan & buffer);
+
 class OTAImageHeaderParser
 {
 public:
@@ -66,8 +99,12 @@ public:
      * @brief Prepare the parser for accepting Matter OTA image chunks.
      *
      * The method can be called many times to reset the parser state.
+     *
+     * @param acceptDeltaImages Whether delta images are decoded. They are rejected by default, as an
+     *                          invalid file identifier, so that image processors which cannot apply a
+     *                          patch never install it as a firmware image.
      */
-    void Init();
+    void Init(bool acceptDeltaImages = false);
 
     /**
      * @brief Clear all resources associated with the parser.
@@ -97,7 +134,8 @@ public:
      * @retval CHIP_ERROR_BUFFER_TOO_SMALL          Provided buffers are insufficient to decode the
      *                                              header. A user is expected call the method again
      *                                              when the next image chunk is available.
-     * @retval CHIP_ERROR_INVALID_FILE_IDENTIFIER   Not a Matter OTA image file.
+     * @retval CHIP_ERROR_INVALID_FILE_IDENTIFIER   Not a Matter OTA image file, nor a delta image file
+     *                                              if the parser accepts them.
      * @retval Error code                           Encoded header is invalid.
      */
     CHIP_ERROR AccumulateAndDecode(ByteSpan & buffer, OTAImageHeader & header);
@@ -115,6 +153,8 @@ private:
     CHIP_ERROR DecodeTlv(OTAImageHeader & header);
 
     State mState;
+    bool mAcceptDelta;
+    bool mIsDelta;
     uint32_t mHeaderTlvSize;
     uint32_t mBufferOffset;
     Platform::ScopedMemoryBuffer<uint8_t> mBuffer;
@@ -26,6 +26,7 @@
 #include <lib/core/TLVUtilities.h>
 
 #include <lib/core/CHIPError.h>
+#include <lib/core/TLVBackingStore.h>
 #include <lib/core/TLVReader.h>
 #include <lib/core/TLVTags.h>
 #include <lib/core/TLVTypes.h>
@@ -43,6 +44,37 @@ namespace {
 // on very deep TLV structures. Embedded has limited stack space.
 constexpr size_t kMaxRecursionDepth = 10;
 
+/**
+ *  A writer backing store that discards everything written to it, so that
+ *  the length of an encoding can be measured without storing it.
+ */
+class DiscardingBackingStore : public TLVBackingStore
+{
+public:
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return GetNewBuffer(writer, bufStart, bufLen);
+    }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mScratch;
+        bufLen   = sizeof(mScratch);
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override { return CHIP_NO_ERROR; }
+
+private:
+    uint8_t mScratch[64];
+};
+
 } // namespace
 
 struct FindContext
@@ -430,6 +462,35 @@ CHIP_ERROR Find(const TLVReader & aReader, IterateHandler aPredicate, void * aCo
     return retval;
 }
 
+/**
+ *  Compute the length of the encoding of the element the specified TLV reader
+ *  is positioned on, when copied with the specified tag (as by
+ *  TLVWriter::CopyElement()). This allows allocating a buffer of the right
+ *  size before copying an element, without a trial copy.
+ *
+ *  @param[in]  aReader    A read-only reference to the TLV reader positioned
+ *                         on the element to measure.
+ *  @param[in]  aTag       The tag the element would be copied with.
+ *  @param[out] aLength    A reference to storage for the length of the
+ *                         encoding, set on success.
+ *
+ *  @retval  #CHIP_NO_ERROR    On success.
+ *
+ */
+CHIP_ERROR EncodedLength(const TLVReader & aReader, const Tag & aTag, size_t & aLength)
+{
+    DiscardingBackingStore store;
+    TLVWriter writer;
+    TLVReader reader;
+
+    reader.Init(aReader);
+    ReturnErrorOnFailure(writer.Init(store));
+    ReturnErrorOnFailure(writer.CopyElement(aTag, reader));
+
+    aLength = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
 } // namespace Utilities
 
 } // namespace TLV
@@ -51,6 +51,8 @@ extern CHIP_ERROR Find(const TLVReader & aReader, const Tag & aTag, TLVReader &
 
 extern CHIP_ERROR Find(const TLVReader & aReader, IterateHandler aHandler, void * aContext, TLVReader & aResult);
 extern CHIP_ERROR Find(const TLVReader & aReader, IterateHandler aHandler, void * aContext, TLVReader & aResult, bool aRecurse);
+
+extern CHIP_ERROR EncodedLength(const TLVReader & aReader, const Tag & aTag, size_t & aLength);
 } // namespace Utilities
 
 } // namespace TLV
@@ -18,8 +18,13 @@
 
 #include <pw_unit_test/framework.h>
 
+#include <lib/core/CHIPEncoding.h>
 #include <lib/core/OTAImageHeader.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <string.h>
 
 using namespace chip;
 
@@ -99,6 +104,7 @@ TEST_F(TestOTAImageHeader, TestHappyPath)
     EXPECT_TRUE(header.mReleaseNotesURL.data_equal("https://rn"_span));
     EXPECT_EQ(header.mImageDigestType, OTAImageDigestType::kSha256);
     EXPECT_EQ(header.mImageDigest.size(), 256u / 8);
+    EXPECT_FALSE(header.mDelta.HasValue());
 }
 
 TEST_F(TestOTAImageHeader, TestEmptyBuffer)
@@ -187,4 +193,119 @@ TEST_F(TestOTAImageHeader, TestSmallBlocks)
         EXPECT_EQ(header.mImageDigest.size(), 256u / 8);
     }
 }
+
+TEST_F(TestOTAImageHeader, TestEncode)
+{
+    constexpr size_t kHeaderSize = sizeof(kOtaImage) - strlen("test payload");
+
+    ByteSpan buffer(kOtaImage);
+    OTAImageHeader header;
+    OTAImageHeaderParser parser;
+
+    parser.Init();
+    EXPECT_EQ(parser.AccumulateAndDecode(buffer, header), CHIP_NO_ERROR);
+
+    uint8_t encoded[kHeaderSize];
+    MutableByteSpan encodedSpan(encoded);
+    EXPECT_EQ(EncodeOTAImageHeader(header, encodedSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(encodedSpan.data_equal(ByteSpan(kOtaImage, kHeaderSize)));
+
+    uint8_t tooSmall[kHeaderSize - 1];
+    MutableByteSpan tooSmallSpan(tooSmall);
+    EXPECT_EQ(EncodeOTAImageHeader(header, tooSmallSpan), CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST_F(TestOTAImageHeader, TestDeltaHeader)
+{
+    static const uint8_t kDigest[32]      = { 0x01, 0x02, 0x03 };
+    static const uint8_t kImageDigest[32] = { 0x04, 0x05, 0x06 };
+
+    OTAImageHeader header;
+    header.mVendorId              = 0xFFF1;
+    header.mProductId             = 0x8000;
+    header.mSoftwareVersion       = 2;
+    header.mSoftwareVersionString = "2.0"_span;
+    header.mPayloadSize           = 1000;
+    header.mMinApplicableVersion.SetValue(1);
+    header.mMaxApplicableVersion.SetValue(1);
+    header.mImageDigestType = OTAImageDigestType::kSha256;
+    header.mImageDigest     = ByteSpan(kDigest);
+    header.mDelta.SetValue(OTAImageDeltaHeader{ 1, 100000, ByteSpan(kImageDigest) });
+
+    uint8_t encoded[256];
+    MutableByteSpan encodedSpan(encoded);
+    EXPECT_EQ(EncodeOTAImageHeader(header, encodedSpan), CHIP_NO_ERROR);
+    EXPECT_EQ(Encoding::LittleEndian::Get32(encoded), kOTADeltaImageFileIdentifier);
+
+    ByteSpan buffer = encodedSpan;
+    OTAImageHeader decoded;
+    OTAImageHeaderParser parser;
+
+    parser.Init(/* acceptDeltaImages = */ true);
+    EXPECT_EQ(parser.AccumulateAndDecode(buffer, decoded), CHIP_NO_ERROR);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(decoded.mVendorId, 0xFFF1);
+    EXPECT_EQ(decoded.mProductId, 0x8000);
+    EXPECT_EQ(decoded.mSoftwareVersion, 2u);
+    EXPECT_TRUE(decoded.mSoftwareVersionString.data_equal("2.0"_span));
+    EXPECT_EQ(decoded.mPayloadSize, 1000u);
+    EXPECT_EQ(decoded.mMinApplicableVersion, header.mMinApplicableVersion);
+    EXPECT_EQ(decoded.mMaxApplicableVersion, header.mMaxApplicableVersion);
+    EXPECT_TRUE(decoded.mReleaseNotesURL.empty());
+    EXPECT_EQ(decoded.mImageDigestType, OTAImageDigestType::kSha256);
+    EXPECT_TRUE(decoded.mImageDigest.data_equal(ByteSpan(kDigest)));
+    ASSERT_TRUE(decoded.mDelta.HasValue());
+    EXPECT_EQ(decoded.mDelta.Value().mBaseSoftwareVersion, 1u);
+    EXPECT_EQ(decoded.mDelta.Value().mImageSize, 100000u);
+    EXPECT_TRUE(decoded.mDelta.Value().mImageDigest.data_equal(ByteSpan(kImageDigest)));
+}
+
+TEST_F(TestOTAImageHeader, TestDeltaIdentifierWithoutExtension)
+{
+    uint8_t otaImage[sizeof(kMinOtaImage)];
+    memcpy(otaImage, kMinOtaImage, sizeof(otaImage));
+    Encoding::LittleEndian::Put32(otaImage, kOTADeltaImageFileIdentifier);
+
+    ByteSpan buffer(otaImage);
+    OTAImageHeader header;
+    OTAImageHeaderParser parser;
+
+    parser.Init(/* acceptDeltaImages = */ true);
+    EXPECT_NE(parser.AccumulateAndDecode(buffer, header), CHIP_NO_ERROR);
+    EXPECT_FALSE(parser.IsInitialized());
+}
+
+TEST_F(TestOTAImageHeader, TestDeltaImageRejectedByDefault)
+{
+    static const uint8_t kDigest[32] = { 0x01, 0x02, 0x03 };
+
+    OTAImageHeader header;
+    header.mVendorId              = 0xFFF1;
+    header.mProductId             = 0x8000;
+    header.mSoftwareVersion       = 2;
+    header.mSoftwareVersionString = "2.0"_span;
+    header.mPayloadSize           = 1000;
+    header.mImageDigestType       = OTAImageDigestType::kSha256;
+    header.mImageDigest           = ByteSpan(kDigest);
+    header.mDelta.SetValue(OTAImageDeltaHeader{ 1, 100000, ByteSpan(kDigest) });
+
+    uint8_t encoded[256];
+    MutableByteSpan encodedSpan(encoded);
+    EXPECT_EQ(EncodeOTAImageHeader(header, encodedSpan), CHIP_NO_ERROR);
+
+    // Platform image processors initialize the parser with the defaults, and feed it the image block by block
+    OTAImageHeader decoded;
+    OTAImageHeaderParser parser;
+    CHIP_ERROR error = CHIP_ERROR_BUFFER_TOO_SMALL;
+
+    parser.Init();
+    for (size_t offset = 0; offset < encodedSpan.size() && error == CHIP_ERROR_BUFFER_TOO_SMALL; offset += 8)
+    {
+        ByteSpan block = encodedSpan.SubSpan(offset, std::min<size_t>(8, encodedSpan.size() - offset));
+        error          = parser.AccumulateAndDecode(block, decoded);
+    }
+    EXPECT_EQ(error, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+    EXPECT_FALSE(parser.IsInitialized());
+    EXPECT_FALSE(decoded.mDelta.HasValue());
+}
 } // namespace
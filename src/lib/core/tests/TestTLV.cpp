@@ -1894,6 +1894,40 @@ TEST_F(TestTLV, CheckTLVEmptyFind)
     EXPECT_EQ(err, CHIP_NO_ERROR);
 }
 
+/**
+ *  Test CHIP TLV EncodedLength
+ */
+TEST_F(TestTLV, CheckTLVEncodedLength)
+{
+    uint8_t buf[2048];
+    uint8_t bytes[300] = {};
+    TLVWriter writer;
+    TLVReader reader;
+    size_t length = 0;
+
+    reader.Init(Encoding1);
+    reader.ImplicitProfileId = TestProfile_2;
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+    // Same tag as in the encoding
+    EXPECT_EQ(chip::TLV::Utilities::EncodedLength(reader, reader.GetTag(), length), CHIP_NO_ERROR);
+    EXPECT_EQ(length, sizeof(Encoding1));
+
+    // Anonymous tag, matching what CopyElement writes
+    EXPECT_EQ(chip::TLV::Utilities::EncodedLength(reader, AnonymousTag(), length), CHIP_NO_ERROR);
+    writer.Init(buf);
+    EXPECT_EQ(writer.CopyElement(AnonymousTag(), reader), CHIP_NO_ERROR);
+    EXPECT_EQ(length, writer.GetLengthWritten());
+
+    // An element longer than the internal scratch buffer
+    writer.Init(buf);
+    EXPECT_EQ(writer.Put(AnonymousTag(), ByteSpan(bytes)), CHIP_NO_ERROR);
+    reader.Init(buf, writer.GetLengthWritten());
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(chip::TLV::Utilities::EncodedLength(reader, AnonymousTag(), length), CHIP_NO_ERROR);
+    EXPECT_EQ(length, writer.GetLengthWritten());
+}
+
 // clang-format off
 uint8_t Encoding2[] =
 {
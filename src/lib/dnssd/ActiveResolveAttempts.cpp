@@ -17,6 +17,7 @@
 
 #include "ActiveResolveAttempts.h"
 
+#include <crypto/RandUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 using namespace chip;
@@ -71,6 +72,19 @@ bool ActiveResolveAttempts::HasBrowseFor(chip::Dnssd::DiscoveryType type) const
     return false;
 }
 
+bool ActiveResolveAttempts::HasAnyBrowse() const
+{
+    for (auto & item : mRetryQueue)
+    {
+        if (item.attempt.IsBrowse())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void ActiveResolveAttempts::CompleteIpResolution(SerializedQNameIterator targetHostName)
 {
     for (auto & item : mRetryQueue)
@@ -246,7 +260,7 @@ std::optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::Ne
             continue;
         }
 
-        entry.queryDueTime = now + entry.nextRetryDelay;
+        entry.queryDueTime = now + entry.nextRetryDelay + RetryJitter();
         entry.nextRetryDelay *= 2;
 
         std::optional<ScheduledAttempt> attempt = std::make_optional(entry.attempt);
@@ -258,6 +272,59 @@ std::optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::Ne
     return std::nullopt;
 }
 
+void ActiveResolveAttempts::DuplicateQuestionReceived(const PeerId & peerId)
+{
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.attempt.Matches(peerId))
+        {
+            DuplicateQuestionReceived(entry);
+            return;
+        }
+    }
+}
+
+void ActiveResolveAttempts::DuplicateQuestionReceived(SerializedQNameIterator hostName)
+{
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.attempt.MatchesIpResolve(hostName))
+        {
+            DuplicateQuestionReceived(entry);
+            return;
+        }
+    }
+}
+
+void ActiveResolveAttempts::DuplicateQuestionReceived(RetryEntry & entry)
+{
+    if (entry.attempt.firstSend)
+    {
+        // Our first query asks for unicast answers, which another host's
+        // multicast question does not provide.
+        return;
+    }
+
+    // Postpone by the interval we are currently waiting for, without growing
+    // the back-off: only our own queries count towards the attempt timeout.
+    const System::Clock::Timestamp postponed = mClock->GetMonotonicTimestamp() + entry.nextRetryDelay / 2;
+    if (postponed > entry.queryDueTime)
+    {
+        entry.queryDueTime = postponed;
+    }
+}
+
+System::Clock::Timeout ActiveResolveAttempts::RetryJitter() const
+{
+    if (mMaxRetryJitter == System::Clock::kZero)
+    {
+        return System::Clock::kZero;
+    }
+
+    const uint32_t maxJitterMs = System::Clock::Milliseconds32(mMaxRetryJitter).count();
+    return System::Clock::Milliseconds32(Crypto::GetRandU32() % (maxJitterMs + 1));
+}
+
 bool ActiveResolveAttempts::ShouldResolveIpAddress(PeerId peerId) const
 {
     for (auto & item : mRetryQueue)
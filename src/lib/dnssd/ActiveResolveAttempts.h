@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <optional>
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/PeerId.h>
 #include <lib/dnssd/Resolver.h>
 #include <lib/dnssd/minimal_mdns/core/HeapQName.h>
@@ -37,11 +38,12 @@ namespace Minimal {
 ///    - add/remove to the list
 ///    - figuring out a 'next query time' for items in the list
 ///    - iterating through the 'schedule now' items of the list
+///    - delaying items for which another host already sent the same question
 ///
 class ActiveResolveAttempts
 {
 public:
-    static constexpr size_t kRetryQueueSize                      = 4;
+    static constexpr size_t kRetryQueueSize                      = CHIP_CONFIG_MINMDNS_RESOLVE_QUEUE_SIZE;
     static constexpr chip::System::Clock::Timeout kMaxRetryDelay = chip::System::Clock::Seconds16(16);
 
     struct ScheduledAttempt
@@ -243,7 +245,17 @@ public:
         bool firstSend = false;
     };
 
-    ActiveResolveAttempts(chip::System::Clock::ClockBase * clock) : mClock(clock) { Reset(); }
+    /// @param clock          time source for scheduling
+    /// @param maxRetryJitter maximum random delay added to retry intervals, so
+    ///                       that hosts that started querying at the same time
+    ///                       do not keep retrying in lockstep
+    ActiveResolveAttempts(chip::System::Clock::ClockBase * clock,
+                          chip::System::Clock::Timeout maxRetryJitter = chip::System::Clock::kZero) :
+        mClock(clock),
+        mMaxRetryJitter(maxRetryJitter)
+    {
+        Reset();
+    }
 
     /// Clear out the internal queue
     void Reset();
@@ -296,6 +308,16 @@ public:
     /// Check if a browse operation is active for the given discovery type
     bool HasBrowseFor(chip::Dnssd::DiscoveryType type) const;
 
+    /// Check if any browse operation is active
+    bool HasAnyBrowse() const;
+
+    /// Duplicate question suppression (RFC 6762 section 7.3): another host
+    /// multicast the question that the given pending attempt would ask, so
+    /// the answers will be multicast as well. The next query for that attempt
+    /// is postponed as if it had been sent now.
+    void DuplicateQuestionReceived(const chip::PeerId & peerId);
+    void DuplicateQuestionReceived(SerializedQNameIterator hostName);
+
 private:
     struct RetryEntry
     {
@@ -314,7 +336,11 @@ private:
         chip::System::Clock::Timeout nextRetryDelay = chip::System::Clock::Seconds16(1);
     };
     void MarkPending(ScheduledAttempt && attempt);
+    void DuplicateQuestionReceived(RetryEntry & entry);
+    chip::System::Clock::Timeout RetryJitter() const;
+
     chip::System::Clock::ClockBase * mClock;
+    const chip::System::Clock::Timeout mMaxRetryJitter;
     RetryEntry mRetryQueue[kRetryQueueSize];
 };
 
@@ -376,6 +376,10 @@ CHIP_ERROR AdvertiserMinMdns::Init(chip::Inet::EndPointManager<chip::Inet::UDPEn
     // GlobalMinimalMdnsServer (used for testing).
     mResponseSender.SetServer(&GlobalMinimalMdnsServer::Server());
 
+    // Init is called again when interfaces or their addresses change, which cached
+    // replies (A/AAAA records) depend on.
+    mResponseSender.InvalidateResponseCache();
+
     ReturnErrorOnFailure(GlobalMinimalMdnsServer::Instance().StartServer(udpEndPointManager, kMdnsPort));
 
     ChipLogProgress(Discovery, "CHIP minimal mDNS started advertising.");
@@ -413,6 +417,8 @@ CHIP_ERROR AdvertiserMinMdns::RemoveServices()
 
 void AdvertiserMinMdns::ClearServices()
 {
+    mResponseSender.InvalidateResponseCache();
+
     while (mOperationalResponders.begin() != mOperationalResponders.end())
     {
         auto it = mOperationalResponders.begin();
@@ -478,6 +484,9 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
 {
     VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
 
+    // Replies cached so far may not reflect the updated service
+    mResponseSender.InvalidateResponseCache();
+
     char nameBuffer[Operational::kInstanceNameMaxLength + 1] = "";
 
     // need to set server name
@@ -608,6 +617,9 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters &
 {
     VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
 
+    // Replies cached so far may not reflect the updated service
+    mResponseSender.InvalidateResponseCache();
+
     if (params.GetCommissionAdvertiseMode() == CommssionAdvertiseMode::kCommissionableNode)
     {
         mQueryResponderAllocatorCommissionable.Clear();
@@ -0,0 +1,171 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "KnownAnswerList.h"
+
+#include <lib/dnssd/minimal_mdns/records/Ptr.h>
+
+using namespace chip;
+
+namespace mdns {
+namespace Minimal {
+
+namespace {
+
+System::Clock::Timestamp ExpiryTime(System::Clock::Timestamp receivedAt, uint32_t ttlSeconds)
+{
+    return receivedAt + System::Clock::Seconds32(ttlSeconds);
+}
+
+} // namespace
+
+void KnownAnswerList::Add(SerializedQNameIterator name, SerializedQNameIterator target, uint32_t ttlSeconds)
+{
+    const System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+
+    for (auto & entry : mEntries)
+    {
+        if (entry.ttlSeconds == 0)
+        {
+            continue;
+        }
+
+        if ((name == entry.name.Content()) && (target == entry.target.Content()))
+        {
+            if (ttlSeconds == 0)
+            {
+                entry = Entry();
+                return;
+            }
+
+            // Refresh of a known record
+            entry.receivedAt = now;
+            entry.ttlSeconds = ttlSeconds;
+            return;
+        }
+    }
+
+    if (ttlSeconds == 0)
+    {
+        return;
+    }
+
+    // Pick an unused or expired entry, otherwise the one closest to expiry.
+    Entry * entryToUse = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if ((entry.ttlSeconds == 0) || (ExpiryTime(entry.receivedAt, entry.ttlSeconds) <= now))
+        {
+            entryToUse = &entry;
+            break;
+        }
+
+        if ((entryToUse == nullptr) ||
+            (ExpiryTime(entry.receivedAt, entry.ttlSeconds) < ExpiryTime(entryToUse->receivedAt, entryToUse->ttlSeconds)))
+        {
+            entryToUse = &entry;
+        }
+    }
+
+    if (entryToUse == nullptr)
+    {
+        return; // known answers disabled
+    }
+
+    entryToUse->name   = HeapQName(name);
+    entryToUse->target = HeapQName(target);
+    if (!entryToUse->name.IsOk() || !entryToUse->target.IsOk())
+    {
+        *entryToUse = Entry();
+        return;
+    }
+    entryToUse->receivedAt = now;
+    entryToUse->ttlSeconds = ttlSeconds;
+}
+
+void KnownAnswerList::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+}
+
+size_t KnownAnswerList::Count() const
+{
+    const System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+
+    size_t count = 0;
+    for (auto & entry : mEntries)
+    {
+        if (ListableTtl(entry, now) != 0)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+void KnownAnswerList::AppendTo(QueryBuilder & builder) const
+{
+    const System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+
+    for (auto & entry : mEntries)
+    {
+        const uint32_t ttl = ListableTtl(entry, now);
+        if (ttl == 0)
+        {
+            continue;
+        }
+
+        PtrResourceRecord record(entry.name.Content(), entry.target.Content());
+        record.SetTtl(ttl);
+
+        builder.AddKnownAnswer(record);
+        if (!builder.Ok())
+        {
+            return;
+        }
+    }
+}
+
+uint32_t KnownAnswerList::ListableTtl(const Entry & entry, System::Clock::Timestamp now) const
+{
+    if (entry.ttlSeconds == 0)
+    {
+        return 0;
+    }
+
+    const System::Clock::Timestamp expiry = ExpiryTime(entry.receivedAt, entry.ttlSeconds);
+    if (expiry <= now)
+    {
+        return 0;
+    }
+
+    const uint32_t remaining = static_cast<uint32_t>(std::chrono::duration_cast<System::Clock::Seconds32>(expiry - now).count());
+
+    // RFC 6762 section 7.1: only list answers with at least half their TTL left.
+    if (static_cast<uint64_t>(remaining) * 2 < entry.ttlSeconds)
+    {
+        return 0;
+    }
+
+    return remaining;
+}
+
+} // namespace Minimal
+} // namespace mdns
@@ -0,0 +1,79 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/dnssd/minimal_mdns/QueryBuilder.h>
+#include <lib/dnssd/minimal_mdns/core/HeapQName.h>
+#include <system/SystemClock.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Keeps track of PTR records received while browsing, so that they can be
+/// listed as known answers in subsequent browse queries (RFC 6762 section 7.1).
+///
+/// Responders that find their own answer in the known-answer list of a query
+/// stay silent, which avoids every already discovered node answering again on
+/// each browse retry.
+class KnownAnswerList
+{
+public:
+    static constexpr size_t kMaxAnswers = CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS;
+
+    KnownAnswerList(chip::System::Clock::ClockBase * clock) : mClock(clock) {}
+
+    /// Remember that `name` points to `target` for the given number of
+    /// seconds. A zero TTL (goodbye packet) forgets the answer.
+    void Add(SerializedQNameIterator name, SerializedQNameIterator target, uint32_t ttlSeconds);
+
+    /// Forget all known answers.
+    void Clear();
+
+    /// Number of answers that would currently be listed in a query.
+    size_t Count() const;
+
+    /// Appends to the builder all answers that still have at least half of
+    /// their TTL remaining, as required by RFC 6762.
+    ///
+    /// Answers that do not fit are left out: the packet built so far stays
+    /// valid, the responders concerned will merely answer again.
+    void AppendTo(QueryBuilder & builder) const;
+
+private:
+    struct Entry
+    {
+        HeapQName name;
+        HeapQName target;
+        chip::System::Clock::Timestamp receivedAt;
+        uint32_t ttlSeconds = 0;
+    };
+
+    /// Remaining TTL of the entry if it may be listed now, 0 otherwise.
+    uint32_t ListableTtl(const Entry & entry, chip::System::Clock::Timestamp now) const;
+
+    chip::System::Clock::ClockBase * mClock;
+    std::array<Entry, kMaxAnswers> mEntries;
+};
+
+} // namespace Minimal
+} // namespace mdns
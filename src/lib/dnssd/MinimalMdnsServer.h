@@ -60,6 +60,10 @@ public:
     void SetQueryDelegate(MdnsPacketDelegate * delegate) { mQueryDelegate = delegate; }
     void SetResponseDelegate(MdnsPacketDelegate * delegate) { mResponseDelegate = delegate; }
 
+    /// Receives queries in addition to the query delegate, without answering
+    /// them. Used by the resolver to notice questions that other hosts ask.
+    void SetQueryObserver(MdnsPacketDelegate * delegate) { mQueryObserver = delegate; }
+
     // ServerDelegate implementation
     void OnQuery(const mdns::Minimal::BytesRange & data, const chip::Inet::IPPacketInfo * info) override
     {
@@ -67,6 +71,11 @@ public:
         {
             mQueryDelegate->OnMdnsPacketData(data, info);
         }
+
+        if (mQueryObserver != nullptr)
+        {
+            mQueryObserver->OnMdnsPacketData(data, info);
+        }
     }
 
     void OnResponse(const mdns::Minimal::BytesRange & data, const chip::Inet::IPPacketInfo * info) override
@@ -84,6 +93,7 @@ private:
     mdns::Minimal::ServerBase * mReplacementServer = nullptr;
     MdnsPacketDelegate * mQueryDelegate            = nullptr;
     MdnsPacketDelegate * mResponseDelegate         = nullptr;
+    MdnsPacketDelegate * mQueryObserver            = nullptr;
 };
 
 } // namespace Dnssd
@@ -20,6 +20,7 @@
 #include <lib/core/CHIPConfig.h>
 #include <lib/dnssd/ActiveResolveAttempts.h>
 #include <lib/dnssd/IncrementalResolve.h>
+#include <lib/dnssd/KnownAnswerList.h>
 #include <lib/dnssd/MinimalMdnsServer.h>
 #include <lib/dnssd/ServiceNaming.h>
 #include <lib/dnssd/minimal_mdns/Logging.h>
@@ -31,6 +32,8 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <tracing/macros.h>
 
+#include <algorithm>
+
 // MDNS servers will receive all broadcast packets over the network.
 // Disable 'invalid packet' messages because the are expected and common
 // These logs are useful for debug only
@@ -43,8 +46,43 @@ namespace {
 constexpr size_t kMdnsMaxPacketSize = 1024;
 constexpr uint16_t kMdnsPort        = 5353;
 
+// Multicast queries are looped back to the sending host, once per interface
+// they were sent on. Copies received within this time are our own.
+constexpr System::Clock::Milliseconds32 kOwnQueryLoopbackTime(1000);
+constexpr size_t kMaxRecentOwnQueries = 4;
+
+/// FNV-1a hash of a packet, to recognize our own looped back queries
+uint32_t PacketHash(const uint8_t * data, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
 using namespace mdns::Minimal;
 
+constexpr QNamePart kOperationalSuffix[] = { kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+
+/// Extracts the peer id from an operational instance name, i.e.
+/// <compressed-fabric-id>-<node-id>._matter._tcp.local
+bool ExtractOperationalPeerId(SerializedQNameIterator name, PeerId & peerId)
+{
+    if (!name.Next() || !name.IsValid())
+    {
+        return false;
+    }
+
+    if (name != kOperationalSuffix)
+    {
+        return false;
+    }
+
+    return ExtractIdFromInstanceName(name.Value(), &peerId) == CHIP_NO_ERROR;
+}
+
 /// Handles processing of minmdns packet data.
 ///
 /// Can process multiple incremental resolves based on SRV data and allows
@@ -53,7 +91,9 @@ using namespace mdns::Minimal;
 class PacketParser : private ParserDelegate
 {
 public:
-    PacketParser(ActiveResolveAttempts & activeResolves) : mActiveResolves(activeResolves) {}
+    PacketParser(ActiveResolveAttempts & activeResolves, KnownAnswerList & knownAnswers) :
+        mActiveResolves(activeResolves), mKnownAnswers(knownAnswers)
+    {}
 
     /// Goes through the given SRV records within a response packet
     /// and sets up data resolution
@@ -65,6 +105,10 @@ public:
     /// Must be called AFTER ParseSrvRecords has been called.
     void ParseNonSrvRecords(Inet::InterfaceId interface, const BytesRange & packet);
 
+    /// Goes through the questions of a query sent by another host, to
+    /// suppress our own identical questions (RFC 6762 section 7.3).
+    void ParseQueries(const BytesRange & packet);
+
     IncrementalResolver * ResolverBegin() { return mResolvers; }
     IncrementalResolver * ResolverEnd() { return mResolvers + kMinMdnsNumParallelResolvers; }
 
@@ -85,29 +129,36 @@ private:
     /// Forwards the resource to all active resolvers.
     void ParseResource(const ResourceData & data);
 
+    /// Remembers a PTR answer of an active browse as a known answer.
+    void ParsePtrResource(const ResourceData & data);
+
     enum class RecordParsingState
     {
         kIdle,
         kSrvInitialization,
         kRecordParsing,
+        kQueryObserving,
     };
 
     static constexpr size_t kMinMdnsNumParallelResolvers = CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES;
 
     // Individual parse set
     bool mIsResponse               = false;
+    bool mHasAnswers               = false;
     Inet::InterfaceId mInterfaceId = Inet::InterfaceId::Null();
     BytesRange mPacketRange;
     RecordParsingState mParsingState = RecordParsingState::kIdle;
 
     // resolvers kept between parse steps
     ActiveResolveAttempts & mActiveResolves;
+    KnownAnswerList & mKnownAnswers;
     IncrementalResolver mResolvers[kMinMdnsNumParallelResolvers];
 };
 
 void PacketParser::OnHeader(ConstHeaderRef & header)
 {
     mIsResponse = header.GetFlags().IsResponse();
+    mHasAnswers = (header.GetAnswerCount() != 0);
 
 #ifdef MINMDNS_RESOLVER_OVERLY_VERBOSE
     if (header.GetFlags().IsTruncated())
@@ -120,9 +171,38 @@ void PacketParser::OnHeader(ConstHeaderRef & header)
 
 void PacketParser::OnQuery(const QueryData & data)
 {
-    // Ignore queries:
-    //   - unicast answers will include the corresponding query in the answer
-    //     packet, however that is not interesting for the resolver.
+    // Unicast answers will include the corresponding query in the answer
+    // packet, however that is not interesting for the resolver. Only queries
+    // from other hosts are looked at.
+    if (mIsResponse || (mParsingState != RecordParsingState::kQueryObserving))
+    {
+        return;
+    }
+
+    // Only multicast questions without known answers are guaranteed to
+    // trigger the multicast answers we are waiting for.
+    if (data.RequestedUnicastAnswer() || mHasAnswers)
+    {
+        return;
+    }
+
+    switch (data.GetType())
+    {
+    case QType::AAAA:
+        mActiveResolves.DuplicateQuestionReceived(data.GetName());
+        break;
+    case QType::ANY:
+    case QType::SRV: {
+        PeerId peerId;
+        if (ExtractOperationalPeerId(data.GetName(), peerId))
+        {
+            mActiveResolves.DuplicateQuestionReceived(peerId);
+        }
+        break;
+    }
+    default:
+        break;
+    }
 }
 
 void PacketParser::OnResource(ResourceType type, const ResourceData & data)
@@ -149,8 +229,14 @@ void PacketParser::OnResource(ResourceType type, const ResourceData & data)
             // SRV packets logged during 'SrvInitialization' phase
             mdns::Minimal::Logging::LogReceivedResource(data);
         }
+        if ((data.GetType() == QType::PTR) && (type == ResourceType::kAnswer))
+        {
+            ParsePtrResource(data);
+        }
         ParseResource(data);
         break;
+    case RecordParsingState::kQueryObserving:
+        break;
     case RecordParsingState::kIdle:
         ChipLogError(Discovery, "Illegal state: received DNSSD resource while IDLE");
         break;
@@ -188,6 +274,38 @@ void PacketParser::ParseResource(const ResourceData & data)
     }
 }
 
+void PacketParser::ParsePtrResource(const ResourceData & data)
+{
+    if (!mActiveResolves.HasAnyBrowse())
+    {
+        return;
+    }
+
+    SerializedQNameIterator target;
+    if (!ParsePtrRecord(data.GetData(), mPacketRange, &target))
+    {
+        return;
+    }
+
+    // Only list nodes whose SRV record is being processed: a node that could
+    // not be parsed (e.g. for lack of parallel resolvers) must answer again.
+    for (auto & resolver : mResolvers)
+    {
+        if (resolver.IsActive() && (resolver.GetRecordName() == target))
+        {
+            mKnownAnswers.Add(data.GetName(), target,
+                              static_cast<uint32_t>(std::min<uint64_t>(data.GetTtlSeconds(), UINT32_MAX)));
+            return;
+        }
+    }
+
+    if (data.GetTtlSeconds() == 0)
+    {
+        // Goodbye packet for a node that is not being processed
+        mKnownAnswers.Add(data.GetName(), target, 0);
+    }
+}
+
 void PacketParser::ParseSRVResource(const ResourceData & data)
 {
     SrvRecord srv;
@@ -264,12 +382,32 @@ void PacketParser::ParseNonSrvRecords(Inet::InterfaceId interface, const BytesRa
     mParsingState = RecordParsingState::kIdle;
 }
 
+void PacketParser::ParseQueries(const BytesRange & packet)
+{
+    MATTER_TRACE_SCOPE("Searching duplicate questions", "PacketParser");
+
+    mParsingState = RecordParsingState::kQueryObserving;
+    mPacketRange  = packet;
+
+    if (!ParsePacket(packet, this))
+    {
+#ifdef MINMDNS_RESOLVER_OVERLY_VERBOSE
+        ChipLogError(Discovery, "DNSSD packet parsing failed (for queries)");
+#endif
+    }
+
+    mParsingState = RecordParsingState::kIdle;
+}
+
 class MinMdnsResolver : public Resolver, public MdnsPacketDelegate
 {
 public:
-    MinMdnsResolver() : mActiveResolves(&chip::System::SystemClock()), mPacketParser(mActiveResolves)
+    MinMdnsResolver() :
+        mActiveResolves(&chip::System::SystemClock(), System::Clock::Milliseconds32(CHIP_CONFIG_MINMDNS_RETRY_JITTER_MS)),
+        mKnownAnswers(&chip::System::SystemClock()), mPacketParser(mActiveResolves, mKnownAnswers)
     {
         GlobalMinimalMdnsServer::Instance().SetResponseDelegate(this);
+        GlobalMinimalMdnsServer::Instance().SetQueryObserver(this);
     }
     ~MinMdnsResolver() { SetDiscoveryContext(nullptr); }
 
@@ -292,14 +430,50 @@ private:
     DiscoveryContext * mDiscoveryContext              = nullptr;
     System::Layer * mSystemLayer                      = nullptr;
     ActiveResolveAttempts mActiveResolves;
+    KnownAnswerList mKnownAnswers;
     PacketParser mPacketParser;
 
+    /// A query packet being filled with the questions of several scheduled
+    /// attempts.
+    struct QueryPacket
+    {
+        QueryPacket(bool unicastAnswers) : unicast(unicastAnswers) {}
+
+        QueryBuilder builder;
+        const bool unicast;    // questions ask for unicast answers (first send)
+        bool hasBrowse = false; // known answers are relevant for the packet
+    };
+
+    /// A multicast query recently sent by this resolver
+    struct SentQuery
+    {
+        System::Clock::Timestamp sentTime;
+        size_t length = 0; // 0 for an unused entry
+        uint32_t hash = 0;
+    };
+
+    SentQuery mRecentQueries[kMaxRecentOwnQueries];
+    size_t mNextRecentQuery = 0;
+
     void SetDiscoveryContext(DiscoveryContext * context);
     void ScheduleIpAddressResolve(SerializedQNameIterator hostName);
 
+    /// Remembers a multicast query before it is sent, so that its looped back
+    /// copies are not taken for the questions of another host.
+    void RememberSentQuery(const System::PacketBufferHandle & packet);
+    bool IsOwnQuery(const BytesRange & data) const;
+
     CHIP_ERROR SendAllPendingQueries();
     CHIP_ERROR ScheduleRetries();
 
+    /// Adds the question for the given attempt to the packet, sending the
+    /// packet first if it is full.
+    CHIP_ERROR AddToQueryPacket(QueryPacket & packet, const ActiveResolveAttempts::ScheduledAttempt & attempt);
+
+    /// Appends known answers to the packet and sends it, if it contains any
+    /// question.
+    CHIP_ERROR FlushQueryPacket(QueryPacket & packet);
+
     /// Prepare a query for the given schedule attempt
     CHIP_ERROR BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt);
 
@@ -503,6 +677,17 @@ void MinMdnsResolver::OnMdnsPacketData(const BytesRange & data, const chip::Inet
 {
     MATTER_TRACE_SCOPE("Received MDNS Packet", "MinMdnsResolver");
 
+    if ((data.Size() >= HeaderRef::kSizeBytes) && ConstHeaderRef(data.Start()).GetFlags().IsQuery())
+    {
+        // Our own queries do not duplicate our questions
+        VerifyOrReturn(!IsOwnQuery(data));
+
+        // A query from another host, received through the query observer
+        mPacketParser.ParseQueries(data);
+        ScheduleRetries();
+        return;
+    }
+
     // Fill up any relevant data
     mPacketParser.ParseSrvRecords(data);
     mPacketParser.ParseNonSrvRecords(info->Interface, data);
@@ -533,6 +718,7 @@ bool MinMdnsResolver::IsInitialized()
 
 void MinMdnsResolver::Shutdown()
 {
+    mKnownAnswers.Clear();
     GlobalMinimalMdnsServer::Instance().ShutdownServer();
 }
 
@@ -671,7 +857,19 @@ CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResol
 
 CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
 {
-    while (true)
+    // Questions due at the same time are packed into as few packets as
+    // possible. First sends ask for unicast answers and are sent differently,
+    // so they go into separate packets.
+    QueryPacket unicastPacket(/* unicastAnswers */ true);
+    QueryPacket multicastPacket(/* unicastAnswers */ false);
+
+    // Operational resolves asked in this round, failed if the queries cannot
+    // be sent instead of silently waiting for their timeout.
+    PeerId resolves[ActiveResolveAttempts::kRetryQueueSize];
+    size_t resolveCount = 0;
+    CHIP_ERROR err      = CHIP_NO_ERROR;
+
+    while (err == CHIP_NO_ERROR)
     {
         std::optional<ActiveResolveAttempts::ScheduledAttempt> resolve = mActiveResolves.NextScheduled();
 
@@ -680,27 +878,125 @@ CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
             break;
         }
 
-        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
-        ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+        if (resolve->IsResolve() && resolveCount < ArraySize(resolves))
+        {
+            resolves[resolveCount++] = resolve->ResolveData().peerId;
+        }
 
-        QueryBuilder builder(std::move(buffer));
-        builder.Header().SetMessageId(0);
+        err = AddToQueryPacket(resolve->firstSend ? unicastPacket : multicastPacket, *resolve);
+    }
 
-        ReturnErrorOnFailure(BuildQuery(builder, *resolve));
+    if (err == CHIP_NO_ERROR)
+    {
+        err = FlushQueryPacket(unicastPacket);
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = FlushQueryPacket(multicastPacket);
+    }
 
-        if (resolve->firstSend)
+    if (err != CHIP_NO_ERROR)
+    {
+        for (size_t i = 0; i < resolveCount; i++)
         {
-            ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort));
+            mActiveResolves.Complete(resolves[i]);
+            if (mOperationalDelegate != nullptr)
+            {
+                mOperationalDelegate->OnOperationalNodeResolutionFailed(resolves[i], err);
+            }
         }
-        else
+    }
+
+    ExpireIncrementalResolvers();
+
+    // Attempts not reached because of a failure stay scheduled
+    ReturnErrorOnFailure(ScheduleRetries());
+    return err;
+}
+
+CHIP_ERROR MinMdnsResolver::AddToQueryPacket(QueryPacket & packet, const ActiveResolveAttempts::ScheduledAttempt & attempt)
+{
+    for (int tries = 0; tries < 2; tries++)
+    {
+        if (!packet.builder.HasPacketBuffer())
         {
-            ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort));
+            System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
+            ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+            packet.builder.Reset(std::move(buffer));
+            packet.builder.Header().SetMessageId(0);
         }
+
+        CHIP_ERROR err = BuildQuery(packet.builder, attempt);
+        if (err == CHIP_NO_ERROR)
+        {
+            packet.hasBrowse = packet.hasBrowse || attempt.IsBrowse();
+            return CHIP_NO_ERROR;
+        }
+
+        // A failed question leaves the packet unchanged: if there was no room
+        // left, send what we have and retry in a new packet.
+        if (packet.builder.Ok() || !packet.builder.HasQueries())
+        {
+            return err;
+        }
+        ReturnErrorOnFailure(FlushQueryPacket(packet));
     }
 
-    ExpireIncrementalResolvers();
+    return CHIP_ERROR_INTERNAL;
+}
 
-    return ScheduleRetries();
+CHIP_ERROR MinMdnsResolver::FlushQueryPacket(QueryPacket & packet)
+{
+    ReturnErrorCodeIf(!packet.builder.HasPacketBuffer(), CHIP_NO_ERROR);
+
+    if (!packet.builder.HasQueries())
+    {
+        // Nothing to send: just free the buffer
+        System::PacketBufferHandle unused = packet.builder.ReleasePacket();
+        packet.hasBrowse                  = false;
+        return CHIP_NO_ERROR;
+    }
+
+    if (packet.hasBrowse)
+    {
+        mKnownAnswers.AppendTo(packet.builder);
+        packet.hasBrowse = false;
+    }
+
+    if (packet.unicast)
+    {
+        return GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(packet.builder.ReleasePacket(), kMdnsPort);
+    }
+
+    System::PacketBufferHandle buffer = packet.builder.ReleasePacket();
+    RememberSentQuery(buffer);
+    return GlobalMinimalMdnsServer::Server().BroadcastSend(std::move(buffer), kMdnsPort);
+}
+
+void MinMdnsResolver::RememberSentQuery(const System::PacketBufferHandle & packet)
+{
+    SentQuery & query = mRecentQueries[mNextRecentQuery];
+    mNextRecentQuery  = (mNextRecentQuery + 1) % kMaxRecentOwnQueries;
+
+    query.sentTime = System::SystemClock().GetMonotonicTimestamp();
+    query.length   = packet->DataLength();
+    query.hash     = PacketHash(packet->Start(), packet->DataLength());
+}
+
+bool MinMdnsResolver::IsOwnQuery(const BytesRange & data) const
+{
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    const uint32_t hash                = PacketHash(data.Start(), data.Size());
+
+    for (const auto & query : mRecentQueries)
+    {
+        if ((query.length == data.Size()) && (query.hash == hash) && (now < query.sentTime + kOwnQueryLoopbackTime))
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 void MinMdnsResolver::ExpireIncrementalResolvers()
@@ -732,12 +1028,16 @@ CHIP_ERROR MinMdnsResolver::StartDiscovery(DiscoveryType type, DiscoveryFilter f
     // minmdns currently supports only one discovery context at a time so override the previous context
     SetDiscoveryContext(&context);
 
+    // A new discovery must hear from all nodes again.
+    mKnownAnswers.Clear();
+
     return BrowseNodes(type, filter);
 }
 
 CHIP_ERROR MinMdnsResolver::StopDiscovery(DiscoveryContext & context)
 {
     SetDiscoveryContext(nullptr);
+    mKnownAnswers.Clear();
 
     return mActiveResolves.CompleteAllBrowses();
 }
@@ -751,14 +1051,19 @@ CHIP_ERROR MinMdnsResolver::BrowseNodes(DiscoveryType type, DiscoveryFilter filt
 {
     mActiveResolves.MarkPending(filter, type);
 
-    return SendAllPendingQueries();
+    // Sent from the retry timer, so that all queries requested in the same
+    // event loop iteration share packets.
+    return ScheduleRetries();
 }
 
 CHIP_ERROR MinMdnsResolver::ResolveNodeId(const PeerId & peerId)
 {
     mActiveResolves.MarkPending(peerId);
 
-    return SendAllPendingQueries();
+    // Sent from the retry timer, so that all queries requested in the same
+    // event loop iteration share packets. Send failures are reported through
+    // OnOperationalNodeResolutionFailed.
+    return ScheduleRetries();
 }
 
 void MinMdnsResolver::NodeIdResolutionNoLongerNeeded(const PeerId & peerId)
@@ -785,7 +1090,11 @@ CHIP_ERROR MinMdnsResolver::ScheduleRetries()
 
 void MinMdnsResolver::RetryCallback(System::Layer *, void * self)
 {
-    reinterpret_cast<MinMdnsResolver *>(self)->SendAllPendingQueries();
+    CHIP_ERROR err = reinterpret_cast<MinMdnsResolver *>(self)->SendAllPendingQueries();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to send mDNS queries: %" CHIP_ERROR_FORMAT, err.Format());
+    }
 }
 
 MinMdnsResolver gResolver;
@@ -201,7 +201,13 @@ struct OperationalNodeData
 {
     PeerId peerId;
     bool hasZeroTTL;
-    void Reset() { peerId = PeerId(); }
+    // TTL of the operational service record, if reported by the DNSSD backend.
+    std::optional<uint32_t> ttlSeconds;
+    void Reset()
+    {
+        peerId = PeerId();
+        ttlSeconds.reset();
+    }
 };
 
 struct OperationalNodeBrowseData : public OperationalNodeData
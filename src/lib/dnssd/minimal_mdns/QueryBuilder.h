@@ -21,15 +21,24 @@
 
 #include <lib/dnssd/minimal_mdns/Query.h>
 #include <lib/dnssd/minimal_mdns/core/DnsHeader.h>
+#include <lib/dnssd/minimal_mdns/records/ResourceRecord.h>
 
 namespace mdns {
 namespace Minimal {
 
+/// Writes a MDNS query into a given packet buffer.
+///
+/// Several questions may be packed into the same packet, followed by a list of
+/// known answers (RFC 6762 section 7.1). Names are compressed across all the
+/// questions and answers of the packet.
 class QueryBuilder
 {
 public:
-    QueryBuilder() : mHeader(nullptr) {}
-    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr) { Reset(std::move(packet)); }
+    QueryBuilder() : mHeader(nullptr), mEndianOutput(nullptr, 0), mWriter(&mEndianOutput) {}
+    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr), mEndianOutput(nullptr, 0), mWriter(&mEndianOutput)
+    {
+        Reset(std::move(packet));
+    }
 
     QueryBuilder & Reset(chip::System::PacketBufferHandle && packet)
     {
@@ -40,6 +49,7 @@ public:
         {
             mPacket->SetDataLength(HeaderRef::kSizeBytes);
             mHeader.Clear();
+            mQueryBuildOk = true;
         }
         else
         {
@@ -47,6 +57,13 @@ public:
         }
 
         mHeader.SetFlags(mHeader.GetFlags().SetQuery());
+
+        mEndianOutput =
+            chip::Encoding::BigEndian::BufferWriter(mPacket->Start(), mPacket->DataLength() + mPacket->AvailableDataLength());
+        mEndianOutput.Skip(mPacket->DataLength());
+
+        mWriter.Reset();
+
         return *this;
     }
 
@@ -60,6 +77,9 @@ public:
 
     HeaderRef & Header() { return mHeader; }
 
+    /// Attempts to add a question to the packet.
+    /// On failure, the packet data length and header are unchanged, so the
+    /// packet built so far can still be sent.
     QueryBuilder & AddQuery(const Query & query)
     {
         if (!mQueryBuildOk)
@@ -67,25 +87,47 @@ public:
             return *this;
         }
 
-        chip::Encoding::BigEndian::BufferWriter out(mPacket->Start() + mPacket->DataLength(), mPacket->AvailableDataLength());
-        RecordWriter writer(&out);
+        if (!query.Append(mHeader, mWriter))
+        {
+            mQueryBuildOk = false;
+        }
+        else
+        {
+            mPacket->SetDataLength(static_cast<uint16_t>(mEndianOutput.Needed()));
+        }
+        return *this;
+    }
+
+    /// Attempts to add a known answer to the packet. Known answers must be
+    /// added after all the questions.
+    /// On failure, the packet data length and header are unchanged.
+    QueryBuilder & AddKnownAnswer(const ResourceRecord & record)
+    {
+        if (!mQueryBuildOk)
+        {
+            return *this;
+        }
 
-        if (!query.Append(mHeader, writer))
+        if (!record.Append(mHeader, ResourceType::kAnswer, mWriter))
         {
             mQueryBuildOk = false;
         }
         else
         {
-            mPacket->SetDataLength(static_cast<uint16_t>(mPacket->DataLength() + out.Needed()));
+            mPacket->SetDataLength(static_cast<uint16_t>(mEndianOutput.Needed()));
         }
         return *this;
     }
 
+    bool HasQueries() const { return mHeader.GetQueryCount() != 0; }
     bool Ok() const { return mQueryBuildOk; }
+    bool HasPacketBuffer() const { return !mPacket.IsNull(); }
 
 private:
     chip::System::PacketBufferHandle mPacket;
     HeaderRef mHeader;
+    chip::Encoding::BigEndian::BufferWriter mEndianOutput;
+    RecordWriter mWriter;
     bool mQueryBuildOk = true;
 };
 
@@ -123,6 +123,9 @@ public:
     bool Ok() const { return mBuildOk; }
     bool HasPacketBuffer() const { return !mPacket.IsNull(); }
 
+    /// The packet built so far, only valid if HasPacketBuffer().
+    const chip::System::PacketBufferHandle & Packet() const { return mPacket; }
+
 private:
     chip::System::PacketBufferHandle mPacket;
     HeaderRef mHeader;
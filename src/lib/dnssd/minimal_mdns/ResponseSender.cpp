@@ -21,6 +21,8 @@
 
 #include <system/SystemClock.h>
 
+#include <cstring>
+
 namespace mdns {
 namespace Minimal {
 
@@ -37,6 +39,16 @@ constexpr uint16_t kMdnsStandardPort = 5353;
 //    the header.
 constexpr uint16_t kPacketSizeBytes = 512;
 
+/// According to https://tools.ietf.org/html/rfc6762#section-6  we should multicast at most 1/sec
+///
+/// TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
+///       broadcasts on one interface to throttle broadcasts on another interface.
+bool WasMulticastRecently(const QueryResponderRecord & record, chip::System::Clock::Timestamp now)
+{
+    const chip::System::Clock::Timestamp cutoff = now - chip::System::Clock::Seconds32(1);
+    return (cutoff > chip::System::Clock::kZero) && (record.lastMulticastTime >= cutoff);
+}
+
 } // namespace
 namespace Internal {
 
@@ -50,6 +62,27 @@ bool ResponseSendingState::IncludeQuery() const
     return (mSource->SrcPort != kMdnsStandardPort);
 }
 
+bool CachedResponse::Matches(const QueryData & query, const chip::Inet::IPPacketInfo & source) const
+{
+    return valid &&                                                //
+        (type == query.GetType()) &&                               //
+        (klass == query.GetClass()) &&                             //
+        (unicastAnswer == query.RequestedUnicastAnswer()) &&       //
+        (fromMdnsPort == (source.SrcPort == kMdnsStandardPort)) && //
+        (interface == source.Interface) &&                         //
+        (addressType == source.SrcAddress.Type()) &&               //
+        (query.GetName() == name.Content());
+}
+
+void CachedResponse::Clear()
+{
+    name = HeapQName();
+    packet.Free();
+    packetSize  = 0;
+    answerCount = 0;
+    valid       = false;
+}
+
 } // namespace Internal
 
 CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder)
@@ -62,11 +95,13 @@ CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder
         if (responder == nullptr || responder == queryResponder)
         {
             responder = queryResponder;
+            InvalidateResponseCache();
             return CHIP_NO_ERROR;
         }
     }
 
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
+    InvalidateResponseCache();
     mResponders.push_back(queryResponder);
     return CHIP_NO_ERROR;
 #else
@@ -80,6 +115,7 @@ CHIP_ERROR ResponseSender::RemoveQueryResponder(QueryResponderBase * queryRespon
     {
         if (*it == queryResponder)
         {
+            InvalidateResponseCache();
             *it = nullptr;
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
             mResponders.erase(it);
@@ -107,6 +143,19 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
 {
     mSendState.Reset(messageId, query, querySource);
 
+    const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+
+    // Announcements and TTL overrides are rare (startup, shutdown), only regular replies are cached.
+    if ((kResponseCacheSize > 0) && !query.IsAnnounceBroadcast() && !configuration.GetTtlSecondsOverride().has_value())
+    {
+        Internal::CachedResponse * cached = FindCachedResponse(query, *querySource);
+        if ((cached != nullptr) && CanSendCachedResponse(*cached, kTimeNow))
+        {
+            return SendCachedResponse(*cached, kTimeNow);
+        }
+        mSendState.SetCacheable(true);
+    }
+
     if (query.IsAnnounceBroadcast())
     {
         // Deny listing large amount of data
@@ -128,21 +177,11 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
 
     // send all 'Answer' replies
     {
-        const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
-
         QueryReplyFilter queryReplyFilter(query);
         QueryResponderRecordFilter responseFilter;
 
         responseFilter.SetReplyFilter(&queryReplyFilter);
 
-        if (!mSendState.SendUnicast())
-        {
-            // According to https://tools.ietf.org/html/rfc6762#section-6  we should multicast at most 1/sec
-            //
-            // TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
-            //       broadcasts on one interface to throttle broadcasts on another interface.
-            responseFilter.SetIncludeOnlyMulticastBeforeMS(kTimeNow - chip::System::Clock::Seconds32(1));
-        }
         for (auto & responder : mResponders)
         {
             if (responder == nullptr)
@@ -151,10 +190,18 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
             }
             for (auto it = responder->begin(&responseFilter); it != responder->end(); it++)
             {
+                if (!mSendState.SendUnicast() && WasMulticastRecently(*it, kTimeNow))
+                {
+                    // A reply lacking throttled answers is not the reply to the query in general
+                    mSendState.SetCacheable(false);
+                    continue;
+                }
+
                 it->responder->AddAllResponses(querySource, this, configuration);
                 ReturnErrorOnFailure(mSendState.GetError());
 
                 responder->MarkAdditionalRepliesFor(it);
+                mSendState.AddAnswer(&*it);
 
                 if (!mSendState.SendUnicast())
                 {
@@ -195,6 +242,11 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
         }
     }
 
+    if (mSendState.IsCacheable())
+    {
+        StoreCachedResponse(query, *querySource);
+    }
+
     return FlushReply();
 }
 
@@ -204,29 +256,146 @@ CHIP_ERROR ResponseSender::FlushReply()
 
     if (mResponseBuilder.HasResponseRecords())
     {
-        char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
-        VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+        return SendReply(mResponseBuilder.ReleasePacket());
+    }
 
-        if (mSendState.SendUnicast())
-        {
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ResponseSender::SendReply(chip::System::PacketBufferHandle && packet)
+{
+    char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
+    VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+
+    if (mSendState.SendUnicast())
+    {
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString,
-                          mSendState.GetSourcePort());
+        ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString, mSendState.GetSourcePort());
 #endif
-            ReturnErrorOnFailure(mServer->DirectSend(mResponseBuilder.ReleasePacket(), mSendState.GetSourceAddress(),
-                                                     mSendState.GetSourcePort(), mSendState.GetSourceInterfaceId()));
-        }
-        else
-        {
+        return mServer->DirectSend(std::move(packet), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                                   mSendState.GetSourceInterfaceId());
+    }
+
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
+    ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
 #endif
-            ReturnErrorOnFailure(mServer->BroadcastSend(mResponseBuilder.ReleasePacket(), kMdnsStandardPort,
-                                                        mSendState.GetSourceInterfaceId(), mSendState.GetSourceAddress().Type()));
+    return mServer->BroadcastSend(std::move(packet), kMdnsStandardPort, mSendState.GetSourceInterfaceId(),
+                                  mSendState.GetSourceAddress().Type());
+}
+
+void ResponseSender::InvalidateResponseCache()
+{
+    for (auto & entry : mResponseCache)
+    {
+        entry.Clear();
+    }
+}
+
+Internal::CachedResponse * ResponseSender::FindCachedResponse(const QueryData & query, const chip::Inet::IPPacketInfo & source)
+{
+    for (auto & entry : mResponseCache)
+    {
+        if (entry.Matches(query, source))
+        {
+            return &entry;
         }
     }
+    return nullptr;
+}
 
-    return CHIP_NO_ERROR;
+bool ResponseSender::CanSendCachedResponse(const Internal::CachedResponse & entry, chip::System::Clock::Timestamp now) const
+{
+    if (mSendState.SendUnicast())
+    {
+        return true;
+    }
+
+    // If any answer was multicast recently, the reply must be built again without it
+    for (size_t i = 0; i < entry.answerCount; i++)
+    {
+        if (WasMulticastRecently(*entry.answers[i], now))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+CHIP_ERROR ResponseSender::SendCachedResponse(Internal::CachedResponse & entry, chip::System::Clock::Timestamp now)
+{
+    entry.lastUsed = ++mResponseCacheUseCounter;
+
+    if (!mSendState.SendUnicast())
+    {
+        for (size_t i = 0; i < entry.answerCount; i++)
+        {
+            entry.answers[i]->lastMulticastTime = now;
+        }
+    }
+
+    ReturnErrorCodeIf(entry.packetSize == 0, CHIP_NO_ERROR); // nothing to reply
+
+    chip::System::PacketBufferHandle packet = chip::System::PacketBufferHandle::NewWithData(entry.packet.Get(), entry.packetSize);
+    ReturnErrorCodeIf(packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    HeaderRef(packet->Start()).SetMessageId(mSendState.GetMessageId());
+
+    return SendReply(std::move(packet));
+}
+
+void ResponseSender::StoreCachedResponse(const QueryData & query, const chip::Inet::IPPacketInfo & source)
+{
+    // Replace the reply to the same query if any, otherwise a free or the least recently used entry
+    Internal::CachedResponse * entry = FindCachedResponse(query, source);
+    if (entry == nullptr)
+    {
+        for (auto & candidate : mResponseCache)
+        {
+            if (!candidate.valid)
+            {
+                entry = &candidate;
+                break;
+            }
+            if ((entry == nullptr) || (candidate.lastUsed < entry->lastUsed))
+            {
+                entry = &candidate;
+            }
+        }
+    }
+    VerifyOrReturn(entry != nullptr);
+
+    entry->Clear();
+
+    if (mResponseBuilder.HasPacketBuffer() && mResponseBuilder.HasResponseRecords())
+    {
+        const chip::System::PacketBufferHandle & packet = mResponseBuilder.Packet();
+        VerifyOrReturn(entry->packet.Alloc(packet->DataLength()));
+        memcpy(entry->packet.Get(), packet->Start(), packet->DataLength());
+        entry->packetSize = packet->DataLength();
+    }
+
+    entry->name = HeapQName(query.GetName());
+    if (!entry->name.IsOk())
+    {
+        entry->Clear();
+        return;
+    }
+
+    entry->type          = query.GetType();
+    entry->klass         = query.GetClass();
+    entry->unicastAnswer = query.RequestedUnicastAnswer();
+    entry->fromMdnsPort  = (source.SrcPort == kMdnsStandardPort);
+    entry->interface     = source.Interface;
+    entry->addressType   = source.SrcAddress.Type();
+
+    entry->answerCount = mSendState.GetAnswerCount();
+    for (size_t i = 0; i < entry->answerCount; i++)
+    {
+        entry->answers[i] = mSendState.GetAnswers()[i];
+    }
+
+    entry->lastUsed = ++mResponseCacheUseCounter;
+    entry->valid    = true;
 }
 
 CHIP_ERROR ResponseSender::PrepareNewReplyPacket()
@@ -309,6 +478,9 @@ void ResponseSender::AddResponse(const ResourceRecord & record)
     {
         mResponseBuilder.Header().SetFlags(mResponseBuilder.Header().GetFlags().SetTruncated(true));
 
+        // Split replies are not cached
+        mSendState.SetCacheable(false);
+
         ReturnOnFailure(mSendState.SetError(FlushReply()));
         ReturnOnFailure(mSendState.SetError(PrepareNewReplyPacket()));
 
@@ -21,18 +21,21 @@
 #include "ResponseBuilder.h"
 #include "Server.h"
 
+#include <lib/core/CHIPConfig.h>
+#include <lib/dnssd/minimal_mdns/core/HeapQName.h>
 #include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
+#include <lib/support/ScopedBuffer.h>
 
 #include <system/SystemPacketBuffer.h>
 
+#include <array>
+
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
 
 #include <list>
 using QueryResponderPtrPool = std::list<mdns::Minimal::QueryResponderBase *>;
 #else
 
-#include <array>
-
 // Note: ptr storage is 2 + number of operational networks required, based on
 // the current implementation of Advertiser_ImplMinimalMdns.cpp:
 //    - 1 for commissionable advertising
@@ -65,6 +68,37 @@ enum class ResponseItemsSent : uint8_t
     kServiceListingData = 0x04,
 };
 
+// Replies with more answers than this are not cached
+inline constexpr size_t kMaxCachedAnswers = 16;
+
+/// A reply previously built for a query, kept in its final (compressed) form
+/// so that an identical query can be answered by copying it.
+struct CachedResponse
+{
+    // Query and query source the reply was built for
+    HeapQName name;
+    QType type                            = QType::ANY;
+    QClass klass                          = QClass::ANY;
+    bool unicastAnswer                    = false;
+    bool fromMdnsPort                     = false;
+    chip::Inet::InterfaceId interface     = chip::Inet::InterfaceId::Null();
+    chip::Inet::IPAddressType addressType = chip::Inet::IPAddressType::kAny;
+
+    // The reply packet, empty if the query did not require any reply
+    chip::Platform::ScopedMemoryBuffer<uint8_t> packet;
+    size_t packetSize = 0;
+
+    // Answers included in the reply, needed to apply multicast throttling
+    QueryResponderRecord * answers[kMaxCachedAnswers];
+    size_t answerCount = 0;
+
+    uint32_t lastUsed = 0;
+    bool valid        = false;
+
+    bool Matches(const QueryData & query, const chip::Inet::IPPacketInfo & source) const;
+    void Clear();
+};
+
 /// Represents the internal state for sending a currently active request
 class ResponseSendingState
 {
@@ -79,6 +113,8 @@ public:
         mSendError    = CHIP_NO_ERROR;
         mResourceType = ResourceType::kAnswer;
         mSentItems.ClearAll();
+        mCacheable   = false;
+        mAnswerCount = 0;
     }
 
     void SetResourceType(ResourceType resourceType) { mResourceType = resourceType; }
@@ -110,6 +146,24 @@ public:
     bool GetWasSent(ResponseItemsSent item) const { return mSentItems.Has(item); }
     void MarkWasSent(ResponseItemsSent item) { mSentItems.Set(item); }
 
+    /// A reply may only be cached if it fits in a single packet and none of
+    /// its answers was held back by multicast throttling.
+    void SetCacheable(bool cacheable) { mCacheable = cacheable; }
+    bool IsCacheable() const { return mCacheable; }
+
+    /// Keep track of the answers sent, for caching the reply.
+    void AddAnswer(QueryResponderRecord * record)
+    {
+        if (mAnswerCount >= kMaxCachedAnswers)
+        {
+            mCacheable = false;
+            return;
+        }
+        mAnswers[mAnswerCount++] = record;
+    }
+    QueryResponderRecord * const * GetAnswers() const { return mAnswers; }
+    size_t GetAnswerCount() const { return mAnswerCount; }
+
 private:
     const QueryData * mQuery                 = nullptr;               // query being replied to
     const chip::Inet::IPPacketInfo * mSource = nullptr;               // Where to send the reply (if unicast)
@@ -117,6 +171,9 @@ private:
     ResourceType mResourceType               = ResourceType::kAnswer; // what is being sent right now
     CHIP_ERROR mSendError                    = CHIP_NO_ERROR;
     chip::BitFlags<ResponseItemsSent> mSentItems;
+    bool mCacheable                                    = false;
+    QueryResponderRecord * mAnswers[kMaxCachedAnswers] = {};
+    size_t mAnswerCount                                = 0;
 };
 
 } // namespace Internal
@@ -125,9 +182,15 @@ private:
 ///
 /// Handles processing the query via a QueryResponderBase and then sending back the reply
 /// using appropriate paths (unicast or multicast) via the given Server.
+///
+/// Replies to regular queries are cached (see CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE)
+/// so that the same query received again, typically browse and resolve retries of
+/// other nodes, is answered by copying the reply instead of rebuilding it.
 class ResponseSender : public ResponderDelegate
 {
 public:
+    static constexpr size_t kResponseCacheSize = CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE;
+
     ResponseSender(ServerBase * server) : mServer(server) {}
 
     CHIP_ERROR AddQueryResponder(QueryResponderBase * queryResponder);
@@ -145,9 +208,21 @@ public:
 
     void SetServer(ServerBase * server) { mServer = server; }
 
+    /// Forget all cached replies.
+    ///
+    /// Must be called whenever the content of the query responders changes
+    /// (services added, updated or removed, interface addresses changed).
+    void InvalidateResponseCache();
+
 private:
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
+    CHIP_ERROR SendReply(chip::System::PacketBufferHandle && packet);
+
+    Internal::CachedResponse * FindCachedResponse(const QueryData & query, const chip::Inet::IPPacketInfo & source);
+    bool CanSendCachedResponse(const Internal::CachedResponse & entry, chip::System::Clock::Timestamp now) const;
+    CHIP_ERROR SendCachedResponse(Internal::CachedResponse & entry, chip::System::Clock::Timestamp now);
+    void StoreCachedResponse(const QueryData & query, const chip::Inet::IPPacketInfo & source);
 
     ServerBase * mServer;
     QueryResponderPtrPool mResponders = {};
@@ -155,6 +230,9 @@ private:
     /// Current send state
     ResponseBuilder mResponseBuilder;          // packet being built
     Internal::ResponseSendingState mSendState; // sending state
+
+    std::array<Internal::CachedResponse, kResponseCacheSize> mResponseCache;
+    uint32_t mResponseCacheUseCounter = 0;
 };
 
 } // namespace Minimal
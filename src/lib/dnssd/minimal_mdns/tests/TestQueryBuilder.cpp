@@ -0,0 +1,151 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/dnssd/minimal_mdns/QueryBuilder.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/core/tests/QNameStrings.h>
+#include <lib/dnssd/minimal_mdns/records/Ptr.h>
+#include <lib/support/CHIPMem.h>
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace mdns::Minimal;
+
+constexpr size_t kPacketSize = 1024;
+constexpr size_t kNodeCount  = 200;
+
+const auto kServiceName = testing::TestQName<3>({ "_matter", "_tcp", "local" });
+
+/// Counts the questions and answers of a parsed packet
+class PacketCounter : public ParserDelegate
+{
+public:
+    void OnHeader(ConstHeaderRef & header) override {}
+    void OnQuery(const QueryData & data) override
+    {
+        EXPECT_EQ(mAnswerCount, 0u); // questions must come first
+        mQueryCount++;
+    }
+    void OnResource(ResourceType type, const ResourceData & data) override
+    {
+        EXPECT_EQ(type, ResourceType::kAnswer);
+        mAnswerCount++;
+    }
+
+    size_t mQueryCount  = 0;
+    size_t mAnswerCount = 0;
+};
+
+class TestQueryBuilder : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+std::vector<std::unique_ptr<testing::TestQName<4>>> OperationalNames(size_t count)
+{
+    std::vector<std::unique_ptr<testing::TestQName<4>>> names;
+    for (size_t i = 0; i < count; i++)
+    {
+        char instance[64];
+        snprintf(instance, sizeof(instance), "1122334455667788-%016X", static_cast<unsigned>(i + 1));
+        names.push_back(std::make_unique<testing::TestQName<4>>(std::array<const char *, 4>{ instance, "_matter", "_tcp", "local" }));
+    }
+    return names;
+}
+
+TEST_F(TestQueryBuilder, TestAggregatesQuestions)
+{
+    // Resolving many nodes at once (e.g. a controller starting up) packs all
+    // questions into as few packets as possible instead of one per node.
+    const auto names = OperationalNames(kNodeCount);
+
+    std::vector<System::PacketBufferHandle> packets;
+    QueryBuilder builder(System::PacketBufferHandle::New(kPacketSize));
+
+    for (auto & name : names)
+    {
+        const Query query = Query(name->Full()).SetType(QType::ANY).SetAnswerViaUnicast(false);
+
+        builder.AddQuery(query);
+        if (!builder.Ok())
+        {
+            ASSERT_TRUE(builder.HasQueries());
+            packets.push_back(builder.ReleasePacket());
+
+            builder.Reset(System::PacketBufferHandle::New(kPacketSize));
+            builder.AddQuery(query);
+            ASSERT_TRUE(builder.Ok());
+        }
+    }
+    packets.push_back(builder.ReleasePacket());
+
+    // Names share a compressed suffix, so far fewer packets than nodes are needed
+    EXPECT_LT(packets.size() * 10, kNodeCount);
+
+    size_t totalQueries = 0;
+    for (auto & packet : packets)
+    {
+        PacketCounter counter;
+        EXPECT_TRUE(ParsePacket(BytesRange(packet->Start(), packet->Start() + packet->DataLength()), &counter));
+        EXPECT_GT(counter.mQueryCount, 1u);
+        totalQueries += counter.mQueryCount;
+    }
+    EXPECT_EQ(totalQueries, kNodeCount);
+}
+
+TEST_F(TestQueryBuilder, TestKnownAnswersFollowQuestions)
+{
+    const auto names = OperationalNames(kNodeCount);
+
+    QueryBuilder builder(System::PacketBufferHandle::New(kPacketSize));
+    builder.AddQuery(Query(kServiceName.Full()).SetType(QType::PTR).SetAnswerViaUnicast(false));
+    EXPECT_TRUE(builder.Ok());
+
+    // Add answers until the packet is full
+    size_t answerCount = 0;
+    for (auto & name : names)
+    {
+        builder.AddKnownAnswer(PtrResourceRecord(kServiceName.Full(), name->Full()));
+        if (!builder.Ok())
+        {
+            break;
+        }
+        answerCount++;
+    }
+    EXPECT_FALSE(builder.Ok());
+    EXPECT_GT(answerCount, 1u);
+
+    // A packet that cannot hold all the answers keeps the ones that fit
+    System::PacketBufferHandle packet = builder.ReleasePacket();
+    PacketCounter counter;
+    EXPECT_TRUE(ParsePacket(BytesRange(packet->Start(), packet->Start() + packet->DataLength()), &counter));
+    EXPECT_EQ(counter.mQueryCount, 1u);
+    EXPECT_EQ(counter.mAnswerCount, answerCount);
+}
+
+} // namespace
@@ -17,6 +17,7 @@
 
 #include <lib/dnssd/minimal_mdns/ResponseSender.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -350,4 +351,149 @@ TEST_F(TestResponseSender, PtrSrvTxtMultipleRespondersToServiceListing)
     EXPECT_TRUE(common1->server.GetHeaderFound());
 }
 
+TEST_F(TestResponseSender, CachedReplyToRepeatedQuery)
+{
+    if (ResponseSender::kResponseCacheSize == 0)
+    {
+        GTEST_SKIP();
+    }
+
+    CommonTestElements common("test");
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    // Build a query for the instance name
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration());
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+
+    // Responder content changes without invalidating the cache: the cached reply is sent
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration());
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+
+    // Once invalidated, the reply is built again
+    responseSender.InvalidateResponseCache();
+
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    responseSender.Respond(3, queryData, &common.packetInfo, ResponseConfiguration());
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+
+    // Announcements (TTL overrides) are never served from the cache
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    responseSender.Respond(4, queryData, &common.packetInfo, ResponseConfiguration().SetTtlSecondsOverride(0));
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+}
+
+TEST_F(TestResponseSender, CachedEmptyReply)
+{
+    if (ResponseSender::kResponseCacheSize == 0)
+    {
+        GTEST_SKIP();
+    }
+
+    CommonTestElements common("test");
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    // Queries for names that are not ours are the most common ones
+    common.recordWriter.WriteQName(common.host);
+    QueryData queryData = QueryData(QType::SRV, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration());
+    EXPECT_FALSE(common.server.GetSendCalled());
+    responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration());
+    EXPECT_FALSE(common.server.GetSendCalled());
+
+    // Adding query responders invalidates the cache
+    CommonTestElements other("test");
+    EXPECT_EQ(responseSender.AddQueryResponder(&other.queryResponder), CHIP_NO_ERROR);
+
+    SrvResourceRecord hostSrvRecord = SrvResourceRecord(common.host, common.host, CommonTestElements::kPort);
+    SrvResponder hostSrvResponder   = SrvResponder(hostSrvRecord);
+    other.queryResponder.AddResponder(&hostSrvResponder);
+
+    common.server.AddExpectedRecord(&hostSrvRecord);
+    responseSender.Respond(3, queryData, &common.packetInfo, ResponseConfiguration());
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+}
+
+/// Only counts replies, so that the benchmark below measures building replies only
+class CountingServer : public CheckOnlyServer
+{
+public:
+    CHIP_ERROR DirectSend(System::PacketBufferHandle && data, const Inet::IPAddress & addr, uint16_t port,
+                          Inet::InterfaceId interface) override
+    {
+        mSendCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    size_t mSendCount = 0;
+};
+
+TEST_F(TestResponseSender, ResponsesPerSecond)
+{
+    // Reply to a browse (PTR + additional SRV/TXT) of a device advertising many services,
+    // with and without the reply cache.
+    constexpr size_t kServiceCount = 8;
+    constexpr size_t kQueryCount   = 2000;
+
+    std::vector<std::unique_ptr<CommonTestElements>> services;
+    CountingServer server;
+    ResponseSender responseSender(&server);
+    for (size_t i = 0; i < kServiceCount; i++)
+    {
+        std::string tag = "test" + std::to_string(i);
+        services.push_back(std::make_unique<CommonTestElements>(tag.c_str()));
+
+        auto & service = *services.back();
+        EXPECT_EQ(responseSender.AddQueryResponder(&service.queryResponder), CHIP_NO_ERROR);
+        service.queryResponder.AddResponder(&service.ptrResponder).SetReportAdditional(service.instance);
+        service.queryResponder.AddResponder(&service.srvResponder);
+        service.queryResponder.AddResponder(&service.txtResponder);
+    }
+    CommonTestElements & query = *services.back();
+    query.recordWriter.WriteQName(query.service);
+    QueryData queryData = QueryData(QType::PTR, QClass::IN, false, query.requestNameStart, query.requestBytesRange);
+
+    for (bool useCache : { false, true })
+    {
+        server.mSendCount = 0;
+
+        const uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (size_t i = 0; i < kQueryCount; i++)
+        {
+            if (!useCache)
+            {
+                responseSender.InvalidateResponseCache();
+            }
+            EXPECT_EQ(responseSender.Respond(1, queryData, &query.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+        }
+        const uint64_t elapsed = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+        EXPECT_EQ(server.mSendCount, kQueryCount);
+        ChipLogProgress(Discovery, "%s: %u replies in %u us (%u replies/s)", useCache ? "Cached" : "Built",
+                        static_cast<unsigned>(kQueryCount), static_cast<unsigned>(elapsed),
+                        static_cast<unsigned>((elapsed > 0) ? (kQueryCount * 1000000 / elapsed) : 0));
+    }
+}
+
 } // namespace
@@ -381,4 +381,66 @@ TEST(TestActiveResolveAttempts, TestCombination)
     EXPECT_FALSE(attempts.GetTimeUntilNextExpectedResponse().has_value());
     EXPECT_FALSE(attempts.NextScheduled().has_value());
 }
+
+TEST(TestActiveResolveAttempts, TestDuplicateQuestionSuppression)
+{
+    System::Clock::Internal::MockClock mockClock;
+    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
+
+    mockClock.AdvanceMonotonic(1234_ms32);
+
+    attempts.MarkPending(MakePeerId(1));
+
+    // Another host asking for the same node before our first (unicast) query
+    // does not delay it.
+    attempts.DuplicateQuestionReceived(MakePeerId(1));
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(0_ms32));
+    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(1, true));
+
+    // Retries are postponed as if sent when another host asks the same question
+    mockClock.AdvanceMonotonic(800_ms32);
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(200_ms32));
+    attempts.DuplicateQuestionReceived(MakePeerId(1));
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(1000_ms32));
+
+    // Questions for other nodes are not relevant
+    attempts.DuplicateQuestionReceived(MakePeerId(2));
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(1000_ms32));
+
+    // The back-off is unchanged: the next retry still uses a 2 second interval
+    mockClock.AdvanceMonotonic(1000_ms32);
+    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(1, false));
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(2000_ms32));
+
+    // The duplicate question counts as sent at the time it was received
+    mockClock.AdvanceMonotonic(100_ms32);
+    attempts.DuplicateQuestionReceived(MakePeerId(1));
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(2000_ms32));
+}
+
+TEST(TestActiveResolveAttempts, TestRetryJitter)
+{
+    System::Clock::Internal::MockClock mockClock;
+    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock, 100_ms32);
+
+    mockClock.AdvanceMonotonic(1234_ms32);
+
+    attempts.MarkPending(MakePeerId(1));
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(0_ms32));
+    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(1, true));
+
+    // Retry interval is at least the RFC 6762 minimum, plus up to the jitter
+    std::optional<Timeout> delay = attempts.GetTimeUntilNextExpectedResponse();
+    ASSERT_TRUE(delay.has_value());
+    EXPECT_GE(*delay, 1000_ms32);
+    EXPECT_LE(*delay, 1100_ms32);
+
+    mockClock.AdvanceMonotonic(*delay);
+    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(1, false));
+
+    delay = attempts.GetTimeUntilNextExpectedResponse();
+    ASSERT_TRUE(delay.has_value());
+    EXPECT_GE(*delay, 2000_ms32);
+    EXPECT_LE(*delay, 2100_ms32);
+}
 } // namespace
@@ -0,0 +1,167 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/dnssd/KnownAnswerList.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/RecordData.h>
+#include <lib/dnssd/minimal_mdns/core/tests/QNameStrings.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using namespace mdns::Minimal;
+
+const auto kServiceName = testing::TestQName<3>({ "_matterc", "_udp", "local" });
+const auto kOtherName   = testing::TestQName<5>({ "_L3840", "_sub", "_matterc", "_udp", "local" });
+const auto kInstance1   = testing::TestQName<4>({ "INSTANCE1", "_matterc", "_udp", "local" });
+const auto kInstance2   = testing::TestQName<4>({ "INSTANCE2", "_matterc", "_udp", "local" });
+const auto kInstance3   = testing::TestQName<4>({ "INSTANCE3", "_matterc", "_udp", "local" });
+
+/// Collects the answers of a parsed packet
+class AnswerCollector : public ParserDelegate
+{
+public:
+    void OnHeader(ConstHeaderRef & header) override { mQueryCount = header.GetQueryCount(); }
+    void OnQuery(const QueryData & data) override {}
+    void OnResource(ResourceType type, const ResourceData & data) override
+    {
+        EXPECT_EQ(type, ResourceType::kAnswer);
+        EXPECT_EQ(data.GetType(), QType::PTR);
+        EXPECT_TRUE(data.GetName() == kServiceName.Full());
+        mAnswerCount++;
+        mLastTtl = data.GetTtlSeconds();
+    }
+
+    uint16_t mQueryCount = 0;
+    size_t mAnswerCount  = 0;
+    uint64_t mLastTtl    = 0;
+};
+
+class TestKnownAnswerList : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestKnownAnswerList, TestAddAndExpire)
+{
+    System::Clock::Internal::MockClock mockClock;
+    KnownAnswerList answers(&mockClock);
+
+    mockClock.AdvanceMonotonic(1234_ms32);
+    EXPECT_EQ(answers.Count(), 0u);
+
+    answers.Add(kServiceName.Serialized(), kInstance1.Serialized(), 120);
+    answers.Add(kServiceName.Serialized(), kInstance2.Serialized(), 120);
+    EXPECT_EQ(answers.Count(), 2u);
+
+    // Refreshing an existing answer does not add a new one
+    mockClock.AdvanceMonotonic(30_s);
+    answers.Add(kServiceName.Serialized(), kInstance1.Serialized(), 120);
+    EXPECT_EQ(answers.Count(), 2u);
+
+    // Answers with less than half of their TTL left are not listed anymore
+    mockClock.AdvanceMonotonic(31_s);
+    EXPECT_EQ(answers.Count(), 1u);
+
+    // Goodbye packets remove the answer
+    answers.Add(kServiceName.Serialized(), kInstance1.Serialized(), 0);
+    EXPECT_EQ(answers.Count(), 0u);
+
+    answers.Add(kServiceName.Serialized(), kInstance3.Serialized(), 120);
+    EXPECT_EQ(answers.Count(), 1u);
+    answers.Clear();
+    EXPECT_EQ(answers.Count(), 0u);
+}
+
+TEST_F(TestKnownAnswerList, TestReplacement)
+{
+    System::Clock::Internal::MockClock mockClock;
+    KnownAnswerList answers(&mockClock);
+
+    // Fill the list, the first answer being the closest to expiry
+    for (unsigned i = 0; i < KnownAnswerList::kMaxAnswers; i++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "INSTANCE-%u", i);
+        const auto instance = testing::TestQName<4>({ name, "_matterc", "_udp", "local" });
+        answers.Add(kServiceName.Serialized(), instance.Serialized(), (i == 0) ? 100 : 120);
+    }
+    EXPECT_EQ(answers.Count(), KnownAnswerList::kMaxAnswers);
+
+    // A new answer replaces the one closest to expiry
+    answers.Add(kServiceName.Serialized(), kInstance1.Serialized(), 120);
+    EXPECT_EQ(answers.Count(), KnownAnswerList::kMaxAnswers);
+
+    const auto firstInstance = testing::TestQName<4>({ "INSTANCE-0", "_matterc", "_udp", "local" });
+    answers.Add(kServiceName.Serialized(), firstInstance.Serialized(), 0);
+    EXPECT_EQ(answers.Count(), KnownAnswerList::kMaxAnswers);
+
+    if (KnownAnswerList::kMaxAnswers > 0)
+    {
+        answers.Add(kServiceName.Serialized(), kInstance1.Serialized(), 0);
+        EXPECT_EQ(answers.Count(), KnownAnswerList::kMaxAnswers - 1);
+    }
+}
+
+TEST_F(TestKnownAnswerList, TestAppendToQuery)
+{
+    System::Clock::Internal::MockClock mockClock;
+    KnownAnswerList answers(&mockClock);
+
+    answers.Add(kServiceName.Serialized(), kInstance1.Serialized(), 120);
+    answers.Add(kServiceName.Serialized(), kInstance2.Serialized(), 120);
+    mockClock.AdvanceMonotonic(20_s);
+
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::New(512);
+    ASSERT_FALSE(buffer.IsNull());
+
+    QueryBuilder builder(std::move(buffer));
+    builder.AddQuery(Query(kServiceName.Full()).SetType(QType::PTR).SetAnswerViaUnicast(false));
+    answers.AppendTo(builder);
+    EXPECT_TRUE(builder.Ok());
+
+    // Questions cannot follow known answers
+    builder.AddQuery(Query(kOtherName.Full()).SetType(QType::PTR));
+    EXPECT_FALSE(builder.Ok());
+
+    System::PacketBufferHandle packet = builder.ReleasePacket();
+    AnswerCollector collector;
+    EXPECT_TRUE(ParsePacket(BytesRange(packet->Start(), packet->Start() + packet->DataLength()), &collector));
+
+    const size_t expected = std::min<size_t>(KnownAnswerList::kMaxAnswers, 2);
+    EXPECT_EQ(collector.mQueryCount, 1u);
+    EXPECT_EQ(collector.mAnswerCount, expected);
+    if (expected > 0)
+    {
+        // Known answers carry their remaining TTL
+        EXPECT_EQ(collector.mLastTtl, 100u);
+    }
+}
+
+} // namespace
@@ -24,30 +24,108 @@
 
 #include <platform/DeviceSafeQueue.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
-void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
+DeviceSafeQueue::DeviceSafeQueue()
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+CHIP_ERROR DeviceSafeQueue::Push(const ChipDeviceEvent & event, bool & wakeConsumer)
+{
+    size_t position = mPushPosition.load(std::memory_order_relaxed);
+    Slot * slot;
+
+    // Claim the slot at the push position, unless the consumer has not popped its previous event yet.
+    while (true)
+    {
+        slot                  = &mSlots[position & (kCapacity - 1)];
+        const size_t sequence = slot->mSequence.load(std::memory_order_acquire);
+
+        if (sequence == position)
+        {
+            if (mPushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (static_cast<intptr_t>(sequence - position) < 0)
+        {
+            mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+            wakeConsumer = false;
+            return CHIP_ERROR_NO_MEMORY;
+        }
+        else
+        {
+            // Another producer claimed the slot first.
+            position = mPushPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->mEvent    = event;
+    slot->mPushTime = System::SystemClock().GetMonotonicMicroseconds64();
+    slot->mSequence.store(position + 1, std::memory_order_release);
+
+    // Only wake the consumer if no push has done so since it started draining.
+    wakeConsumer = !mWakePending.exchange(true, std::memory_order_acq_rel);
+    if (wakeConsumer)
+    {
+        mWakeCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return CHIP_NO_ERROR;
 }
 
-bool DeviceSafeQueue::Empty()
+bool DeviceSafeQueue::BeginDrain()
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    // Acquiring the flag makes the events pushed before it was set visible.
+    return mWakePending.exchange(false, std::memory_order_acq_rel);
+}
+
+bool DeviceSafeQueue::PopFront(ChipDeviceEvent & event)
+{
+    Slot & slot = mSlots[mPopPosition & (kCapacity - 1)];
+
+    // The slot is not ready if it is empty or a producer is still writing to it. In the latter case, that
+    // producer wakes the consumer once done.
+    if (slot.mSequence.load(std::memory_order_acquire) != mPopPosition + 1)
+    {
+        return false;
+    }
+
+    const System::Clock::Microseconds64 latency = System::SystemClock().GetMonotonicMicroseconds64() - slot.mPushTime;
+
+    mMaxDepth     = std::max(mMaxDepth, GetDepth());
+    mTotalLatency = mTotalLatency + latency;
+    mMaxLatency   = std::max(mMaxLatency, latency);
+
+    event = slot.mEvent;
+    slot.mSequence.store(mPopPosition + kCapacity, std::memory_order_release);
+    mPopPosition++;
+
+    return true;
 }
 
-ChipDeviceEvent DeviceSafeQueue::PopFront()
+DeviceSafeQueue::Stats DeviceSafeQueue::GetStats() const
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
+    Stats stats;
 
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
+    stats.mDepth        = GetDepth();
+    stats.mMaxDepth     = mMaxDepth;
+    stats.mPushedCount  = mPushPosition.load(std::memory_order_relaxed);
+    stats.mDroppedCount = mDroppedCount.load(std::memory_order_relaxed);
+    stats.mWakeCount    = mWakeCount.load(std::memory_order_relaxed);
+    stats.mTotalLatency = mTotalLatency;
+    stats.mMaxLatency   = mMaxLatency;
 
-    return event;
+    return stats;
 }
 
 } // namespace Internal
@@ -24,12 +24,14 @@
 
 #pragma once
 
-#include <mutex>
-#include <queue>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
 
 #include <lib/core/CHIPCore.h>
 #include <platform/CHIPDeviceConfig.h>
 #include <platform/CHIPDeviceEvent.h>
+#include <system/SystemClock.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -39,24 +41,99 @@ namespace Internal {
  *  @class DeviceSafeQueue
  *
  *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
- *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
- *      and then an action is performed.
+ *      This class represents a thread-safe message queue, the message queue is used by the CHIP event loop to hold
+ *      incoming messages. Each message is sequentially dequeued, decoded, and then an action is performed.
  *
+ *      The queue is a bounded lock-free ring, which any number of threads may push events to, and a single thread,
+ *      the consumer, pops events from. Pushes that need to wake the consumer are coalesced: only the first event
+ *      pushed since the consumer last called BeginDrain() requests a wake-up.
+ *
+ *      The consumer processes events as follows:
+ *
+ *          while (queue.BeginDrain())
+ *          {
+ *              while (queue.PopFront(event))
+ *              {
+ *                  ...
+ *              }
+ *          }
  */
 class DeviceSafeQueue
 {
 public:
-    DeviceSafeQueue()  = default;
+    static constexpr size_t kCapacity = CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE;
+
+    /**
+     * Queue statistics.
+     */
+    struct Stats
+    {
+        size_t mDepth          = 0; ///< Number of events in the queue
+        size_t mMaxDepth       = 0; ///< Highest number of events in the queue seen when popping an event
+        uint64_t mPushedCount  = 0; ///< Number of events pushed
+        uint64_t mDroppedCount = 0; ///< Number of events not pushed because the queue was full
+        uint64_t mWakeCount    = 0; ///< Number of pushes that requested a wake-up of the consumer
+        System::Clock::Microseconds64 mTotalLatency{ 0 }; ///< Total time popped events spent in the queue
+        System::Clock::Microseconds64 mMaxLatency{ 0 };   ///< Longest time a popped event spent in the queue
+    };
+
+    DeviceSafeQueue();
     ~DeviceSafeQueue() = default;
 
-    void Push(const ChipDeviceEvent & event);
-    bool Empty();
-    ChipDeviceEvent PopFront();
+    /**
+     * Push an event, from any thread.
+     *
+     * @param[in]  event         The event to push.
+     * @param[out] wakeConsumer  Whether the consumer must be woken up to process the event.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY  The queue is full.
+     */
+    CHIP_ERROR Push(const ChipDeviceEvent & event, bool & wakeConsumer);
+
+    /**
+     * Consumer: start draining the queue. Returns whether events may have been pushed since the previous call.
+     */
+    bool BeginDrain();
+
+    /**
+     * Consumer: pop the oldest event. Returns false if the queue is empty.
+     */
+    bool PopFront(ChipDeviceEvent & event);
+
+    bool Empty() const { return GetDepth() == 0; }
+
+    /**
+     * Get the queue statistics. Must be called from the consumer thread, or with the consumer otherwise excluded
+     * (e.g. with the CHIP stack lock held, if the consumer pops events with it held).
+     */
+    Stats GetStats() const;
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0, "Event queue size must be a power of two");
+
+    struct Slot
+    {
+        // Position at which the slot can be pushed to, or position plus one when it holds an event to pop
+        std::atomic<size_t> mSequence;
+        ChipDeviceEvent mEvent;
+        System::Clock::Microseconds64 mPushTime;
+    };
+
+    size_t GetDepth() const { return mPushPosition.load(std::memory_order_acquire) - mPopPosition; }
+
+    Slot mSlots[kCapacity];
+
+    // Producer state
+    alignas(64) std::atomic<size_t> mPushPosition{ 0 };
+    std::atomic<bool> mWakePending{ false };
+    std::atomic<uint64_t> mDroppedCount{ 0 };
+    std::atomic<uint64_t> mWakeCount{ 0 };
+
+    // Consumer state
+    alignas(64) size_t mPopPosition = 0;
+    size_t mMaxDepth                = 0;
+    System::Clock::Microseconds64 mTotalLatency{ 0 };
+    System::Clock::Microseconds64 mMaxLatency{ 0 };
 
     DeviceSafeQueue(const DeviceSafeQueue &)             = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
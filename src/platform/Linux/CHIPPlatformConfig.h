@@ -56,6 +56,10 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 8
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+#ifndef CHIP_CONFIG_SECURE_SESSION_INDEX
+#define CHIP_CONFIG_SECURE_SESSION_INDEX 1
+#endif // CHIP_CONFIG_SECURE_SESSION_INDEX
+
 #ifndef CHIP_LOG_FILTERING
 #define CHIP_LOG_FILTERING 1
 #endif // CHIP_LOG_FILTERING
@@ -64,6 +68,22 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 256
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
+#ifndef CHIP_CONFIG_MINMDNS_RESOLVE_QUEUE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESOLVE_QUEUE_SIZE 64
+#endif // CHIP_CONFIG_MINMDNS_RESOLVE_QUEUE_SIZE
+
+#ifndef CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+#define CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS 32
+#endif // CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 16
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
 // ==================== Security Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_KVS_PATH
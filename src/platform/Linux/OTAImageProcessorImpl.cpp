@@ -63,7 +63,7 @@ CHIP_ERROR OTAImageProcessorImpl::Abort()
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
 {
-    if (!mOfs.is_open() || !mOfs.good())
+    if (!mStagingFile.IsOpen())
     {
         return CHIP_ERROR_INTERNAL;
     }
@@ -125,14 +125,13 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
         return;
     }
 
-    unlink(imageProcessor->mImageFile);
-
     imageProcessor->mParams.downloadedBytes = 0;
     imageProcessor->mParams.totalFileBytes  = 0;
     imageProcessor->mHeaderParser.Init();
-    imageProcessor->mOfs.open(imageProcessor->mImageFile, std::ofstream::out | std::ofstream::ate | std::ofstream::app);
-    if (!imageProcessor->mOfs.good())
+    CHIP_ERROR error = imageProcessor->mStagingFile.Open(imageProcessor->mImageFile);
+    if (error != CHIP_NO_ERROR)
     {
+        ChipLogError(SoftwareUpdate, "Cannot create %s: %" CHIP_ERROR_FORMAT, imageProcessor->mImageFile, error.Format());
         imageProcessor->mDownloader->OnPreparedForDownload(CHIP_ERROR_OPEN_FAILED);
         return;
     }
@@ -148,10 +147,19 @@ void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
     imageProcessor->ReleaseBlock();
 
-    ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mImageFile);
+    // The payload was verified as it arrived, so there is nothing left to check but whether it is complete
+    CHIP_ERROR error = imageProcessor->mStagingFile.Close(S_IRUSR | S_IWUSR | S_IXUSR | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "OTA image is incomplete or invalid: %" CHIP_ERROR_FORMAT, error.Format());
+        imageProcessor->mStagingFile.Abort();
+        imageProcessor->CancelUpdate(error);
+        return;
+    }
+
+    ChipLogProgress(SoftwareUpdate, "OTA image downloaded and verified to %s", imageProcessor->mImageFile);
 }
 
 void OTAImageProcessorImpl::HandleApply(intptr_t context)
@@ -163,9 +171,13 @@ void OTAImageProcessorImpl::HandleApply(intptr_t context)
     VerifyOrReturn(requestor != nullptr);
 
     // Move the downloaded image to the location where the new image is to be executed from
-    unlink(kImageExecPath);
-    rename(imageProcessor->mImageFile, kImageExecPath);
-    chmod(kImageExecPath, S_IRUSR | S_IWUSR | S_IXUSR | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+    CHIP_ERROR error = imageProcessor->mStagingFile.Commit(kImageExecPath);
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot apply OTA image: %" CHIP_ERROR_FORMAT, error.Format());
+        imageProcessor->CancelUpdate(error);
+        return;
+    }
 
     // Shutdown the stack and expect to boot into the new image once the event loop is stopped
     DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) { DeviceLayer::PlatformMgr().HandleServerShuttingDown(); });
@@ -180,8 +192,7 @@ void OTAImageProcessorImpl::HandleAbort(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
-    unlink(imageProcessor->mImageFile);
+    imageProcessor->mStagingFile.Abort();
     imageProcessor->ReleaseBlock();
 }
 
@@ -203,14 +214,16 @@ void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
     CHIP_ERROR error = imageProcessor->ProcessHeader(block);
     if (error != CHIP_NO_ERROR)
     {
-        ChipLogError(SoftwareUpdate, "Image does not contain a valid header");
+        ChipLogError(SoftwareUpdate, "Image does not contain a valid header: %" CHIP_ERROR_FORMAT, error.Format());
         imageProcessor->mDownloader->EndDownload(CHIP_ERROR_INVALID_FILE_IDENTIFIER);
         return;
     }
 
-    if (!imageProcessor->mOfs.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size())))
+    error = imageProcessor->mStagingFile.Write(block);
+    if (error != CHIP_NO_ERROR)
     {
-        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_WRITE_FAILED);
+        ChipLogError(SoftwareUpdate, "Cannot write OTA image: %" CHIP_ERROR_FORMAT, error.Format());
+        imageProcessor->mDownloader->EndDownload(error == CHIP_ERROR_INTEGRITY_CHECK_FAILED ? error : CHIP_ERROR_WRITE_FAILED);
         return;
     }
 
@@ -218,6 +231,21 @@ void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
     imageProcessor->mDownloader->FetchNextData();
 }
 
+void OTAImageProcessorImpl::CancelUpdate(CHIP_ERROR error)
+{
+    // The transfer is usually reported complete already, as the last block is acknowledged before it is finalized: ending the
+    // download alone would leave the requestor in its Downloading (or Applying) state.
+    OTARequestorInterface * requestor = chip::GetRequestorInstance();
+    if (requestor != nullptr)
+    {
+        requestor->CancelImageUpdate();
+    }
+    else if (mDownloader != nullptr)
+    {
+        mDownloader->EndDownload(error);
+    }
+}
+
 CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
 {
     if (mHeaderParser.IsInitialized())
@@ -230,7 +258,9 @@ CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
         ReturnErrorOnFailure(error);
 
         mParams.totalFileBytes = header.mPayloadSize;
+        error                  = mStagingFile.Reserve(header);
         mHeaderParser.Clear();
+        ReturnErrorOnFailure(error);
     }
 
     return CHIP_NO_ERROR;
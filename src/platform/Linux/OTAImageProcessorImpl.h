@@ -18,13 +18,13 @@
 
 #pragma once
 
+#include "OTAImageStagingFile.h"
+
 #include <app/clusters/ota-requestor/OTADownloader.h>
 #include <lib/core/OTAImageHeader.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/OTAImageProcessor.h>
 
-#include <fstream>
-
 namespace chip {
 
 // Full file path to where the new image will be executed from post-download
@@ -53,6 +53,11 @@ private:
     static void HandleAbort(intptr_t context);
     static void HandleProcessBlock(intptr_t context);
 
+    /**
+     * Called when the downloaded image cannot be finalized or applied, to get the requestor out of its update state
+     */
+    void CancelUpdate(CHIP_ERROR error);
+
     CHIP_ERROR ProcessHeader(ByteSpan & block);
 
     /**
@@ -65,7 +70,8 @@ private:
      */
     CHIP_ERROR ReleaseBlock();
 
-    std::ofstream mOfs;
+    // The payload is verified as it is written, so that applying the image only takes a rename
+    OTAImageStagingFile mStagingFile;
     MutableByteSpan mBlock;
     OTADownloader * mDownloader;
     OTAImageHeaderParser mHeaderParser;
@@ -0,0 +1,274 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "OTAImageStagingFile.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+namespace chip {
+
+namespace {
+
+/// Length of the digest in the image header for the given digest type, or 0 if it cannot be verified.
+size_t GetSha256DigestLength(OTAImageDigestType digestType)
+{
+    switch (digestType)
+    {
+    case OTAImageDigestType::kSha256:
+        return 32;
+    case OTAImageDigestType::kSha256_128:
+        return 16;
+    case OTAImageDigestType::kSha256_120:
+        return 15;
+    case OTAImageDigestType::kSha256_96:
+        return 12;
+    case OTAImageDigestType::kSha256_64:
+        return 8;
+    case OTAImageDigestType::kSha256_32:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+} // namespace
+
+CHIP_ERROR OTAImageStagingFile::Open(const char * path)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Abort();
+
+    const size_t pathLength = strlen(path);
+    VerifyOrReturnError(mPath.Alloc(pathLength + 1), CHIP_ERROR_NO_MEMORY);
+    memcpy(mPath.Get(), path, pathLength + 1);
+
+    if (mChunk == nullptr)
+    {
+        VerifyOrReturnError(mChunkStorage.Alloc(kChunkSize + kAlignment), CHIP_ERROR_NO_MEMORY);
+        const size_t misalignment = reinterpret_cast<uintptr_t>(mChunkStorage.Get()) % kAlignment;
+        mChunk                    = mChunkStorage.Get() + (kAlignment - misalignment) % kAlignment;
+    }
+
+    unlink(path);
+
+    constexpr int kFlags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+#ifdef O_DIRECT
+    mFd     = open(path, kFlags | O_DIRECT, S_IRUSR | S_IWUSR);
+    mDirect = (mFd >= 0);
+#endif
+    if (mFd < 0)
+    {
+        // Not all file systems support O_DIRECT (tmpfs does not, for instance)
+        mFd = open(path, kFlags, S_IRUSR | S_IWUSR);
+    }
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_POSIX(errno));
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStagingFile::Reserve(const OTAImageHeader & header)
+{
+    VerifyOrReturnError(IsOpen() && !mReserved, CHIP_ERROR_INCORRECT_STATE);
+
+    mExpectedDigestLength = GetSha256DigestLength(header.mImageDigestType);
+    VerifyOrReturnError(mExpectedDigestLength != 0, CHIP_ERROR_NOT_IMPLEMENTED,
+                        ChipLogError(SoftwareUpdate, "Unsupported OTA image digest type: %u",
+                                     to_underlying(header.mImageDigestType)));
+    VerifyOrReturnError(header.mImageDigest.size() == mExpectedDigestLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<off_t>(header.mPayloadSize), CHIP_ERROR_INVALID_ARGUMENT);
+
+    memcpy(mExpectedDigest, header.mImageDigest.data(), mExpectedDigestLength);
+    ReturnErrorOnFailure(mHash.Begin());
+
+    mPayloadSize = header.mPayloadSize;
+    mReserved    = true;
+
+#if defined(__linux__)
+    if (mPayloadSize > 0)
+    {
+        // Fail early if the image does not fit, and keep the file from fragmenting as it grows. Not all file
+        // systems support pre-allocation, which is not an error.
+        const int error = posix_fallocate(mFd, 0, static_cast<off_t>(mPayloadSize));
+        VerifyOrReturnError(error == 0 || error == EOPNOTSUPP || error == EINVAL, CHIP_ERROR_POSIX(error));
+    }
+#endif
+
+    return (mPayloadSize == 0) ? Verify() : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStagingFile::Write(ByteSpan data)
+{
+    VerifyOrReturnError(IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorCodeIf(data.empty(), CHIP_NO_ERROR);
+    VerifyOrReturnError(mReserved && !mVerified, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(data.size() <= mPayloadSize - mWrittenBytes, CHIP_ERROR_INTEGRITY_CHECK_FAILED,
+                        ChipLogError(SoftwareUpdate, "OTA image payload is larger than announced"));
+
+    ReturnErrorOnFailure(mHash.AddData(data));
+    mWrittenBytes += data.size();
+
+    while (!data.empty())
+    {
+        const size_t length = std::min(data.size(), kChunkSize - mChunkUsed);
+        memcpy(mChunk + mChunkUsed, data.data(), length);
+        mChunkUsed += length;
+        data = data.SubSpan(length);
+
+        if (mChunkUsed == kChunkSize)
+        {
+            ReturnErrorOnFailure(FlushChunk());
+        }
+    }
+
+    return (mWrittenBytes == mPayloadSize) ? Verify() : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStagingFile::Close(mode_t mode)
+{
+    VerifyOrReturnError(IsOpen() && mVerified, CHIP_ERROR_INCORRECT_STATE);
+
+    VerifyOrReturnError(fchmod(mFd, mode) == 0, CHIP_ERROR_POSIX(errno));
+    VerifyOrReturnError(fsync(mFd) == 0, CHIP_ERROR_POSIX(errno));
+    CloseFile();
+    mClosed = true;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStagingFile::Commit(const char * destPath)
+{
+    VerifyOrReturnError(destPath != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mClosed && mVerified, CHIP_ERROR_INCORRECT_STATE);
+
+    // rename() replaces destPath atomically: it refers to either the previous or the new image at any time
+    VerifyOrReturnError(rename(mPath.Get(), destPath) == 0, CHIP_ERROR_POSIX(errno));
+
+    mPath.Free();
+    mClosed   = false;
+    mVerified = false;
+    mReserved = false;
+
+    return CHIP_NO_ERROR;
+}
+
+void OTAImageStagingFile::Abort()
+{
+    CloseFile();
+    if (mPath)
+    {
+        unlink(mPath.Get());
+        mPath.Free();
+    }
+
+    mHash.Clear();
+    mChunkUsed    = 0;
+    mPayloadSize  = 0;
+    mWrittenBytes = 0;
+    mReserved     = false;
+    mVerified     = false;
+    mClosed       = false;
+}
+
+CHIP_ERROR OTAImageStagingFile::WriteToFile(const uint8_t * data, size_t length)
+{
+    while (length > 0)
+    {
+        const ssize_t written = write(mFd, data, length);
+        if (written < 0)
+        {
+            const int error = errno;
+            // The file system may accept O_DIRECT when opening the file, but reject direct writes
+            VerifyOrReturnError(error == EINTR || (error == EINVAL && mDirect), CHIP_ERROR_POSIX(error));
+            if (error == EINVAL)
+            {
+                DisableDirectIO();
+            }
+            continue;
+        }
+
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStagingFile::FlushChunk()
+{
+    ReturnErrorOnFailure(WriteToFile(mChunk, mChunkUsed));
+    mChunkUsed = 0;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStagingFile::Verify()
+{
+    if (mChunkUsed > 0)
+    {
+        // The last chunk is partial, which O_DIRECT does not allow
+        DisableDirectIO();
+        ReturnErrorOnFailure(FlushChunk());
+    }
+
+    uint8_t digestBuffer[Crypto::kSHA256_Hash_Length];
+    MutableByteSpan digest(digestBuffer);
+    ReturnErrorOnFailure(mHash.Finish(digest));
+
+    VerifyOrReturnError(memcmp(digest.data(), mExpectedDigest, mExpectedDigestLength) == 0, CHIP_ERROR_INTEGRITY_CHECK_FAILED,
+                        ChipLogError(SoftwareUpdate, "OTA image payload does not match its digest"));
+    mVerified = true;
+
+    return CHIP_NO_ERROR;
+}
+
+void OTAImageStagingFile::DisableDirectIO()
+{
+#ifdef O_DIRECT
+    VerifyOrReturn(mDirect);
+    const int flags = fcntl(mFd, F_GETFL);
+    if (flags >= 0)
+    {
+        fcntl(mFd, F_SETFL, flags & ~O_DIRECT);
+    }
+#endif
+    mDirect = false;
+}
+
+void OTAImageStagingFile::CloseFile()
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+    mDirect = false;
+}
+
+} // namespace chip
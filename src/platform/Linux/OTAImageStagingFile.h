@@ -0,0 +1,117 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/OTAImageHeader.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+#include <sys/types.h>
+
+namespace chip {
+
+/**
+ * File an OTA image payload is streamed to while it is being downloaded.
+ *
+ * The payload is hashed as it is written, and verified against the digest of the image header as
+ * soon as its last byte arrives, so the image never has to be read back. The file is pre-allocated
+ * to the payload size and written in large aligned chunks, bypassing the page cache (O_DIRECT) if
+ * the file system supports it. Once verified and closed, the image is installed by atomically
+ * renaming the staging file over its destination.
+ */
+class OTAImageStagingFile
+{
+public:
+    OTAImageStagingFile() = default;
+    ~OTAImageStagingFile() { CloseFile(); }
+
+    OTAImageStagingFile(const OTAImageStagingFile &)             = delete;
+    OTAImageStagingFile & operator=(const OTAImageStagingFile &) = delete;
+
+    /**
+     * @brief Create the staging file, replacing any previous one.
+     */
+    CHIP_ERROR Open(const char * path);
+
+    /**
+     * @brief Take the payload size and digest from the image header, and pre-allocate the file.
+     *
+     * @retval CHIP_ERROR_NOT_IMPLEMENTED  The digest type is not a (possibly truncated) SHA-256.
+     */
+    CHIP_ERROR Reserve(const OTAImageHeader & header);
+
+    /**
+     * @brief Append payload data.
+     *
+     * @retval CHIP_ERROR_INTEGRITY_CHECK_FAILED  The payload is larger than announced by the header, or
+     *                                            it is complete and does not match the header digest.
+     */
+    CHIP_ERROR Write(ByteSpan data);
+
+    /**
+     * @brief Make the verified payload durable, set its file mode and close the staging file.
+     */
+    CHIP_ERROR Close(mode_t mode);
+
+    /**
+     * @brief Atomically move the closed staging file to destPath, replacing any file there.
+     */
+    CHIP_ERROR Commit(const char * destPath);
+
+    /**
+     * @brief Close and remove the staging file.
+     */
+    void Abort();
+
+    bool IsOpen() const { return mFd >= 0; }
+    bool IsVerified() const { return mVerified; }
+    uint64_t GetWrittenBytes() const { return mWrittenBytes; }
+
+private:
+    static constexpr size_t kAlignment = 4096;
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    CHIP_ERROR WriteToFile(const uint8_t * data, size_t length);
+    CHIP_ERROR FlushChunk();
+    CHIP_ERROR Verify();
+    void DisableDirectIO();
+    void CloseFile();
+
+    int mFd      = -1;
+    bool mDirect = false;
+    Platform::ScopedMemoryBuffer<char> mPath;
+
+    // Chunk buffer, aligned within mChunkStorage for O_DIRECT
+    Platform::ScopedMemoryBuffer<uint8_t> mChunkStorage;
+    uint8_t * mChunk  = nullptr;
+    size_t mChunkUsed = 0;
+
+    Crypto::Hash_SHA256_stream mHash;
+    uint8_t mExpectedDigest[Crypto::kSHA256_Hash_Length];
+    size_t mExpectedDigestLength = 0;
+    uint64_t mPayloadSize        = 0;
+    uint64_t mWrittenBytes       = 0;
+    bool mReserved               = false;
+    bool mVerified               = false;
+    bool mClosed                 = false;
+};
+
+} // namespace chip
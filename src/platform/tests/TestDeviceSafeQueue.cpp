@@ -0,0 +1,249 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/DeviceSafeQueue.h>
+#include <system/SystemClock.h>
+
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+ChipDeviceEvent MakeEvent(uintptr_t arg)
+{
+    ChipDeviceEvent event;
+    event.Type                    = DeviceEventType::kCallWorkFunct;
+    event.CallWorkFunct.WorkFunct = nullptr;
+    event.CallWorkFunct.Arg       = static_cast<intptr_t>(arg);
+    return event;
+}
+
+TEST(TestDeviceSafeQueue, TestOrderAndCapacity)
+{
+    auto queue = std::make_unique<DeviceSafeQueue>();
+    bool wake  = false;
+    ChipDeviceEvent event;
+
+    EXPECT_TRUE(queue->Empty());
+    EXPECT_FALSE(queue->PopFront(event));
+
+    for (uintptr_t i = 0; i < DeviceSafeQueue::kCapacity; i++)
+    {
+        EXPECT_EQ(queue->Push(MakeEvent(i), wake), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(queue->Push(MakeEvent(DeviceSafeQueue::kCapacity), wake), CHIP_ERROR_NO_MEMORY);
+    EXPECT_FALSE(wake);
+
+    // Freeing a slot makes room for one more event, which wraps around the ring.
+    EXPECT_TRUE(queue->BeginDrain());
+    EXPECT_TRUE(queue->PopFront(event));
+    EXPECT_EQ(event.CallWorkFunct.Arg, 0);
+    EXPECT_EQ(queue->Push(MakeEvent(DeviceSafeQueue::kCapacity), wake), CHIP_NO_ERROR);
+
+    for (uintptr_t i = 1; i <= DeviceSafeQueue::kCapacity; i++)
+    {
+        EXPECT_TRUE(queue->PopFront(event));
+        EXPECT_EQ(event.Type, DeviceEventType::kCallWorkFunct);
+        EXPECT_EQ(event.CallWorkFunct.Arg, static_cast<intptr_t>(i));
+    }
+    EXPECT_FALSE(queue->PopFront(event));
+    EXPECT_TRUE(queue->Empty());
+
+    DeviceSafeQueue::Stats stats = queue->GetStats();
+    EXPECT_EQ(stats.mDepth, 0u);
+    EXPECT_EQ(stats.mMaxDepth, DeviceSafeQueue::kCapacity);
+    EXPECT_EQ(stats.mPushedCount, DeviceSafeQueue::kCapacity + 1);
+    EXPECT_EQ(stats.mDroppedCount, 1u);
+}
+
+TEST(TestDeviceSafeQueue, TestWakeCoalescing)
+{
+    auto queue = std::make_unique<DeviceSafeQueue>();
+    bool wake  = false;
+    ChipDeviceEvent event;
+
+    EXPECT_FALSE(queue->BeginDrain());
+
+    // Only the first event pushed since the consumer started draining wakes it up.
+    EXPECT_EQ(queue->Push(MakeEvent(0), wake), CHIP_NO_ERROR);
+    EXPECT_TRUE(wake);
+    EXPECT_EQ(queue->Push(MakeEvent(1), wake), CHIP_NO_ERROR);
+    EXPECT_FALSE(wake);
+
+    EXPECT_TRUE(queue->BeginDrain());
+    EXPECT_TRUE(queue->PopFront(event));
+
+    // Pushes made while draining wake the consumer once more, and are drained in the next pass.
+    EXPECT_EQ(queue->Push(MakeEvent(2), wake), CHIP_NO_ERROR);
+    EXPECT_TRUE(wake);
+    EXPECT_EQ(queue->Push(MakeEvent(3), wake), CHIP_NO_ERROR);
+    EXPECT_FALSE(wake);
+
+    EXPECT_TRUE(queue->PopFront(event));
+    EXPECT_TRUE(queue->PopFront(event));
+    EXPECT_TRUE(queue->PopFront(event));
+    EXPECT_EQ(event.CallWorkFunct.Arg, 3);
+    EXPECT_FALSE(queue->PopFront(event));
+
+    EXPECT_TRUE(queue->BeginDrain());
+    EXPECT_FALSE(queue->PopFront(event));
+    EXPECT_FALSE(queue->BeginDrain());
+
+    EXPECT_EQ(queue->GetStats().mWakeCount, 2u);
+}
+
+// Mutex-protected queue the lock-free queue replaced, as a baseline for the benchmark
+class MutexQueue
+{
+public:
+    void Push(const ChipDeviceEvent & event)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mQueue.push(event);
+    }
+
+    bool PopFront(ChipDeviceEvent & event)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        if (mQueue.empty())
+        {
+            return false;
+        }
+        event = mQueue.front();
+        mQueue.pop();
+        return true;
+    }
+
+private:
+    std::mutex mLock;
+    std::queue<ChipDeviceEvent> mQueue;
+};
+
+constexpr uintptr_t kProducerCount     = 8;
+constexpr uintptr_t kEventsPerProducer = 50000;
+
+// Encode the producer in the upper bits of the event argument, so that the consumer can check per-producer ordering.
+constexpr unsigned kProducerShift = 24;
+
+template <typename PushFunc, typename PopFunc>
+System::Clock::Microseconds64 RunProducers(PushFunc push, PopFunc pop)
+{
+    std::vector<uintptr_t> nextSequence(kProducerCount, 0);
+    std::vector<std::thread> producers;
+    size_t received = 0;
+    bool ordered    = true;
+
+    const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+
+    for (uintptr_t producer = 0; producer < kProducerCount; producer++)
+    {
+        producers.emplace_back([producer, &push]() {
+            for (uintptr_t sequence = 0; sequence < kEventsPerProducer; sequence++)
+            {
+                push(MakeEvent((producer << kProducerShift) | sequence));
+            }
+        });
+    }
+
+    ChipDeviceEvent event;
+    while (received < kProducerCount * kEventsPerProducer)
+    {
+        if (!pop(event))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const uintptr_t arg      = static_cast<uintptr_t>(event.CallWorkFunct.Arg);
+        const uintptr_t producer = arg >> kProducerShift;
+        ordered &= (producer < kProducerCount) && (arg & ((1u << kProducerShift) - 1)) == nextSequence[producer];
+        nextSequence[producer]++;
+        received++;
+    }
+
+    for (auto & thread : producers)
+    {
+        thread.join();
+    }
+
+    EXPECT_TRUE(ordered);
+    return System::SystemClock().GetMonotonicMicroseconds64() - start;
+}
+
+TEST(TestDeviceSafeQueue, TestMultiProducerBenchmark)
+{
+    auto queue        = std::make_unique<DeviceSafeQueue>();
+    uint64_t wakes    = 0;
+    bool drainPending = false;
+
+    const System::Clock::Microseconds64 lockFreeTime = RunProducers(
+        [&queue](const ChipDeviceEvent & event) {
+            bool wake;
+            while (queue->Push(event, wake) != CHIP_NO_ERROR)
+            {
+                std::this_thread::yield();
+            }
+        },
+        [&queue, &wakes, &drainPending](ChipDeviceEvent & event) {
+            // Follow the consumer protocol of the event loop, counting the passes that would have needed a wake-up.
+            if (!drainPending)
+            {
+                drainPending = queue->BeginDrain();
+                wakes += drainPending ? 1 : 0;
+            }
+            drainPending = drainPending && queue->PopFront(event);
+            return drainPending;
+        });
+
+    MutexQueue mutexQueue;
+    const System::Clock::Microseconds64 mutexTime = RunProducers(
+        [&mutexQueue](const ChipDeviceEvent & event) { mutexQueue.Push(event); },
+        [&mutexQueue](ChipDeviceEvent & event) { return mutexQueue.PopFront(event); });
+
+    const DeviceSafeQueue::Stats stats = queue->GetStats();
+    const uint64_t eventCount          = kProducerCount * kEventsPerProducer;
+
+    ChipLogProgress(DeviceLayer,
+                    "%u producers, %u events: lock-free queue %u ms (%u wakes, max depth %u, average latency %u us, max %u us), "
+                    "mutex queue %u ms",
+                    static_cast<unsigned>(kProducerCount), static_cast<unsigned>(eventCount),
+                    static_cast<unsigned>(lockFreeTime.count() / 1000), static_cast<unsigned>(stats.mWakeCount),
+                    static_cast<unsigned>(stats.mMaxDepth), static_cast<unsigned>(stats.mTotalLatency.count() / eventCount),
+                    static_cast<unsigned>(stats.mMaxLatency.count()), static_cast<unsigned>(mutexTime.count() / 1000));
+
+    EXPECT_EQ(stats.mPushedCount, eventCount);
+    EXPECT_EQ(stats.mDepth, 0u);
+    EXPECT_LE(stats.mMaxDepth, DeviceSafeQueue::kCapacity);
+
+    // Wake-ups are coalesced: at most one per drain pass, rather than one per event.
+    EXPECT_LE(stats.mWakeCount, wakes + 1);
+    EXPECT_LT(stats.mWakeCount, eventCount);
+}
+
+} // namespace
@@ -0,0 +1,257 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/OTAImageHeader.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/OTAImageStagingFile.h>
+#include <system/SystemClock.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+using namespace chip;
+
+namespace {
+
+constexpr char kStagingPath[] = "/tmp/chip_test_ota_staging.bin";
+constexpr char kInstallPath[] = "/tmp/chip_test_ota_install.bin";
+
+// Typical size of the BDX blocks an OTA image is downloaded with
+constexpr size_t kBlockSize = 1024;
+
+constexpr uint64_t kNoCorruption = UINT64_MAX;
+
+// Deterministic payload contents
+uint8_t PayloadByte(uint64_t offset)
+{
+    return static_cast<uint8_t>((offset * 131) ^ (offset >> 8));
+}
+
+CHIP_ERROR ComputePayloadDigest(uint64_t payloadSize, uint8_t (&digest)[Crypto::kSHA256_Hash_Length])
+{
+    Crypto::Hash_SHA256_stream hash;
+    uint8_t block[kBlockSize];
+
+    ReturnErrorOnFailure(hash.Begin());
+    for (uint64_t offset = 0; offset < payloadSize; offset += kBlockSize)
+    {
+        const size_t length = static_cast<size_t>(std::min<uint64_t>(kBlockSize, payloadSize - offset));
+        for (size_t i = 0; i < length; i++)
+        {
+            block[i] = PayloadByte(offset + i);
+        }
+        ReturnErrorOnFailure(hash.AddData(ByteSpan(block, length)));
+    }
+
+    MutableByteSpan digestSpan(digest);
+    return hash.Finish(digestSpan);
+}
+
+// Encode the header of a Matter OTA image, as generated by src/app/ota_image_tool.py.
+CHIP_ERROR EncodeImageHeader(uint64_t payloadSize, OTAImageDigestType digestType, ByteSpan digest, MutableByteSpan & header)
+{
+    uint8_t tlvBuffer[128];
+    TLV::TLVWriter tlvWriter;
+    TLV::TLVType outerType;
+
+    tlvWriter.Init(tlvBuffer);
+    ReturnErrorOnFailure(tlvWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(0), static_cast<uint16_t>(0xFFF1)));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(1), static_cast<uint16_t>(0x8000)));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(2), static_cast<uint32_t>(2)));
+    ReturnErrorOnFailure(tlvWriter.PutString(TLV::ContextTag(3), "2.0"));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(4), payloadSize));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(8), to_underlying(digestType)));
+    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(9), digest));
+    ReturnErrorOnFailure(tlvWriter.EndContainer(outerType));
+    ReturnErrorOnFailure(tlvWriter.Finalize());
+
+    const uint32_t tlvSize = tlvWriter.GetLengthWritten();
+    Encoding::LittleEndian::BufferWriter writer(header);
+    writer.Put32(kOTAImageFileIdentifier).Put64(16 + tlvSize + payloadSize).Put32(tlvSize).Put(tlvBuffer, tlvSize);
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    header.reduce_size(writer.Needed());
+    return CHIP_NO_ERROR;
+}
+
+// Stream an image to a staging file in BDX-sized blocks, decoding its header on the way like OTAImageProcessorImpl does.
+// The payload byte at corruptOffset, if any, is altered.
+CHIP_ERROR StreamImage(OTAImageStagingFile & stagingFile, ByteSpan header, uint64_t payloadSize,
+                       uint64_t corruptOffset = kNoCorruption)
+{
+    OTAImageHeaderParser parser;
+    uint8_t blockBuffer[kBlockSize];
+    const uint64_t imageSize = header.size() + payloadSize;
+
+    parser.Init();
+    for (uint64_t offset = 0; offset < imageSize; offset += kBlockSize)
+    {
+        const size_t length = static_cast<size_t>(std::min<uint64_t>(kBlockSize, imageSize - offset));
+        for (size_t i = 0; i < length; i++)
+        {
+            const uint64_t imageOffset = offset + i;
+            if (imageOffset < header.size())
+            {
+                blockBuffer[i] = header[static_cast<size_t>(imageOffset)];
+                continue;
+            }
+
+            const uint64_t payloadOffset = imageOffset - header.size();
+            blockBuffer[i] = static_cast<uint8_t>(PayloadByte(payloadOffset) ^ (payloadOffset == corruptOffset ? 0xFF : 0));
+        }
+
+        ByteSpan block(blockBuffer, length);
+        if (parser.IsInitialized())
+        {
+            OTAImageHeader imageHeader;
+            CHIP_ERROR err = parser.AccumulateAndDecode(block, imageHeader);
+            if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+            {
+                continue;
+            }
+            ReturnErrorOnFailure(err);
+            err = stagingFile.Reserve(imageHeader);
+            parser.Clear();
+            ReturnErrorOnFailure(err);
+        }
+
+        ReturnErrorOnFailure(stagingFile.Write(block));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool FileExists(const char * path)
+{
+    struct stat st;
+    return stat(path, &st) == 0;
+}
+
+class TestOTAImageStagingFile : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void TearDown() override
+    {
+        unlink(kStagingPath);
+        unlink(kInstallPath);
+    }
+};
+
+// Download, verify and install a 50 MB image end to end, and report the throughput.
+TEST_F(TestOTAImageStagingFile, TestStreamVerifyAndCommit)
+{
+    constexpr uint64_t kPayloadSize = 50 * 1024 * 1024;
+
+    uint8_t digest[Crypto::kSHA256_Hash_Length];
+    ASSERT_EQ(ComputePayloadDigest(kPayloadSize, digest), CHIP_NO_ERROR);
+
+    uint8_t headerBuffer[256];
+    MutableByteSpan header(headerBuffer);
+    ASSERT_EQ(EncodeImageHeader(kPayloadSize, OTAImageDigestType::kSha256, ByteSpan(digest), header), CHIP_NO_ERROR);
+
+    OTAImageStagingFile stagingFile;
+    const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+
+    ASSERT_EQ(stagingFile.Open(kStagingPath), CHIP_NO_ERROR);
+    EXPECT_EQ(StreamImage(stagingFile, header, kPayloadSize), CHIP_NO_ERROR);
+    EXPECT_TRUE(stagingFile.IsVerified());
+    EXPECT_EQ(stagingFile.Close(S_IRUSR | S_IWUSR | S_IXUSR), CHIP_NO_ERROR);
+    EXPECT_EQ(stagingFile.Commit(kInstallPath), CHIP_NO_ERROR);
+
+    const System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+    ChipLogProgress(SoftwareUpdate, "Streamed, verified and installed a %u MB image in %u ms (%u MB/s)",
+                    static_cast<unsigned>(kPayloadSize >> 20), static_cast<unsigned>(elapsed.count() / 1000),
+                    static_cast<unsigned>((kPayloadSize >> 20) * 1000000 / std::max<uint64_t>(elapsed.count(), 1)));
+
+    struct stat st;
+    ASSERT_EQ(stat(kInstallPath, &st), 0);
+    EXPECT_EQ(static_cast<uint64_t>(st.st_size), kPayloadSize);
+    EXPECT_TRUE(st.st_mode & S_IXUSR);
+    EXPECT_FALSE(FileExists(kStagingPath));
+}
+
+// A corrupted payload is detected as its last block is written, and cannot be installed.
+TEST_F(TestOTAImageStagingFile, TestCorruptedPayload)
+{
+    constexpr uint64_t kPayloadSize = 100 * 1000;
+
+    uint8_t digest[Crypto::kSHA256_Hash_Length];
+    ASSERT_EQ(ComputePayloadDigest(kPayloadSize, digest), CHIP_NO_ERROR);
+
+    uint8_t headerBuffer[256];
+    MutableByteSpan header(headerBuffer);
+    ASSERT_EQ(EncodeImageHeader(kPayloadSize, OTAImageDigestType::kSha256, ByteSpan(digest), header), CHIP_NO_ERROR);
+
+    OTAImageStagingFile stagingFile;
+    ASSERT_EQ(stagingFile.Open(kStagingPath), CHIP_NO_ERROR);
+    EXPECT_EQ(StreamImage(stagingFile, header, kPayloadSize, kPayloadSize / 2), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    EXPECT_EQ(stagingFile.GetWrittenBytes(), kPayloadSize);
+    EXPECT_FALSE(stagingFile.IsVerified());
+    EXPECT_NE(stagingFile.Close(S_IRUSR | S_IWUSR), CHIP_NO_ERROR);
+    EXPECT_NE(stagingFile.Commit(kInstallPath), CHIP_NO_ERROR);
+
+    stagingFile.Abort();
+    EXPECT_FALSE(FileExists(kStagingPath));
+    EXPECT_FALSE(FileExists(kInstallPath));
+}
+
+// Truncated SHA-256 digests are verified, and data past the announced payload size is rejected.
+TEST_F(TestOTAImageStagingFile, TestTruncatedDigestAndOversizedPayload)
+{
+    constexpr uint64_t kPayloadSize = 3 * kBlockSize + 17;
+
+    uint8_t digest[Crypto::kSHA256_Hash_Length];
+    ASSERT_EQ(ComputePayloadDigest(kPayloadSize, digest), CHIP_NO_ERROR);
+
+    uint8_t headerBuffer[256];
+    MutableByteSpan header(headerBuffer);
+    ASSERT_EQ(EncodeImageHeader(kPayloadSize, OTAImageDigestType::kSha256_128, ByteSpan(digest, 16), header), CHIP_NO_ERROR);
+
+    OTAImageStagingFile stagingFile;
+    ASSERT_EQ(stagingFile.Open(kStagingPath), CHIP_NO_ERROR);
+    EXPECT_EQ(StreamImage(stagingFile, header, kPayloadSize), CHIP_NO_ERROR);
+    EXPECT_TRUE(stagingFile.IsVerified());
+
+    const uint8_t extra = 0;
+    EXPECT_NE(stagingFile.Write(ByteSpan(&extra, 1)), CHIP_NO_ERROR);
+
+    // An image announcing more data than it contains is never verified
+    header = MutableByteSpan(headerBuffer);
+    ASSERT_EQ(EncodeImageHeader(kPayloadSize + 1, OTAImageDigestType::kSha256_128, ByteSpan(digest, 16), header), CHIP_NO_ERROR);
+    ASSERT_EQ(stagingFile.Open(kStagingPath), CHIP_NO_ERROR);
+    EXPECT_EQ(StreamImage(stagingFile, header, kPayloadSize), CHIP_NO_ERROR);
+    EXPECT_FALSE(stagingFile.IsVerified());
+    EXPECT_NE(stagingFile.Close(S_IRUSR | S_IWUSR), CHIP_NO_ERROR);
+}
+
+} // namespace
@@ -6,8 +6,11 @@
 
 #include <protocols/bdx/BdxTransferSession.h>
 
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/TLV.h>
 #include <lib/support/BufferReader.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/TypeTraits.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <protocols/Protocols.h>
@@ -22,6 +25,67 @@
 namespace {
 constexpr uint8_t kBdxVersion = 0; ///< The version of this implementation of the BDX spec
 
+/// Vendor-specific metadata element of TransferInit and Accept messages, holding the number of Blocks in flight a node allows
+constexpr ::chip::TLV::Tag kBlocksInFlightTag = ::chip::TLV::ProfileTag(CHIP_CONFIG_BDX_BLOCKS_IN_FLIGHT_VENDOR_ID, 0, 1);
+constexpr size_t kBlocksInFlightElementMaxSize = 16;
+
+/**
+ * @brief
+ *   Copy the metadata of the application to a new buffer, and append the number of Blocks in flight to it.
+ */
+CHIP_ERROR AppendBlocksInFlight(const uint8_t * metadata, size_t metadataLength, uint8_t blocksInFlight,
+                                ::chip::Platform::ScopedMemoryBuffer<uint8_t> & buffer, size_t & length)
+{
+    VerifyOrReturnError(buffer.Alloc(metadataLength + kBlocksInFlightElementMaxSize), CHIP_ERROR_NO_MEMORY);
+    if (metadataLength > 0)
+    {
+        memcpy(buffer.Get(), metadata, metadataLength);
+    }
+
+    ::chip::TLV::TLVWriter writer;
+    writer.Init(buffer.Get() + metadataLength, kBlocksInFlightElementMaxSize);
+    ReturnErrorOnFailure(writer.Put(kBlocksInFlightTag, blocksInFlight));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    length = metadataLength + writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * @brief
+ *   Find the number of Blocks in flight advertised by the peer in the metadata of a TransferInit or Accept message. The element
+ *   is removed from the metadata passed on to the application when it is the last one, as appended by AppendBlocksInFlight().
+ *
+ * @return the number of Blocks in flight advertised by the peer, 1 if it did not advertise any.
+ */
+uint8_t TakeBlocksInFlight(const uint8_t * metadata, size_t & metadataLength)
+{
+    VerifyOrReturnValue(metadata != nullptr && metadataLength > 0, 1);
+
+    ::chip::TLV::TLVReader reader;
+    reader.Init(metadata, metadataLength);
+
+    while (true)
+    {
+        const size_t elementStart = reader.GetLengthRead();
+        VerifyOrReturnValue(reader.Next() == CHIP_NO_ERROR, 1);
+
+        if (reader.GetTag() == kBlocksInFlightTag)
+        {
+            uint8_t blocksInFlight;
+            VerifyOrReturnValue(reader.Get(blocksInFlight) == CHIP_NO_ERROR && blocksInFlight > 0, 1);
+            if (reader.Next() == CHIP_END_OF_TLV)
+            {
+                metadataLength = elementStart;
+            }
+            return blocksInFlight;
+        }
+
+        // Move to the end of the element, so that the read length is the start of the next one
+        VerifyOrReturnValue(reader.Skip() == CHIP_NO_ERROR, 1);
+    }
+}
+
 /**
  * @brief
  *   Allocate a new PacketBuffer and write data from a BDX message struct.
@@ -164,6 +228,14 @@ CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitD
     initMsg.Metadata           = initData.Metadata;
     initMsg.MetadataLength     = initData.MetadataLength;
 
+    Platform::ScopedMemoryBuffer<uint8_t> metadataBuffer;
+    if (mMaxBlocksInFlight > 1)
+    {
+        ReturnErrorOnFailure(AppendBlocksInFlight(initData.Metadata, initData.MetadataLength, mMaxBlocksInFlight, metadataBuffer,
+                                                  initMsg.MetadataLength));
+        initMsg.Metadata = metadataBuffer.Get();
+    }
+
     ReturnErrorOnFailure(WriteToPacketBuffer(initMsg, mPendingMsgHandle));
 
     const MessageType msgType = (mRole == TransferRole::kSender) ? MessageType::SendInit : MessageType::ReceiveInit;
@@ -197,6 +269,16 @@ CHIP_ERROR TransferSession::WaitForTransfer(TransferRole role, BitFlags<Transfer
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TransferSession::SetMaxBlocksInFlight(uint8_t maxBlocksInFlight)
+{
+    VerifyOrReturnError(mState == TransferState::kUnitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(maxBlocksInFlight > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mMaxBlocksInFlight = maxBlocksInFlight;
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData)
 {
     MessageType msgType;
@@ -213,6 +295,17 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
 
+    // Only a peer that advertised a number of Blocks in flight gets one back
+    const uint8_t * metadata = acceptData.Metadata;
+    size_t metadataLength    = acceptData.MetadataLength;
+    Platform::ScopedMemoryBuffer<uint8_t> metadataBuffer;
+    if (IsPipelined())
+    {
+        ReturnErrorOnFailure(AppendBlocksInFlight(acceptData.Metadata, acceptData.MetadataLength, mBlocksInFlightWindow,
+                                                  metadataBuffer, metadataLength));
+        metadata = metadataBuffer.Get();
+    }
+
     if (mRole == TransferRole::kSender)
     {
         mStartOffset    = acceptData.StartOffset;
@@ -224,8 +317,8 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.StartOffset    = acceptData.StartOffset;
         acceptMsg.Length         = acceptData.Length;
-        acceptMsg.Metadata       = acceptData.Metadata;
-        acceptMsg.MetadataLength = acceptData.MetadataLength;
+        acceptMsg.Metadata       = metadata;
+        acceptMsg.MetadataLength = metadataLength;
 
         ReturnErrorOnFailure(WriteToPacketBuffer(acceptMsg, mPendingMsgHandle));
         msgType = MessageType::ReceiveAccept;
@@ -241,8 +334,8 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
         acceptMsg.Version        = mTransferVersion;
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
-        acceptMsg.Metadata       = acceptData.Metadata;
-        acceptMsg.MetadataLength = acceptData.MetadataLength;
+        acceptMsg.Metadata       = metadata;
+        acceptMsg.MetadataLength = metadataLength;
 
         ReturnErrorOnFailure(WriteToPacketBuffer(acceptMsg, mPendingMsgHandle));
         msgType = MessageType::SendAccept;
@@ -284,7 +377,7 @@ CHIP_ERROR TransferSession::PrepareBlockQuery()
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(CanSendBlockQuery(), CHIP_ERROR_INCORRECT_STATE);
 
     BlockQuery queryMsg;
     queryMsg.BlockCounter = mNextQueryNum;
@@ -311,7 +404,7 @@ CHIP_ERROR TransferSession::PrepareBlockQueryWithSkip(const uint64_t & bytesToSk
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(CanSendBlockQuery(), CHIP_ERROR_INCORRECT_STATE);
 
     BlockQueryWithSkip queryMsg;
     queryMsg.BlockCounter = mNextQueryNum;
@@ -337,7 +430,7 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(CanSendBlock(), CHIP_ERROR_INCORRECT_STATE);
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
@@ -437,6 +530,11 @@ void TransferSession::Reset()
     mNextBlockNum      = 0;
     mLastQueryNum      = 0;
     mNextQueryNum      = 0;
+    mNextAckNum        = 0;
+    mNextExpectedNum   = 0;
+
+    mMaxBlocksInFlight    = 1;
+    mBlocksInFlightWindow = 1;
 
     mTimeout                = System::Clock::kZero;
     mTimeoutStartTime       = System::Clock::kZero;
@@ -559,7 +657,8 @@ void TransferSession::HandleTransferInit(MessageType msgType, System::PacketBuff
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
     ResolveTransferControlOptions(transferInit.TransferCtlOptions);
-    mTransferVersion      = ::chip::min(kBdxVersion, transferInit.Version);
+    mTransferVersion = ::chip::min(kBdxVersion, transferInit.Version);
+    NegotiateBlocksInFlightWindow(TakeBlocksInFlight(transferInit.Metadata, transferInit.MetadataLength));
     mTransferMaxBlockSize = ::chip::min(mMaxSupportedBlockSize, transferInit.MaxBlockSize);
 
     // Accept for now, they may be changed or rejected by the peer if this is a ReceiveInit
@@ -597,6 +696,7 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
 
     // Verify that Accept parameters are compatible with the original proposed parameters
     ReturnOnFailure(VerifyProposedMode(rcvAcceptMsg.TransferCtlFlags));
+    NegotiateBlocksInFlightWindow(TakeBlocksInFlight(rcvAcceptMsg.Metadata, rcvAcceptMsg.MetadataLength));
 
     mTransferMaxBlockSize = rcvAcceptMsg.MaxBlockSize;
     mStartOffset          = rcvAcceptMsg.StartOffset;
@@ -633,6 +733,7 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
 
     // Verify that Accept parameters are compatible with the original proposed parameters
     ReturnOnFailure(VerifyProposedMode(sendAcceptMsg.TransferCtlFlags));
+    NegotiateBlocksInFlightWindow(TakeBlocksInFlight(sendAcceptMsg.Metadata, sendAcceptMsg.MetadataLength));
 
     // Note: if VerifyProposedMode() returned with no error, then mControlMode must match the proposed mode in the SendAccept
     // message
@@ -659,19 +760,23 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockQuery(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    // A pipelining Receiver may have queried past the end of the file before receiving the BlockEOF
+    VerifyOrReturn(!IsPipelined() || mState != TransferState::kAwaitingEOFAck);
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mAwaitingResponse || IsPipelined(), PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockQuery query;
     const CHIP_ERROR err = query.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
-    VerifyOrReturn(query.BlockCounter == mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    const uint32_t expectedQueryNum = IsPipelined() ? mNextExpectedNum : mNextBlockNum;
+    VerifyOrReturn(query.BlockCounter == expectedQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
     mPendingOutput = OutputEventType::kQueryReceived;
 
     mAwaitingResponse = false;
     mLastQueryNum     = query.BlockCounter;
+    mNextExpectedNum  = query.BlockCounter + 1;
 
 #if CHIP_AUTOMATION_LOGGING
     query.LogMessage(MessageType::BlockQuery);
@@ -681,19 +786,23 @@ void TransferSession::HandleBlockQuery(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockQueryWithSkip(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    // A pipelining Receiver may have queried past the end of the file before receiving the BlockEOF
+    VerifyOrReturn(!IsPipelined() || mState != TransferState::kAwaitingEOFAck);
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mAwaitingResponse || IsPipelined(), PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockQueryWithSkip query;
     const CHIP_ERROR err = query.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
-    VerifyOrReturn(query.BlockCounter == mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    const uint32_t expectedQueryNum = IsPipelined() ? mNextExpectedNum : mNextBlockNum;
+    VerifyOrReturn(query.BlockCounter == expectedQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
     mPendingOutput = OutputEventType::kQueryWithSkipReceived;
 
     mAwaitingResponse        = false;
     mLastQueryNum            = query.BlockCounter;
+    mNextExpectedNum         = query.BlockCounter + 1;
     mBytesToSkip.BytesToSkip = query.BytesToSkip;
 
 #if CHIP_AUTOMATION_LOGGING
@@ -705,13 +814,13 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(CanReceiveBlock(), PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     Block blockMsg;
     const CHIP_ERROR err = blockMsg.Parse(msgData.Retain());
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
-    VerifyOrReturn(blockMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    VerifyOrReturn(blockMsg.BlockCounter == GetExpectedBlockNum(), PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn((blockMsg.DataLength > 0) && (blockMsg.DataLength <= mTransferMaxBlockSize),
                    PrepareStatusReport(StatusCode::kBadMessageContents));
 
@@ -730,9 +839,7 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     mPendingOutput    = OutputEventType::kBlockReceived;
 
     mNumBytesProcessed += blockMsg.DataLength;
-    mLastBlockNum = blockMsg.BlockCounter;
-
-    mAwaitingResponse = false;
+    OnBlockAccepted(blockMsg.BlockCounter);
 
 #if CHIP_AUTOMATION_LOGGING
     blockMsg.LogMessage(MessageType::Block);
@@ -743,13 +850,13 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(CanReceiveBlock(), PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockEOF blockEOFMsg;
     const CHIP_ERROR err = blockEOFMsg.Parse(msgData.Retain());
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
-    VerifyOrReturn(blockEOFMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    VerifyOrReturn(blockEOFMsg.BlockCounter == GetExpectedBlockNum(), PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn(blockEOFMsg.DataLength <= mTransferMaxBlockSize, PrepareStatusReport(StatusCode::kBadMessageContents));
 
     mBlockEventData.Data         = blockEOFMsg.Data;
@@ -761,7 +868,7 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
     mPendingOutput    = OutputEventType::kBlockReceived;
 
     mNumBytesProcessed += blockEOFMsg.DataLength;
-    mLastBlockNum = blockEOFMsg.BlockCounter;
+    OnBlockAccepted(blockEOFMsg.BlockCounter);
 
     mAwaitingResponse = false;
     mState            = TransferState::kReceivedEOF;
@@ -774,19 +881,35 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn((mState == TransferState::kTransferInProgress) || (IsPipelined() && mState == TransferState::kAwaitingEOFAck),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mAwaitingResponse || IsPipelined(), PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockAck ackMsg;
     const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
-    VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    if (IsPipelined())
+    {
+        VerifyOrReturn(ackMsg.BlockCounter < mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+        // BlockAcks are cumulative, so one that arrives after a later one (or twice) carries no news and is dropped.
+        VerifyOrReturn(ackMsg.BlockCounter >= mNextAckNum);
+        mNextAckNum = ackMsg.BlockCounter + 1;
+
+        // Blocks that preceded the BlockEOF may still be acknowledged, but only the BlockAckEOF matters by then.
+        VerifyOrReturn(mState == TransferState::kTransferInProgress);
+    }
+    else
+    {
+        VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    }
 
     mPendingOutput = OutputEventType::kAckReceived;
 
     // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
     // In this case, the Sender should wait to receive a BlockQuery next.
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+    mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive) || (IsPipelined() && mNextAckNum != mNextBlockNum);
 
 #if CHIP_AUTOMATION_LOGGING
     ackMsg.LogMessage(MessageType::BlockAck);
@@ -915,6 +1038,53 @@ bool TransferSession::IsTransferLengthDefinite() const
     return (mTransferLength > 0);
 }
 
+void TransferSession::NegotiateBlocksInFlightWindow(uint8_t peerMaxBlocksInFlight)
+{
+    mBlocksInFlightWindow = ::chip::min(mMaxBlocksInFlight, peerMaxBlocksInFlight);
+}
+
+bool TransferSession::CanSendBlock() const
+{
+    VerifyOrReturnValue(IsPipelined(), !mAwaitingResponse);
+
+    if (mControlMode == TransferControlFlags::kSenderDrive)
+    {
+        return (mNextBlockNum - mNextAckNum) < mBlocksInFlightWindow;
+    }
+
+    // In Receiver Drive, there must be a BlockQuery left to answer
+    return mNextBlockNum != mNextExpectedNum;
+}
+
+bool TransferSession::CanSendBlockQuery() const
+{
+    VerifyOrReturnValue(IsPipelined() && mControlMode == TransferControlFlags::kReceiverDrive, !mAwaitingResponse);
+
+    return (mNextQueryNum - mNextExpectedNum) < mBlocksInFlightWindow;
+}
+
+bool TransferSession::CanReceiveBlock() const
+{
+    VerifyOrReturnValue(IsPipelined(), mAwaitingResponse);
+
+    // In Sender Drive, Blocks may arrive before the previous ones were acknowledged
+    return (mControlMode == TransferControlFlags::kSenderDrive) || (mNextExpectedNum != mNextQueryNum);
+}
+
+uint32_t TransferSession::GetExpectedBlockNum() const
+{
+    return IsPipelined() ? mNextExpectedNum : mLastQueryNum;
+}
+
+void TransferSession::OnBlockAccepted(uint32_t blockCounter)
+{
+    mLastBlockNum     = blockCounter;
+    mNextExpectedNum  = blockCounter + 1;
+    // A pipelining Receiver in Receiver Drive keeps waiting for the Blocks it queried
+    mAwaitingResponse =
+        IsPipelined() && (mControlMode == TransferControlFlags::kReceiverDrive) && (mNextExpectedNum != mNextQueryNum);
+}
+
 const char * TransferSession::OutputEvent::ToString(OutputEventType outputEventType)
 {
     switch (outputEventType)
@@ -217,6 +217,33 @@ public:
     CHIP_ERROR WaitForTransfer(TransferRole role, BitFlags<TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
                                System::Clock::Timeout timeout);
 
+    /**
+     * @brief
+     *   Allow more than one Block (Sender Drive) or BlockQuery (Receiver Drive) to be outstanding at a time, so that the transfer
+     *   rate is no longer bounded by one round trip per Block. Must be called before StartTransfer() or WaitForTransfer().
+     *
+     *   Pipelining is only used if the peer also enables it. Both nodes advertise the number of Blocks they allow in flight with a
+     *   vendor-specific element appended to the metadata of the TransferInit and Accept messages (see
+     *   CHIP_CONFIG_BDX_BLOCKS_IN_FLIGHT_VENDOR_ID), which is removed from the metadata passed on to the application. The BDX
+     *   version stays 0. With any other peer, the transfer falls back to a single Block in flight; see GetBlocksInFlightWindow()
+     *   once the transfer has been accepted.
+     *
+     *   In a pipelined transfer:
+     *     - the Sender in Sender Drive may prepare Blocks until maxBlocksInFlight of them are not acknowledged. BlockAck messages
+     *       are cumulative: stale or duplicate ones are dropped without emitting kAckReceived.
+     *     - the Receiver in Receiver Drive may prepare BlockQuery and BlockQueryWithSkip messages until maxBlocksInFlight of them
+     *       are not answered. A skip applies after the Blocks already queried, so gaps can be requested without draining the
+     *       window. Queries still in flight when the Sender reaches the end of the file are dropped by the Sender.
+     *
+     *   Note that MRP allows a single unacknowledged message per exchange, so the window is only effective over transports that
+     *   do not use MRP, such as TCP.
+     *
+     * @param maxBlocksInFlight The number of Blocks or BlockQuery messages that may be outstanding. 1 disables pipelining.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if a transfer was already started, CHIP_ERROR_INVALID_ARGUMENT if maxBlocksInFlight is 0.
+     */
+    CHIP_ERROR SetMaxBlocksInFlight(uint8_t maxBlocksInFlight);
+
     /**
      * @brief
      *   Indicate that all transfer parameters are acceptable and prepare a SendAccept or ReceiveAccept message (depending on role).
@@ -319,6 +346,7 @@ public:
     uint32_t GetNextBlockNum() const { return mNextBlockNum; }
     uint32_t GetNextQueryNum() const { return mNextQueryNum; }
     size_t GetNumBytesProcessed() const { return mNumBytesProcessed; }
+    uint8_t GetBlocksInFlightWindow() const { return mBlocksInFlightWindow; }
     const uint8_t * GetFileDesignator(uint16_t & fileDesignatorLen) const
     {
         fileDesignatorLen = mTransferRequestData.FileDesLength;
@@ -370,6 +398,15 @@ private:
     void PrepareStatusReport(StatusCode code);
     bool IsTransferLengthDefinite() const;
 
+    // Pipelined transfer helpers. With a window of 1, these reduce to the lock-step checks on mAwaitingResponse.
+    void NegotiateBlocksInFlightWindow(uint8_t peerMaxBlocksInFlight);
+    bool IsPipelined() const { return mBlocksInFlightWindow > 1; }
+    bool CanSendBlock() const;
+    bool CanSendBlockQuery() const;
+    bool CanReceiveBlock() const;
+    uint32_t GetExpectedBlockNum() const;
+    void OnBlockAccepted(uint32_t blockCounter);
+
     OutputEventType mPendingOutput = OutputEventType::kNone;
     TransferState mState           = TransferState::kUnitialized;
     TransferRole mRole;
@@ -401,6 +438,14 @@ private:
     uint32_t mLastQueryNum = 0;
     uint32_t mNextQueryNum = 0;
 
+    // Pipelined transfers only: the oldest Block not acknowledged yet (Sender, Sender Drive), or the next Block (Receiver) or
+    // BlockQuery (Sender, Receiver Drive) counter expected from the peer.
+    uint32_t mNextAckNum      = 0;
+    uint32_t mNextExpectedNum = 0;
+
+    uint8_t mMaxBlocksInFlight    = 1; ///< Configured with SetMaxBlocksInFlight()
+    uint8_t mBlocksInFlightWindow = 1; ///< Agreed upon with the peer, 1 unless both sides support pipelining
+
     System::Clock::Timeout mTimeout            = System::Clock::kZero;
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
     bool mShouldInitTimeoutStart               = true;
@@ -1,12 +1,16 @@
 #include <string.h>
 
+#include <deque>
+
 #include <pw_unit_test/framework.h>
 
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/core/TLV.h>
 #include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <protocols/Protocols.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <protocols/bdx/BdxTransferSession.h>
@@ -24,6 +28,8 @@ constexpr System::Clock::Timestamp kNoAdvanceTime = System::Clock::kZero;
 
 const TLV::Tag tlvStrTag  = TLV::ContextTag(4);
 const TLV::Tag tlvListTag = TLV::ProfileTag(7777, 8888);
+
+constexpr uint16_t kPipelinedBlockSize = 32;
 } // anonymous namespace
 
 // Helper method for generating a complete TLV structure with a list containing a single tag and string
@@ -354,6 +360,163 @@ void SendAndVerifyBlockAck(TransferSession & ackReceiver, TransferSession & ackS
     VerifyNoMoreOutput(ackReceiver);
 }
 
+// Helper method for passing a BlockAck with an arbitrary Block counter to a Sender.
+void SendBlockAck(TransferSession & ackReceiver, uint32_t blockCounter)
+{
+    BlockAck ackMsg;
+    ackMsg.BlockCounter = blockCounter;
+
+    size_t msgSize = ackMsg.MessageSize();
+    Encoding::LittleEndian::PacketBufferWriter bbuf(System::PacketBufferHandle::New(msgSize));
+    ASSERT_FALSE(bbuf.IsNull());
+    ackMsg.WriteToBuffer(bbuf);
+
+    TransferSession::MessageTypeData typeData;
+    typeData.ProtocolId  = Protocols::BDX::Id;
+    typeData.MessageType = to_underlying(MessageType::BlockAck);
+    EXPECT_EQ(AttachHeaderAndSend(typeData, bbuf.Finalize(), ackReceiver), CHIP_NO_ERROR);
+}
+
+// Helper method for negotiating a transfer between an initiating Receiver and a responding Sender, each allowing the given number
+// of Blocks in flight.
+void StartPipelinedTransfer(TransferSession & initiatingReceiver, uint8_t receiverMaxBlocksInFlight,
+                            TransferSession & respondingSender, uint8_t senderMaxBlocksInFlight, TransferControlFlags driveMode)
+{
+    TransferSession::OutputEvent outEvent;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+
+    EXPECT_EQ(initiatingReceiver.SetMaxBlocksInFlight(receiverMaxBlocksInFlight), CHIP_NO_ERROR);
+    EXPECT_EQ(respondingSender.SetMaxBlocksInFlight(senderMaxBlocksInFlight), CHIP_NO_ERROR);
+
+    // ReceiveInit parameters
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = kPipelinedBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    // The application metadata must reach the peer unchanged, without the number of Blocks in flight
+    uint8_t tlvBuf[64]    = { 0 };
+    char metadataStr[11]  = { "hi_dad.txt" };
+    uint32_t bytesWritten = 0;
+    EXPECT_EQ(WriteTLVString(tlvBuf, sizeof(tlvBuf), metadataStr, bytesWritten), CHIP_NO_ERROR);
+    initOptions.Metadata       = tlvBuf;
+    initOptions.MetadataLength = bytesWritten;
+
+    BitFlags<TransferControlFlags> senderOpts;
+    senderOpts.Set(driveMode);
+
+    SendAndVerifyTransferInit(outEvent, timeout, initiatingReceiver, TransferRole::kReceiver, initOptions, respondingSender,
+                              senderOpts, kPipelinedBlockSize);
+    EXPECT_EQ(outEvent.transferInitData.MetadataLength, bytesWritten);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode    = respondingSender.GetControlMode();
+    acceptData.MaxBlockSize   = kPipelinedBlockSize;
+    acceptData.StartOffset    = 0;
+    acceptData.Length         = 0;
+    acceptData.Metadata       = tlvBuf;
+    acceptData.MetadataLength = bytesWritten;
+
+    SendAndVerifyAcceptMsg(outEvent, respondingSender, TransferRole::kSender, acceptData, initiatingReceiver, initOptions);
+    EXPECT_EQ(outEvent.transferAcceptData.MetadataLength, bytesWritten);
+}
+
+// Helper method for running a transfer of numBlocks Blocks once it was accepted, where every message takes oneWayLatency to reach
+// the other node. Both nodes act on their events immediately: the Sender prepares Blocks and the Receiver prepares BlockQuery
+// messages (in Receiver Drive) for as long as their TransferSession allows it. Returns the time the transfer took.
+System::Clock::Milliseconds64 RunTransferWithLatency(TransferSession & sender, TransferSession & receiver, uint32_t numBlocks,
+                                                     System::Clock::Milliseconds64 oneWayLatency)
+{
+    struct DelayedMessage
+    {
+        System::Clock::Timestamp deliveryTime;
+        TransferSession::MessageTypeData typeData;
+        System::PacketBufferHandle msg;
+        TransferSession * destination;
+    };
+
+    // All messages take the same time to arrive, so they are delivered in the order they were sent.
+    std::deque<DelayedMessage> inFlight;
+    System::Clock::Timestamp now            = System::Clock::kZero;
+    uint8_t blockData[kPipelinedBlockSize] = { 0 };
+    uint32_t numBlocksPrepared              = 0;
+    uint32_t numBlocksReceived              = 0;
+    bool transferDone                       = false;
+    bool failed                             = false;
+
+    auto processOutput = [&](TransferSession & node, TransferSession & peer) {
+        TransferSession::OutputEvent event;
+        for (node.PollOutput(event, now); !failed && event.EventType != TransferSession::OutputEventType::kNone;
+             node.PollOutput(event, now))
+        {
+            switch (event.EventType)
+            {
+            case TransferSession::OutputEventType::kMsgToSend:
+                inFlight.push_back({ now + oneWayLatency, event.msgTypeData, std::move(event.MsgData), &peer });
+                break;
+            case TransferSession::OutputEventType::kBlockReceived:
+                EXPECT_EQ(event.blockdata.BlockCounter, numBlocksReceived);
+                numBlocksReceived++;
+                if (event.blockdata.IsEof || node.GetControlMode() == TransferControlFlags::kSenderDrive)
+                {
+                    EXPECT_EQ(node.PrepareBlockAck(), CHIP_NO_ERROR);
+                }
+                break;
+            case TransferSession::OutputEventType::kQueryReceived:
+            case TransferSession::OutputEventType::kAckReceived:
+                break;
+            case TransferSession::OutputEventType::kAckEOFReceived:
+                transferDone = true;
+                break;
+            default:
+                ADD_FAILURE() << "Unexpected event " << event.ToString(event.EventType);
+                failed = true;
+                break;
+            }
+        }
+    };
+
+    auto runNodes = [&]() {
+        TransferSession::BlockData block;
+        block.Data   = blockData;
+        block.Length = sizeof(blockData);
+        block.IsEof  = (numBlocksPrepared + 1 == numBlocks);
+        while (numBlocksPrepared < numBlocks && sender.PrepareBlock(block) == CHIP_NO_ERROR)
+        {
+            processOutput(sender, receiver);
+            numBlocksPrepared++;
+            block.IsEof = (numBlocksPrepared + 1 == numBlocks);
+        }
+
+        while (receiver.GetControlMode() == TransferControlFlags::kReceiverDrive && receiver.PrepareBlockQuery() == CHIP_NO_ERROR)
+        {
+            processOutput(receiver, sender);
+        }
+    };
+
+    runNodes();
+    while (!transferDone && !failed && !inFlight.empty())
+    {
+        DelayedMessage message = std::move(inFlight.front());
+        inFlight.pop_front();
+        now = message.deliveryTime;
+
+        chip::PayloadHeader payloadHeader;
+        payloadHeader.SetMessageType(message.typeData.ProtocolId, message.typeData.MessageType);
+        EXPECT_EQ(message.destination->HandleMessageReceived(payloadHeader, std::move(message.msg), now), CHIP_NO_ERROR);
+
+        processOutput(*message.destination, (message.destination == &sender) ? receiver : sender);
+        runNodes();
+    }
+
+    EXPECT_TRUE(transferDone);
+    EXPECT_EQ(numBlocksReceived, numBlocks);
+
+    return now;
+}
+
 struct TestBdxTransferSession : public ::testing::Test
 {
     static void SetUpTestSuite() { EXPECT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
@@ -759,3 +922,148 @@ TEST_F(TestBdxTransferSession, TestRejectTransfer)
     // Reject the transfer with a status
     SendAndVerifyRejectMsg(outEvent, respondingSender, StatusCode::kResponderBusy, initiatingReceiver);
 }
+
+// Test that pipelined transfers keep several Blocks in flight in both drive modes, so that they are not bounded by one round trip
+// per Block like lock-step transfers.
+TEST_F(TestBdxTransferSession, TestPipelinedTransferThroughput)
+{
+    constexpr uint32_t kNumBlocks = 64;
+    constexpr System::Clock::Milliseconds64 kOneWayLatency(50);
+    constexpr uint8_t kMaxBlocksInFlight[] = { 1, 8 };
+
+    for (TransferControlFlags driveMode : { TransferControlFlags::kSenderDrive, TransferControlFlags::kReceiverDrive })
+    {
+        System::Clock::Milliseconds64 elapsed[ArraySize(kMaxBlocksInFlight)];
+
+        for (size_t i = 0; i < ArraySize(kMaxBlocksInFlight); i++)
+        {
+            TransferSession initiatingReceiver;
+            TransferSession respondingSender;
+
+            StartPipelinedTransfer(initiatingReceiver, kMaxBlocksInFlight[i], respondingSender, kMaxBlocksInFlight[i], driveMode);
+            EXPECT_EQ(initiatingReceiver.GetBlocksInFlightWindow(), kMaxBlocksInFlight[i]);
+            EXPECT_EQ(respondingSender.GetBlocksInFlightWindow(), kMaxBlocksInFlight[i]);
+
+            elapsed[i] = RunTransferWithLatency(respondingSender, initiatingReceiver, kNumBlocks, kOneWayLatency);
+        }
+
+        const char * driveModeStr = (driveMode == TransferControlFlags::kSenderDrive) ? "Sender" : "Receiver";
+        ChipLogProgress(BDX, "%s Drive: %u blocks with %u ms latency took %u ms lock-step, %u ms with %u blocks in flight",
+                        driveModeStr, static_cast<unsigned>(kNumBlocks), static_cast<unsigned>(kOneWayLatency.count()),
+                        static_cast<unsigned>(elapsed[0].count()), static_cast<unsigned>(elapsed[1].count()),
+                        static_cast<unsigned>(kMaxBlocksInFlight[1]));
+
+        // Lock-step transfers take (at least) one round trip per Block
+        EXPECT_GE(elapsed[0], kNumBlocks * 2 * kOneWayLatency);
+        EXPECT_LE(elapsed[1] * 4, elapsed[0]);
+    }
+}
+
+// Test that a pipelining node falls back to a single Block in flight with a peer that does not pipeline, whichever role it has.
+TEST_F(TestBdxTransferSession, TestPipelinedTransferLegacyPeer)
+{
+    constexpr uint32_t kNumBlocks = 16;
+    constexpr System::Clock::Milliseconds64 kOneWayLatency(50);
+
+    for (TransferControlFlags driveMode : { TransferControlFlags::kSenderDrive, TransferControlFlags::kReceiverDrive })
+    {
+        for (bool receiverPipelines : { true, false })
+        {
+            TransferSession initiatingReceiver;
+            TransferSession respondingSender;
+
+            StartPipelinedTransfer(initiatingReceiver, receiverPipelines ? 8 : 1, respondingSender, receiverPipelines ? 1 : 8,
+                                   driveMode);
+            EXPECT_EQ(initiatingReceiver.GetBlocksInFlightWindow(), 1);
+            EXPECT_EQ(respondingSender.GetBlocksInFlightWindow(), 1);
+
+            EXPECT_GE(RunTransferWithLatency(respondingSender, initiatingReceiver, kNumBlocks, kOneWayLatency),
+                      kNumBlocks * 2 * kOneWayLatency);
+        }
+    }
+}
+
+// Test that a pipelining node still advertises the only BDX version defined by the spec, and appends the number of Blocks in
+// flight to the metadata of the application.
+TEST_F(TestBdxTransferSession, TestPipelinedTransferVersion)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+
+    uint8_t tlvBuf[64]    = { 0 };
+    char metadataStr[11]  = { "hi_dad.txt" };
+    uint32_t bytesWritten = 0;
+    EXPECT_EQ(WriteTLVString(tlvBuf, sizeof(tlvBuf), metadataStr, bytesWritten), CHIP_NO_ERROR);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = TransferControlFlags::kReceiverDrive;
+    initOptions.MaxBlockSize     = kPipelinedBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+    initOptions.Metadata         = tlvBuf;
+    initOptions.MetadataLength   = bytesWritten;
+
+    EXPECT_EQ(initiatingReceiver.SetMaxBlocksInFlight(8), CHIP_NO_ERROR);
+    EXPECT_EQ(initiatingReceiver.StartTransfer(TransferRole::kReceiver, initOptions, System::Clock::Seconds16(24)), CHIP_NO_ERROR);
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, MessageType::ReceiveInit);
+
+    TransferInit transferInit;
+    ASSERT_EQ(transferInit.Parse(std::move(outEvent.MsgData)), CHIP_NO_ERROR);
+    EXPECT_EQ(transferInit.Version, 0);
+    ASSERT_GT(transferInit.MetadataLength, static_cast<size_t>(bytesWritten));
+    EXPECT_EQ(0, memcmp(transferInit.Metadata, tlvBuf, bytesWritten));
+}
+
+// Test that a pipelining Sender treats BlockAcks as cumulative: stale and duplicate ones are dropped, while one for a Block that
+// was never sent ends the transfer.
+TEST_F(TestBdxTransferSession, TestPipelinedTransferOutOfOrderAcks)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+    uint8_t fakeData[kPipelinedBlockSize] = { 0 };
+
+    StartPipelinedTransfer(initiatingReceiver, 4, respondingSender, 4, TransferControlFlags::kSenderDrive);
+
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeData;
+    blockData.Length = sizeof(fakeData);
+    blockData.IsEof  = false;
+
+    auto sendBlocks = [&](uint32_t count) {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(respondingSender.PrepareBlock(blockData), CHIP_NO_ERROR);
+            respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+            VerifyBdxMessageToSend(outEvent, MessageType::Block);
+        }
+
+        // The window is full
+        EXPECT_NE(respondingSender.PrepareBlock(blockData), CHIP_NO_ERROR);
+        VerifyNoMoreOutput(respondingSender);
+    };
+
+    // Blocks 0 to 3
+    sendBlocks(4);
+
+    // Acknowledging Block 2 also acknowledges the Blocks before it, which makes room for Blocks 4 to 6
+    SendBlockAck(respondingSender, 2);
+    respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kAckReceived);
+    sendBlocks(3);
+
+    // A BlockAck received out of order, and a duplicate one, are dropped
+    SendBlockAck(respondingSender, 1);
+    VerifyNoMoreOutput(respondingSender);
+    SendBlockAck(respondingSender, 2);
+    VerifyNoMoreOutput(respondingSender);
+    EXPECT_EQ(respondingSender.GetNextBlockNum(), 7u);
+
+    // A BlockAck for a Block that was not sent yet is an error
+    SendBlockAck(respondingSender, 7);
+    respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+    VerifyStatusReport(outEvent.MsgData, StatusCode::kBadBlockCounter);
+}
@@ -17,7 +17,10 @@
 
 #include <protocols/secure_channel/DefaultSessionResumptionStorage.h>
 
+#include <algorithm>
+
 #include <lib/support/Base64.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 
 namespace chip {
@@ -25,7 +28,12 @@ namespace chip {
 CHIP_ERROR DefaultSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                                                Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
 {
+    ReturnErrorOnFailure(LoadCache());
+    SlotIndex slot = FindSlot(node);
+    VerifyOrReturnError(slot != kInvalidSlot, CHIP_ERROR_KEY_NOT_FOUND);
     ReturnErrorOnFailure(LoadState(node, resumptionId, sharedSecret, peerCATs));
+    SetResumptionId(slot, resumptionId);
+    Touch(slot);
     return CHIP_NO_ERROR;
 }
 
@@ -42,6 +50,16 @@ CHIP_ERROR DefaultSessionResumptionStorage::FindByResumptionId(ConstResumptionId
 
 CHIP_ERROR DefaultSessionResumptionStorage::FindNodeByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node)
 {
+    ReturnErrorOnFailure(LoadCache());
+    SlotIndex slot = FindSlot(resumptionId);
+    if (slot != kInvalidSlot)
+    {
+        node = mCache[slot].mNode;
+        return CHIP_NO_ERROR;
+    }
+
+    // The link table only needs to be consulted while some entries loaded from storage have not learnt their resumption ID yet.
+    VerifyOrReturnError(HasUnknownResumptionIds(), CHIP_ERROR_KEY_NOT_FOUND);
     ReturnErrorOnFailure(LoadLink(resumptionId, node));
     return CHIP_NO_ERROR;
 }
@@ -49,123 +67,83 @@ CHIP_ERROR DefaultSessionResumptionStorage::FindNodeByResumptionId(ConstResumpti
 CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
                                                  const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
 {
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
+    ReturnErrorOnFailure(LoadCache());
 
-    for (size_t i = 0; i < index.mSize; ++i)
+    SlotIndex slot = FindSlot(node);
+    if (slot != kInvalidSlot)
     {
-        if (index.mNodes[i] == node)
+        // Node already exists in the index.  Save in place.
+        ResumptionIdStorage oldResumptionId;
+        // This follows the approach in Delete.  Removal of the old
+        // resumption-id-keyed link is best effort.  If we cannot load
+        // state to lookup the resumption ID for the key, the entry in
+        // the link table will be leaked.
+        CHIP_ERROR err = LookupResumptionId(slot, node, oldResumptionId);
+        if (err != CHIP_NO_ERROR)
         {
-            // Node already exists in the index.  Save in place.
-            CHIP_ERROR err = CHIP_NO_ERROR;
-            ResumptionIdStorage oldResumptionId;
-            Crypto::P256ECDHDerivedSecret oldSharedSecret;
-            CATValues oldPeerCATs;
-            // This follows the approach in Delete.  Removal of the old
-            // resumption-id-keyed link is best effort.  If we cannot load
-            // state to lookup the resumption ID for the key, the entry in
-            // the link table will be leaked.
-            err = LoadState(node, oldResumptionId, oldSharedSecret, oldPeerCATs);
+            ChipLogError(SecureChannel,
+                         "LoadState failed; unable to fully delete session resumption record for node " ChipLogFormatX64
+                         ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(node.GetNodeId()), err.Format());
+        }
+        else
+        {
+            err = DeleteLink(oldResumptionId);
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(SecureChannel,
-                             "LoadState failed; unable to fully delete session resumption record for node " ChipLogFormatX64
+                             "DeleteLink failed; unable to fully delete session resumption record for node " ChipLogFormatX64
                              ": %" CHIP_ERROR_FORMAT,
                              ChipLogValueX64(node.GetNodeId()), err.Format());
             }
-            else
-            {
-                err = DeleteLink(oldResumptionId);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(SecureChannel,
-                                 "DeleteLink failed; unable to fully delete session resumption record for node " ChipLogFormatX64
-                                 ": %" CHIP_ERROR_FORMAT,
-                                 ChipLogValueX64(node.GetNodeId()), err.Format());
-                }
-            }
-            ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
-            ReturnErrorOnFailure(SaveLink(resumptionId, node));
-            return CHIP_NO_ERROR;
         }
-    }
+        ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
+        ReturnErrorOnFailure(SaveLink(resumptionId, node));
+        SetResumptionId(slot, resumptionId);
+        Touch(slot);
 
-    if (index.mSize == CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE)
-    {
-        // TODO: implement LRU for resumption
-        ReturnErrorOnFailure(Delete(index.mNodes[0]));
-        ReturnErrorOnFailure(LoadIndex(index));
+        // The index is not otherwise written by in-place saves: write the recency order of this save and of earlier lookups
+        err = FlushIndex();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+        return CHIP_NO_ERROR;
     }
 
     ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
-    ReturnErrorOnFailure(SaveLink(resumptionId, node));
+    CHIP_ERROR err = SaveLink(resumptionId, node);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Best effort: the state is not reachable without the link and an index entry anyway
+        DeleteState(node);
+        return err;
+    }
 
-    index.mNodes[index.mSize++] = node;
-    ReturnErrorOnFailure(SaveIndex(index));
+    // The least recently used entry is only evicted once the new one is stored, so that a failed save does not lose it
+    slot = AllocateSlot();
+    if (slot == kInvalidSlot)
+    {
+        slot = LeastRecentlyUsedSlot();
+        DeleteEntryStorage(slot, mCache[slot].mNode);
+        ReleaseSlot(slot);
+    }
 
-    return CHIP_NO_ERROR;
+    OccupySlot(slot, node, resumptionId);
+    return SaveCachedIndex();
 }
 
 CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 {
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
+    ReturnErrorOnFailure(LoadCache());
 
-    ResumptionIdStorage resumptionId;
-    Crypto::P256ECDHDerivedSecret sharedSecret;
-    CATValues peerCATs;
-    CHIP_ERROR err = LoadState(node, resumptionId, sharedSecret, peerCATs);
-    if (err == CHIP_NO_ERROR)
-    {
-        err = DeleteLink(resumptionId);
-        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
-        {
-            ChipLogError(SecureChannel,
-                         "Unable to delete session resumption link for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                         ChipLogValueX64(node.GetNodeId()), err.Format());
-        }
-    }
-    else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
-    {
-        ChipLogError(SecureChannel,
-                     "Unable to load session resumption state during session deletion for node " ChipLogFormatX64
-                     ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
-    }
+    SlotIndex slot = FindSlot(node);
+    DeleteEntryStorage(slot, node);
 
-    err = DeleteState(node);
-    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    if (slot != kInvalidSlot)
     {
-        ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
-    }
-
-    bool found = false;
-    for (size_t i = 0; i < index.mSize; ++i)
-    {
-        if (found)
-        {
-            // index.mSize was decreased by 1 when found was set to true.
-            // So the (i+1)th element isn't out of bounds.
-            index.mNodes[i] = index.mNodes[i + 1];
-        }
-        else
-        {
-            if (index.mNodes[i] == node)
-            {
-                found = true;
-                if (i + 1 < index.mSize)
-                {
-                    index.mNodes[i] = index.mNodes[i + 1];
-                }
-                index.mSize -= 1;
-            }
-        }
-    }
-
-    if (found)
-    {
-        err = SaveIndex(index);
+        ReleaseSlot(slot);
+        CHIP_ERROR err = SaveCachedIndex();
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
@@ -173,9 +151,8 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
     }
     else
     {
-        ChipLogError(SecureChannel,
-                     "Unable to find session resumption state for node in index" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
+        ChipLogError(SecureChannel, "Unable to find session resumption state for node in index " ChipLogFormatX64,
+                     ChipLogValueX64(node.GetNodeId()));
     }
 
     return CHIP_NO_ERROR;
@@ -185,22 +162,16 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
 {
     CHIP_ERROR stickyErr = CHIP_NO_ERROR;
     size_t found         = 0;
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
-    size_t initialSize = index.mSize;
-    for (size_t i = 0; i < initialSize; ++i)
+    ReturnErrorOnFailure(LoadCache());
+    for (SlotIndex slot = 0; slot < kCacheSize; ++slot)
     {
         CHIP_ERROR err = CHIP_NO_ERROR;
-        size_t cur     = i - found;
-        size_t remain  = initialSize - i;
         ResumptionIdStorage resumptionId;
-        Crypto::P256ECDHDerivedSecret sharedSecret;
-        CATValues peerCATs;
-        if (index.mNodes[cur].GetFabricIndex() != fabricIndex)
+        if (!mCache[slot].mInUse || mCache[slot].mNode.GetFabricIndex() != fabricIndex)
         {
             continue;
         }
-        err       = LoadState(index.mNodes[cur], resumptionId, sharedSecret, peerCATs);
+        err       = LookupResumptionId(slot, mCache[slot].mNode, resumptionId);
         stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -220,7 +191,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
                          fabricIndex, err.Format());
             continue;
         }
-        err       = DeleteState(index.mNodes[cur]);
+        err       = DeleteState(mCache[slot].mNode);
         stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -231,16 +202,11 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
             continue;
         }
         ++found;
-        --remain;
-        if (remain)
-        {
-            memmove(&index.mNodes[cur], &index.mNodes[cur + 1], remain * sizeof(index.mNodes[0]));
-        }
+        ReleaseSlot(slot);
     }
     if (found)
     {
-        index.mSize -= found;
-        CHIP_ERROR err = SaveIndex(index);
+        CHIP_ERROR err = SaveCachedIndex();
         stickyErr      = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -254,4 +220,318 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
     return stickyErr;
 }
 
+CHIP_ERROR DefaultSessionResumptionStorage::FlushIndex()
+{
+    VerifyOrReturnError(mCacheLoaded && mIndexDirty, CHIP_NO_ERROR);
+    return SaveCachedIndex();
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::LoadCache()
+{
+    VerifyOrReturnError(!mCacheLoaded, CHIP_NO_ERROR);
+
+    SessionIndex index;
+    ReturnErrorOnFailure(LoadIndex(index));
+
+    for (auto & entry : mCache)
+    {
+        entry.mInUse             = false;
+        entry.mResumptionIdKnown = false;
+        entry.mLastUsed          = 0;
+    }
+
+    // The persisted index is ordered from least to most recently used.
+    for (size_t i = 0; i < index.mSize; ++i)
+    {
+        CacheEntry & entry       = mCache[i];
+        entry.mNode              = index.mNodes[i];
+        entry.mInUse             = true;
+        entry.mResumptionIdKnown = false;
+        entry.mLastUsed          = static_cast<uint32_t>(i + 1);
+    }
+
+    mUseCounter  = static_cast<uint32_t>(index.mSize);
+    mIndexDirty  = false;
+    mCacheLoaded = true;
+    RebuildBuckets();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::SaveCachedIndex()
+{
+    // Order the entries from least to most recently used so that recency survives a reload.
+    SlotIndex order[kCacheSize];
+    size_t count = 0;
+    for (SlotIndex slot = 0; slot < kCacheSize; ++slot)
+    {
+        if (!mCache[slot].mInUse)
+        {
+            continue;
+        }
+        size_t pos = count++;
+        while (pos > 0 && mCache[order[pos - 1]].mLastUsed > mCache[slot].mLastUsed)
+        {
+            order[pos] = order[pos - 1];
+            --pos;
+        }
+        order[pos] = slot;
+    }
+
+    SessionIndex index;
+    index.mSize = count;
+    for (size_t i = 0; i < count; ++i)
+    {
+        index.mNodes[i] = mCache[order[i]].mNode;
+    }
+
+    ReturnErrorOnFailure(SaveIndex(index));
+    mIndexDirty = false;
+    return CHIP_NO_ERROR;
+}
+
+DefaultSessionResumptionStorage::SlotIndex DefaultSessionResumptionStorage::FindSlot(const ScopedNodeId & node) const
+{
+    size_t bucket = Hash(node) % kBucketCount;
+    while (mNodeBuckets[bucket] != kInvalidSlot)
+    {
+        SlotIndex slot = mNodeBuckets[bucket];
+        if (mCache[slot].mInUse && mCache[slot].mNode == node)
+        {
+            return slot;
+        }
+        bucket = (bucket + 1) % kBucketCount;
+    }
+    return kInvalidSlot;
+}
+
+DefaultSessionResumptionStorage::SlotIndex DefaultSessionResumptionStorage::FindSlot(ConstResumptionIdView resumptionId) const
+{
+    size_t bucket = Hash(resumptionId) % kBucketCount;
+    while (mResumptionIdBuckets[bucket] != kInvalidSlot)
+    {
+        SlotIndex slot           = mResumptionIdBuckets[bucket];
+        const CacheEntry & entry = mCache[slot];
+        if (entry.mInUse && entry.mResumptionIdKnown &&
+            std::equal(entry.mResumptionId.begin(), entry.mResumptionId.end(), resumptionId.begin(), resumptionId.end()))
+        {
+            return slot;
+        }
+        bucket = (bucket + 1) % kBucketCount;
+    }
+    return kInvalidSlot;
+}
+
+DefaultSessionResumptionStorage::SlotIndex DefaultSessionResumptionStorage::AllocateSlot() const
+{
+    for (SlotIndex slot = 0; slot < kCacheSize; ++slot)
+    {
+        if (!mCache[slot].mInUse)
+        {
+            return slot;
+        }
+    }
+    return kInvalidSlot;
+}
+
+DefaultSessionResumptionStorage::SlotIndex DefaultSessionResumptionStorage::LeastRecentlyUsedSlot() const
+{
+    SlotIndex lru = kInvalidSlot;
+    for (SlotIndex slot = 0; slot < kCacheSize; ++slot)
+    {
+        if (mCache[slot].mInUse && (lru == kInvalidSlot || mCache[slot].mLastUsed < mCache[lru].mLastUsed))
+        {
+            lru = slot;
+        }
+    }
+    return lru;
+}
+
+bool DefaultSessionResumptionStorage::HasUnknownResumptionIds() const
+{
+    for (const auto & entry : mCache)
+    {
+        if (entry.mInUse && !entry.mResumptionIdKnown)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void DefaultSessionResumptionStorage::OccupySlot(SlotIndex slot, const ScopedNodeId & node, ConstResumptionIdView resumptionId)
+{
+    CacheEntry & entry       = mCache[slot];
+    entry.mNode              = node;
+    entry.mInUse             = true;
+    entry.mResumptionIdKnown = false;
+    InsertNodeBucket(slot);
+    SetResumptionId(slot, resumptionId);
+    Touch(slot);
+}
+
+void DefaultSessionResumptionStorage::ReleaseSlot(SlotIndex slot)
+{
+    mCache[slot].mInUse             = false;
+    mCache[slot].mResumptionIdKnown = false;
+    mIndexDirty                     = true;
+    // Linear probing does not support removal, so rebuild the tables. Removals are rare compared to lookups.
+    RebuildBuckets();
+}
+
+void DefaultSessionResumptionStorage::SetResumptionId(SlotIndex slot, ConstResumptionIdView resumptionId)
+{
+    CacheEntry & entry = mCache[slot];
+    if (entry.mResumptionIdKnown)
+    {
+        if (std::equal(entry.mResumptionId.begin(), entry.mResumptionId.end(), resumptionId.begin(), resumptionId.end()))
+        {
+            return;
+        }
+        std::copy(resumptionId.begin(), resumptionId.end(), entry.mResumptionId.begin());
+        RebuildBuckets();
+        return;
+    }
+
+    std::copy(resumptionId.begin(), resumptionId.end(), entry.mResumptionId.begin());
+    entry.mResumptionIdKnown = true;
+    InsertResumptionIdBucket(slot);
+}
+
+void DefaultSessionResumptionStorage::Touch(SlotIndex slot)
+{
+    if (mUseCounter != 0 && mCache[slot].mLastUsed == mUseCounter)
+    {
+        // Already the most recently used entry.
+        return;
+    }
+
+    if (mUseCounter == UINT32_MAX)
+    {
+        // Renumber entries by their current rank so the counter can keep growing.
+        uint32_t ranks[kCacheSize];
+        for (SlotIndex i = 0; i < kCacheSize; ++i)
+        {
+            ranks[i] = 0;
+            for (SlotIndex j = 0; j < kCacheSize; ++j)
+            {
+                if (mCache[i].mInUse && mCache[j].mInUse && mCache[j].mLastUsed <= mCache[i].mLastUsed)
+                {
+                    ++ranks[i];
+                }
+            }
+        }
+        mUseCounter = 0;
+        for (SlotIndex i = 0; i < kCacheSize; ++i)
+        {
+            mCache[i].mLastUsed = ranks[i];
+            mUseCounter         = std::max(mUseCounter, ranks[i]);
+        }
+    }
+
+    mCache[slot].mLastUsed = ++mUseCounter;
+    mIndexDirty            = true;
+}
+
+void DefaultSessionResumptionStorage::RebuildBuckets()
+{
+    std::fill(std::begin(mNodeBuckets), std::end(mNodeBuckets), kInvalidSlot);
+    std::fill(std::begin(mResumptionIdBuckets), std::end(mResumptionIdBuckets), kInvalidSlot);
+    for (SlotIndex slot = 0; slot < kCacheSize; ++slot)
+    {
+        if (!mCache[slot].mInUse)
+        {
+            continue;
+        }
+        InsertNodeBucket(slot);
+        if (mCache[slot].mResumptionIdKnown)
+        {
+            InsertResumptionIdBucket(slot);
+        }
+    }
+}
+
+void DefaultSessionResumptionStorage::InsertNodeBucket(SlotIndex slot)
+{
+    size_t bucket = Hash(mCache[slot].mNode) % kBucketCount;
+    while (mNodeBuckets[bucket] != kInvalidSlot)
+    {
+        bucket = (bucket + 1) % kBucketCount;
+    }
+    mNodeBuckets[bucket] = slot;
+}
+
+void DefaultSessionResumptionStorage::InsertResumptionIdBucket(SlotIndex slot)
+{
+    size_t bucket = Hash(mCache[slot].mResumptionId) % kBucketCount;
+    while (mResumptionIdBuckets[bucket] != kInvalidSlot)
+    {
+        bucket = (bucket + 1) % kBucketCount;
+    }
+    mResumptionIdBuckets[bucket] = slot;
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::LookupResumptionId(SlotIndex slot, const ScopedNodeId & node,
+                                                               ResumptionIdStorage & resumptionId)
+{
+    if (slot != kInvalidSlot && mCache[slot].mResumptionIdKnown)
+    {
+        resumptionId = mCache[slot].mResumptionId;
+        return CHIP_NO_ERROR;
+    }
+
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    return LoadState(node, resumptionId, sharedSecret, peerCATs);
+}
+
+void DefaultSessionResumptionStorage::DeleteEntryStorage(SlotIndex slot, const ScopedNodeId & node)
+{
+    ResumptionIdStorage resumptionId;
+    CHIP_ERROR err = LookupResumptionId(slot, node, resumptionId);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = DeleteLink(resumptionId);
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            ChipLogError(SecureChannel,
+                         "Unable to delete session resumption link for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(node.GetNodeId()), err.Format());
+        }
+    }
+    else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(SecureChannel,
+                     "Unable to load session resumption state during session deletion for node " ChipLogFormatX64
+                     ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(node.GetNodeId()), err.Format());
+    }
+
+    err = DeleteState(node);
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(node.GetNodeId()), err.Format());
+    }
+}
+
+size_t DefaultSessionResumptionStorage::Hash(const ScopedNodeId & node)
+{
+    // 64-bit mix (splitmix64 finalizer); node IDs are frequently sequential.
+    uint64_t value = node.GetNodeId() ^ (static_cast<uint64_t>(node.GetFabricIndex()) << 56);
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return static_cast<size_t>(value);
+}
+
+size_t DefaultSessionResumptionStorage::Hash(ConstResumptionIdView resumptionId)
+{
+    // Resumption IDs are random, so any of their bytes make a good hash.
+    const uint8_t * data = resumptionId.data();
+    return static_cast<size_t>(data[0]) | (static_cast<size_t>(data[1]) << 8) | (static_cast<size_t>(data[2]) << 16) |
+        (static_cast<size_t>(data[3]) << 24);
+}
+
 } // namespace chip
@@ -29,6 +29,14 @@ namespace chip {
  *   The implementation saves 2 maps:
  *     * <FabricIndex, PeerNodeId>   => <ResumptionId, ShareSecret, PeerCATs>
  *     * <ResumptionId>              => <FabricIndex, PeerNodeId>
+ *
+ *   The index of stored nodes is mirrored in RAM, together with hash tables over ScopedNodeId and ResumptionId, so lookups do
+ *   not need to read and scan the persisted index. Shared secrets are never cached. When the storage is full, the least recently
+ *   used entry is evicted. The persisted index keeps its original format and is written in least-to-most recently used order;
+ *   recency updates caused by lookups are batched and only written out with the next save or change to the index, or on
+ *   FlushIndex().
+ *
+ *   The in-memory index assumes that this object is the only writer of the index in the backing storage.
  */
 class DefaultSessionResumptionStorage : public SessionResumptionStorage
 {
@@ -53,7 +61,18 @@ public:
     CHIP_ERROR Delete(const ScopedNodeId & node);
     CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
 
+    /**
+     * Write the index to storage if lookups have changed the recency order since it was last written.
+     */
+    CHIP_ERROR FlushIndex();
+
 protected:
+    /**
+     * Drop the in-memory index, so that it is reloaded from storage on next use. Must be called when the backing storage is
+     * (re)initialized.
+     */
+    void InvalidateIndexCache() { mCacheLoaded = false; }
+
     CHIP_ERROR virtual SaveIndex(const SessionIndex & index) = 0;
     CHIP_ERROR virtual LoadIndex(SessionIndex & index)       = 0;
 
@@ -66,6 +85,57 @@ protected:
     CHIP_ERROR virtual LoadState(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)             = 0;
     CHIP_ERROR virtual DeleteState(const ScopedNodeId & node)                                                    = 0;
+
+private:
+    static constexpr size_t kCacheSize = CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE;
+    static_assert(kCacheSize < UINT16_MAX, "Session resumption cache size does not fit the slot index type");
+
+    using SlotIndex                         = uint16_t;
+    static constexpr SlotIndex kInvalidSlot = UINT16_MAX;
+
+    // Keep the hash tables at most half full so that linear probing stays short and always finds an empty bucket.
+    static constexpr size_t kBucketCount = 2 * kCacheSize;
+
+    struct CacheEntry
+    {
+        ScopedNodeId mNode;
+        ResumptionIdStorage mResumptionId;
+        uint32_t mLastUsed;
+        bool mInUse;
+        // Entries loaded from the persisted index learn their resumption ID lazily, on first state load.
+        bool mResumptionIdKnown;
+    };
+
+    CHIP_ERROR LoadCache();
+    CHIP_ERROR SaveCachedIndex();
+
+    SlotIndex FindSlot(const ScopedNodeId & node) const;
+    SlotIndex FindSlot(ConstResumptionIdView resumptionId) const;
+    SlotIndex AllocateSlot() const;
+    SlotIndex LeastRecentlyUsedSlot() const;
+    bool HasUnknownResumptionIds() const;
+
+    void OccupySlot(SlotIndex slot, const ScopedNodeId & node, ConstResumptionIdView resumptionId);
+    void ReleaseSlot(SlotIndex slot);
+    void SetResumptionId(SlotIndex slot, ConstResumptionIdView resumptionId);
+    void Touch(SlotIndex slot);
+
+    void RebuildBuckets();
+    void InsertNodeBucket(SlotIndex slot);
+    void InsertResumptionIdBucket(SlotIndex slot);
+
+    CHIP_ERROR LookupResumptionId(SlotIndex slot, const ScopedNodeId & node, ResumptionIdStorage & resumptionId);
+    void DeleteEntryStorage(SlotIndex slot, const ScopedNodeId & node);
+
+    static size_t Hash(const ScopedNodeId & node);
+    static size_t Hash(ConstResumptionIdView resumptionId);
+
+    CacheEntry mCache[kCacheSize];
+    SlotIndex mNodeBuckets[kBucketCount];
+    SlotIndex mResumptionIdBuckets[kBucketCount];
+    uint32_t mUseCounter = 0;
+    bool mCacheLoaded    = false;
+    bool mIndexDirty     = false;
 };
 
 } // namespace chip
@@ -61,9 +61,8 @@ TEST(TestDefaultSessionResumptionStorage, TestSave)
 
     // Verify behavior for over-fill.
     //
-    // Currently, DefaultSessionResumptionStorage replaces index 0.
-    // If more sophisticated LRU behavior is implemented, this test
-    // case should be modified to match.
+    // DefaultSessionResumptionStorage evicts the least recently used
+    // entry, which is index 0 since no entry has been looked up yet.
     {
         size_t last = ArraySize(vectors) - 1;
         EXPECT_EQ(
@@ -388,3 +387,263 @@ TEST(TestDefaultSessionResumptionStorage, TestDeleteAll)
         }
     }
 }
+
+TEST(TestDefaultSessionResumptionStorage, TestLRUEviction)
+{
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    chip::TestPersistentStorageDelegate storage;
+    sessionStorage.Init(&storage);
+    chip::Crypto::P256ECDHDerivedSecret sharedSecret;
+    struct
+    {
+        chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        chip::ScopedNodeId node;
+    } vectors[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE + 2];
+
+    sharedSecret.SetLength(sharedSecret.Capacity());
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(sharedSecret.Bytes(), sharedSecret.Length()), CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < ArraySize(vectors); ++i)
+    {
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(vectors[i].resumptionId.data(), vectors[i].resumptionId.size()), CHIP_NO_ERROR);
+        *vectors[i].resumptionId.data() = static_cast<uint8_t>(i);
+        vectors[i].node                 = chip::ScopedNodeId(static_cast<chip::NodeId>(i + 1), static_cast<chip::FabricIndex>(1));
+    }
+
+    // Fill storage.
+    for (size_t i = 0; i < CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE; ++i)
+    {
+        EXPECT_EQ(sessionStorage.Save(vectors[i].node, vectors[i].resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    }
+
+    // Use entry 0 by node and entry 1 by resumption ID, making entry 2 the least recently used one.
+    chip::ScopedNodeId outNode;
+    chip::SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+    chip::CATValues outCats;
+    EXPECT_EQ(sessionStorage.FindByScopedNodeId(vectors[0].node, outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+    EXPECT_EQ(sessionStorage.FindByResumptionId(vectors[1].resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+
+    // Over-fill twice: entries 2 and 3 get evicted.
+    for (size_t i = CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE; i < ArraySize(vectors); ++i)
+    {
+        EXPECT_EQ(sessionStorage.Save(vectors[i].node, vectors[i].resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    }
+
+    for (size_t i = 0; i < ArraySize(vectors); ++i)
+    {
+        bool evicted = (i == 2 || i == 3);
+        EXPECT_EQ(sessionStorage.FindByScopedNodeId(vectors[i].node, outResumptionId, outSharedSecret, outCats) == CHIP_NO_ERROR,
+                  !evicted);
+        EXPECT_EQ(sessionStorage.FindByResumptionId(vectors[i].resumptionId, outNode, outSharedSecret, outCats) == CHIP_NO_ERROR,
+                  !evicted);
+    }
+
+    // Verify the evicted entries did not leak state or link table entries.
+    for (size_t i = 2; i <= 3; ++i)
+    {
+        uint16_t size = 0;
+        EXPECT_EQ(storage.SyncGetKeyValue(chip::SimpleSessionResumptionStorage::GetStorageKey(vectors[i].node).KeyName(), nullptr,
+                                          size),
+                  CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        EXPECT_EQ(storage.SyncGetKeyValue(
+                      chip::SimpleSessionResumptionStorage::GetStorageKey(vectors[i].resumptionId).KeyName(), nullptr, size),
+                  CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    }
+}
+
+TEST(TestDefaultSessionResumptionStorage, TestDeferredIndexWrites)
+{
+    class IndexWriteCountingStorage : public chip::TestPersistentStorageDelegate
+    {
+    public:
+        CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+        {
+            if (strcmp(key, chip::DefaultStorageKeyAllocator::SessionResumptionIndex().KeyName()) == 0)
+            {
+                ++mIndexWrites;
+            }
+            return chip::TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+        }
+
+        size_t mIndexWrites = 0;
+    };
+
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    IndexWriteCountingStorage storage;
+    sessionStorage.Init(&storage);
+    chip::Crypto::P256ECDHDerivedSecret sharedSecret;
+    sharedSecret.SetLength(sharedSecret.Capacity());
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(sharedSecret.Bytes(), sharedSecret.Length()), CHIP_NO_ERROR);
+
+    chip::SessionResumptionStorage::ResumptionIdStorage resumptionIds[2];
+    chip::ScopedNodeId nodes[2] = { chip::ScopedNodeId(1, 1), chip::ScopedNodeId(2, 1) };
+    for (size_t i = 0; i < ArraySize(nodes); ++i)
+    {
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(resumptionIds[i].data(), resumptionIds[i].size()), CHIP_NO_ERROR);
+        EXPECT_EQ(sessionStorage.Save(nodes[i], resumptionIds[i], sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(storage.mIndexWrites, ArraySize(nodes));
+
+    // Lookups only change recency and must not write the index.
+    chip::SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+    chip::CATValues outCats;
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(sessionStorage.FindByScopedNodeId(nodes[0], outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(storage.mIndexWrites, ArraySize(nodes));
+
+    // The next save writes the pending recency order once.
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(resumptionIds[0].data(), resumptionIds[0].size()), CHIP_NO_ERROR);
+    EXPECT_EQ(sessionStorage.Save(nodes[0], resumptionIds[0], sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.mIndexWrites, ArraySize(nodes) + 1);
+    EXPECT_EQ(sessionStorage.Save(nodes[0], resumptionIds[0], sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.mIndexWrites, ArraySize(nodes) + 1);
+
+    // So does a flush.
+    EXPECT_EQ(sessionStorage.FindByScopedNodeId(nodes[1], outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+    EXPECT_EQ(sessionStorage.FlushIndex(), CHIP_NO_ERROR);
+    EXPECT_EQ(sessionStorage.FlushIndex(), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.mIndexWrites, ArraySize(nodes) + 2);
+
+    chip::DefaultSessionResumptionStorage::SessionIndex index;
+    EXPECT_EQ(sessionStorage.LoadIndex(index), CHIP_NO_ERROR);
+    EXPECT_EQ(index.mSize, ArraySize(nodes));
+    EXPECT_EQ(index.mNodes[0], nodes[0]);
+    EXPECT_EQ(index.mNodes[1], nodes[1]);
+}
+
+TEST(TestDefaultSessionResumptionStorage, TestFailedSaveKeepsEntries)
+{
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    chip::TestPersistentStorageDelegate storage;
+    sessionStorage.Init(&storage);
+    chip::Crypto::P256ECDHDerivedSecret sharedSecret;
+    struct
+    {
+        chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        chip::ScopedNodeId node;
+    } vectors[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE + 1];
+
+    sharedSecret.SetLength(sharedSecret.Capacity());
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(sharedSecret.Bytes(), sharedSecret.Length()), CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < ArraySize(vectors); ++i)
+    {
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(vectors[i].resumptionId.data(), vectors[i].resumptionId.size()), CHIP_NO_ERROR);
+        *vectors[i].resumptionId.data() = static_cast<uint8_t>(i);
+        vectors[i].node                 = chip::ScopedNodeId(static_cast<chip::NodeId>(i + 1), static_cast<chip::FabricIndex>(1));
+    }
+
+    // Fill storage.
+    for (size_t i = 0; i < CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE; ++i)
+    {
+        EXPECT_EQ(sessionStorage.Save(vectors[i].node, vectors[i].resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    }
+
+    // Saving a new entry fails, first on its state, then on its link: the least recently used entry must not be evicted.
+    auto & extra               = vectors[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+    const std::string stateKey = chip::SimpleSessionResumptionStorage::GetStorageKey(extra.node).KeyName();
+    const std::string linkKey  = chip::SimpleSessionResumptionStorage::GetStorageKey(extra.resumptionId).KeyName();
+    for (const std::string & poisonKey : { stateKey, linkKey })
+    {
+        storage.AddPoisonKey(poisonKey);
+        EXPECT_NE(sessionStorage.Save(extra.node, extra.resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+        storage.ClearPoisonKeys();
+
+        // Nothing of the failed entry is left behind
+        EXPECT_FALSE(storage.HasKey(stateKey));
+        EXPECT_FALSE(storage.HasKey(linkKey));
+    }
+
+    chip::ScopedNodeId outNode;
+    chip::SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+    chip::CATValues outCats;
+    for (size_t i = 0; i < CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE; ++i)
+    {
+        EXPECT_EQ(sessionStorage.FindByScopedNodeId(vectors[i].node, outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(sessionStorage.FindByResumptionId(vectors[i].resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(sessionStorage.FindByScopedNodeId(extra.node, outResumptionId, outSharedSecret, outCats), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+TEST(TestDefaultSessionResumptionStorage, TestStorageCompatibility)
+{
+    chip::TestPersistentStorageDelegate storage;
+    chip::Crypto::P256ECDHDerivedSecret sharedSecret;
+    sharedSecret.SetLength(sharedSecret.Capacity());
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(sharedSecret.Bytes(), sharedSecret.Length()), CHIP_NO_ERROR);
+
+    struct
+    {
+        chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        chip::ScopedNodeId node;
+    } vectors[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+
+    // Write records the way the persisted tables are laid out, bypassing the in-memory index.
+    {
+        chip::SimpleSessionResumptionStorage writer;
+        writer.Init(&storage);
+        chip::DefaultSessionResumptionStorage::SessionIndex index;
+        index.mSize = 0;
+        for (size_t i = 0; i < ArraySize(vectors); ++i)
+        {
+            EXPECT_EQ(chip::Crypto::DRBG_get_bytes(vectors[i].resumptionId.data(), vectors[i].resumptionId.size()),
+                      CHIP_NO_ERROR);
+            *vectors[i].resumptionId.data() = static_cast<uint8_t>(i);
+            vectors[i].node = chip::ScopedNodeId(static_cast<chip::NodeId>(i + 1), static_cast<chip::FabricIndex>(i % 3 + 1));
+            EXPECT_EQ(writer.SaveState(vectors[i].node, vectors[i].resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+            EXPECT_EQ(writer.SaveLink(vectors[i].resumptionId, vectors[i].node), CHIP_NO_ERROR);
+            index.mNodes[index.mSize++] = vectors[i].node;
+        }
+        EXPECT_EQ(writer.SaveIndex(index), CHIP_NO_ERROR);
+    }
+
+    // A fresh instance finds every record, by resumption ID before any node lookup.
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    sessionStorage.Init(&storage);
+    for (auto & vector : vectors)
+    {
+        chip::ScopedNodeId outNode;
+        chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+        chip::CATValues outCats;
+        EXPECT_EQ(sessionStorage.FindByResumptionId(vector.resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(outNode, vector.node);
+        EXPECT_EQ(memcmp(sharedSecret.ConstBytes(), outSharedSecret.ConstBytes(), sharedSecret.Length()), 0);
+    }
+
+    // Updates through the in-memory index are readable through the persisted tables.
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(vectors[0].resumptionId.data(), vectors[0].resumptionId.size()), CHIP_NO_ERROR);
+    EXPECT_EQ(sessionStorage.Save(vectors[0].node, vectors[0].resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    EXPECT_EQ(sessionStorage.Delete(vectors[1].node), CHIP_NO_ERROR);
+    EXPECT_EQ(sessionStorage.DeleteAll(3), CHIP_NO_ERROR);
+
+    chip::SimpleSessionResumptionStorage reader;
+    reader.Init(&storage);
+    chip::DefaultSessionResumptionStorage::SessionIndex index;
+    EXPECT_EQ(reader.LoadIndex(index), CHIP_NO_ERROR);
+    for (size_t i = 0; i < ArraySize(vectors); ++i)
+    {
+        bool deleted = (i == 1) || (vectors[i].node.GetFabricIndex() == 3);
+        bool indexed = false;
+        for (size_t j = 0; j < index.mSize; ++j)
+        {
+            indexed = indexed || (index.mNodes[j] == vectors[i].node);
+        }
+        EXPECT_EQ(indexed, !deleted);
+
+        chip::ScopedNodeId outNode;
+        EXPECT_EQ(reader.LoadLink(vectors[i].resumptionId, outNode) == CHIP_NO_ERROR, !deleted);
+        if (!deleted)
+        {
+            EXPECT_EQ(outNode, vectors[i].node);
+        }
+    }
+
+    // The most recently used entry is persisted last.
+    ASSERT_GT(index.mSize, 0u);
+    EXPECT_EQ(index.mNodes[index.mSize - 1], vectors[0].node);
+}
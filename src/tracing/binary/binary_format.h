@@ -0,0 +1,78 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+/// On-disk layout of binary trace files.
+///
+/// A file is a FileHeader followed by a stream of fixed-size Record
+/// entries, all in host byte order. Labels and groups are identified by
+/// the address of their (static) string; the first time an identifier is
+/// written, it is preceded by a kString record whose payload (`arg` bytes,
+/// no NUL terminator) immediately follows the record.
+///
+/// Timestamps are raw ticks of a cheap monotonic counter (the CPU timestamp
+/// counter where available). kClockSync records pair a tick value with the
+/// monotonic clock in nanoseconds so that readers can convert by
+/// interpolating between them.
+///
+/// Use `trace_to_json.py` in this directory to convert a file into the
+/// Chrome trace event format, which can be loaded in https://ui.perfetto.dev.
+
+inline constexpr uint32_t kFileMagic     = 0x4352544D; // "MTRC" read as little endian
+inline constexpr uint16_t kFormatVersion = 1;
+
+enum class RecordType : uint8_t
+{
+    kBegin     = 1, // scope started: label, group
+    kEnd       = 2, // scope ended: label, group
+    kInstant   = 3, // zero-duration event: label, group
+    kCounter   = 4, // counter increment: label
+    kString    = 5, // string definition: label is the id, arg the payload length
+    kDropped   = 6, // arg records were dropped by the thread since the last report
+    kClockSync = 7, // label is the monotonic clock in nanoseconds at tick `timestamp`
+};
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;
+};
+
+struct Record
+{
+    uint64_t timestamp; // ticks, see kClockSync
+    uint64_t label;
+    uint64_t group;
+    uint32_t arg;
+    uint16_t threadId;
+    RecordType type;
+    uint8_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 8, "File header layout must not change within a format version");
+static_assert(sizeof(Record) == 32, "Record layout must not change within a format version");
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,338 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/binary/binary_tracing.h>
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemError.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+namespace {
+
+static_assert((BinaryBackend::kRecordsPerThread & (BinaryBackend::kRecordsPerThread - 1)) == 0,
+              "Ring buffer size must be a power of two");
+
+constexpr auto kDrainInterval = std::chrono::milliseconds(10);
+
+std::atomic<uint32_t> gNextInstanceId{ 1 };
+
+/// Last buffer used by the current thread. Keyed by backend instance id
+/// (never reused) so that a destroyed backend cannot be matched.
+struct ThreadBufferCache
+{
+    uint32_t instanceId = 0;
+    void * buffer       = nullptr;
+};
+
+thread_local ThreadBufferCache tBufferCache;
+
+uint64_t MonotonicNanoseconds()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/// Reads the timestamp stored in records. Reading the clock through a syscall (or even
+/// the vDSO) dominates the cost of a record, so use the CPU counter when there is one;
+/// the drainer writes kClockSync records that map ticks back to nanoseconds.
+inline uint64_t ReadTicks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return MonotonicNanoseconds();
+#endif
+}
+
+} // namespace
+
+BinaryBackend::BinaryBackend() : mInstanceId(gNextInstanceId.fetch_add(1, std::memory_order_relaxed)) {}
+
+BinaryBackend::~BinaryBackend()
+{
+    CloseFile();
+
+    ThreadBuffer * buffer = mBuffers.exchange(nullptr);
+    while (buffer != nullptr)
+    {
+        ThreadBuffer * next = buffer->next;
+        delete buffer;
+        buffer = next;
+    }
+}
+
+CHIP_ERROR BinaryBackend::OpenFile(const char * path)
+{
+    CloseFile();
+
+    FILE * file = fopen(path, "wb");
+    if (file == nullptr)
+    {
+        return CHIP_ERROR_POSIX(errno);
+    }
+
+    const FileHeader header = { kFileMagic, kFormatVersion, static_cast<uint16_t>(sizeof(Record)) };
+    if (fwrite(&header, sizeof(header), 1, file) != 1)
+    {
+        fclose(file);
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    // Discard anything left over from a previous recording session
+    for (ThreadBuffer * buffer = mBuffers.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->next)
+    {
+        buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mDrainMutex);
+        mOutputFile  = file;
+        mStopDrainer = false;
+        mWrittenStrings.clear();
+        WriteClockSync();
+    }
+
+    mDrainer = std::thread(&BinaryBackend::DrainerLoop, this);
+    mRecording.store(true, std::memory_order_release);
+
+    return CHIP_NO_ERROR;
+}
+
+void BinaryBackend::CloseFile()
+{
+    mRecording.store(false, std::memory_order_release);
+
+    if (mDrainer.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mDrainMutex);
+            mStopDrainer = true;
+        }
+        mDrainWakeup.notify_one();
+        mDrainer.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mDrainMutex);
+    VerifyOrReturn(mOutputFile != nullptr);
+
+    DrainLocked();
+    fclose(mOutputFile);
+    mOutputFile = nullptr;
+    mWrittenStrings.clear();
+}
+
+void BinaryBackend::Flush()
+{
+    std::lock_guard<std::mutex> lock(mDrainMutex);
+    VerifyOrReturn(mOutputFile != nullptr);
+
+    DrainLocked();
+    fflush(mOutputFile);
+}
+
+void BinaryBackend::TraceBegin(const char * label, const char * group)
+{
+    Append(RecordType::kBegin, label, group);
+}
+
+void BinaryBackend::TraceEnd(const char * label, const char * group)
+{
+    Append(RecordType::kEnd, label, group);
+}
+
+void BinaryBackend::TraceInstant(const char * label, const char * group)
+{
+    Append(RecordType::kInstant, label, group);
+}
+
+void BinaryBackend::TraceCounter(const char * label)
+{
+    Append(RecordType::kCounter, label, nullptr);
+}
+
+void BinaryBackend::Append(RecordType type, const char * label, const char * group)
+{
+    VerifyOrReturn(mRecording.load(std::memory_order_relaxed));
+
+    ThreadBuffer * buffer = CurrentThreadBuffer();
+    VerifyOrReturn(buffer != nullptr);
+
+    const uint32_t head = buffer->head.load(std::memory_order_relaxed);
+    const uint32_t used = head - buffer->tail.load(std::memory_order_acquire);
+    if (used >= kRecordsPerThread)
+    {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        mDroppedTotal.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Record & record  = buffer->records[head & (kRecordsPerThread - 1)];
+    record.timestamp = ReadTicks();
+    record.label     = reinterpret_cast<uintptr_t>(label);
+    record.group     = reinterpret_cast<uintptr_t>(group);
+    record.arg       = 0;
+    record.threadId  = buffer->threadId;
+    record.type      = type;
+    record.reserved  = 0;
+    buffer->head.store(head + 1, std::memory_order_release);
+
+    // Wake the drainer early (once per half buffer) on bursts
+    if (used == kRecordsPerThread / 2)
+    {
+        mDrainWakeup.notify_one();
+    }
+}
+
+BinaryBackend::ThreadBuffer * BinaryBackend::CurrentThreadBuffer()
+{
+    if (tBufferCache.instanceId == mInstanceId)
+    {
+        return static_cast<ThreadBuffer *>(tBufferCache.buffer);
+    }
+
+    ThreadBuffer * buffer = AcquireThreadBuffer();
+    if (buffer != nullptr)
+    {
+        tBufferCache.instanceId = mInstanceId;
+        tBufferCache.buffer     = buffer;
+    }
+    return buffer;
+}
+
+BinaryBackend::ThreadBuffer * BinaryBackend::AcquireThreadBuffer()
+{
+    const std::thread::id self = std::this_thread::get_id();
+
+    // The thread may have used this backend before and since switched to another one
+    for (ThreadBuffer * buffer = mBuffers.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->next)
+    {
+        if (buffer->owner == self)
+        {
+            return buffer;
+        }
+    }
+
+    ThreadBuffer * buffer = new (std::nothrow) ThreadBuffer();
+    VerifyOrReturnValue(buffer != nullptr, nullptr);
+
+    buffer->owner    = self;
+    buffer->threadId = mNextThreadId.fetch_add(1, std::memory_order_relaxed);
+    buffer->next     = mBuffers.load(std::memory_order_relaxed);
+    while (!mBuffers.compare_exchange_weak(buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+    return buffer;
+}
+
+void BinaryBackend::DrainerLoop()
+{
+    std::unique_lock<std::mutex> lock(mDrainMutex);
+    while (!mStopDrainer)
+    {
+        mDrainWakeup.wait_for(lock, kDrainInterval, [this] { return mStopDrainer; });
+        DrainLocked();
+    }
+}
+
+void BinaryBackend::DrainLocked()
+{
+    VerifyOrReturn(mOutputFile != nullptr);
+
+    bool written = false;
+    for (ThreadBuffer * buffer = mBuffers.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->next)
+    {
+        const uint32_t head = buffer->head.load(std::memory_order_acquire);
+        uint32_t tail       = buffer->tail.load(std::memory_order_relaxed);
+
+        for (; tail != head; tail++)
+        {
+            const Record & record = buffer->records[tail & (kRecordsPerThread - 1)];
+            WriteString(reinterpret_cast<const char *>(static_cast<uintptr_t>(record.label)));
+            WriteString(reinterpret_cast<const char *>(static_cast<uintptr_t>(record.group)));
+            WriteRecord(record);
+        }
+        written = written || (tail != buffer->tail.load(std::memory_order_relaxed));
+        buffer->tail.store(tail, std::memory_order_release);
+
+        const uint32_t dropped = buffer->dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0)
+        {
+            Record record    = {};
+            record.timestamp = ReadTicks();
+            record.arg       = dropped;
+            record.threadId  = buffer->threadId;
+            record.type      = RecordType::kDropped;
+            WriteRecord(record);
+            written = true;
+        }
+    }
+
+    // Bound the drained records with a tick to nanosecond mapping
+    if (written)
+    {
+        WriteClockSync();
+    }
+}
+
+void BinaryBackend::WriteClockSync()
+{
+    Record record    = {};
+    record.timestamp = ReadTicks();
+    record.label     = MonotonicNanoseconds();
+    record.type      = RecordType::kClockSync;
+    WriteRecord(record);
+}
+
+void BinaryBackend::WriteString(const char * str)
+{
+    VerifyOrReturn(str != nullptr);
+    VerifyOrReturn(mWrittenStrings.insert(str).second);
+
+    const size_t length = strlen(str);
+    Record record       = {};
+    record.label        = reinterpret_cast<uintptr_t>(str);
+    record.arg          = static_cast<uint32_t>(length);
+    record.type         = RecordType::kString;
+    WriteRecord(record);
+    fwrite(str, 1, length, mOutputFile);
+}
+
+void BinaryBackend::WriteRecord(const Record & record)
+{
+    fwrite(&record, sizeof(record), 1, mOutputFile);
+}
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,114 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <tracing/backend.h>
+#include <tracing/binary/binary_format.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+/// A Backend that records fixed-size binary records into per-thread
+/// lock-free ring buffers and writes them to a file from a background
+/// drainer thread.
+///
+/// Tracing calls do no formatting, allocation or locking once a thread has
+/// its buffer: they only take a timestamp and copy a record. If a thread
+/// produces records faster than they are drained, new records are dropped
+/// and the drop count is reported in the output.
+///
+/// THREAD SAFETY:
+///    Trace* methods may be called from any thread. OpenFile/CloseFile/Flush
+///    must not be called concurrently with each other.
+class BinaryBackend : public ::chip::Tracing::Backend
+{
+public:
+    /// Number of records each tracing thread can buffer (power of two).
+    static constexpr uint32_t kRecordsPerThread = 4096;
+
+    BinaryBackend();
+    ~BinaryBackend();
+
+    // Start tracing output to the given file
+    CHIP_ERROR OpenFile(const char * path);
+
+    // Stop tracing and close the output file if one is open
+    void CloseFile();
+
+    // Synchronously write all buffered records to the output file
+    void Flush();
+
+    // Total number of records dropped because a thread buffer was full
+    uint64_t DroppedRecords() const { return mDroppedTotal.load(std::memory_order_relaxed); }
+
+    void TraceBegin(const char * label, const char * group) override;
+    void TraceEnd(const char * label, const char * group) override;
+    void TraceInstant(const char * label, const char * group) override;
+    void TraceCounter(const char * label) override;
+    void Close() override { CloseFile(); }
+
+private:
+    /// Single-producer (the owning thread), single-consumer (the drainer) ring.
+    struct ThreadBuffer
+    {
+        std::array<Record, kRecordsPerThread> records;
+        std::atomic<uint32_t> head{ 0 }; // written by the owning thread only
+        std::atomic<uint32_t> tail{ 0 }; // written by the drainer only
+        std::atomic<uint32_t> dropped{ 0 };
+        std::thread::id owner;
+        uint16_t threadId   = 0;
+        ThreadBuffer * next = nullptr;
+    };
+
+    void Append(RecordType type, const char * label, const char * group);
+    ThreadBuffer * CurrentThreadBuffer();
+    ThreadBuffer * AcquireThreadBuffer();
+
+    void DrainerLoop();
+    void DrainLocked();
+    void WriteString(const char * str);
+    void WriteClockSync();
+    void WriteRecord(const Record & record);
+
+    const uint32_t mInstanceId;
+    std::atomic<bool> mRecording{ false };
+    std::atomic<ThreadBuffer *> mBuffers{ nullptr };
+    std::atomic<uint16_t> mNextThreadId{ 1 };
+    std::atomic<uint64_t> mDroppedTotal{ 0 };
+
+    // Drainer state, protected by mDrainMutex
+    std::mutex mDrainMutex;
+    std::condition_variable mDrainWakeup;
+    std::thread mDrainer;
+    bool mStopDrainer  = false;
+    FILE * mOutputFile = nullptr;
+    std::unordered_set<const char *> mWrittenStrings;
+};
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
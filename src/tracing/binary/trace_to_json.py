@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Project CHIP Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Convert a binary trace (see binary_format.h) to the Chrome trace event format.
+
+Traces are written in host byte order; little endian hosts are assumed.
+
+The output can be loaded in https://ui.perfetto.dev or chrome://tracing.
+"""
+
+import argparse
+import bisect
+import json
+import struct
+import sys
+
+FILE_MAGIC = 0x4352544D
+FORMAT_VERSION = 1
+
+HEADER = struct.Struct('<IHH')
+RECORD = struct.Struct('<QQQIHBB')
+
+BEGIN, END, INSTANT, COUNTER, STRING, DROPPED, CLOCK_SYNC = range(1, 8)
+
+
+def read_records(data):
+    magic, version, record_size = HEADER.unpack_from(data, 0)
+    if magic != FILE_MAGIC:
+        raise ValueError('Not a binary trace file (bad magic 0x%08X)' % magic)
+    if version != FORMAT_VERSION or record_size != RECORD.size:
+        raise ValueError('Unsupported trace format version %d (record size %d)' % (version, record_size))
+
+    offset = HEADER.size
+    while offset + RECORD.size <= len(data):
+        record = RECORD.unpack_from(data, offset)
+        offset += RECORD.size
+
+        payload = None
+        if record[5] == STRING:
+            payload = data[offset:offset + record[3]].decode('utf-8', errors='replace')
+            offset += record[3]
+        yield record, payload
+
+
+class TickConverter:
+    """Maps raw record ticks to nanoseconds using the CLOCK_SYNC records."""
+
+    def __init__(self, syncs):
+        self.syncs = sorted(syncs)
+        self.ticks = [t for t, _ in self.syncs]
+
+    def to_ns(self, ticks):
+        if len(self.syncs) < 2:
+            # No rate information: assume ticks are nanoseconds
+            return ticks - self.ticks[0] + self.syncs[0][1] if self.syncs else ticks
+
+        # Interpolate (or extrapolate at the ends) between the surrounding sync points
+        i = min(max(bisect.bisect_right(self.ticks, ticks), 1), len(self.syncs) - 1)
+        (t0, ns0), (t1, ns1) = self.syncs[i - 1], self.syncs[i]
+        if t1 == t0:
+            return ns0
+        return ns0 + (ticks - t0) * (ns1 - ns0) / (t1 - t0)
+
+
+def convert(data):
+    strings = {0: ''}
+    counters = {}
+    events = []
+
+    records = []
+    syncs = []
+    for record, payload in read_records(data):
+        timestamp, label, kind = record[0], record[1], record[5]
+        if kind == STRING:
+            strings[label] = payload
+        elif kind == CLOCK_SYNC:
+            syncs.append((timestamp, label))
+        else:
+            records.append(record)
+
+    clock = TickConverter(syncs)
+    start = clock.to_ns(min(r[0] for r in records)) if records else 0
+
+    for timestamp, label, group, arg, thread, kind, _ in records:
+        event = {'pid': 1, 'tid': thread, 'ts': (clock.to_ns(timestamp) - start) / 1000.0}
+
+        if kind in (BEGIN, END, INSTANT):
+            event.update(name=strings.get(label, hex(label)), cat=strings.get(group, hex(group)))
+            event['ph'] = {BEGIN: 'B', END: 'E', INSTANT: 'i'}[kind]
+            if kind == INSTANT:
+                event['s'] = 't'
+        elif kind == COUNTER:
+            name = strings.get(label, hex(label))
+            counters[name] = counters.get(name, 0) + 1
+            event.update(name=name, ph='C', args={'value': counters[name]})
+        elif kind == DROPPED:
+            event.update(name='Dropped records', cat='Tracing', ph='i', s='t', args={'count': arg})
+        else:
+            continue
+
+        events.append(event)
+
+    # Records are grouped per thread in the file; viewers expect time order
+    events.sort(key=lambda e: e['ts'])
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('input', help='binary trace file')
+    parser.add_argument('output', nargs='?', help='output json file (default: stdout)')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        trace = convert(f.read())
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
@@ -78,5 +78,17 @@ constexpr MetricKey kMetricDeviceRMPRetryCount = "core_dev_rmp_retry_count";
 // Subscription setup
 constexpr MetricKey kMetricDeviceSubscriptionSetup = "core_dev_subscription_setup";
 
+// Delay chosen by the resubscription coordinator before a resubscription attempt
+constexpr MetricKey kMetricResubscriptionDelay = "core_resub_delay";
+
+// Resubscription attempts waiting for admission by the resubscription coordinator
+constexpr MetricKey kMetricResubscriptionQueued = "core_resub_queued";
+
+// Resubscription attempts in progress
+constexpr MetricKey kMetricResubscriptionInProgress = "core_resub_in_progress";
+
+// Admitted resubscription attempt that can reuse a CASE session (1) or needs a new one (0)
+constexpr MetricKey kMetricResubscriptionSessionReuse = "core_resub_session_reuse";
+
 } // namespace Tracing
 } // namespace chip
@@ -0,0 +1,230 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <tracing/binary/binary_tracing.h>
+#include <tracing/macros.h>
+#include <tracing/registry.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Binary;
+
+namespace {
+
+/// A decoded trace file: string-resolved events, in file order
+struct DecodedTrace
+{
+    std::vector<std::string> events;
+    std::map<uint16_t, size_t> eventsPerThread;
+    uint64_t dropped    = 0;
+    size_t clockSyncs   = 0;
+    uint64_t lastSyncNs = 0;
+};
+
+std::string TempTracePath()
+{
+    char path[] = "/tmp/matter_binary_trace_XXXXXX";
+    int fd      = mkstemp(path);
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    return path;
+}
+
+bool DecodeTrace(const std::string & path, DecodedTrace & trace)
+{
+    FILE * file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    FileHeader header;
+    bool ok = (fread(&header, sizeof(header), 1, file) == 1) && (header.magic == kFileMagic) &&
+        (header.version == kFormatVersion) && (header.recordSize == sizeof(Record));
+
+    std::map<uint64_t, std::string> strings = { { 0, "" } };
+    Record record;
+    while (ok && fread(&record, sizeof(record), 1, file) == 1)
+    {
+        switch (record.type)
+        {
+        case RecordType::kString: {
+            std::string value(record.arg, '\0');
+            ok = (fread(&value[0], 1, record.arg, file) == record.arg);
+            strings[record.label] = value;
+            break;
+        }
+        case RecordType::kBegin:
+        case RecordType::kEnd:
+        case RecordType::kInstant:
+        case RecordType::kCounter: {
+            static const char * const kNames[] = { "", "BEGIN", "END", "INSTANT", "COUNTER" };
+            ok = (strings.count(record.label) == 1) && (strings.count(record.group) == 1);
+            trace.events.push_back(std::string(kNames[static_cast<int>(record.type)]) + ":" + strings[record.group] + ":" +
+                                   strings[record.label]);
+            trace.eventsPerThread[record.threadId]++;
+            break;
+        }
+        case RecordType::kDropped:
+            trace.dropped += record.arg;
+            break;
+        case RecordType::kClockSync:
+            ok = (record.label >= trace.lastSyncNs);
+            trace.lastSyncNs = record.label;
+            trace.clockSyncs++;
+            break;
+        default:
+            ok = false;
+            break;
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+TEST(TestBinaryTracing, TestRoundTrip)
+{
+    const std::string path = TempTracePath();
+    BinaryBackend backend;
+
+    ASSERT_EQ(backend.OpenFile(path.c_str()), CHIP_NO_ERROR);
+    {
+        ScopedRegistration scope(backend);
+
+        MATTER_TRACE_SCOPE("A", "Group");
+        {
+            MATTER_TRACE_SCOPE("B", "Group");
+            MATTER_TRACE_INSTANT("FOO", "Group");
+        }
+        MATTER_TRACE_COUNTER("Counter");
+        MATTER_TRACE_COUNTER("Counter");
+    }
+    // Unregistering closes the file
+
+    DecodedTrace trace;
+    ASSERT_TRUE(DecodeTrace(path, trace));
+
+    std::vector<std::string> expected = {
+        "BEGIN:Group:A",    "BEGIN:Group:B",    "INSTANT:Group:FOO", "END:Group:B",
+        "COUNTER::Counter", "COUNTER::Counter", "END:Group:A",
+    };
+    EXPECT_EQ(trace.events, expected);
+    EXPECT_EQ(trace.dropped, 0u);
+    EXPECT_GE(trace.clockSyncs, 2u); // recorded events are bracketed by clock syncs
+    EXPECT_EQ(backend.DroppedRecords(), 0u);
+
+    remove(path.c_str());
+}
+
+TEST(TestBinaryTracing, TestMultipleThreads)
+{
+    constexpr int kThreads         = 4;
+    constexpr int kScopesPerThread = 1000;
+    const std::string path         = TempTracePath();
+    BinaryBackend backend;
+    std::atomic<int> finished{ 0 };
+
+    ASSERT_EQ(backend.OpenFile(path.c_str()), CHIP_NO_ERROR);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; i++)
+    {
+        threads.emplace_back([&backend, &finished] {
+            for (int j = 0; j < kScopesPerThread; j++)
+            {
+                backend.TraceBegin("Work", "Thread");
+                backend.TraceEnd("Work", "Thread");
+            }
+
+            // Keep all threads alive until every one has traced, so none can inherit another's buffer
+            finished++;
+            while (finished.load() < kThreads)
+            {
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    backend.CloseFile();
+
+    DecodedTrace trace;
+    ASSERT_TRUE(DecodeTrace(path, trace));
+
+    // Every thread gets its own buffer; anything not recorded is accounted for as dropped
+    EXPECT_EQ(trace.eventsPerThread.size(), static_cast<size_t>(kThreads));
+    EXPECT_EQ(trace.events.size() + trace.dropped, static_cast<size_t>(kThreads * kScopesPerThread * 2));
+    EXPECT_EQ(trace.dropped, backend.DroppedRecords());
+
+    remove(path.c_str());
+}
+
+TEST(TestBinaryTracing, TestScopeCost)
+{
+    // Cost of a MATTER_TRACE_SCOPE (begin + end) through the multiplexed
+    // registry. Batches stay below the ring capacity and are flushed in
+    // between so that the measured path is the recording one, not the drop one.
+    constexpr int kBatch   = BinaryBackend::kRecordsPerThread / 4;
+    constexpr int kBatches = 100;
+    const std::string path = TempTracePath();
+    BinaryBackend backend;
+
+    ASSERT_EQ(backend.OpenFile(path.c_str()), CHIP_NO_ERROR);
+    {
+        ScopedRegistration scope(backend);
+
+        std::chrono::nanoseconds elapsed(0);
+        for (int i = 0; i < kBatches; i++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (int j = 0; j < kBatch; j++)
+            {
+                MATTER_TRACE_SCOPE("Benchmark", "Test");
+            }
+            elapsed += std::chrono::steady_clock::now() - start;
+            backend.Flush();
+        }
+
+        const double nsPerScope = static_cast<double>(elapsed.count()) / (kBatch * kBatches);
+        printf("MATTER_TRACE_SCOPE with binary backend: %.1f ns per scope\n", nsPerScope);
+
+        // Loose bound: this only guards against accidental formatting/locking on the hot path
+        EXPECT_LT(nsPerScope, 2000.0);
+    }
+    EXPECT_EQ(backend.DroppedRecords(), 0u);
+
+    remove(path.c_str());
+}
+
+} // namespace
@@ -0,0 +1,202 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <transport/SecureMessageDecryptPool.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <transport/SecureMessageCodec.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Transport {
+
+CHIP_ERROR SecureMessageDecryptPool::Init(Delegate & delegate, size_t workerCount)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(workerCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mWorkers.Alloc(workerCount), CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(System::Mutex::Init(mLock));
+
+    mDelegate = &delegate;
+
+    mLock.Lock();
+    mHead          = 0;
+    mNextToDecrypt = 0;
+    mTail          = 0;
+    mShuttingDown  = false;
+    mLock.Unlock();
+
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        int res = pthread_create(&mWorkers[i], nullptr, WorkerMain, this);
+        if (res != 0)
+        {
+            ChipLogError(Inet, "Failed to start decryption worker: %s", strerror(res));
+            Shutdown();
+            return CHIP_ERROR_POSIX(res);
+        }
+        mWorkerCount = i + 1;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void SecureMessageDecryptPool::Shutdown()
+{
+    VerifyOrReturn(IsInitialized());
+
+    mLock.Lock();
+    mShuttingDown = true;
+    mLock.Unlock();
+    mWorkAvailable.notify_all();
+
+    for (size_t i = 0; i < mWorkerCount; i++)
+    {
+        pthread_join(mWorkers[i], nullptr);
+    }
+    mWorkers.Free();
+    mWorkerCount = 0;
+
+    // The workers are gone, so every message belongs to this thread now
+    mLock.Lock();
+    for (; mHead != mTail; mHead++)
+    {
+        Slot & slot = GetSlot(mHead);
+        slot.mMessage.mSession.ClearValue();
+        slot.mMessage.mBuffer = nullptr;
+        slot.mState           = SlotState::kFree;
+    }
+    mNextToDecrypt       = mTail;
+    mProcessingScheduled = false;
+    mLock.Unlock();
+}
+
+CHIP_ERROR SecureMessageDecryptPool::Submit(const SessionHandle & session, const CryptoContext & cryptoContext,
+                                            const PeerAddress & peerAddress, const PacketHeader & packetHeader,
+                                            CryptoContext::ConstNonceView nonce, System::PacketBufferHandle && buffer)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    mLock.Lock();
+    const size_t position = mTail;
+    const bool full       = (mTail - mHead == kQueueSize);
+    mLock.Unlock();
+
+    VerifyOrReturnError(!full, CHIP_ERROR_NO_MEMORY);
+
+    // Free slots belong to this thread, so the message is filled before the lock is taken again to queue it
+    Message & message = GetSlot(position).mMessage;
+    message.mSession.Emplace(*session.operator->());
+    message.mCryptoContext = &cryptoContext;
+    message.mPeerAddress   = peerAddress;
+    message.mPacketHeader  = packetHeader;
+    memcpy(message.mNonce.data(), nonce.data(), nonce.size());
+    message.mBuffer        = std::move(buffer);
+    message.mPayloadHeader = PayloadHeader();
+    message.mDecryptError  = CHIP_NO_ERROR;
+
+    mLock.Lock();
+    GetSlot(position).mState = SlotState::kQueued;
+    mTail++;
+    mLock.Unlock();
+    mWorkAvailable.notify_one();
+
+    return CHIP_NO_ERROR;
+}
+
+void SecureMessageDecryptPool::ProcessDecryptedMessages()
+{
+    mLock.Lock();
+    mProcessingScheduled = false;
+
+    while (mHead != mTail && GetSlot(mHead).mState == SlotState::kDecrypted)
+    {
+        Slot & slot = GetSlot(mHead);
+        mLock.Unlock();
+
+        mDelegate->OnMessageDecrypted(slot.mMessage);
+        slot.mMessage.mSession.ClearValue();
+        slot.mMessage.mBuffer = nullptr;
+
+        mLock.Lock();
+        slot.mState = SlotState::kFree;
+        mHead++;
+    }
+
+    mLock.Unlock();
+}
+
+void * SecureMessageDecryptPool::WorkerMain(void * context)
+{
+    static_cast<SecureMessageDecryptPool *>(context)->RunWorker();
+    return nullptr;
+}
+
+void SecureMessageDecryptPool::RunWorker()
+{
+    mLock.Lock();
+
+    while (true)
+    {
+        mWorkAvailable.wait(mLock, [this]() CHIP_NO_THREAD_SAFETY_ANALYSIS { return mShuttingDown || mNextToDecrypt != mTail; });
+        if (mShuttingDown)
+        {
+            break;
+        }
+
+        const size_t position = mNextToDecrypt++;
+        Slot & slot           = GetSlot(position);
+        slot.mState           = SlotState::kDecrypting;
+        mLock.Unlock();
+
+        Message & message     = slot.mMessage;
+        message.mDecryptError = SecureMessageCodec::Decrypt(*message.mCryptoContext, message.mNonce, message.mPayloadHeader,
+                                                            message.mPacketHeader, message.mBuffer);
+
+        mLock.Lock();
+        slot.mState = SlotState::kDecrypted;
+
+        // Messages are handed back in order, so only the oldest one being decrypted is worth a wake-up
+        const bool schedule  = !mProcessingScheduled && GetSlot(mHead).mState == SlotState::kDecrypted;
+        mProcessingScheduled = mProcessingScheduled || schedule;
+
+        if (schedule)
+        {
+            mLock.Unlock();
+            CHIP_ERROR err = mDelegate->ScheduleDecryptedMessages();
+            mLock.Lock();
+
+            if (err != CHIP_NO_ERROR)
+            {
+                // The next message decrypted tries again
+                ChipLogError(Inet, "Failed to schedule decrypted messages: %" CHIP_ERROR_FORMAT, err.Format());
+                mProcessingScheduled = false;
+            }
+        }
+    }
+
+    mLock.Unlock();
+}
+
+} // namespace Transport
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
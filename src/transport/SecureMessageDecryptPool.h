@@ -0,0 +1,164 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/Optional.h>
+#include <lib/support/ScopedBuffer.h>
+#include <system/SystemConfig.h>
+#include <system/SystemMutex.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/CryptoContext.h>
+#include <transport/Session.h>
+#include <transport/raw/MessageHeader.h>
+#include <transport/raw/PeerAddress.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <condition_variable>
+#include <pthread.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Pool of worker threads decrypting received secure messages off the thread running the CHIP stack.
+ *
+ * The CHIP thread submits each message once its packet header has been decoded and its session found. Workers
+ * decrypt and authenticate messages in parallel, and messages are handed back to the CHIP thread in the order
+ * they were submitted, for message counter verification and dispatch.
+ *
+ * Workers only use the cryptographic context of the session of a message, which is not modified once the session
+ * is established and lives as long as the session. Everything else, including taking and releasing references to
+ * sessions, happens on the CHIP thread.
+ */
+class SecureMessageDecryptPool
+{
+public:
+    static constexpr size_t kQueueSize = CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_QUEUE_SIZE;
+
+    struct Message
+    {
+        // Keeps the session, and so its cryptographic context, alive until the message is handed back
+        Optional<SessionHandle> mSession;
+        const CryptoContext * mCryptoContext = nullptr;
+        PeerAddress mPeerAddress;
+        PacketHeader mPacketHeader;
+        CryptoContext::NonceStorage mNonce;
+        System::PacketBufferHandle mBuffer;
+
+        // Filled by the worker decrypting the message
+        PayloadHeader mPayloadHeader;
+        CHIP_ERROR mDecryptError = CHIP_NO_ERROR;
+    };
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() {}
+
+        /**
+         * Called on a worker thread when the oldest message submitted has been decrypted, to have
+         * ProcessDecryptedMessages() called on the CHIP thread. Not called again until it is, unless
+         * scheduling fails.
+         */
+        virtual CHIP_ERROR ScheduleDecryptedMessages() = 0;
+
+        /**
+         * Called on the CHIP thread by ProcessDecryptedMessages(), for each message in the order they were submitted.
+         * The message must be checked for a decryption error first.
+         */
+        virtual void OnMessageDecrypted(Message & message) = 0;
+    };
+
+    SecureMessageDecryptPool() = default;
+    ~SecureMessageDecryptPool() { Shutdown(); }
+
+    SecureMessageDecryptPool(const SecureMessageDecryptPool &)             = delete;
+    SecureMessageDecryptPool & operator=(const SecureMessageDecryptPool &) = delete;
+
+    /**
+     * Start the given number of worker threads.
+     */
+    CHIP_ERROR Init(Delegate & delegate, size_t workerCount) CHIP_EXCLUDES(mLock);
+
+    /**
+     * Stop the worker threads, and drop the messages not handed back yet. Called on the CHIP thread.
+     */
+    void Shutdown() CHIP_EXCLUDES(mLock);
+
+    bool IsInitialized() const { return mWorkerCount > 0; }
+
+    /**
+     * Queue a message for decryption. Called on the CHIP thread.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the queue is full, in which case the message is left untouched.
+     */
+    CHIP_ERROR Submit(const SessionHandle & session, const CryptoContext & cryptoContext, const PeerAddress & peerAddress,
+                      const PacketHeader & packetHeader, CryptoContext::ConstNonceView nonce, System::PacketBufferHandle && buffer)
+        CHIP_EXCLUDES(mLock);
+
+    /**
+     * Hand the messages decrypted so far back to the delegate, in the order they were submitted. Called on the
+     * CHIP thread, after the delegate asked for it.
+     */
+    void ProcessDecryptedMessages() CHIP_EXCLUDES(mLock);
+
+private:
+    enum class SlotState : uint8_t
+    {
+        kFree,
+        kQueued,
+        kDecrypting,
+        kDecrypted,
+    };
+
+    // The message of a slot belongs to the CHIP thread while the slot is free or decrypted, and to the worker
+    // decrypting it otherwise. Ownership changes with the state of the slot, under the lock.
+    struct Slot
+    {
+        Message mMessage;
+        SlotState mState = SlotState::kFree;
+    };
+
+    static void * WorkerMain(void * context);
+    void RunWorker() CHIP_EXCLUDES(mLock);
+    Slot & GetSlot(size_t position) { return mSlots[position % kQueueSize]; }
+
+    Delegate * mDelegate = nullptr;
+    Platform::ScopedMemoryBuffer<pthread_t> mWorkers;
+    size_t mWorkerCount = 0;
+
+    System::Mutex mLock;
+    std::condition_variable_any mWorkAvailable;
+    Slot mSlots[kQueueSize];
+
+    // Positions in the queue, counting messages since Init(): the oldest message not handed back, the next message
+    // to decrypt, and the next free slot.
+    size_t mHead CHIP_GUARDED_BY(mLock)              = 0;
+    size_t mNextToDecrypt CHIP_GUARDED_BY(mLock)     = 0;
+    size_t mTail CHIP_GUARDED_BY(mLock)              = 0;
+    bool mProcessingScheduled CHIP_GUARDED_BY(mLock) = false;
+    bool mShuttingDown CHIP_GUARDED_BY(mLock)        = false;
+};
+
+} // namespace Transport
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
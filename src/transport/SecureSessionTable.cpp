@@ -22,6 +22,8 @@
 #include <transport/SecureSession.h>
 #include <transport/SecureSessionTable.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Transport {
 
@@ -54,6 +56,9 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
 
     SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
                                                    peerSessionId, fabricIndex, config);
+#if CHIP_CONFIG_SECURE_SESSION_INDEX
+    result = IndexNewSession(result);
+#endif
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -80,6 +85,9 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
         allocated = EvictAndAllocate(sessionId.Value(), secureSessionType, sessionEvictionHint);
     }
 
+#if CHIP_CONFIG_SECURE_SESSION_INDEX
+    allocated = IndexNewSession(allocated);
+#endif
     VerifyOrReturnValue(allocated != nullptr, Optional<SessionHandle>::Missing());
 
     rv             = MakeOptional<SessionHandle>(*allocated);
@@ -102,99 +110,104 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
     ChipLogProgress(SecureChannel, "Evicting a slot for session with LSID: %d, type: %u", localSessionId,
                     (uint8_t) secureSessionType);
 
-    VerifyOrDie(mEntries.Allocated() <= GetMaxSessionTableSize());
+    //
+    // The maximum size may have been lowered below the number of sessions in the table, in which case
+    // sessions are evicted until the table is below it. Failing that, evicting a single session still
+    // makes room for the new one.
+    //
+    bool evictedAny = false;
+    while (mEntries.Allocated() >= GetMaxSessionTableSize() && EvictSession(sessionEvictionHint))
+    {
+        evictedAny = true;
+    }
+
+    VerifyOrDieWithMsg(evictedAny, SecureChannel, "We couldn't find any session to evict at all, something's wrong!");
+
+    return mEntries.CreateObject(*this, secureSessionType, localSessionId);
+}
+
+bool SecureSessionTable::EvictSession(const ScopedNodeId & sessionEvictionHint)
+{
+    const size_t numSessions = mEntries.Allocated();
 
     //
     // Create a temporary list of objects each of which points to a session in the existing
-    // session table, but are swappable. This allows them to then be used with a sorting algorithm
-    // without affecting the sessions in the table itself.
+    // session table, along with the number of other sessions on its fabric and to its peer,
+    // which are used by the eviction policy.
     //
     // The size of this shouldn't place significant demands on the stack if using the default
     // configuration for CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (17). Each item is
     // 8 bytes in size (on a 32-bit platform), and 16 bytes in size (on a 64-bit platform,
     // including padding).
     //
-    // Total size of this stack variable = 17 * 8 = 136bytes (32-bit platform), 272 bytes (64-bit platform).
-    //
-    // Even if the define is set to a large value, it's likely not so bad on the sort of platform setup
-    // that would have that sort of pool size.
-    //
-    // We need to sort (as opposed to just a linear search for the smallest/largest item)
-    // since it is possible that the candidate selected for eviction may not actually be
-    // released once marked for expiration (see comments below for more details).
-    //
-    // Consequently, we may need to walk the candidate list till we find one that is.
-    // Sorting provides a better overall performance model in this scheme.
-    //
-    // (#19967): Investigate doing linear search instead.
-    //
-    //
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // The table size is set at runtime, so the list cannot live on the stack.
+    Platform::ScopedMemoryBuffer<SortableSession> sortableSessionsBuffer;
+    VerifyOrReturnValue(sortableSessionsBuffer.Alloc(numSessions), false);
+    SortableSession * sortableSessions = sortableSessionsBuffer.Get();
+#else
     SortableSession sortableSessions[CHIP_CONFIG_SECURE_SESSION_POOL_SIZE];
+#endif
 
-    unsigned int index = 0;
-
-    //
-    // Compute two key stats for each session - the number of other sessions that
-    // match its fabric, as well as the number of other sessions that match its peer.
-    //
-    // This will be used by the session eviction algorithm later.
-    //
-    ForEachSession([&index, &sortableSessions, this](auto * session) {
-        sortableSessions[index].mSession             = session;
-        sortableSessions[index].mNumMatchingOnFabric = 0;
-        sortableSessions[index].mNumMatchingOnPeer   = 0;
-
-        ForEachSession([session, index, &sortableSessions](auto * otherSession) {
-            if (session != otherSession)
-            {
-                if (session->GetFabricIndex() == otherSession->GetFabricIndex())
-                {
-                    sortableSessions[index].mNumMatchingOnFabric++;
-
-                    if (session->GetPeerNodeId() == otherSession->GetPeerNodeId())
-                    {
-                        sortableSessions[index].mNumMatchingOnPeer++;
-                    }
-                }
-            }
-
-            return Loop::Continue;
-        });
-
+    size_t index = 0;
+    ForEachSession([&index, &sortableSessions](auto * session) {
+        sortableSessions[index].mSession = session;
         index++;
         return Loop::Continue;
     });
 
-    auto sortableSessionSpan = Span<SortableSession>(sortableSessions, mEntries.Allocated());
-    EvictionPolicyContext policyContext(sortableSessionSpan, sessionEvictionHint);
-
-    DefaultEvictionPolicy(policyContext);
-    ChipLogProgress(SecureChannel, "Sorted sessions for eviction...");
-
-    const auto numSessions = mEntries.Allocated();
+    //
+    // Grouping the sessions by fabric, then by peer, gives the number of sessions matching the
+    // fabric and the peer of each session from the length of its groups, without comparing every
+    // pair of sessions.
+    //
+    std::sort(sortableSessions, sortableSessions + numSessions, [](const SortableSession & a, const SortableSession & b) {
+        if (a->GetFabricIndex() != b->GetFabricIndex())
+        {
+            return a->GetFabricIndex() < b->GetFabricIndex();
+        }
+        return a->GetPeerNodeId() < b->GetPeerNodeId();
+    });
 
-#if CHIP_DETAIL_LOGGING
-    ChipLogDetail(SecureChannel, "Sorted Eviction Candidates (ranked from best candidate to worst):");
-    for (auto * session = sortableSessions; session != (sortableSessions + numSessions); session++)
+    for (size_t fabricStart = 0, fabricEnd; fabricStart < numSessions; fabricStart = fabricEnd)
     {
-        ChipLogDetail(SecureChannel,
-                      "\t%ld: [%p] -- Peer: [%u:" ChipLogFormatX64
-                      "] State: '%s', NumMatchingOnFabric: %d NumMatchingOnPeer: %d ActivityTime: %lu",
-                      static_cast<long int>(session - sortableSessions), session->mSession,
-                      session->mSession->GetPeer().GetFabricIndex(), ChipLogValueX64(session->mSession->GetPeer().GetNodeId()),
-                      session->mSession->GetStateStr(), session->mNumMatchingOnFabric, session->mNumMatchingOnPeer,
-                      static_cast<unsigned long>(session->mSession->GetLastActivityTime().count()));
-    }
-#endif
+        const FabricIndex fabricIndex = sortableSessions[fabricStart]->GetFabricIndex();
+        for (fabricEnd = fabricStart; fabricEnd < numSessions && sortableSessions[fabricEnd]->GetFabricIndex() == fabricIndex;
+             fabricEnd++)
+        {
+        }
 
-    for (auto * session = sortableSessions; session != (sortableSessions + numSessions); session++)
-    {
-        if (session->mSession->IsPendingEviction())
+        for (size_t peerStart = fabricStart, peerEnd; peerStart < fabricEnd; peerStart = peerEnd)
         {
-            continue;
+            const NodeId peerNodeId = sortableSessions[peerStart]->GetPeerNodeId();
+            for (peerEnd = peerStart; peerEnd < fabricEnd && sortableSessions[peerEnd]->GetPeerNodeId() == peerNodeId; peerEnd++)
+            {
+            }
+
+            for (size_t i = peerStart; i < peerEnd; i++)
+            {
+                sortableSessions[i].mNumMatchingOnFabric = static_cast<uint16_t>(fabricEnd - fabricStart - 1);
+                sortableSessions[i].mNumMatchingOnPeer   = static_cast<uint16_t>(peerEnd - peerStart - 1);
+            }
         }
+    }
+
+    EvictionPolicyContext policyContext(Span<SortableSession>(sortableSessions, numSessions), sessionEvictionHint);
 
-        ChipLogProgress(SecureChannel, "Candidate Session[%p] - Attempting to evict...", session->mSession);
+    //
+    // It is possible that the candidate selected for eviction is not actually released once marked
+    // for eviction. It is then pending eviction, and the next best candidate is selected.
+    //
+    for (SortableSession * session = DefaultEvictionPolicy(policyContext); session != nullptr;
+         session                   = DefaultEvictionPolicy(policyContext))
+    {
+        ChipLogProgress(SecureChannel,
+                        "Candidate Session[%p] - Peer: [%u:" ChipLogFormatX64
+                        "] State: '%s', NumMatchingOnFabric: %d NumMatchingOnPeer: %d ActivityTime: %lu - Attempting to evict...",
+                        session->mSession, session->mSession->GetPeer().GetFabricIndex(),
+                        ChipLogValueX64(session->mSession->GetPeer().GetNodeId()), session->mSession->GetStateStr(),
+                        session->mNumMatchingOnFabric, session->mNumMatchingOnPeer,
+                        static_cast<unsigned long>(session->mSession->GetLastActivityTime().count()));
 
         auto prevCount = mEntries.Allocated();
 
@@ -211,22 +224,17 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         //
         session->mSession->MarkForEviction();
 
-        auto newCount = mEntries.Allocated();
-
-        if (newCount < prevCount)
+        if (mEntries.Allocated() < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
-            VerifyOrDie(session != nullptr);
-            return retSession;
+            return true;
         }
     }
 
-    VerifyOrDieWithMsg(false, SecureChannel, "We couldn't find any session to evict at all, something's wrong!");
-    return nullptr;
+    return false;
 }
 
-void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionContext)
+SecureSessionTable::SortableSession * SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionContext)
 {
     //
     // This implements a spec-compliant sorting policy that ensures both guarantees for sessions per-fabric as
@@ -235,7 +243,7 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
     //
     // See the description of this function in the header for more details on each sorting key below.
     //
-    evictionContext.Sort([&evictionContext](const SortableSession & a, const SortableSession & b) -> bool {
+    return evictionContext.SelectBest([&evictionContext](const SortableSession & a, const SortableSession & b) -> bool {
         //
         // Sorting on Key1
         //
@@ -339,6 +347,9 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
+#if CHIP_CONFIG_SECURE_SESSION_INDEX
+    SecureSession * result = mSessionIndex.Find(localSessionId);
+#else
     SecureSession * result = nullptr;
     mEntries.ForEachActiveObject([&](auto session) {
         if (session->GetLocalSessionId() == localSessionId)
@@ -348,11 +359,24 @@ Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t
         }
         return Loop::Continue;
     });
+#endif // CHIP_CONFIG_SECURE_SESSION_INDEX
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
+#if CHIP_CONFIG_SECURE_SESSION_INDEX
+    // IDs are handed out sequentially, so the first candidates are almost always free
+    for (uint32_t i = 0; i <= kMaxSessionID; i++)
+    {
+        const uint16_t candidate = static_cast<uint16_t>(mNextSessionId + i);
+        if (candidate != kUnsecuredSessionId && mSessionIndex.Find(candidate) == nullptr)
+        {
+            return MakeOptional(candidate);
+        }
+    }
+    return NullOptional;
+#else
     uint16_t candidate_base = 0;
     uint64_t candidate_mask = 0;
     for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
@@ -401,7 +425,130 @@ Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
     }
 
     return NullOptional;
+#endif // CHIP_CONFIG_SECURE_SESSION_INDEX
 }
 
+void SecureSessionTable::ReleaseSession(SecureSession * session)
+{
+#if CHIP_CONFIG_SECURE_SESSION_INDEX
+    const uint16_t localSessionId = session->GetLocalSessionId();
+    const bool wasIndexed         = mSessionIndex.Remove(session);
+#endif
+
+    mEntries.ReleaseObject(session);
+
+#if CHIP_CONFIG_SECURE_SESSION_INDEX
+    if (!wasIndexed)
+    {
+        mSessionIndex.mShadowedSessions--;
+    }
+    else if (mSessionIndex.mShadowedSessions > 0)
+    {
+        // Make a session with the same ID that was shadowed by the released one reachable again
+        mEntries.ForEachActiveObject([&](SecureSession * other) {
+            if (other->GetLocalSessionId() != localSessionId)
+            {
+                return Loop::Continue;
+            }
+            if (mSessionIndex.Insert(other))
+            {
+                mSessionIndex.mShadowedSessions--;
+            }
+            return Loop::Break;
+        });
+    }
+#endif
+}
+
+CHIP_ERROR SecureSessionTable::SetMaxSessionTableSize(size_t size)
+{
+    VerifyOrReturnError(size > 0 && size <= kMaxSessionID, CHIP_ERROR_INVALID_ARGUMENT);
+#if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    VerifyOrReturnError(size <= CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, CHIP_ERROR_NO_MEMORY);
+#endif
+
+    mMaxSessionTableSize = size;
+    return CHIP_NO_ERROR;
+}
+
+#if CHIP_CONFIG_SECURE_SESSION_INDEX
+
+SecureSession * SecureSessionTable::IndexNewSession(SecureSession * session)
+{
+    VerifyOrReturnValue(session != nullptr, nullptr);
+
+    if (mSessionIndex.Find(session->GetLocalSessionId()) != nullptr)
+    {
+        mSessionIndex.mShadowedSessions++;
+        return session;
+    }
+
+    if (!mSessionIndex.Insert(session))
+    {
+        // Not reachable by incoming messages, so do not hand it out
+        mEntries.ReleaseObject(session);
+        return nullptr;
+    }
+    return session;
+}
+
+bool SecureSessionTable::LocalSessionIdIndex::Insert(SecureSession * session)
+{
+    const uint16_t id = session->GetLocalSessionId();
+    auto & page       = mPages[id >> 8];
+
+    if (page == nullptr)
+    {
+        page = static_cast<SecureSession **>(Platform::MemoryCalloc(kPageSize, sizeof(SecureSession *)));
+        VerifyOrReturnValue(page != nullptr, false);
+    }
+
+    if (page[id & 0xFF] == nullptr)
+    {
+        page[id & 0xFF] = session;
+        mPageUsage[id >> 8]++;
+    }
+    return true;
+}
+
+bool SecureSessionTable::LocalSessionIdIndex::Remove(SecureSession * session)
+{
+    const uint16_t id = session->GetLocalSessionId();
+    auto & page       = mPages[id >> 8];
+
+    VerifyOrReturnValue(page != nullptr && page[id & 0xFF] == session, false);
+
+    page[id & 0xFF] = nullptr;
+    if (--mPageUsage[id >> 8] == 0)
+    {
+        Platform::MemoryFree(page);
+        page = nullptr;
+    }
+    return true;
+}
+
+void SecureSessionTable::LocalSessionIdIndex::Clear()
+{
+    for (size_t i = 0; i < kPageCount; i++)
+    {
+        Platform::MemoryFree(mPages[i]);
+        mPages[i]     = nullptr;
+        mPageUsage[i] = 0;
+    }
+    mShadowedSessions = 0;
+}
+
+size_t SecureSessionTable::LocalSessionIdIndex::AllocatedBytes() const
+{
+    size_t bytes = 0;
+    for (auto * page : mPages)
+    {
+        bytes += (page != nullptr) ? kPageSize * sizeof(SecureSession *) : 0;
+    }
+    return bytes;
+}
+
+#endif // CHIP_CONFIG_SECURE_SESSION_INDEX
+
 } // namespace Transport
 } // namespace chip
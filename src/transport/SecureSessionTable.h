@@ -19,7 +19,6 @@
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/Pool.h>
-#include <lib/support/SortUtils.h>
 #include <system/TimeSource.h>
 #include <transport/SecureSession.h>
 
@@ -39,7 +38,13 @@ inline constexpr uint16_t kUnsecuredSessionId = 0;
 class SecureSessionTable
 {
 public:
-    ~SecureSessionTable() { mEntries.ReleaseAll(); }
+    ~SecureSessionTable()
+    {
+        mEntries.ReleaseAll();
+#if CHIP_CONFIG_SECURE_SESSION_INDEX
+        mSessionIndex.Clear();
+#endif
+    }
 
     void Init() { mNextSessionId = chip::Crypto::GetRandU16(); }
 
@@ -76,7 +81,23 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session);
+
+    /**
+     * Set the number of sessions the table holds before it starts evicting
+     * sessions to make room for new ones.
+     *
+     * Only heap based pools (CHIP_SYSTEM_CONFIG_POOL_USE_HEAP) can hold more than
+     * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE sessions. Lowering the limit below the
+     * current number of sessions does not release any right away: the next session
+     * created evicts sessions until the table is below the new limit.
+     *
+     * @returns CHIP_ERROR_INVALID_ARGUMENT if size is 0 or larger than the session ID space,
+     *          CHIP_ERROR_NO_MEMORY if the pool cannot hold that many sessions.
+     */
+    CHIP_ERROR SetMaxSessionTableSize(size_t size);
+
+    size_t GetMaxSessionTableSize() const { return mMaxSessionTableSize; }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -162,28 +183,37 @@ private:
      *
      * Encapsulates all the necessary context for an eviction policy callback
      * to implement its specific policy. The context is provided to the callee
-     * with the expectation that it'll call Sort() with a comparator function provided
-     * to get the list of sessions sorted in the desired order.
+     * with the expectation that it'll call SelectBest() with a comparator function provided
+     * to get the best candidate for eviction.
      *
      */
     class EvictionPolicyContext
     {
     public:
         /*
-         * Called by the policy implementor to sort the list of sessions given a comparator
-         * function. The provided function shall have the following signature:
+         * Called by the policy implementor to select the best candidate for eviction given a
+         * comparator function, in a single pass over the sessions. Sessions already pending
+         * eviction are not candidates. The provided function shall have the following signature:
          *
          * bool CompareFunc(const SortableSession &a, const SortableSession &b);
          *
          * If a is a better candidate than b, true should be returned. Else, return false.
          *
-         * NOTE: Sort() can be called multiple times.
+         * @return the best candidate, or nullptr if no session is a candidate.
          *
          */
         template <typename CompareFunc>
-        void Sort(CompareFunc func)
+        SortableSession * SelectBest(CompareFunc func)
         {
-            Sorting::InsertionSort(mSessionList.begin(), mSessionList.size(), func);
+            SortableSession * best = nullptr;
+            for (SortableSession & session : mSessionList)
+            {
+                if (!session.mSession->IsPendingEviction() && (best == nullptr || func(session, *best)))
+                {
+                    best = &session;
+                }
+            }
+            return best;
         }
 
         const ScopedNodeId & GetSessionEvictionHint() const { return mSessionEvictionHint; }
@@ -202,7 +232,7 @@ private:
 
     /**
      *
-     * This implements an eviction policy by sorting sessions using the following sorting keys and selecting
+     * This implements an eviction policy by ordering sessions using the following sorting keys and selecting
      * the session that is most ahead as the best candidate for eviction:
      *
      *  - Key1:  Sessions on fabrics that have more sessions in the table are placed ahead of sessions on fabrics
@@ -230,16 +260,24 @@ private:
      *           is the canonical sorting criteria for basic LRU.
      *
      */
-    void DefaultEvictionPolicy(EvictionPolicyContext & evictionContext);
+    SortableSession * DefaultEvictionPolicy(EvictionPolicyContext & evictionContext);
 
     /**
      *
-     * Evicts a session from the session table using the DefaultEvictionPolicy implementation.
+     * Evicts sessions from the session table using the DefaultEvictionPolicy implementation until it is
+     * below its maximum size, and allocates a new session.
      *
      */
     SecureSession * EvictAndAllocate(uint16_t localSessionId, SecureSession::Type secureSessionType,
                                      const ScopedNodeId & sessionEvictionHint);
 
+    /**
+     * Evicts the best candidate session that can be released.
+     *
+     * @return false if no session could be evicted.
+     */
+    bool EvictSession(const ScopedNodeId & sessionEvictionHint);
+
     /**
      * Find an available session ID that is unused in the secure session table.
      *
@@ -256,22 +294,58 @@ private:
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+#if CHIP_CONFIG_SECURE_SESSION_INDEX
+    /**
+     * Maps local session IDs to sessions.
+     *
+     * The high byte of a session ID selects a page and the low byte a slot in it. Pages
+     * are allocated when the first session in their range is added and freed when the
+     * last one is removed, so memory follows the (mostly sequential) IDs in use.
+     *
+     * Only one session per ID is indexed: test-only APIs can create sessions with
+     * duplicate IDs, those are counted as shadowed and re-indexed on release.
+     */
+    class LocalSessionIdIndex
+    {
+    public:
+        ~LocalSessionIdIndex() { Clear(); }
+
+        /// Returns false if memory for the index could not be allocated.
+        bool Insert(SecureSession * session);
+
+        /// Returns true if the session was the indexed one for its ID.
+        bool Remove(SecureSession * session);
+
+        SecureSession * Find(uint16_t localSessionId) const
+        {
+            SecureSession * const * page = mPages[localSessionId >> 8];
+            return page != nullptr ? page[localSessionId & 0xFF] : nullptr;
+        }
+
+        void Clear();
+
+        size_t AllocatedBytes() const;
+
+        size_t mShadowedSessions = 0;
+
+    private:
+        static constexpr size_t kPageSize  = 256;
+        static constexpr size_t kPageCount = (static_cast<size_t>(kMaxSessionID) + 1) / kPageSize;
+
+        SecureSession ** mPages[kPageCount] = {};
+        uint16_t mPageUsage[kPageCount]     = {};
+    };
+
+    /// Adds a newly created session to the index, releasing it if that fails.
+    SecureSession * IndexNewSession(SecureSession * session);
+
+    LocalSessionIdIndex mSessionIndex;
+#endif // CHIP_CONFIG_SECURE_SESSION_INDEX
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
 
-    size_t GetMaxSessionTableSize() const
-    {
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-        return mMaxSessionTableSize;
-#else
-        return CHIP_CONFIG_SECURE_SESSION_POOL_SIZE;
-#endif
-    }
-
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     size_t mMaxSessionTableSize = CHIP_CONFIG_SECURE_SESSION_POOL_SIZE;
-    void SetMaxSessionTableSize(size_t size) { mMaxSessionTableSize = size; }
-#endif
 
     uint16_t mNextSessionId = 0;
 };
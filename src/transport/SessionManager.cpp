@@ -152,6 +152,10 @@ CHIP_ERROR SessionManager::Init(System::Layer * systemLayer, TransportMgrBase *
     mConnClosedCb   = nullptr;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+    ReturnErrorOnFailure(mDecryptPool.Init(mDecryptPoolDelegate, CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS));
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
     return CHIP_NO_ERROR;
 }
 
@@ -166,6 +170,11 @@ void SessionManager::Shutdown()
     // Ensure that we don't create new sessions as we iterate our session table.
     mState = State::kNotReady;
 
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+    // Drop the messages being decrypted, and the references they hold to their sessions
+    mDecryptPool.Shutdown();
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
     // Just in case some consumer forgot to do it, expire all our secure
     // sessions.  Note that this stands a good chance of crashing with a
     // null-deref if there are in fact any secure sessions left, since they will
@@ -912,8 +921,6 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
 {
     MATTER_TRACE_SCOPE("Secure Unicast Message Dispatch", "SessionManager");
 
-    CHIP_ERROR err = CHIP_NO_ERROR;
-
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     if (peerAddress.GetTransportType() == Transport::Type::kTcp && ctxt->conn == nullptr)
     {
@@ -969,8 +976,6 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     PacketHeader packetHeader;
     ReturnOnFailure(packetHeader.DecodeAndConsume(msg));
 
-    SessionMessageDelegate::DuplicateMessage isDuplicate = SessionMessageDelegate::DuplicateMessage::No;
-
     if (msg.IsNull())
     {
         ChipLogError(Inet, "Secure transport received Unicast NULL packet, discarding");
@@ -997,13 +1002,39 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(),
                               secureSession->GetSecureSessionType() == SecureSession::Type::kCASE ? secureSession->GetPeerNodeId()
                                                                                                   : kUndefinedNodeId);
+
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+    // Messages over TCP are not offloaded, since they cannot be dropped when the queue is full
+    if (peerAddress.GetTransportType() == Transport::Type::kUdp)
+    {
+        CHIP_ERROR err = mDecryptPool.Submit(session.Value(), secureSession->GetCryptoContext(), peerAddress, packetHeader,
+                                             nonce, std::move(msg));
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Dropping secure unicast message, failed to queue it for decryption: %" CHIP_ERROR_FORMAT,
+                         err.Format());
+        }
+        return;
+    }
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
     if (SecureMessageCodec::Decrypt(secureSession->GetCryptoContext(), nonce, payloadHeader, packetHeader, msg) != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Secure transport received message, but failed to decode/authenticate it, discarding");
         return;
     }
 
-    err =
+    SecureUnicastMessageDecrypted(session.Value(), packetHeader, payloadHeader, peerAddress, std::move(msg));
+}
+
+void SessionManager::SecureUnicastMessageDecrypted(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                   const PayloadHeader & payloadHeader, const Transport::PeerAddress & peerAddress,
+                                                   System::PacketBufferHandle && msg)
+{
+    Transport::SecureSession * secureSession             = session->AsSecureSession();
+    SessionMessageDelegate::DuplicateMessage isDuplicate = SessionMessageDelegate::DuplicateMessage::No;
+
+    CHIP_ERROR err =
         secureSession->GetSessionMessageCounter().GetPeerMessageCounter().VerifyEncryptedUnicast(packetHeader.GetMessageCounter());
     if (err == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED)
     {
@@ -1047,7 +1078,7 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
             secureSession->SetCaseCommissioningSessionStatus(secureSession->GetFabricIndex() ==
                                                              mFabricTable->GetPendingNewFabricIndex());
         }
-        mCB->OnMessageReceived(packetHeader, payloadHeader, session.Value(), isDuplicate, std::move(msg));
+        mCB->OnMessageReceived(packetHeader, payloadHeader, session, isDuplicate, std::move(msg));
     }
     else
     {
@@ -1055,6 +1086,26 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     }
 }
 
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+CHIP_ERROR SessionManager::DecryptPoolDelegate::ScheduleDecryptedMessages()
+{
+    // Called on a decryption worker: ScheduleLambda posts an event to the CHIP thread, which is safe from any thread
+    return mSessionManager.mSystemLayer->ScheduleLambda([this] { mSessionManager.mDecryptPool.ProcessDecryptedMessages(); });
+}
+
+void SessionManager::DecryptPoolDelegate::OnMessageDecrypted(Transport::SecureMessageDecryptPool::Message & message)
+{
+    if (message.mDecryptError != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Secure transport received message, but failed to decode/authenticate it, discarding");
+        return;
+    }
+
+    mSessionManager.SecureUnicastMessageDecrypted(message.mSession.Value(), message.mPacketHeader, message.mPayloadHeader,
+                                                  message.mPeerAddress, std::move(message.mBuffer));
+}
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
 /**
  * Helper function to implement a single attempt to decrypt a groupcast message
  * using the given group key and privacy setting.
@@ -52,6 +52,13 @@
 #include <transport/raw/PeerAddress.h>
 #include <transport/raw/Tuple.h>
 
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+#if !CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#error "CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS requires CHIP_SYSTEM_CONFIG_POSIX_LOCKING"
+#endif
+#include <transport/SecureMessageDecryptPool.h>
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
 #include <transport/SessionConnectionDelegate.h>
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
@@ -579,6 +586,24 @@ private:
 
     GlobalUnencryptedMessageCounter mGlobalUnencryptedMessageCounter;
 
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+    // Hands the secure unicast messages decrypted by worker threads back to the session manager
+    class DecryptPoolDelegate : public Transport::SecureMessageDecryptPool::Delegate
+    {
+    public:
+        DecryptPoolDelegate(SessionManager & sessionManager) : mSessionManager(sessionManager) {}
+
+        CHIP_ERROR ScheduleDecryptedMessages() override;
+        void OnMessageDecrypted(Transport::SecureMessageDecryptPool::Message & message) override;
+
+    private:
+        SessionManager & mSessionManager;
+    };
+
+    DecryptPoolDelegate mDecryptPoolDelegate{ *this };
+    Transport::SecureMessageDecryptPool mDecryptPool;
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
     /**
      * @brief Parse, decrypt, validate, and dispatch a secure unicast message.
      *
@@ -592,6 +617,19 @@ private:
     void SecureUnicastMessageDispatch(const PacketHeader & partialPacketHeader, const Transport::PeerAddress & peerAddress,
                                       System::PacketBufferHandle && msg, Transport::MessageTransportContext * ctxt = nullptr);
 
+    /**
+     * @brief Validate the message counter of a decrypted secure unicast message, and dispatch it.
+     *
+     * @param session The session the message was received on.
+     * @param packetHeader The fully decoded PacketHeader of the message.
+     * @param payloadHeader The PayloadHeader of the message, decoded along with its payload.
+     * @param peerAddress The PeerAddress of the message as provided by the receiving Transport Endpoint.
+     * @param msg The decrypted payload of the message.
+     */
+    void SecureUnicastMessageDecrypted(const SessionHandle & session, const PacketHeader & packetHeader,
+                                       const PayloadHeader & payloadHeader, const Transport::PeerAddress & peerAddress,
+                                       System::PacketBufferHandle && msg);
+
     /**
      * @brief Parse, decrypt, validate, and dispatch a secure group message.
      *
@@ -27,6 +27,7 @@
 #include <inet/InetInterface.h>
 #include <inet/TCPEndPoint.h>
 #include <lib/core/CHIPCore.h>
+#include <system/SystemClock.h>
 #include <transport/raw/PeerAddress.h>
 #include <transport/raw/TCPConfig.h>
 
@@ -76,7 +77,7 @@ struct ActiveTCPConnectionState
     bool IsConnecting() const { return (mEndPoint != nullptr && mConnectionState == TCPState::kConnecting); }
 
     // Associated endpoint.
-    Inet::TCPEndPoint * mEndPoint;
+    Inet::TCPEndPoint * mEndPoint = nullptr;
 
     // Peer Node Address
     PeerAddress mPeerAddr;
@@ -85,7 +86,10 @@ struct ActiveTCPConnectionState
     System::PacketBufferHandle mReceived;
 
     // Current state of the connection
-    TCPState mConnectionState;
+    TCPState mConnectionState = TCPState::kNotReady;
+
+    // Last time data was sent or received on the connection.
+    System::Clock::Timestamp mLastActivity = System::Clock::kZero;
 
     // A pointer to an application-specific state object. It should
     // represent an object that is at a layer above the SessionManager. The
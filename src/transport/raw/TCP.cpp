@@ -28,10 +28,12 @@
 #include <lib/core/CHIPEncoding.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
 #include <transport/raw/MessageHeader.h>
 
 #include <inttypes.h>
 #include <limits>
+#include <new>
 
 namespace chip {
 namespace Transport {
@@ -62,7 +64,13 @@ TCPBase::~TCPBase()
         mListenSocket = nullptr;
     }
 
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleIdleConnectionTimer, this);
+    }
+
     CloseActiveConnections();
+    ReleaseHeapConnections();
 }
 
 void TCPBase::CloseActiveConnections()
@@ -82,6 +90,9 @@ CHIP_ERROR TCPBase::Init(TcpListenParameters & params)
 
     VerifyOrExit(mState == TCPState::kNotReady, err = CHIP_ERROR_INCORRECT_STATE);
 
+    err = ResizeConnectionTable(params.GetMaxActiveConnections());
+    SuccessOrExit(err);
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     err = params.GetEndPointManager()->NewEndPoint(&mListenSocket);
 #else
@@ -97,7 +108,9 @@ CHIP_ERROR TCPBase::Init(TcpListenParameters & params)
     mListenSocket->OnConnectionReceived = HandleIncomingConnection;
     mListenSocket->OnAcceptError        = HandleAcceptError;
 
-    mEndpointType = params.GetAddressType();
+    mEndpointType          = params.GetAddressType();
+    mSystemLayer           = &params.GetEndPointManager()->SystemLayer();
+    mIdleConnectionTimeout = System::Clock::Milliseconds32(params.GetIdleConnectionTimeoutMs());
 
     err = mListenSocket->Listen(kListenBacklogSize);
     SuccessOrExit(err);
@@ -125,9 +138,61 @@ void TCPBase::Close()
         mListenSocket->Free();
         mListenSocket = nullptr;
     }
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleIdleConnectionTimer, this);
+    }
     mState = TCPState::kNotReady;
 }
 
+void TCPBase::SetIdleConnectionTimeout(System::Clock::Milliseconds32 timeout)
+{
+    mIdleConnectionTimeout = timeout;
+    ScheduleIdleConnectionTimer();
+}
+
+CHIP_ERROR TCPBase::ResizeConnectionTable(size_t size)
+{
+    if (size <= mBuiltinConnectionsSize)
+    {
+        size = mBuiltinConnectionsSize;
+    }
+    VerifyOrReturnError(size != mActiveConnectionsSize, CHIP_NO_ERROR);
+
+    // Connection states are handed out to upper layers, so the table cannot move while any is in use.
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        VerifyOrReturnError(!mActiveConnections[i].InUse(), CHIP_ERROR_INCORRECT_STATE);
+    }
+
+#if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // Every connection needs an endpoint from the (then fixed size) endpoint pool.
+    VerifyOrReturnError(size <= INET_CONFIG_NUM_TCP_ENDPOINTS, CHIP_ERROR_INVALID_ARGUMENT);
+#endif // !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    ReleaseHeapConnections();
+    if (size == mBuiltinConnectionsSize)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    ActiveTCPConnectionState * connections = new (std::nothrow) ActiveTCPConnectionState[size];
+    VerifyOrReturnError(connections != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mActiveConnections     = connections;
+    mActiveConnectionsSize = size;
+    return CHIP_NO_ERROR;
+}
+
+void TCPBase::ReleaseHeapConnections()
+{
+    VerifyOrReturn(mActiveConnections != mBuiltinConnections);
+
+    delete[] mActiveConnections;
+    mActiveConnections     = mBuiltinConnections;
+    mActiveConnectionsSize = mBuiltinConnectionsSize;
+}
+
 ActiveTCPConnectionState * TCPBase::AllocateConnection()
 {
     for (size_t i = 0; i < mActiveConnectionsSize; i++)
@@ -223,6 +288,7 @@ CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::
 
     if (connection != nullptr)
     {
+        MarkActive(connection);
         return connection->mEndPoint->Send(std::move(msgBuf));
     }
 
@@ -313,6 +379,7 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const Pe
 {
     ActiveTCPConnectionState * state = FindActiveConnection(endPoint);
     VerifyOrReturnError(state != nullptr, CHIP_ERROR_INTERNAL);
+    MarkActive(state);
     state->mReceived.AddToEnd(std::move(buffer));
 
     while (!state->mReceived.IsNull())
@@ -359,16 +426,37 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
     MessageTransportContext msgContext;
     msgContext.conn = state;
 
-    if (state->mReceived->DataLength() == messageSize)
+    const size_t headLength = state->mReceived->DataLength();
+    if (headLength == messageSize)
     {
         // In this case, the head packet buffer contains exactly the message.
         // This is common because typical messages fit in a network packet, and are delivered as such.
         // Peel off the head to pass upstream, which effectively consumes it from `state->mReceived`.
         message = state->mReceived.PopHead();
     }
+    else if (headLength > messageSize && headLength - messageSize < messageSize)
+    {
+        // The head buffer holds the message followed by the start of the next one(s), which is common
+        // for bulk transfers. Move the (smaller) data that follows the message to a buffer of its own,
+        // and pass the head upstream: it then contains exactly the message.
+        const size_t remainingLength             = headLength - messageSize;
+        System::PacketBufferHandle remainingData = System::PacketBufferHandle::New(remainingLength, 0);
+        VerifyOrReturnError(!remainingData.IsNull(), CHIP_ERROR_NO_MEMORY);
+        memcpy(remainingData->Start(), state->mReceived->Start() + messageSize, remainingLength);
+        remainingData->SetDataLength(remainingLength);
+
+        message = state->mReceived.PopHead();
+        message->SetDataLength(messageSize);
+        if (!state->mReceived.IsNull())
+        {
+            remainingData->AddToEnd(std::move(state->mReceived));
+        }
+        state->mReceived = std::move(remainingData);
+    }
     else
     {
-        // The message is either longer or shorter than the head buffer.
+        // The message is either shorter than the head buffer and followed by more data than its own size,
+        // or it is longer than the head buffer.
         // In either case, copy the message to a fresh linear buffer to pass upstream. We always copy, rather than provide
         // a shared reference to the current buffer, in case upper layers manipulate the buffer in ways that would affect
         // our use, e.g. chaining it elsewhere or reusing space beyond the current message.
@@ -387,6 +475,75 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
     return CHIP_NO_ERROR;
 }
 
+void TCPBase::MarkActive(ActiveTCPConnectionState * connection)
+{
+    connection->mLastActivity = System::SystemClock().GetMonotonicTimestamp();
+}
+
+void TCPBase::ScheduleIdleConnectionTimer()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+    mSystemLayer->CancelTimer(HandleIdleConnectionTimer, this);
+    VerifyOrReturn(mIdleConnectionTimeout != System::Clock::kZero);
+
+    ActiveTCPConnectionState * leastRecentlyActive = nullptr;
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        if (mActiveConnections[i].IsConnected() &&
+            (leastRecentlyActive == nullptr || mActiveConnections[i].mLastActivity < leastRecentlyActive->mLastActivity))
+        {
+            leastRecentlyActive = &mActiveConnections[i];
+        }
+    }
+    VerifyOrReturn(leastRecentlyActive != nullptr);
+
+    // Traffic only postpones the expiry, so the timer may fire early: it is then restarted.
+    const System::Clock::Timestamp now    = System::SystemClock().GetMonotonicTimestamp();
+    const System::Clock::Timestamp expiry = leastRecentlyActive->mLastActivity + mIdleConnectionTimeout;
+    const System::Clock::Timeout delay =
+        (expiry > now) ? std::chrono::duration_cast<System::Clock::Timeout>(expiry - now) : System::Clock::kZero;
+    if (mSystemLayer->StartTimer(delay, HandleIdleConnectionTimer, this) != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to start the idle TCP connection timer");
+    }
+}
+
+void TCPBase::HandleIdleConnectionTimer(System::Layer * systemLayer, void * appState)
+{
+    static_cast<TCPBase *>(appState)->CloseIdleConnections();
+}
+
+void TCPBase::CloseIdleConnections()
+{
+    VerifyOrReturn(mIdleConnectionTimeout != System::Clock::kZero);
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        ActiveTCPConnectionState * connection = &mActiveConnections[i];
+        if (!connection->IsConnected() || now - connection->mLastActivity < mIdleConnectionTimeout)
+        {
+            continue;
+        }
+
+        if (connection->mEndPoint->PendingSendLength() != 0)
+        {
+            // Still draining data queued earlier, so not idle.
+            MarkActive(connection);
+            continue;
+        }
+
+        char addrStr[Transport::PeerAddress::kMaxToStringSize];
+        connection->mPeerAddr.ToString(addrStr);
+        ChipLogProgress(Inet, "Closing idle connection with peer %s.", addrStr);
+
+        // Let the upper layers know, so that they stop using the connection.
+        CloseConnectionInternal(connection, CHIP_NO_ERROR, SuppressCallback::No);
+    }
+
+    ScheduleIdleConnectionTimer();
+}
+
 void TCPBase::CloseConnectionInternal(ActiveTCPConnectionState * connection, CHIP_ERROR err, SuppressCallback suppressCallback)
 {
     TCPState prevState;
@@ -514,6 +671,9 @@ void TCPBase::HandleTCPEndPointConnectComplete(Inet::TCPEndPoint * endPoint, CHI
         // Set the TCPKeepalive configurations on the established connection
         endPoint->EnableKeepAlive(activeConnection->mTCPKeepAliveIntervalSecs, activeConnection->mTCPMaxNumKeepAliveProbes);
 
+        tcp->MarkActive(activeConnection);
+        tcp->ScheduleIdleConnectionTimer();
+
         ChipLogProgress(Inet, "Connection established successfully with %s.", addrStr);
 
         // Let higher layer/delegate know that connection is successfully
@@ -581,6 +741,9 @@ void TCPBase::HandleIncomingConnection(Inet::TCPEndPoint * listenEndPoint, Inet:
         // Set the TCPKeepalive configurations on the received connection
         endPoint->EnableKeepAlive(activeConnection->mTCPKeepAliveIntervalSecs, activeConnection->mTCPMaxNumKeepAliveProbes);
 
+        tcp->MarkActive(activeConnection);
+        tcp->ScheduleIdleConnectionTimer();
+
         char addrStr[Transport::PeerAddress::kMaxToStringSize];
         peerAddress.ToString(addrStr);
         ChipLogProgress(Inet, "Incoming connection established with peer at %s.", addrStr);
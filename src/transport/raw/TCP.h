@@ -34,6 +34,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/PoolWrapper.h>
+#include <system/SystemLayer.h>
 #include <transport/raw/ActiveTCPConnectionState.h>
 #include <transport/raw/Base.h>
 #include <transport/raw/TCPConfig.h>
@@ -79,11 +80,36 @@ public:
         return *this;
     }
 
+    size_t GetMaxActiveConnections() const { return mMaxActiveConnections; }
+    /**
+     * Allow up to `count` simultaneous connections. Above the size the transport was built with,
+     * the connection table is allocated from the heap.
+     */
+    TcpListenParameters & SetMaxActiveConnections(size_t count)
+    {
+        mMaxActiveConnections = count;
+
+        return *this;
+    }
+
+    uint32_t GetIdleConnectionTimeoutMs() const { return mIdleConnectionTimeoutMs; }
+    TcpListenParameters & SetIdleConnectionTimeoutMs(uint32_t timeoutMs)
+    {
+        mIdleConnectionTimeoutMs = timeoutMs;
+
+        return *this;
+    }
+
 private:
     Inet::EndPointManager<Inet::TCPEndPoint> * mEndPointManager;   ///< Associated endpoint factory
     Inet::IPAddressType mAddressType = Inet::IPAddressType::kIPv6; ///< type of listening socket
     uint16_t mListenPort             = CHIP_PORT;                  ///< TCP listen port
     Inet::InterfaceId mInterfaceId   = Inet::InterfaceId::Null();  ///< Interface to listen on
+
+    // Size of the connection table; 0 for the size the transport was built with.
+    size_t mMaxActiveConnections = 0;
+    // Connections without traffic for this long get closed; 0 keeps them open.
+    uint32_t mIdleConnectionTimeoutMs = CHIP_CONFIG_TCP_IDLE_CONNECTION_TIMEOUT_MSECS;
 };
 
 /**
@@ -119,7 +145,8 @@ protected:
 public:
     using PendingPacketPoolType = PoolInterface<PendingPacket, const PeerAddress &, System::PacketBufferHandle &&>;
     TCPBase(ActiveTCPConnectionState * activeConnectionsBuffer, size_t bufferSize, PendingPacketPoolType & packetBuffers) :
-        mActiveConnections(activeConnectionsBuffer), mActiveConnectionsSize(bufferSize), mPendingPackets(packetBuffers)
+        mActiveConnections(activeConnectionsBuffer), mActiveConnectionsSize(bufferSize),
+        mBuiltinConnections(activeConnectionsBuffer), mBuiltinConnectionsSize(bufferSize), mPendingPackets(packetBuffers)
     {
         // activeConnectionsBuffer must be initialized by the caller.
     }
@@ -144,6 +171,12 @@ public:
      */
     void SetConnectTimeout(const uint32_t connTimeoutMsecs) { mConnectTimeout = connTimeoutMsecs; }
 
+    /**
+     * Set the time after which connections without any traffic get closed.
+     * A zero timeout keeps idle connections open.
+     */
+    void SetIdleConnectionTimeout(System::Clock::Milliseconds32 timeout);
+
     /**
      * Close the open endpoint without destroying the object
      */
@@ -203,11 +236,23 @@ public:
      */
     void CloseActiveConnections();
 
+    /**
+     * Close the connections that have been idle for longer than the idle connection timeout.
+     */
+    void CloseIdleConnections();
+
 private:
     // Allow tests to access private members.
     template <size_t kActiveConnectionsSize, size_t kPendingPacketSize>
     friend class TCPBaseTestAccess;
 
+    /**
+     * Use a connection table of the given size: the one the transport was built with if
+     * it is large enough, otherwise one allocated from the heap.
+     */
+    CHIP_ERROR ResizeConnectionTable(size_t size);
+    void ReleaseHeapConnections();
+
     /**
      * Allocate an unused connection from the pool
      *
@@ -268,6 +313,17 @@ private:
     CHIP_ERROR StartConnect(const PeerAddress & addr, AppTCPConnectionCallbackCtxt * appState,
                             Transport::ActiveTCPConnectionState ** outPeerConnState);
 
+    /**
+     * Record traffic on a connection, which postpones closing it for being idle.
+     */
+    void MarkActive(ActiveTCPConnectionState * connection);
+
+    /**
+     * (Re)start the idle connection timer to expire when the least recently active connection becomes idle.
+     */
+    void ScheduleIdleConnectionTimer();
+    static void HandleIdleConnectionTimer(System::Layer * systemLayer, void * appState);
+
     /**
      * Gracefully Close or Abort a given connection.
      *
@@ -306,12 +362,20 @@ private:
     // giving up.
     uint32_t mConnectTimeout = CHIP_CONFIG_TCP_CONNECT_TIMEOUT_MSECS;
 
+    // Connections without traffic for this long get closed; zero if they are kept open.
+    System::Clock::Milliseconds32 mIdleConnectionTimeout = System::Clock::kZero;
+    System::Layer * mSystemLayer                         = nullptr;
+
     // Number of active and 'pending connection' endpoints
     size_t mUsedEndPointCount = 0;
 
     // Currently active connections
     ActiveTCPConnectionState * mActiveConnections;
-    const size_t mActiveConnectionsSize;
+    size_t mActiveConnectionsSize;
+
+    // The connection table provided by the subclass, used unless a larger one was requested.
+    ActiveTCPConnectionState * const mBuiltinConnections;
+    const size_t mBuiltinConnectionsSize;
 
     // Data to be sent when connections succeed
     PendingPacketPoolType & mPendingPackets;
@@ -333,7 +397,7 @@ public:
 
 private:
     ActiveTCPConnectionState mConnectionsBuffer[kActiveConnectionsSize];
-    PoolImpl<PendingPacket, kPendingPacketSize, ObjectPoolMem::kInline, PendingPacketPoolType::Interface> mPendingPackets;
+    PoolImpl<PendingPacket, kPendingPacketSize, ObjectPoolMem::kDefault, PendingPacketPoolType::Interface> mPendingPackets;
 };
 
 } // namespace Transport
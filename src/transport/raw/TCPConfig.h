@@ -76,6 +76,20 @@ namespace chip {
 #define CHIP_CONFIG_TCP_CONNECT_TIMEOUT_MSECS (10000)
 #endif // CHIP_CONFIG_TCP_CONNECT_TIMEOUT_MSECS
 
+/**
+ *  @def CHIP_CONFIG_TCP_IDLE_CONNECTION_TIMEOUT_MSECS
+ *
+ *  @brief
+ *    This defines the default time (in milliseconds) after
+ *    which a TCP connection that has neither sent nor received
+ *    any data is closed, releasing its connection slot.
+ *    A value of 0 keeps idle connections open.
+ *
+ */
+#ifndef CHIP_CONFIG_TCP_IDLE_CONNECTION_TIMEOUT_MSECS
+#define CHIP_CONFIG_TCP_IDLE_CONNECTION_TIMEOUT_MSECS (0)
+#endif // CHIP_CONFIG_TCP_IDLE_CONNECTION_TIMEOUT_MSECS
+
 /**
  *  @def CHIP_CONFIG_KEEPALIVE_INTERVAL_SECS
  *
@@ -27,6 +27,10 @@
 #include <transport/raw/Base.h>
 #include <transport/raw/PeerAddress.h>
 
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+#include <transport/raw/ActiveTCPConnectionState.h>
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+
 #include <nlbyteorder.h>
 #include <queue>
 
@@ -116,7 +120,17 @@ public:
         {
             auto item = std::move(_this->mPendingMessageQueue.front());
             _this->mPendingMessageQueue.pop();
-            _this->HandleMessageReceived(LoopbackPeer(item.mDestinationAddress), std::move(item.mPendingMessage));
+
+            Transport::MessageTransportContext context;
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+            // Messages to TCP peer addresses (for sessions that should allow large payloads)
+            // have to arrive over a connection.
+            if (item.mDestinationAddress.GetTransportType() == Transport::Type::kTcp)
+            {
+                context.conn = &_this->mLoopbackConnection;
+            }
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+            _this->HandleMessageReceived(LoopbackPeer(item.mDestinationAddress), std::move(item.mPendingMessage), &context);
         }
     }
 
@@ -198,6 +212,9 @@ public:
     uint32_t mNumMessagesToAllowBeforeError    = 0;
     CHIP_ERROR mMessageSendError               = CHIP_NO_ERROR;
     LoopbackTransportDelegate * mDelegate      = nullptr;
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    Transport::ActiveTCPConnectionState mLoopbackConnection;
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 };
 
 } // namespace Test
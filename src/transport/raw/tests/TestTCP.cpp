@@ -23,6 +23,7 @@
 
 #include "NetworkTestHelpers.h"
 
+#include <algorithm>
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
@@ -665,6 +666,48 @@ TEST_F(TestTCP, CheckProcessReceivedBuffer)
     EXPECT_EQ(err, CHIP_NO_ERROR);
     EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
 
+    // Test two messages in a single packet buffer, the second shorter than the first (it is moved out of the buffer),
+    // then longer than the first (the first is copied out of the buffer).
+    for (const uint32_t firstSize : { 151u, 51u })
+    {
+        const uint32_t firstSizes[]  = { firstSize, 0 };
+        const uint32_t secondSizes[] = { 202u - firstSize, 0 };
+        gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+        EXPECT_TRUE(testData[0].Init(firstSizes));
+        EXPECT_TRUE(testData[1].Init(secondSizes));
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(testData[0].mTotalLength + testData[1].mTotalLength, 0);
+        ASSERT_FALSE(buffer.IsNull());
+        memcpy(buffer->Start(), testData[0].mPayload, testData[0].mTotalLength);
+        memcpy(buffer->Start() + testData[0].mTotalLength, testData[1].mPayload, testData[1].mTotalLength);
+        buffer->SetDataLength(testData[0].mTotalLength + testData[1].mTotalLength);
+        err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buffer));
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
+    }
+
+    // Test a message followed by the start of the next one in a packet buffer, with the rest of the next one in another.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 161, 0 }));
+    EXPECT_TRUE(testData[1].Init((const uint32_t[]){ 162, 0 }));
+    {
+        const size_t splitLength          = testData[0].mTotalLength + 20;
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(splitLength, 0);
+        System::PacketBufferHandle rest   = System::PacketBufferHandle::New(testData[1].mTotalLength - 20, 0);
+        ASSERT_FALSE(buffer.IsNull() || rest.IsNull());
+        memcpy(buffer->Start(), testData[0].mPayload, testData[0].mTotalLength);
+        memcpy(buffer->Start() + testData[0].mTotalLength, testData[1].mPayload, 20);
+        buffer->SetDataLength(splitLength);
+        memcpy(rest->Start(), testData[1].mPayload + 20, testData[1].mTotalLength - 20);
+        rest->SetDataLength(testData[1].mTotalLength - 20);
+
+        err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buffer));
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+        err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(rest));
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
+    }
+
     // Test a single packet buffer that is larger than
     // kMaxSizeWithoutReserve but less than CHIP_CONFIG_MAX_LARGE_PAYLOAD_SIZE_BYTES.
     gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
@@ -688,4 +731,122 @@ TEST_F(TestTCP, CheckProcessReceivedBuffer)
     EXPECT_EQ(TestAccess::GetEndpoint(state), nullptr);
 }
 
+TEST_F(TestTCP, CheckIdleConnectionsClosed)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+    tcp.SetIdleConnectionTimeout(System::Clock::Milliseconds32(50));
+    gMockTransportMgrDelegate.ConnectTest(tcp, addr);
+
+    // Without any traffic, both ends of the connection get closed, and the upper layers are told so.
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), [&tcp]() { return !tcp.HasActiveConnections(); });
+    EXPECT_FALSE(tcp.HasActiveConnections());
+    EXPECT_TRUE(gMockTransportMgrDelegate.mHandleConnectionCloseCalled);
+}
+
+// Counts the messages received by a transport.
+class MessageCounter : public Transport::RawTransportDelegate
+{
+public:
+    void HandleMessageReceived(const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg,
+                               Transport::MessageTransportContext * ctxt) override
+    {
+        mMessageCount++;
+        mByteCount += msg->DataLength();
+    }
+
+    size_t mMessageCount = 0;
+    size_t mByteCount    = 0;
+};
+
+// Bulk transfers to several peers at once, each over its own connection. The client
+// needs more connections than it was built with, so uses a heap allocated table.
+TEST_F(TestTCP, MultiConnectionThroughput)
+{
+    constexpr size_t kPeerCount       = 8;
+    constexpr size_t kMessagesPerPeer = 32;
+    constexpr size_t kMessageSize     = 16 * 1024;
+    static_assert(kPeerCount > kMaxTcpActiveConnectionCount, "The client should need a heap allocated connection table");
+    static_assert(kMessageSize <= System::PacketBuffer::kLargeBufMaxSize, "Messages should fit in a large buffer");
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    TCPImpl peers[kPeerCount];
+    MessageCounter peerCounters[kPeerCount];
+    for (size_t i = 0; i < kPeerCount; i++)
+    {
+        peers[i].SetDelegate(&peerCounters[i]);
+        ASSERT_EQ(peers[i].Init(Transport::TcpListenParameters(mIOContext->GetTCPEndPointManager())
+                                    .SetAddressType(addr.Type())
+                                    .SetListenPort(static_cast<uint16_t>(gChipTCPPort + 1 + i))),
+                  CHIP_NO_ERROR);
+    }
+
+    TCPImpl client;
+    MessageCounter clientCounter;
+    client.SetDelegate(&clientCounter);
+    ASSERT_EQ(client.Init(Transport::TcpListenParameters(mIOContext->GetTCPEndPointManager())
+                              .SetAddressType(addr.Type())
+                              .SetListenPort(gChipTCPPort)
+                              .SetMaxActiveConnections(kPeerCount)),
+              CHIP_NO_ERROR);
+
+    Transport::ActiveTCPConnectionState * connections[kPeerCount] = {};
+    for (size_t i = 0; i < kPeerCount; i++)
+    {
+        EXPECT_EQ(client.TCPConnect(Transport::PeerAddress::TCP(addr, static_cast<uint16_t>(gChipTCPPort + 1 + i)), nullptr,
+                                    &connections[i]),
+                  CHIP_NO_ERROR);
+    }
+    auto allConnected = [&connections]() {
+        return std::all_of(std::begin(connections), std::end(connections),
+                           [](auto * connection) { return connection != nullptr && connection->IsConnected(); });
+    };
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), allConnected);
+    ASSERT_TRUE(allConnected());
+
+    const uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+    for (size_t message = 0; message < kMessagesPerPeer; message++)
+    {
+        for (size_t i = 0; i < kPeerCount; i++)
+        {
+            System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMessageSize);
+            ASSERT_FALSE(buffer.IsNull());
+            memset(buffer->Start(), static_cast<int>(message), kMessageSize);
+            buffer->SetDataLength(kMessageSize);
+            EXPECT_EQ(client.SendMessage(Transport::PeerAddress::TCP(addr, static_cast<uint16_t>(gChipTCPPort + 1 + i)),
+                                         std::move(buffer)),
+                      CHIP_NO_ERROR);
+        }
+    }
+    auto allReceived = [&peerCounters]() {
+        return std::all_of(std::begin(peerCounters), std::end(peerCounters),
+                           [](const MessageCounter & counter) { return counter.mMessageCount == kMessagesPerPeer; });
+    };
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(30), allReceived);
+    const uint64_t elapsed = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+    EXPECT_TRUE(allReceived());
+
+    size_t byteCount = 0;
+    for (const auto & counter : peerCounters)
+    {
+        byteCount += counter.mByteCount;
+    }
+    EXPECT_EQ(byteCount, kPeerCount * kMessagesPerPeer * kMessageSize);
+    ChipLogProgress(Inet, "%u connections: %u bytes in %u us (%u KiB/s)", static_cast<unsigned>(kPeerCount),
+                    static_cast<unsigned>(byteCount), static_cast<unsigned>(elapsed),
+                    static_cast<unsigned>(byteCount * 1000000 / 1024 / std::max<uint64_t>(elapsed, 1)));
+
+    client.CloseActiveConnections();
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), [&peers]() {
+        return std::none_of(std::begin(peers), std::end(peers), [](TCPImpl & peer) { return peer.HasActiveConnections(); });
+    });
+}
+
 } // namespace
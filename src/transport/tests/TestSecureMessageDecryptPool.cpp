@@ -0,0 +1,310 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+#include <transport/SecureMessageCodec.h>
+#include <transport/SecureMessageDecryptPool.h>
+#include <transport/SecureSessionTable.h>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Transport;
+
+namespace {
+
+constexpr uint16_t kSessionId   = 1;
+constexpr size_t kPayloadLength = 1024;
+constexpr uint8_t kSecret[]     = "Test secret for the decrypt pool";
+constexpr uint8_t kSalt[]       = "Test salt";
+
+class TestSecureMessageDecryptPool : public ::testing::Test, public SecureMessageDecryptPool::Delegate
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                                   System::Clock::Milliseconds16(0));
+
+        mSessionTable.Init();
+        mSession = mSessionTable.CreateNewSecureSessionForTest(SecureSession::Type::kPASE, kSessionId, kUndefinedNodeId,
+                                                               kUndefinedNodeId, CATValues(), kSessionId, kUndefinedFabricIndex,
+                                                               config);
+        ASSERT_TRUE(mSession.HasValue());
+
+        ASSERT_EQ(mSender.InitFromSecret(mKeystore, ByteSpan(kSecret), ByteSpan(kSalt),
+                                         CryptoContext::SessionInfoType::kSessionEstablishment,
+                                         CryptoContext::SessionRole::kInitiator),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(mReceiver.InitFromSecret(mKeystore, ByteSpan(kSecret), ByteSpan(kSalt),
+                                           CryptoContext::SessionInfoType::kSessionEstablishment,
+                                           CryptoContext::SessionRole::kResponder),
+                  CHIP_NO_ERROR);
+    }
+
+    void TearDown() override
+    {
+        mSession.Value()->AsSecureSession()->MarkForEviction();
+        mSession.ClearValue();
+    }
+
+    // Encrypt messages carrying their message counter, and a payload filled with its low byte
+    void EncryptMessages(uint32_t count)
+    {
+        for (uint32_t counter = 0; counter < count; counter++)
+        {
+            PacketHeader packetHeader;
+            packetHeader.SetSessionId(kSessionId).SetMessageCounter(counter);
+
+            PayloadHeader payloadHeader;
+            payloadHeader.SetExchangeID(static_cast<uint16_t>(counter));
+
+            System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kPayloadLength + kMaxTagLen);
+            ASSERT_FALSE(buffer.IsNull());
+            memset(buffer->Start(), static_cast<uint8_t>(counter), kPayloadLength);
+            buffer->SetDataLength(kPayloadLength);
+
+            CryptoContext::NonceStorage nonce;
+            ASSERT_EQ(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), counter, kUndefinedNodeId), CHIP_NO_ERROR);
+            ASSERT_EQ(SecureMessageCodec::Encrypt(mSender, nonce, payloadHeader, packetHeader, buffer), CHIP_NO_ERROR);
+
+            mPacketHeaders.push_back(packetHeader);
+            mEncryptedMessages.emplace_back(buffer->Start(), buffer->Start() + buffer->DataLength());
+        }
+    }
+
+    // Copy an encrypted message into a new buffer, as received from the network
+    System::PacketBufferHandle CopyMessage(uint32_t counter)
+    {
+        const std::vector<uint8_t> & message = mEncryptedMessages[counter];
+        return System::PacketBufferHandle::NewWithData(message.data(), message.size());
+    }
+
+    // Submit copies of the encrypted messages to the pool, and hand the decrypted messages back on this thread
+    // as the CHIP thread would, until every message has been handed back.
+    void ReceiveMessages(SecureMessageDecryptPool & pool)
+    {
+        const uint32_t count = static_cast<uint32_t>(mEncryptedMessages.size());
+        uint32_t submitted   = 0;
+
+        mReceivedCount = 0;
+
+        while (mReceivedCount < count)
+        {
+            // Both the queue and the packet buffer pool may be full, until decrypted messages are handed back
+            System::PacketBufferHandle buffer = (submitted < count) ? CopyMessage(submitted) : nullptr;
+            if (!buffer.IsNull())
+            {
+                CryptoContext::NonceStorage nonce;
+                const PacketHeader & packetHeader = mPacketHeaders[submitted];
+                ASSERT_EQ(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), submitted, kUndefinedNodeId),
+                          CHIP_NO_ERROR);
+
+                CHIP_ERROR err = pool.Submit(mSession.Value(), mReceiver, PeerAddress::UDP(Inet::IPAddress::Any), packetHeader,
+                                             nonce, std::move(buffer));
+                if (err == CHIP_NO_ERROR)
+                {
+                    submitted++;
+                    continue;
+                }
+                ASSERT_EQ(err, CHIP_ERROR_NO_MEMORY);
+            }
+
+            if (mProcessingScheduled.exchange(false))
+            {
+                pool.ProcessDecryptedMessages();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    CHIP_ERROR ScheduleDecryptedMessages() override
+    {
+        mScheduleCount++;
+        mProcessingScheduled = true;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnMessageDecrypted(SecureMessageDecryptPool::Message & message) override
+    {
+        const uint32_t counter = message.mPacketHeader.GetMessageCounter();
+
+        EXPECT_EQ(counter, mReceivedCount);
+        EXPECT_TRUE(message.mSession.HasValue() && message.mSession.Value() == mSession.Value());
+
+        if (mCorruptedCounters.count(counter) != 0)
+        {
+            EXPECT_NE(message.mDecryptError, CHIP_NO_ERROR);
+        }
+        else
+        {
+            EXPECT_EQ(message.mDecryptError, CHIP_NO_ERROR);
+            EXPECT_EQ(message.mPayloadHeader.GetExchangeID(), static_cast<uint16_t>(counter));
+            ASSERT_EQ(message.mBuffer->DataLength(), kPayloadLength);
+
+            const uint8_t * payload = message.mBuffer->Start();
+            for (size_t i = 0; i < kPayloadLength; i++)
+            {
+                EXPECT_EQ(payload[i], static_cast<uint8_t>(counter));
+            }
+        }
+
+        mReceivedCount++;
+    }
+
+protected:
+    Crypto::DefaultSessionKeystore mKeystore;
+    CryptoContext mSender;
+    CryptoContext mReceiver;
+    SecureSessionTable mSessionTable;
+    Optional<SessionHandle> mSession;
+
+    std::vector<PacketHeader> mPacketHeaders;
+    std::vector<std::vector<uint8_t>> mEncryptedMessages;
+    std::set<uint32_t> mCorruptedCounters;
+
+    std::atomic<bool> mProcessingScheduled{ false };
+    std::atomic<uint32_t> mScheduleCount{ 0 };
+    uint32_t mReceivedCount = 0;
+};
+
+TEST_F(TestSecureMessageDecryptPool, TestInit)
+{
+    SecureMessageDecryptPool pool;
+
+    EXPECT_FALSE(pool.IsInitialized());
+    EXPECT_EQ(pool.Init(*this, 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    CryptoContext::NonceStorage nonce{};
+    EXPECT_EQ(pool.Submit(mSession.Value(), mReceiver, PeerAddress::UDP(Inet::IPAddress::Any), PacketHeader(), nonce,
+                          System::PacketBufferHandle::New(kPayloadLength)),
+              CHIP_ERROR_INCORRECT_STATE);
+
+    EXPECT_EQ(pool.Init(*this, 2), CHIP_NO_ERROR);
+    EXPECT_TRUE(pool.IsInitialized());
+    EXPECT_EQ(pool.Init(*this, 2), CHIP_ERROR_INCORRECT_STATE);
+
+    pool.Shutdown();
+    EXPECT_FALSE(pool.IsInitialized());
+}
+
+TEST_F(TestSecureMessageDecryptPool, TestInOrderHandback)
+{
+    constexpr uint32_t kMessageCount = 3 * SecureMessageDecryptPool::kQueueSize + 5;
+
+    EncryptMessages(kMessageCount);
+
+    // Messages failing authentication are handed back in order too, with their error
+    for (uint32_t counter : { 0u, 7u, kMessageCount - 1 })
+    {
+        mCorruptedCounters.insert(counter);
+        mEncryptedMessages[counter][kPayloadLength / 2] ^= 0xFF;
+    }
+
+    SecureMessageDecryptPool pool;
+    ASSERT_EQ(pool.Init(*this, 4), CHIP_NO_ERROR);
+
+    ReceiveMessages(pool);
+    EXPECT_EQ(mReceivedCount, kMessageCount);
+
+    // Wake-ups are coalesced over the messages decrypted before the CHIP thread got to them
+    EXPECT_LE(mScheduleCount.load(), kMessageCount);
+    EXPECT_FALSE(mProcessingScheduled.load());
+}
+
+TEST_F(TestSecureMessageDecryptPool, TestShutdownDropsPendingMessages)
+{
+    EncryptMessages(8);
+
+    SecureMessageDecryptPool pool;
+    ASSERT_EQ(pool.Init(*this, 1), CHIP_NO_ERROR);
+
+    for (uint32_t counter = 0; counter < 8; counter++)
+    {
+        CryptoContext::NonceStorage nonce;
+        const PacketHeader & packetHeader = mPacketHeaders[counter];
+        ASSERT_EQ(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), counter, kUndefinedNodeId), CHIP_NO_ERROR);
+        EXPECT_EQ(pool.Submit(mSession.Value(), mReceiver, PeerAddress::UDP(Inet::IPAddress::Any), packetHeader, nonce,
+                              CopyMessage(counter)),
+                  CHIP_NO_ERROR);
+    }
+
+    // Messages not handed back yet are dropped, along with their references to the session
+    pool.Shutdown();
+    pool.ProcessDecryptedMessages();
+    EXPECT_EQ(mReceivedCount, 0u);
+    EXPECT_EQ(mSession.Value()->AsSecureSession()->GetReferenceCount(), 2u);
+}
+
+TEST_F(TestSecureMessageDecryptPool, TestWorkerScalingBenchmark)
+{
+    constexpr uint32_t kMessageCount = 4000;
+
+    EncryptMessages(kMessageCount);
+
+    // Baseline: decrypting every message on the CHIP thread, as done without the pool
+    const System::Clock::Microseconds64 inlineStart = System::SystemClock().GetMonotonicMicroseconds64();
+    for (uint32_t counter = 0; counter < kMessageCount; counter++)
+    {
+        System::PacketBufferHandle buffer = CopyMessage(counter);
+        CryptoContext::NonceStorage nonce;
+        PayloadHeader payloadHeader;
+        ASSERT_EQ(CryptoContext::BuildNonce(nonce, mPacketHeaders[counter].GetSecurityFlags(), counter, kUndefinedNodeId),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(SecureMessageCodec::Decrypt(mReceiver, nonce, payloadHeader, mPacketHeaders[counter], buffer), CHIP_NO_ERROR);
+    }
+    const System::Clock::Microseconds64 inlineTime = System::SystemClock().GetMonotonicMicroseconds64() - inlineStart;
+
+    ChipLogProgress(Inet, "%u messages of %u bytes decrypted inline in %u ms", static_cast<unsigned>(kMessageCount),
+                    static_cast<unsigned>(kPayloadLength), static_cast<unsigned>(inlineTime.count() / 1000));
+
+    for (size_t workerCount : { 1, 2, 4, 8 })
+    {
+        SecureMessageDecryptPool pool;
+        ASSERT_EQ(pool.Init(*this, workerCount), CHIP_NO_ERROR);
+        mScheduleCount = 0;
+
+        const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        ReceiveMessages(pool);
+        const System::Clock::Microseconds64 time = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        ChipLogProgress(Inet, "%u messages decrypted by %u workers in %u ms (%u wake-ups, %u hardware threads)",
+                        static_cast<unsigned>(kMessageCount), static_cast<unsigned>(workerCount),
+                        static_cast<unsigned>(time.count() / 1000), static_cast<unsigned>(mScheduleCount.load()),
+                        std::thread::hardware_concurrency());
+
+        EXPECT_EQ(mReceivedCount, kMessageCount);
+    }
+}
+
+} // namespace
@@ -21,6 +21,7 @@
  *      This file implements unit tests for the SessionManager implementation.
  */
 
+#include <chrono>
 #include <errno.h>
 #include <vector>
 
@@ -43,6 +44,16 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidateLoweredSessionTableSize();
+
+    static size_t IndexBytes(const SecureSessionTable & table)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_INDEX
+        return table.mSessionIndex.AllocatedBytes();
+#else
+        return 0;
+#endif
+    }
 
 private:
     struct SessionParameters
@@ -452,6 +463,34 @@ void TestSecureSessionTable::ValidateSessionSorting()
     }
 }
 
+void TestSecureSessionTable::ValidateLoweredSessionTableSize()
+{
+    std::vector<SessionParameters> sessionParamList = {
+        { { 1, kFabric1 }, System::Clock::Timestamp(6), SecureSession::State::kActive },
+        { { 1, kFabric1 }, System::Clock::Timestamp(1), SecureSession::State::kActive },
+        { { 1, kFabric1 }, System::Clock::Timestamp(5), SecureSession::State::kActive },
+        { { 1, kFabric1 }, System::Clock::Timestamp(2), SecureSession::State::kActive },
+        { { 1, kFabric1 }, System::Clock::Timestamp(4), SecureSession::State::kActive },
+        { { 1, kFabric1 }, System::Clock::Timestamp(3), SecureSession::State::kActive },
+    };
+
+    CreateSessionTable(sessionParamList);
+
+    // Lowering the limit of a full table does not release any session
+    EXPECT_EQ(mSessionTable->SetMaxSessionTableSize(3), CHIP_NO_ERROR);
+    EXPECT_EQ(mSessionTable->mEntries.Allocated(), sessionParamList.size());
+
+    // The next session created evicts the oldest sessions until the table is below the new limit
+    auto session = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId(1, kFabric1));
+    EXPECT_TRUE(session.HasValue());
+    EXPECT_EQ(mSessionTable->mEntries.Allocated(), 3u);
+
+    for (size_t i = 0; i < sessionParamList.size(); i++)
+    {
+        EXPECT_EQ(mSessionList[i]->mSessionReleased, sessionParamList[i].mLastActivityTime < System::Clock::Timestamp(5));
+    }
+}
+
 TEST_F(TestSecureSessionTable, ValidateSessionSorting)
 {
     // This calls TestSecureSessionTable::ValidateSessionSorting instead of just doing the
@@ -461,5 +500,101 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+TEST_F(TestSecureSessionTable, ValidateLoweredSessionTableSize)
+{
+    ValidateLoweredSessionTableSize();
+}
+
+TEST_F(TestSecureSessionTable, FindByLocalKey)
+{
+    SecureSessionTable table;
+    table.Init();
+
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+
+    // Test-only allocation can create sessions with colliding IDs: the first one wins
+    // and the other one takes over once the first is released.
+    auto first = table.CreateNewSecureSessionForTest(SecureSession::Type::kPASE, 10, kUndefinedNodeId, kUndefinedNodeId,
+                                                     CATValues(), 1, kUndefinedFabricIndex, config);
+    auto second = table.CreateNewSecureSessionForTest(SecureSession::Type::kPASE, 10, kUndefinedNodeId, kUndefinedNodeId,
+                                                      CATValues(), 2, kUndefinedFabricIndex, config);
+    auto other = table.CreateNewSecureSessionForTest(SecureSession::Type::kPASE, 300, kUndefinedNodeId, kUndefinedNodeId,
+                                                     CATValues(), 3, kUndefinedFabricIndex, config);
+    ASSERT_TRUE(first.HasValue() && second.HasValue() && other.HasValue());
+
+    EXPECT_TRUE(table.FindSecureSessionByLocalKey(10).Value() == first.Value());
+    EXPECT_TRUE(table.FindSecureSessionByLocalKey(300).Value() == other.Value());
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(11).HasValue());
+
+    // Test sessions hold a reference to themselves until evicted
+    first.Value()->AsSecureSession()->MarkForEviction();
+    first.ClearValue();
+    EXPECT_TRUE(table.FindSecureSessionByLocalKey(10).Value() == second.Value());
+
+    second.Value()->AsSecureSession()->MarkForEviction();
+    second.ClearValue();
+    other.Value()->AsSecureSession()->MarkForEviction();
+    other.ClearValue();
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(10).HasValue());
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(300).HasValue());
+    EXPECT_EQ(IndexBytes(table), 0u);
+
+    // New sessions never reuse an ID that is in use
+    auto a = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    auto b = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(a.HasValue() && b.HasValue());
+    EXPECT_NE(a.Value()->AsSecureSession()->GetLocalSessionId(), b.Value()->AsSecureSession()->GetLocalSessionId());
+    EXPECT_NE(a.Value()->AsSecureSession()->GetLocalSessionId(), kUnsecuredSessionId);
+    EXPECT_TRUE(table.FindSecureSessionByLocalKey(b.Value()->AsSecureSession()->GetLocalSessionId()).Value() == b.Value());
+}
+
+TEST_F(TestSecureSessionTable, ScaleSessionLookup)
+{
+    // Models a controller keeping N subscribed nodes: every incoming report first
+    // resolves its session from the local session ID in the message header.
+    for (size_t count : { 100u, 1000u, 5000u })
+    {
+        SecureSessionTable table;
+        table.Init();
+        if (table.SetMaxSessionTableSize(count) != CHIP_NO_ERROR)
+        {
+            GTEST_SKIP() << "Session pool cannot hold " << count << " sessions";
+        }
+
+        std::vector<SessionHandle> sessions;
+        sessions.reserve(count);
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; i++)
+        {
+            auto session = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+            ASSERT_TRUE(session.HasValue());
+            sessions.push_back(std::move(session.Value()));
+        }
+        const auto createTime = std::chrono::steady_clock::now() - start;
+
+        constexpr size_t kRounds = 20;
+        size_t found             = 0;
+        start                    = std::chrono::steady_clock::now();
+        for (size_t round = 0; round < kRounds; round++)
+        {
+            for (auto & session : sessions)
+            {
+                found += table.FindSecureSessionByLocalKey(session->AsSecureSession()->GetLocalSessionId()).HasValue() ? 1 : 0;
+            }
+        }
+        const auto lookupTime = std::chrono::steady_clock::now() - start;
+        EXPECT_EQ(found, count * kRounds);
+
+        ChipLogProgress(SecureChannel, "%u sessions: %u bytes/session + %u index bytes/session, create %u ns, lookup %u ns",
+                        static_cast<unsigned>(count), static_cast<unsigned>(sizeof(SecureSession)),
+                        static_cast<unsigned>(IndexBytes(table) / count),
+                        static_cast<unsigned>(std::chrono::duration_cast<std::chrono::nanoseconds>(createTime).count() / count),
+                        static_cast<unsigned>(std::chrono::duration_cast<std::chrono::nanoseconds>(lookupTime).count() /
+                                              (count * kRounds)));
+    }
+}
+
 } // namespace Transport
 } // namespace chip